@@ -0,0 +1,242 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Benchmark description: measure the cost of starting snapshot transactions as the number of open
+ * sessions grows. A few sessions hold transactions with IDs open so the oldest and current IDs
+ * differ, a writer thread commits an update every millisecond, and reader threads repeatedly begin
+ * a transaction, search for a key and commit. The reported metrics are the average time of a read
+ * transaction and the number of sessions scanned per read transaction; both should stay flat as
+ * the number of idle sessions grows.
+ */
+
+#define N_ACTIVE 4 /* Sessions holding transaction IDs open */
+#define N_READ_THREADS 4
+#define N_READ_TXNS (100 * WT_THOUSAND)
+#define N_RECORDS (10 * WT_THOUSAND)
+#define URI "table:snapshot_perf"
+
+static const u_int session_counts[] = {100, 500, 1000, 2000};
+
+typedef struct {
+    WT_CONNECTION *conn;
+    volatile bool done;
+} SHARED;
+
+/*
+ * thread_read --
+ *     Run read-only snapshot transactions.
+ */
+static WT_THREAD_RET
+thread_read(void *arg)
+{
+    SHARED *shared;
+    WT_CURSOR *cursor;
+    WT_RAND_STATE rnd;
+    WT_SESSION *session;
+    uint64_t i;
+
+    shared = arg;
+    __wt_random_init_seed(NULL, &rnd);
+    testutil_check(shared->conn->open_session(shared->conn, NULL, NULL, &session));
+    testutil_check(session->open_cursor(session, URI, NULL, NULL, &cursor));
+    for (i = 0; i < N_READ_TXNS; ++i) {
+        testutil_check(session->begin_transaction(session, "isolation=snapshot"));
+        cursor->set_key(cursor, (uint64_t)(__wt_random(&rnd) % N_RECORDS + 1));
+        testutil_check(cursor->search(cursor));
+        testutil_check(cursor->reset(cursor));
+        testutil_check(session->commit_transaction(session, NULL));
+    }
+    testutil_check(session->close(session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * thread_write --
+ *     Commit an update every millisecond until the readers finish.
+ */
+static WT_THREAD_RET
+thread_write(void *arg)
+{
+    SHARED *shared;
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uint64_t i;
+
+    shared = arg;
+    testutil_check(shared->conn->open_session(shared->conn, NULL, NULL, &session));
+    testutil_check(session->open_cursor(session, URI, NULL, NULL, &cursor));
+    for (i = 0; !shared->done; ++i) {
+        cursor->set_key(cursor, i % N_RECORDS + 1);
+        cursor->set_value(cursor, i);
+        testutil_check(cursor->update(cursor));
+        __wt_sleep(0, WT_THOUSAND);
+    }
+    testutil_check(session->close(session, NULL));
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * get_stat --
+ *     Return a connection statistic.
+ */
+static int64_t
+get_stat(WT_SESSION *session, int stat)
+{
+    WT_CURSOR *cursor;
+    int64_t value;
+
+    testutil_check(session->open_cursor(session, "statistics:", NULL, NULL, &cursor));
+    cursor->set_key(cursor, stat);
+    testutil_check(cursor->search(cursor));
+    testutil_check(cursor->get_value(cursor, NULL, NULL, &value));
+    testutil_check(cursor->close(cursor));
+    return (value);
+}
+
+/*
+ * run --
+ *     Run the read transactions with the given number of open sessions, returning the average time
+ *     of a read transaction in nanoseconds and the number of sessions scanned per read transaction.
+ */
+static void
+run(TEST_OPTS *opts, u_int nsessions, double *txn_nsp, double *scannedp)
+{
+    struct timespec end, start;
+    SHARED shared;
+    WT_CURSOR *cursor;
+    WT_SESSION *session, **sessions;
+    wt_thread_t read_tids[N_READ_THREADS], write_tid;
+    uint64_t i, ntxns;
+    int64_t scanned;
+    u_int t;
+    char config[128];
+
+    testutil_recreate_dir(opts->home);
+    testutil_snprintf(config, sizeof(config),
+      "create,cache_size=200MB,session_max=%u,statistics=(fast)", nsessions + 100);
+    testutil_check(wiredtiger_open(opts->home, NULL, config, &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    testutil_check(session->create(session, URI, "key_format=r,value_format=Q"));
+    testutil_check(session->open_cursor(session, URI, NULL, NULL, &cursor));
+    for (i = 1; i <= N_RECORDS; ++i) {
+        cursor->set_key(cursor, i);
+        cursor->set_value(cursor, i);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+
+    /*
+     * Open the idle sessions, the last few of which hold transactions with IDs open, so every walk
+     * of the sessions has to scan all of them. Their keys are past the ones the writer updates so
+     * the writer never conflicts with them.
+     */
+    sessions = dcalloc(nsessions, sizeof(WT_SESSION *));
+    for (t = 0; t < nsessions; ++t)
+        testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &sessions[t]));
+    for (t = nsessions - N_ACTIVE; t < nsessions; ++t) {
+        testutil_check(sessions[t]->begin_transaction(sessions[t], NULL));
+        testutil_check(sessions[t]->open_cursor(sessions[t], URI, NULL, NULL, &cursor));
+        cursor->set_key(cursor, (uint64_t)N_RECORDS + t + 1);
+        cursor->set_value(cursor, (uint64_t)t);
+        testutil_check(cursor->insert(cursor));
+        testutil_check(cursor->close(cursor));
+    }
+
+    scanned = get_stat(session, WT_STAT_CONN_TXN_SESSIONS_WALKED);
+
+    shared.conn = opts->conn;
+    shared.done = false;
+    testutil_check(__wt_thread_create(NULL, &write_tid, thread_write, &shared));
+    __wt_epoch(NULL, &start);
+    for (t = 0; t < N_READ_THREADS; ++t)
+        testutil_check(__wt_thread_create(NULL, &read_tids[t], thread_read, &shared));
+    for (t = 0; t < N_READ_THREADS; ++t)
+        testutil_check(__wt_thread_join(NULL, &read_tids[t]));
+    __wt_epoch(NULL, &end);
+    shared.done = true;
+    testutil_check(__wt_thread_join(NULL, &write_tid));
+
+    ntxns = (uint64_t)N_READ_THREADS * N_READ_TXNS;
+    *txn_nsp = (double)WT_TIMEDIFF_NS(end, start) * N_READ_THREADS / ntxns;
+    *scannedp = (double)(get_stat(session, WT_STAT_CONN_TXN_SESSIONS_WALKED) - scanned) / ntxns;
+
+    free(sessions);
+    testutil_check(opts->conn->close(opts->conn, NULL));
+    opts->conn = NULL;
+}
+
+/*
+ * create_perf_json --
+ *     Construct the performance json which is used to generate the performance charts.
+ */
+static void
+create_perf_json(const double *txn_ns, const double *scanned)
+{
+    FILE *fp;
+    size_t i;
+
+    testutil_assert_errno((fp = fopen("snapshot_perf.json", "w")) != NULL);
+    testutil_assert(fprintf(fp, "[{\"info\":{\"test_name\": \"snapshot_perf\"},\"metrics\": [") > 0);
+    for (i = 0; i < WT_ELEMENTS(session_counts); ++i)
+        testutil_assert(fprintf(fp,
+                          "%s{\"name\":\"Read transaction ns (%u sessions)\",\"value\":%.0f}, "
+                          "{\"name\":\"Sessions scanned per transaction (%u sessions)\","
+                          "\"value\":%.2f}",
+                          i == 0 ? "" : ", ", session_counts[i], txn_ns[i], session_counts[i],
+                          scanned[i]) > 0);
+    testutil_assert(fprintf(fp, "]}]") > 0);
+    testutil_assert(fclose(fp) == 0);
+}
+
+/*
+ * main --
+ *     Measure read transactions with increasing numbers of open sessions.
+ */
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    double scanned[WT_ELEMENTS(session_counts)], txn_ns[WT_ELEMENTS(session_counts)];
+    size_t i;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+
+    printf("%10s %16s %26s\n", "sessions", "ns/transaction", "sessions scanned/transaction");
+    for (i = 0; i < WT_ELEMENTS(session_counts); ++i) {
+        run(opts, session_counts[i], &txn_ns[i], &scanned[i]);
+        printf("%10u %16.0f %26.2f\n", session_counts[i], txn_ns[i], scanned[i]);
+    }
+    create_perf_json(txn_ns, scanned);
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
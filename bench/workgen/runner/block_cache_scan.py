@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# Compare the block cache replacement policies on a zipfian point-read workload mixed with scans.
+# Point reads of a table are interleaved with full scans of a second table, as a backup or an
+# analytic query would do. The scanned table is larger than the block cache: with the frequency
+# policy, whatever fills the cache first stays there until it ages out, with the tinylfu policy
+# the blocks being read repeatedly replace the scanned ones. The block cache hit ratio of the
+# point reads is reported for each policy.
+
+from runner import *
+from wiredtiger import *
+from wiredtiger import stat
+from workgen import *
+
+def get_stat(session, stat):
+    stat_cursor = session.open_cursor('statistics:')
+    val = stat_cursor[stat][2]
+    stat_cursor.close()
+    return val
+
+def scan(session, uri):
+    cursor = session.open_cursor(uri)
+    while cursor.next() == 0:
+        pass
+    cursor.close()
+
+# The WiredTiger cache is small, so most point reads go to the block manager.
+context = Context()
+conn_config = 'create,cache_size=20MB,statistics=(fast)'
+block_cache_config = 'block_cache=(enabled=true,type=dram,size=32MB,cache_on_writes=false,\
+    cache_on_checkpoint=false,policy={})'
+conn = context.wiredtiger_open(conn_config)
+s = conn.open_session()
+
+hot_name = 'table:hot'
+scan_name = 'table:scan'
+s.create(hot_name, 'key_format=S,value_format=S')
+s.create(scan_name, 'key_format=S,value_format=S')
+hot_table = Table(hot_name)
+hot_table.options.key_size = 20
+hot_table.options.value_size = 200
+scan_table = Table(scan_name)
+scan_table.options.key_size = 20
+scan_table.options.value_size = 200
+
+# Populate phase.
+populate_threads = 8
+insert_ops = Operation(Operation.OP_INSERT, hot_table) + \
+    Operation(Operation.OP_INSERT, scan_table) * 2
+insert_thread = Thread(insert_ops * (300000 // populate_threads))
+populate_workload = Workload(context, insert_thread * populate_threads)
+ret = populate_workload.run(conn)
+assert ret == 0, ret
+s.checkpoint()
+conn.close()
+
+# Point reads, skewed toward a hot set of keys.
+read_op = Operation(Operation.OP_SEARCH, hot_table, Key(Key.KEYGEN_PARETO, 0, ParetoOptions(10)))
+read_thread = Thread(read_op)
+read_workload = Workload(context, read_thread * 8)
+read_workload.options.run_time = 30
+read_workload.options.report_interval = 5
+
+for policy in ['frequency', 'tinylfu']:
+    conn = context.wiredtiger_open(conn_config + ',' + block_cache_config.format(policy))
+    s = conn.open_session()
+    for phase in range(3):
+        # A scan fills the block cache with blocks that won't be read again.
+        scan(s, scan_name)
+
+        hits = get_stat(s, stat.conn.block_cache_hits)
+        lookups = get_stat(s, stat.conn.block_cache_lookups)
+        ret = read_workload.run(conn)
+        assert ret == 0, ret
+        hits = get_stat(s, stat.conn.block_cache_hits) - hits
+        lookups = get_stat(s, stat.conn.block_cache_lookups) - lookups
+        print('policy {}, phase {}: point read block cache hit ratio {:.1f}%'.format(
+            policy, phase, 100.0 * hits / lookups if lookups != 0 else 0.0))
+    if policy == 'tinylfu':
+        print('policy {}: {} blocks admitted, {} blocks rejected'.format(policy,
+            get_stat(s, stat.conn.block_cache_admission_accepted),
+            get_stat(s, stat.conn.block_cache_admission_rejected)))
+    conn.close()
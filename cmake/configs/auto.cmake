@@ -298,6 +298,12 @@ config_compile(
     DEPENDS "HAVE_LIBPTHREAD"
 )
 
+config_compile(
+    HAVE_IO_URING
+    "If the Linux io_uring asynchronous I/O interface is available."
+    SOURCE "${CMAKE_CURRENT_LIST_DIR}/compile_test/io_uring_test.c"
+)
+
 include(TestBigEndian)
 test_big_endian(is_big_endian)
 if(NOT is_big_endian)
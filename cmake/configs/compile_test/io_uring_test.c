@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2014-present MongoDB, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/syscall.h>
+
+int
+main()
+{
+    struct io_uring_sqe sqe;
+
+    /* IORING_OP_READ is the newest interface we depend on, it was added in Linux 5.6. */
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_READ;
+    return (__NR_io_uring_setup > 0 && __NR_io_uring_enter > 0 ? 0 : 1);
+}
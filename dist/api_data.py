@@ -199,11 +199,24 @@ file_runtime_config = common_runtime_config + [
 
 # Per-file configuration
 file_config = format_meta + file_runtime_config + tiered_config + [
+    Config('adaptive_hash_index', '0', r'''
+        the number of entries in an adaptive hash index for the row-store file, mapping the keys
+        most often found by point searches directly to their leaf page, so repeated searches for
+        them skip the descent of the tree. Each entry takes 40 bytes of cache; 0 disables the
+        index (ignored for column-stores)''',
+        min='0', max='16M'),
     Config('block_allocation', 'best', r'''
         configure block allocation. Permitted values are \c "best" or \c "first"; the \c "best"
         configuration uses a best-fit algorithm, the \c "first" configuration uses a
         first-available algorithm during block allocation''',
         choices=['best', 'first',]),
+    Config('block_allocation_arenas', '0', r'''
+        the number of block allocation arenas; each arena reserves a range of free file space
+        that threads writing blocks allocate from, and batches blocks freed by threads, without
+        locking the file's extent lists, reducing contention when many threads write the file
+        concurrently. Reserved space and freed blocks are returned to the file's extent lists
+        when the file is checkpointed. The default value of 0 disables allocation arenas''',
+        min='0', max='64'),
     Config('allocation_size', '4KB', r'''
         the file unit allocation size, in bytes, must be a power of two; smaller values decrease
         the file space required by overflow items, and the default value of 4KB is a good choice
@@ -251,6 +264,11 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         capacity. Only valid in conjunction with in-memory databases. Should be used with caution -
         this configuration allows WiredTiger to consume memory over the configured cache limit''',
         type='boolean'),
+    Config('internal_key_prefix_search', 'false', r'''
+        search row-store internal pages using a dense array of key prefixes built when the page is
+        read into memory or split, to narrow the binary search before comparing keys. The array
+        takes 8 bytes of cache per key (ignored for custom collators)''',
+        type='boolean'),
     Config('internal_key_truncate', 'true', r'''
         configure internal key truncation, discarding unnecessary trailing bytes on internal keys
         (ignored for custom collators)''',
@@ -275,6 +293,12 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         size are stored as overflow items (which may require additional I/O to access).
         The default value is one-tenth the size of a newly split leaf page''',
         min='0'),
+    Config('leaf_key_prefix_search', '0', r'''
+        search row-store leaf pages using a directory of key prefixes, built once a page has been
+        searched this many times, to narrow the binary search before building and comparing keys.
+        The directory takes 8 bytes of cache per key; 0 disables it (ignored for custom
+        collators)''',
+        min='0', max='1000000'),
     Config('leaf_page_max', '32KB', r'''
         the maximum page size for leaf nodes, in bytes; the size must be a multiple of the
         allocation size, and is significant for applications wanting to maximize sequential data
@@ -306,6 +330,13 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         upper bound of <code>cache_size / 10</code>. This limit is soft - it is possible for
         pages to be temporarily larger than this value.''',
         min='512B', max='10TB'),
+    Config('page_arena', 'false', r'''
+        allocate the structures of keys inserted into an in-memory page, and of their first
+        values, from larger blocks of memory belonging to the page, freed together when the
+        page is evicted, rather than allocating them one at a time. This makes inserts cheaper
+        and reduces memory fragmentation in insert-heavy workloads; values of inserted keys
+        that are later updated or removed stay in memory until the page is evicted''',
+        type='boolean'),
     Config('prefix_compression', 'false', r'''
         configure prefix compression on row-store leaf pages''',
         type='boolean'),
@@ -325,6 +356,12 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         when a Btree page is split, it will be split into smaller pages, where each page is
         the specified percentage of the maximum Btree page size''',
         min='50', max='100'),
+    Config('value_zone_maps', 'false', r'''
+        record a zone map for each row-store leaf page written, bounding the values stored on the
+        page, so cursors with value bounds can skip pages holding no value within the bounds
+        without reading them. Zone maps are only kept in memory, with the page's address in its
+        parent page, and are lost when the parent page leaves the cache''',
+        type='boolean'),
 ]
 
 # File metadata, including both configurable and non-configurable (internal)
@@ -431,6 +468,13 @@ connection_runtime_config = [
             min='1', max='500'),
         Config('nvram_path', '', r'''
             the absolute path to the file system mounted on the NVRAM device'''),
+        Config('policy', 'frequency', r'''
+            the block replacement policy. With \c frequency, blocks are evicted when they haven't been
+            referenced recently, least referenced first. With \c tinylfu, a compact frequency sketch
+            of recent block accesses is also used as an admission filter once the cache is full: a
+            block read into the cache must have been accessed more frequently than the block it
+            replaces, so a single scan cannot flush frequently accessed blocks from the cache''',
+            choices=['frequency', 'tinylfu']),
         Config('percent_file_in_dram', '50', r'''
             bypass cache for a file if the set percentage of the file fits in system DRAM
             (as specified by block_cache.system_ram)''',
@@ -471,6 +515,11 @@ connection_runtime_config = [
             A database can configure both log_size and wait to set an upper bound for checkpoints;
             setting this value above 0 configures periodic checkpoints''',
             min='0', max='2GB'),
+        Config('threads', '0', r'''
+            maximum number of threads WiredTiger will start to help checkpoints write the leaf
+            pages of the trees being checkpointed. Each thread uses a session from the
+            configured \c session_max while a checkpoint runs''',
+            min='0', max='20'),
         Config('wait', '0', r'''
             seconds to wait between each checkpoint; setting this value above 0 configures
             periodic checkpoints''',
@@ -572,7 +621,10 @@ connection_runtime_config = [
             Config('threads_max', '8', r'''
                 maximum number of threads WiredTiger will start to help evict pages from cache. The
                 number of threads started will vary depending on the current eviction load. Each
-                eviction worker thread uses a session from the configured session_max''',
+                eviction worker thread uses a session from the configured session_max. When the
+                connection is opened, eviction queues are split into a shard for every four
+                threads, each walked by its own thread; changing this value later doesn't change
+                the number of shards''',
                 min=1, max=20), # !!! Must match WT_EVICT_MAX_WORKERS
             Config('threads_min', '1', r'''
                 minimum number of threads WiredTiger will start to help evict pages from
@@ -676,6 +728,14 @@ connection_runtime_config = [
                 maximum number of obsolete time window pages that can be marked as dirty per btree
                 in a single checkpoint by the checkpoint cleanup''',
                 min=0, max=100000),
+            Config('descent_validation', 'page_index', r'''
+                how searches descending a row-store tree detect they raced with a split of the
+                internal pages they searched. With \c page_index, searches check the parent page's
+                index has not changed when they search past the end of an internal page. With
+                \c version, searches read each internal page's split version before its index, keep
+                the page pinned until the child page's index is read, and restart from the root if
+                the split version changed''',
+                choices=['page_index', 'version']),
             Config('eviction_obsolete_tw_pages_dirty_max', '100', r'''
                 maximum number of obsolete time window pages that can be marked dirty per btree in a
                 single checkpoint by the eviction threads''',
@@ -875,6 +935,25 @@ log_configuration_common = [
     Config('archive', 'true', r'''
         automatically remove unneeded log files (deprecated)''',
         type='boolean', undoc=True),
+    Config('group_commit', '', r'''
+        group synchronous commits so they share a log file sync. The first synchronous commit
+        joining a log buffer holds the buffer open for the other synchronous commits, for no longer
+        than a time adapted from the recent file sync latency''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            enable group commit''',
+            type='boolean'),
+        Config('max_bytes', '64KB', r'''
+            stop waiting once the group's log records reach this size''',
+            min='4KB', max='1MB'),
+        Config('max_commits', '32', r'''
+            stop waiting once this many synchronous commits have joined the group''',
+            min='2', max='1000'),
+        Config('max_wait', '1000', r'''
+            the maximum time in microseconds a group waits for more commits. The wait is tuned
+            from the observed file sync latency and never exceeds this value''',
+            min='1', max='100000'),
+        ]),
     Config('os_cache_dirty_pct', '0', r'''
         maximum dirty system buffer cache usage, as a percentage of the log's \c file_max.
         If non-zero, schedule writes for dirty blocks belonging to the log in the system buffer
@@ -928,7 +1007,15 @@ wiredtiger_open_log_configuration = [
         Config('recover', 'on', r'''
             run recovery or fail with an error if recovery needs to run after an unclean
             shutdown''',
-            choices=['error', 'on'])
+            choices=['error', 'on']),
+        Config('recover_threads', '4', r'''
+            number of threads WiredTiger will start to apply log records during recovery, in
+            addition to the thread reading the log. Operations are divided among the threads by
+            file, so recovery of a single file isn't parallelized. If zero, log records are applied
+            by the thread reading the log. Each recovery thread uses a session from the configured
+            WT_RECOVERY_MAX_WORKERS''',
+            min=0,
+            max=10),    # !!! Must match WT_RECOVERY_MAX_WORKERS
     ]),
 ]
 
@@ -1083,6 +1170,11 @@ wiredtiger_open_chunk_cache_configuration = [
         Config('type', 'FILE', r'''
             cache location, defaults to the file system.''',
             choices=['FILE', 'DRAM'], undoc=True),
+        Config('warmup_threads', '4', r'''
+            number of threads reading the chunks of a file cache back from disk at startup, which
+            bounds the number of reads the warm-up has in flight. Chunks not yet read back are read
+            on first access. A value of 0 disables the warm-up''',
+            min='0', max='64'),
     ]),
 ]
 
@@ -1141,13 +1233,34 @@ wiredtiger_open_common =\
         the list from the reconstructed metadata. The target list must include URIs of type
         \c table:''',
         type='list'),
-    Config('buffer_alignment', '', r'''
-        this option is no longer supported, retained for backward compatibility.''',
-        min='-1', max='1MB', undoc=True),
+    Config('buffer_alignment', '-1', r'''
+        in-memory alignment (in bytes) for buffers used for I/O. The default value of -1
+        indicates a platform-specific alignment value should be used (4KB on Linux systems when
+        direct I/O is configured, zero elsewhere). The alignment must be a power of two, and
+        the \c allocation_size of files using direct I/O must be a multiple of it. Requires the
+        \c posix_memalign API''',
+        min='-1', max='1MB'),
     Config('builtin_extension_config', '', r'''
         A structure where the keys are the names of builtin extensions and the values are
         passed to WT_CONNECTION::load_extension as the \c config parameter (for example,
         <code>builtin_extension_config={zlib={compression_level=3}}</code>)'''),
+    Config('cache_arena', '', r'''
+        allocate the images of pages read into the cache from a memory arena mapped when the
+        connection is opened, rather than from the system allocator. The arena is divided between
+        the NUMA nodes of the system and page images are allocated from the node of the reading
+        thread where possible. Images the arena can't hold are allocated from the system allocator''',
+        type='category', subconfig=[
+        Config('hugepages', 'true', r'''
+            back the arena with explicitly reserved 2MB huge pages, falling back to transparent
+            huge pages if none are available''',
+            type='boolean'),
+        Config('numa', 'true', r'''
+            divide the arena between the NUMA nodes of the system, binding each part to its node''',
+            type='boolean'),
+        Config('size', '0', r'''
+            size of the arena. The value 0 disables the arena''',
+            min='0', max='10TB'),
+        ]),
     Config('cache_cursors', 'true', r'''
         enable caching of cursors for reuse. This is the default value for any sessions created,
         and can be overridden in configuring \c cache_cursors in WT_CONNECTION.open_session.''',
@@ -1160,8 +1273,14 @@ wiredtiger_open_common =\
         are compiled internally when the connection is opened.''',
         min='500'),
     Config('direct_io', '', r'''
-        this option is no longer supported, retained for backward compatibility.''',
-        type='list', undoc=True),
+        Use \c O_DIRECT on POSIX systems to access files, bypassing the system buffer cache so
+        data file pages are cached only in the WiredTiger cache. Ignored on non-POSIX systems and
+        falls back to buffered I/O if the filesystem doesn't support it. Options are given as a
+        list, such as <code>"direct_io=[data]"</code>. Including \c "data" will cause
+        WiredTiger data files to use direct I/O; \c "checkpoint" and \c "log" are accepted for
+        backward compatibility and ignored. Direct I/O is incompatible with the chunk cache, and
+        data files using it are never memory mapped''',
+        type='list', choices=['checkpoint', 'data', 'log']),
     Config('encryption', '', r'''
         configure an encryptor for system wide metadata and logs. If a system wide encryptor is
         set, it is also used for encrypting data files and tables, unless encryption configuration
@@ -1221,6 +1340,12 @@ wiredtiger_open_common =\
         Enable automatic detection of scans by applications, and attempt to pre-fetch future
         content into the cache''',
         type='category', subconfig=[
+        Config('async_read_depth', '0', r'''
+            the number of block reads each pre-fetch thread keeps in flight using the Linux io_uring
+            interface. Pre-fetch threads read the blocks of a batch of queued pages concurrently
+            instead of one page at a time. The value 0 disables asynchronous reads; the setting is
+            ignored on systems without io_uring support''',
+            min='0', max='256'),
         Config('available', 'false', r'''
             whether the thread pool for the pre-fetch functionality is started''',
             type='boolean'),
@@ -1259,11 +1384,40 @@ wiredtiger_open_common =\
             for more information''',
             choices=['dsync', 'fsync', 'none']),
         ]),
+    Config('update_pool', '', r'''
+        keep the memory of small discarded updates in pools for reuse by later updates, rather
+        than returning it to the system allocator. Each session allocates from and frees into its
+        own pool; sessions whose pools overflow, such as those of eviction threads, pass updates
+        to a pool shared by the connection, from which sessions whose pools are empty refill
+        theirs''',
+        type='category', subconfig=[
+        Config('session_max', '0', r'''
+            maximum bytes of discarded updates each session keeps for reuse. The value 0 disables
+            the update pools''',
+            min='0', max='64MB'),
+        Config('shared_max', '16MB', r'''
+            maximum bytes of discarded updates kept in the pool shared by the connection''',
+            min='0', max='1GB'),
+        ]),
     Config('verify_metadata', 'false', r'''
         open connection and verify any WiredTiger metadata. Not supported when opening a
         connection from a backup. This API allows verification and detection of corruption in
         WiredTiger metadata.''',
         type='boolean'),
+    Config('write_pipeline', '', r'''
+        hand the blocks of pages reconciliation splits into several blocks to a pool of threads
+        that compress, encrypt, checksum and write them, while reconciliation goes on to build the
+        next block''',
+        type='category', subconfig=[
+        Config('max_inflight', '16MB', r'''
+            maximum bytes of page images handed to the write pipeline threads and not yet written.
+            Blocks past the limit are written by the reconciling thread''',
+            min='1MB', max='1GB'),
+        Config('threads', '0', r'''
+            number of write pipeline threads. The value 0 writes every block from the reconciling
+            thread''',
+            min='0', max='20'),
+        ]),
     Config('write_through', '', r'''
         Use \c FILE_FLAG_WRITE_THROUGH on Windows to write to files. Ignored on non-Windows
         systems. Options are given as a list, such as <code>"write_through=[data]"</code>. 
@@ -1313,6 +1467,14 @@ cursor_bound_config = [
         configures which bound is being operated on. It takes one of two values, "lower" or "upper".
         ''',
         choices=['lower','upper']),
+    Config('value', 'false', r'''
+        configures whether the bound applies to the cursor's values rather than its keys. The value
+        relevant to the given bound must have been set prior to the call using
+        WT_CURSOR::set_value. Values are compared byte-wise in their packed format, and
+        WT_CURSOR::next and WT_CURSOR::prev skip records whose values fall outside the value
+        bounds. Value bounds are only supported on row-store file cursors, and clearing bounds
+        clears both key and value bounds''',
+        type='boolean'),
 ]
 
 cursor_runtime_config = [
@@ -1594,8 +1756,11 @@ methods = {
         the default configuration is the database configuration. The "clear" configuration
         resets statistics after gathering them, where appropriate (for example, a cache size
         statistic is not cleared, while the count of cursor insert operations will be cleared).
+        The "delta" configuration returns only the statistics whose values changed since the
+        cursor's statistics were last gathered; statistics are gathered again after each
+        WT_CURSOR::reset, and the first set gathered is returned in full.
         See @ref statistics for more information''',
-        type='list', choices=['all', 'cache_walk', 'fast', 'clear', 'size', 'tree_walk']),
+        type='list', choices=['all', 'cache_walk', 'fast', 'clear', 'delta', 'size', 'tree_walk']),
     Config('target', '', r'''
         if non-empty, back up the given list of objects; valid only for a backup data source''',
         type='list'),
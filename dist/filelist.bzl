@@ -129,6 +129,7 @@ WT_FILELIST = ['src/block/block_addr.c',
  'src/os_common/os_fstream_stdio.c',
  'src/os_common/os_getopt.c',
  'src/os_common/os_strtouq.c',
+ 'src/os_common/os_uring.c',
  'src/packing/pack_api.c',
  'src/packing/pack_impl.c',
  'src/packing/pack_stream.c',
@@ -215,13 +215,22 @@ int
 __wt_stat_''' + name + '''_init(
     WT_SESSION_IMPL *session, ''' + handle + ''' *handle)
 {
+\tsize_t size;
 \tint i;
+\tuint8_t *p;
 
-\tWT_RET(__wt_calloc(session, (size_t)WT_STAT_''' + capname + '''_COUNTER_SLOTS,
-\t    sizeof(*handle->stat_array), &handle->stat_array));
+\t/*
+\t * Pad each slot's structure to a cache line boundary so threads updating different slots
+\t * never share a cache line.
+\t */
+\tsize = WT_ALIGN(sizeof(WT_''' + name.upper() + '''_STATS), WT_CACHE_LINE_ALIGNMENT);
+\tWT_RET(__wt_calloc(session, 1,
+\t    (size_t)WT_STAT_''' + capname + '''_COUNTER_SLOTS * size + WT_CACHE_LINE_ALIGNMENT,
+\t    &handle->stat_array));
 
+\tp = (uint8_t *)WT_ALIGN((uintptr_t)handle->stat_array, WT_CACHE_LINE_ALIGNMENT);
 \tfor (i = 0; i < WT_STAT_''' + capname + '''_COUNTER_SLOTS; ++i) {
-\t\thandle->stats[i] = &handle->stat_array[i];
+\t\thandle->stats[i] = (WT_''' + name.upper() + '''_STATS *)(p + (size_t)i * size);
 \t\t__wt_stat_''' + name + '''_init_single(handle->stats[i]);
 \t}
 \treturn (0);
@@ -285,28 +294,10 @@ void
 __wt_stat_''' + name + '''_aggregate(
     WT_''' + name.upper() + '_STATS **from, WT_' + name.upper() + '''_STATS *to)
 {
+\t__wt_stats_aggregate_all_''' + capname.lower() + '''(
+\t    from, (int64_t *)to, sizeof(*to) / sizeof(int64_t));
+}
 ''')
-        # Connection level aggregation does not currently have any computation
-        # of a maximum value; I'm leaving in support for it, but don't declare
-        # a temporary variable until it's needed.
-        for l in statlist:
-            if 'max_aggregate' in l.flags:
-                f.write('\tint64_t v;\n\n')
-                break;
-        for l in statlist:
-            if 'max_aggregate' in l.flags:
-                o = '\tif ((v = WT_STAT_' + capname + '_READ(from, ' + l.name + ')) > ' +\
-                    'to->' + l.name + ')\n'
-                if len(o) > 72:             # Account for the leading tab.
-                    o = o.replace(' > ', ' >\n\t    ')
-                o +='\t\tto->' + l.name + ' = v;\n'
-            else:
-                o = '\tto->' + l.name + ' += WT_STAT_' + capname + '_READ(from, ' + l.name +\
-                    ');\n'
-                if len(o) > 72:             # Account for the leading tab.
-                    o = o.replace(' += ', ' +=\n\t    ')
-            f.write(o)
-        f.write('}\n')
 
 # Write the stat initialization and refresh routines to the stat.c file.
 f = open(tmp_file, 'w')
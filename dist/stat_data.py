@@ -214,6 +214,9 @@ conn_stats = [
     ##########################################
     # Block cache statistics
     ##########################################
+    BlockCacheStat('block_cache_admission_accepted', 'number of blocks admitted in place of a less frequently accessed block'),
+    BlockCacheStat('block_cache_admission_rejected', 'number of blocks not admitted because they were less frequently accessed than the blocks they would replace'),
+    BlockCacheStat('block_cache_admission_sketch_resets', 'number of admission frequency sketch resets'),
     BlockCacheStat('block_cache_blocks', 'total blocks'),
     BlockCacheStat('block_cache_blocks_evicted', 'evicted blocks'),
     BlockCacheStat('block_cache_blocks_insert_read', 'total blocks inserted on read path'),
@@ -255,10 +258,18 @@ conn_stats = [
     BlockStat('block_remap_file_resize', 'number of times the file was remapped because it changed size via fallocate or truncate'),
     BlockStat('block_remap_file_write', 'number of times the region was remapped via write'),
     BlockStat('block_write', 'blocks written'),
+    BlockStat('block_write_aligned_copy', 'blocks copied into aligned buffers for direct I/O writes'),
 
     ##########################################
     # Cache statistics
     ##########################################
+    CacheStat('cache_arena_alloc', 'page images allocated from the cache arena'),
+    CacheStat('cache_arena_alloc_fallback', 'page images the cache arena could not allocate'),
+    CacheStat('cache_arena_alloc_remote', 'page images allocated from a remote NUMA node of the cache arena'),
+    CacheStat('cache_arena_bytes', 'cache arena bytes assigned to size classes', 'no_clear,no_scale,size'),
+    CacheStat('cache_arena_bytes_fragmented', 'cache arena bytes lost to fragmentation', 'no_clear,no_scale,size'),
+    CacheStat('cache_arena_bytes_inuse', 'cache arena bytes allocated to page images', 'no_clear,no_scale,size'),
+    CacheStat('cache_arena_hugepages', 'cache arena backed by explicitly reserved huge pages', 'no_clear,no_scale'),
     CacheStat('cache_bytes_hs', 'bytes belonging to the history store table in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_image', 'bytes belonging to page images in the cache', 'no_clear,no_scale,size'),
     CacheStat('cache_bytes_internal', 'tracked bytes belonging to internal pages in the cache', 'no_clear,no_scale,size'),
@@ -276,6 +287,10 @@ conn_stats = [
     CacheStat('cache_pages_inuse', 'pages currently held in the cache', 'no_clear,no_scale'),
     CacheStat('cache_read_app_count', 'application threads page read from disk to cache count'),
     CacheStat('cache_read_app_time', 'application threads page read from disk to cache time (usecs)'),
+    CacheStat('cache_update_pool_alloc', 'update pool allocations'),
+    CacheStat('cache_update_pool_alloc_reuse', 'update pool allocations reusing discarded updates'),
+    CacheStat('cache_update_pool_bytes', 'bytes of discarded updates held by update pools', 'no_clear,no_scale,size'),
+    CacheStat('cache_update_pool_refill', 'update pool refills from the shared pool'),
     CacheStat('cache_write_app_count', 'application threads page write from cache to disk count'),
     CacheStat('cache_write_app_time', 'application threads page write from cache to disk time (usecs)'),
     CacheStat('npos_evict_walk_max', 'eviction walk restored - had to walk this many pages', 'max_aggregate,no_scale'),
@@ -310,6 +325,7 @@ conn_stats = [
     EvictStat('eviction_force_no_retry', 'forced eviction - do not retry count to evict pages selected to evict during reconciliation'),
     EvictStat('eviction_get_ref_empty', 'eviction calls to get a page found queue empty'),
     EvictStat('eviction_get_ref_empty2', 'eviction calls to get a page found queue empty after locking'),
+    EvictStat('eviction_get_ref_steal', 'eviction calls to get a page found a page in another shard'),
     EvictStat('eviction_internal_pages_already_queued', 'internal pages seen by eviction walk that are already queued'),
     EvictStat('eviction_internal_pages_queued', 'internal pages queued for eviction'),
     EvictStat('eviction_internal_pages_seen', 'internal pages seen by eviction walk'),
@@ -444,10 +460,12 @@ conn_stats = [
     ChunkCacheStat('chunkcache_bytes_inuse', 'total bytes used by the cache'),
     ChunkCacheStat('chunkcache_bytes_inuse_pinned', 'total bytes used by the cache for pinned chunks'),
     ChunkCacheStat('chunkcache_bytes_read_persistent', 'total bytes read from persistent content'),
+    ChunkCacheStat('chunkcache_bytes_warmed_up', 'total bytes read back by the startup warm-up'),
     ChunkCacheStat('chunkcache_chunks_evicted', 'chunks evicted'),
     ChunkCacheStat('chunkcache_chunks_inuse', 'total chunks held by the chunk cache'),
     ChunkCacheStat('chunkcache_chunks_loaded_from_flushed_tables', 'number of chunks loaded from flushed tables in chunk cache'),
     ChunkCacheStat('chunkcache_chunks_pinned', 'total pinned chunks held by the chunk cache'),
+    ChunkCacheStat('chunkcache_chunks_warmed_up', 'total chunks read back by the startup warm-up'),
     ChunkCacheStat('chunkcache_created_from_metadata', 'total number of chunks inserted on startup from persisted metadata.'),
     ChunkCacheStat('chunkcache_exceeded_bitmap_capacity', 'could not allocate due to exceeding bitmap capacity'),
     ChunkCacheStat('chunkcache_exceeded_capacity', 'could not allocate due to exceeding capacity'),
@@ -486,6 +504,7 @@ conn_stats = [
     CursorStat('cursor_reset', 'cursor reset calls'),
     CursorStat('cursor_restart', 'cursor operation restarted'),
     CursorStat('cursor_search', 'cursor search calls'),
+    CursorStat('cursor_search_batch', 'cursor search batch calls'),
     CursorStat('cursor_search_hs', 'cursor search history store calls'),
     CursorStat('cursor_search_near', 'cursor search near calls'),
     CursorStat('cursor_truncate', 'cursor truncate calls'),
@@ -575,6 +594,11 @@ conn_stats = [
     LogStat('log_force_remove_sleep', 'force log remove time sleeping (usecs)'),
     LogStat('log_force_write', 'log force write operations'),
     LogStat('log_force_write_skip', 'log force write operations skipped'),
+    LogStat('log_group_commit', 'group commit groups'),
+    LogStat('log_group_commit_full', 'group commit groups closed at the size or commit limit'),
+    LogStat('log_group_commit_joined', 'group commit synchronous commits grouped'),
+    LogStat('log_group_commit_wait', 'group commit time waiting for commits to join (usecs)'),
+    LogStat('log_group_commit_window', 'group commit current wait window (usecs)', 'no_clear,no_scale'),
     LogStat('log_max_filesize', 'maximum log file size', 'no_clear,no_scale,size'),
     LogStat('log_prealloc_files', 'pre-allocated log files prepared'),
     LogStat('log_prealloc_max', 'number of pre-allocated log files to create', 'no_clear,no_scale'),
@@ -646,6 +670,10 @@ conn_stats = [
     ##########################################
     # Prefetch statistics
     ##########################################
+    PrefetchStat('prefetch_async_read_batches', 'pre-fetch asynchronous read batches'),
+    PrefetchStat('prefetch_async_read_failed', 'pre-fetch asynchronous block reads that failed'),
+    PrefetchStat('prefetch_async_read_submitted', 'pre-fetch asynchronous block reads submitted'),
+    PrefetchStat('prefetch_async_read_used', 'pre-fetch asynchronous block reads used to read a page'),
     PrefetchStat('prefetch_attempts', 'pre-fetch triggered by page read'),
     PrefetchStat('prefetch_disk_one', 'pre-fetch not triggered after single disk read'),
     PrefetchStat('prefetch_failed_start', 'number of times pre-fetch failed to start'),
@@ -770,6 +798,7 @@ conn_stats = [
     TxnStat('txn_set_ts_out_of_order', 'set timestamp global oldest timestamp set to be more recent than the global stable timestamp'),
     TxnStat('txn_set_ts_stable', 'set timestamp stable calls'),
     TxnStat('txn_set_ts_stable_upd', 'set timestamp stable updates'),
+    TxnStat('txn_snapshot_reused', 'transaction snapshots reused without a walk of concurrent sessions'),
     TxnStat('txn_timestamp_oldest_active_read', 'transaction read timestamp of the oldest active reader', 'no_clear,no_scale'),
     TxnStat('txn_walk_sessions', 'transaction walk of concurrent sessions'),
 
@@ -801,6 +830,8 @@ dsrc_stats = [
     ##########################################
     BlockStat('allocation_size', 'file allocation unit size', 'max_aggregate,no_scale,size'),
     BlockStat('block_alloc', 'blocks allocated'),
+    BlockStat('block_arena_alloc', 'blocks allocated from allocation arenas'),
+    BlockStat('block_arena_free', 'blocks freed into allocation arenas'),
     BlockStat('block_checkpoint_size', 'checkpoint size', 'no_scale,size'),
     BlockStat('block_extension', 'allocations requiring file extension'),
     BlockStat('block_free', 'blocks freed'),
@@ -918,6 +949,7 @@ dsrc_stats = [
     CursorStat('cursor_reset', 'reset calls'),
     CursorStat('cursor_restart', 'operation restarted'),
     CursorStat('cursor_search', 'search calls'),
+    CursorStat('cursor_search_batch', 'search batch calls'),
     CursorStat('cursor_search_hs', 'search history store calls'),
     CursorStat('cursor_search_near', 'search near calls'),
     CursorStat('cursor_truncate', 'truncate calls'),
@@ -1020,6 +1052,7 @@ conn_dsrc_stats = [
     CacheStat('cache_hs_write_squash', 'history store table writes requiring squashed modifies'),
     CacheStat('cache_inmem_split', 'in-memory page splits'),
     CacheStat('cache_inmem_splittable', 'in-memory page passed criteria to be split'),
+    CacheStat('cache_page_arena_chunk', 'page arena chunks allocated'),
     CacheStat('cache_pages_prefetch', 'pages requested from the cache due to pre-fetch'),
     CacheStat('cache_pages_requested', 'pages requested from the cache'),
     CacheStat('cache_read', 'pages read into cache'),
@@ -1068,11 +1101,14 @@ conn_dsrc_stats = [
     CursorStat('cursor_prev_skip_total', 'Total number of entries skipped by cursor prev calls'),
     CursorStat('cursor_reposition', 'Total number of times cursor temporarily releases pinned page to encourage eviction of hot or large page'),
     CursorStat('cursor_reposition_failed', 'Total number of times cursor fails to temporarily release pinned page to encourage eviction of hot or large page'),
+    CursorStat('cursor_search_ahi_hit', 'Total number of searches resolved by the adaptive hash index'),
+    CursorStat('cursor_search_ahi_miss', 'Total number of searches not resolved by the adaptive hash index'),
     CursorStat('cursor_search_near_prefix_fast_paths', 'Total number of times a search near has exited due to prefix config'),
     CursorStat('cursor_skip_hs_cur_position', 'Total number of entries skipped to position the history store cursor'),
     CursorStat('cursor_tree_walk_del_page_skip', 'Total number of deleted pages skipped during tree walk'),
     CursorStat('cursor_tree_walk_inmem_del_page_skip', 'Total number of in-memory deleted pages skipped during tree walk'),
     CursorStat('cursor_tree_walk_ondisk_del_page_skip', 'Total number of on-disk deleted pages skipped during tree walk'),
+    CursorStat('cursor_tree_walk_zone_page_skip', 'Total number of pages skipped during tree walk by cursor value bounds'),
 
     ##########################################
     # Cursor API error statistics
@@ -1096,6 +1132,7 @@ conn_dsrc_stats = [
     CursorErrorStat('cursor_reopen_error', 'cursor reopen calls that return an error'),
     CursorErrorStat('cursor_reserve_error', 'cursor reserve calls that return an error'),
     CursorErrorStat('cursor_reset_error', 'cursor reset calls that return an error'),
+    CursorErrorStat('cursor_search_batch_error', 'cursor search batch calls that return an error'),
     CursorErrorStat('cursor_search_error', 'cursor search calls that return an error'),
     CursorErrorStat('cursor_search_near_error', 'cursor search near calls that return an error'),
     CursorErrorStat('cursor_update_error', 'cursor update calls that return an error'),
@@ -291,5 +291,6 @@ methods = {
         Number of threads that execute search near calls.''')]),
     'search_near_02' : Method(test_config),
     'search_near_03' : Method(test_config),
+    'split_descent_benchmarks' : Method(test_config),
     'test_template' : Method(test_config),
 }
@@ -277,6 +277,24 @@ cursor_ops(WT_SESSION *session)
         /*! [Search for an exact match] */
     }
 
+    {
+        /*! [Search for a batch of keys] */
+        /* Keys and values are in raw format: string keys include the trailing nul byte. */
+        WT_ITEM keys[2], values[2];
+        int results[2];
+
+        keys[0].data = "some key";
+        keys[0].size = strlen("some key") + 1;
+        keys[1].data = "missing key";
+        keys[1].size = strlen("missing key") + 1;
+        error_check(cursor->search_batch(cursor, keys, values, results, 2));
+        if (results[0] == 0)
+            printf("found: %s\n", (const char *)values[0].data);
+        if (results[1] == WT_NOTFOUND)
+            printf("not found: %s\n", (const char *)keys[1].data);
+        /*! [Search for a batch of keys] */
+    }
+
     cursor_search_near(cursor);
 
     {
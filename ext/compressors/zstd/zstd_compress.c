@@ -27,7 +27,9 @@
  */
 
 #include <zstd.h>
+#include <zdict.h>
 #include <errno.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -47,6 +49,15 @@
 /* Default context pool size. */
 #define CONTEXT_POOL_SIZE 50
 
+/*
+ * Dictionary compression: by default a dictionary is trained from 100 sampled pages, a file's
+ * dictionary is retrained when its pages compress 20% worse than they did just after training, and
+ * no more than 16 dictionaries are trained for a file while it's open.
+ */
+#define ZSTD_DICT_SAMPLES_DEFAULT 100
+#define ZSTD_DICT_RETRAIN_PCT 20
+#define ZSTD_DICT_MAX 16
+
 struct ZSTD_Context;
 typedef struct ZSTD_Context ZSTD_CONTEXT;
 struct ZSTD_Context {
@@ -72,10 +83,59 @@ typedef struct {
 
     int compression_level; /* compression level */
 
+    size_t dict_size;      /* Dictionary size, 0 if not training dictionaries */
+    uint32_t dict_samples; /* Pages sampled to train a dictionary */
+
     ZSTD_CONTEXT_POOL *cctx_pool; /* Compression context pool. */
     ZSTD_CONTEXT_POOL *dctx_pool; /* Decompression context pool. */
 } ZSTD_COMPRESSOR;
 
+/*
+ * A dictionary trained for a file. Zstd stores the dictionary ID in the frame of every page
+ * compressed with the dictionary, so pages compressed with older dictionaries remain readable after
+ * a file's dictionary is retrained.
+ */
+struct ZSTD_Dictionary;
+typedef struct ZSTD_Dictionary ZSTD_DICTIONARY;
+struct ZSTD_Dictionary {
+    unsigned id;       /* Dictionary ID */
+    ZSTD_CDict *cdict; /* Compression dictionary, only if loaded for compression */
+    ZSTD_DDict *ddict; /* Decompression dictionary */
+    ZSTD_DICTIONARY *next;
+};
+
+/*
+ * Per-file compressor, created by customizing the zstd compressor for a file. Dictionaries are
+ * stored next to the file they belong to, in files named "<file>.<dictionary ID>.zdict"; the file
+ * "<file>.zdict" holds the ID of the file's current dictionary.
+ */
+typedef struct {
+    WT_COMPRESSOR compressor; /* Must come first */
+
+    ZSTD_COMPRESSOR *zcompressor; /* Shared zstd compressor */
+    WT_FILE_SYSTEM *file_system;  /* File system for dictionary files */
+    char *prefix;                 /* Dictionary file path prefix */
+
+    WT_EXTENSION_SPINLOCK lock; /* Spinlock */
+
+    ZSTD_DICTIONARY *dicts;   /* Dictionaries loaded or trained */
+    ZSTD_DICTIONARY *current; /* Current dictionary, NULL if none */
+    uint32_t dicts_trained;   /* Dictionaries trained while open */
+
+    int sampling;           /* Collecting samples */
+    int training;           /* A thread is training a dictionary */
+    uint8_t *samples;       /* Sampled page images */
+    size_t samples_len;     /* Bytes of samples */
+    size_t samples_max;     /* Maximum bytes of samples */
+    size_t *sample_sizes;   /* Size of each sample */
+    uint32_t samples_count; /* Count of samples */
+
+    uint64_t window_in;    /* Bytes compressed with the current dictionary */
+    uint64_t window_out;   /* Bytes after compression */
+    uint32_t window_pages; /* Pages compressed */
+    uint64_t baseline_pct; /* Compressed percent of the first window after training */
+} ZSTD_FILE_COMPRESSOR;
+
 /*
  * Zstd decompression requires an exact compressed byte count. WiredTiger doesn't track that value,
  * store it in the destination buffer.
@@ -180,32 +240,15 @@ zstd_release_context(
 }
 
 /*
- *  zstd_compress --
- *	WiredTiger Zstd compression.
+ * zstd_compress_finish --
+ *     Finish compression: store the compressed byte count if compression succeeded.
  */
 static int
-zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+zstd_compress_finish(WT_COMPRESSOR *compressor, WT_SESSION *session, size_t zstd_ret,
+  size_t src_len, uint8_t *dst, size_t *result_lenp, int *compression_failed)
 {
-    ZSTD_COMPRESSOR *zcompressor;
-    ZSTD_CONTEXT *context = NULL;
-    size_t zstd_ret;
     uint64_t zstd_len;
 
-    zcompressor = (ZSTD_COMPRESSOR *)compressor;
-
-    zstd_get_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, &context);
-
-    /* Compress, starting past the prefix bytes. */
-    if (context != NULL) {
-        zstd_ret = ZSTD_compressCCtx((ZSTD_CCtx *)context->ctx, dst + ZSTD_PREFIX,
-          dst_len - ZSTD_PREFIX, src, src_len, zcompressor->compression_level);
-    } else {
-        zstd_ret = ZSTD_compress(
-          dst + ZSTD_PREFIX, dst_len - ZSTD_PREFIX, src, src_len, zcompressor->compression_level);
-    }
-
-    zstd_release_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, context);
     /*
      * If compression succeeded and the compressed length is smaller than the original size, return
      * success.
@@ -235,21 +278,47 @@ zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 }
 
 /*
- * zstd_decompress --
- *     WiredTiger Zstd decompression.
+ *  zstd_compress --
+ *	WiredTiger Zstd compression.
  */
 static int
-zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
-  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
 {
-    WT_EXTENSION_API *wt_api;
     ZSTD_COMPRESSOR *zcompressor;
     ZSTD_CONTEXT *context = NULL;
     size_t zstd_ret;
+
+    zcompressor = (ZSTD_COMPRESSOR *)compressor;
+
+    zstd_get_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, &context);
+
+    /* Compress, starting past the prefix bytes. */
+    if (context != NULL) {
+        zstd_ret = ZSTD_compressCCtx((ZSTD_CCtx *)context->ctx, dst + ZSTD_PREFIX,
+          dst_len - ZSTD_PREFIX, src, src_len, zcompressor->compression_level);
+    } else {
+        zstd_ret = ZSTD_compress(
+          dst + ZSTD_PREFIX, dst_len - ZSTD_PREFIX, src, src_len, zcompressor->compression_level);
+    }
+
+    zstd_release_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, context);
+    return (zstd_compress_finish(
+      compressor, session, zstd_ret, src_len, dst, result_lenp, compression_failed));
+}
+
+/*
+ * zstd_frame_len --
+ *     Retrieve the saved compressed byte count.
+ */
+static int
+zstd_frame_len(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint64_t *zstd_lenp)
+{
+    WT_EXTENSION_API *wt_api;
     uint64_t zstd_len;
 
     wt_api = ((ZSTD_COMPRESSOR *)compressor)->wt_api;
-    zcompressor = (ZSTD_COMPRESSOR *)compressor;
 
     /*
      * Retrieve the saved length, handling little- to big-endian conversion as necessary.
@@ -263,6 +332,28 @@ zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
           wt_api, session, "WT_COMPRESSOR.decompress: stored size exceeds source size");
         return (WT_ERROR);
     }
+    *zstd_lenp = zstd_len;
+    return (0);
+}
+
+/*
+ * zstd_decompress --
+ *     WiredTiger Zstd decompression.
+ */
+static int
+zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_CONTEXT *context = NULL;
+    size_t zstd_ret;
+    uint64_t zstd_len;
+    int ret;
+
+    zcompressor = (ZSTD_COMPRESSOR *)compressor;
+
+    if ((ret = zstd_frame_len(compressor, session, src, src_len, &zstd_len)) != 0)
+        return (ret);
 
     /*
      * This type of context management is useful to avoid repeated context allocation overhead. This
@@ -306,6 +397,612 @@ zstd_pre_size(
     return (0);
 }
 
+/*
+ * zstd_dict_free --
+ *     Free a dictionary.
+ */
+static void
+zstd_dict_free(ZSTD_DICTIONARY *dict)
+{
+    if (dict == NULL)
+        return;
+    ZSTD_freeCDict(dict->cdict);
+    ZSTD_freeDDict(dict->ddict);
+    free(dict);
+}
+
+/*
+ * zstd_dict_create --
+ *     Digest a dictionary for decompression and, optionally, compression.
+ */
+static int
+zstd_dict_create(ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session, const void *buf, size_t len,
+  int compress, ZSTD_DICTIONARY **dictp)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_DICTIONARY *dict;
+
+    wt_api = zfile->zcompressor->wt_api;
+    *dictp = NULL;
+
+    if ((dict = calloc(1, sizeof(ZSTD_DICTIONARY))) == NULL)
+        return (errno);
+    dict->id = ZDICT_getDictID(buf, len);
+    dict->ddict = ZSTD_createDDict(buf, len);
+    if (compress)
+        dict->cdict = ZSTD_createCDict(buf, len, zfile->zcompressor->compression_level);
+    if (dict->id == 0 || dict->ddict == NULL || (compress && dict->cdict == NULL)) {
+        zstd_dict_free(dict);
+        (void)wt_api->err_printf(
+          wt_api, session, "zstd_dict_create: %s: invalid dictionary", zfile->prefix);
+        return (WT_ERROR);
+    }
+
+    *dictp = dict;
+    return (0);
+}
+
+/*
+ * zstd_dict_path --
+ *     Build the path of one of a file's dictionary files: the dictionary with the given ID, or the
+ *     file holding the current dictionary ID if the ID is 0.
+ */
+static int
+zstd_dict_path(ZSTD_FILE_COMPRESSOR *zfile, unsigned id, const char *suffix, char **pathp)
+{
+    size_t len;
+    char *path;
+
+    *pathp = NULL;
+
+    len = strlen(zfile->prefix) + 32;
+    if ((path = malloc(len)) == NULL)
+        return (errno);
+    if (id == 0)
+        (void)snprintf(path, len, "%s.zdict%s", zfile->prefix, suffix);
+    else
+        (void)snprintf(path, len, "%s.%u.zdict%s", zfile->prefix, id, suffix);
+
+    *pathp = path;
+    return (0);
+}
+
+/*
+ * zstd_dict_read_file --
+ *     Read a dictionary file into allocated memory.
+ */
+static int
+zstd_dict_read_file(ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session, const char *path,
+  uint8_t **bufp, size_t *lenp)
+{
+    WT_FILE_HANDLE *fh;
+    wt_off_t size;
+    int ret, tret;
+    uint8_t *buf;
+
+    *bufp = NULL;
+    *lenp = 0;
+    buf = NULL;
+
+    if ((ret = zfile->file_system->fs_open_file(
+           zfile->file_system, session, path, WT_FS_OPEN_FILE_TYPE_REGULAR, 0, &fh)) != 0)
+        return (ret);
+    if ((ret = fh->fh_size(fh, session, &size)) == 0) {
+        if ((buf = malloc((size_t)size + 1)) == NULL)
+            ret = errno;
+        else
+            ret = fh->fh_read(fh, session, 0, (size_t)size, buf);
+    }
+    if ((tret = fh->close(fh, session)) != 0 && ret == 0)
+        ret = tret;
+
+    if (ret != 0) {
+        free(buf);
+        return (ret);
+    }
+    buf[size] = '\0';
+    *bufp = buf;
+    *lenp = (size_t)size;
+    return (0);
+}
+
+/*
+ * zstd_dict_write_file --
+ *     Durably write a dictionary file.
+ */
+static int
+zstd_dict_write_file(ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session, const char *path,
+  const void *buf, size_t len, int exclusive)
+{
+    WT_FILE_HANDLE *fh;
+    uint32_t flags;
+    int ret, tret;
+
+    flags = WT_FS_OPEN_CREATE | WT_FS_OPEN_DURABLE;
+    if (exclusive)
+        flags |= WT_FS_OPEN_EXCLUSIVE;
+    if ((ret = zfile->file_system->fs_open_file(
+           zfile->file_system, session, path, WT_FS_OPEN_FILE_TYPE_REGULAR, flags, &fh)) != 0)
+        return (ret);
+    if ((ret = fh->fh_write(fh, session, 0, len, buf)) == 0)
+        ret = fh->fh_sync(fh, session);
+    if ((tret = fh->close(fh, session)) != 0 && ret == 0)
+        ret = tret;
+    return (ret);
+}
+
+/*
+ * zstd_dict_load --
+ *     Load a file's dictionary from its dictionary file.
+ */
+static int
+zstd_dict_load(ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session, unsigned id, int compress,
+  ZSTD_DICTIONARY **dictp)
+{
+    WT_EXTENSION_API *wt_api;
+    size_t len;
+    int ret;
+    char *path;
+    uint8_t *buf;
+
+    wt_api = zfile->zcompressor->wt_api;
+    *dictp = NULL;
+
+    if ((ret = zstd_dict_path(zfile, id, "", &path)) != 0)
+        return (ret);
+    if ((ret = zstd_dict_read_file(zfile, session, path, &buf, &len)) != 0) {
+        (void)wt_api->err_printf(wt_api, session, "zstd_dict_load: %s: %s", path,
+          wt_api->strerror(wt_api, session, ret));
+        free(path);
+        return (ret);
+    }
+    free(path);
+
+    ret = zstd_dict_create(zfile, session, buf, len, compress, dictp);
+    free(buf);
+    if (ret == 0 && (*dictp)->id != id) {
+        zstd_dict_free(*dictp);
+        *dictp = NULL;
+        (void)wt_api->err_printf(
+          wt_api, session, "zstd_dict_load: %s: dictionary %u has the wrong ID", zfile->prefix, id);
+        ret = WT_ERROR;
+    }
+    return (ret);
+}
+
+/*
+ * zstd_dict_get --
+ *     Return one of a file's dictionaries, loading it if it's not yet been used.
+ */
+static int
+zstd_dict_get(
+  ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session, unsigned id, ZSTD_DICTIONARY **dictp)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_DICTIONARY *dict, *loaded;
+    int ret;
+
+    wt_api = zfile->zcompressor->wt_api;
+
+    wt_api->spin_lock(wt_api, session, &zfile->lock);
+    for (dict = zfile->dicts; dict != NULL; dict = dict->next)
+        if (dict->id == id)
+            break;
+    wt_api->spin_unlock(wt_api, session, &zfile->lock);
+    if ((*dictp = dict) != NULL)
+        return (0);
+
+    /* Load the dictionary outside the lock, another thread may race us to it. */
+    if ((ret = zstd_dict_load(zfile, session, id, 0, &loaded)) != 0)
+        return (ret);
+
+    wt_api->spin_lock(wt_api, session, &zfile->lock);
+    for (dict = zfile->dicts; dict != NULL; dict = dict->next)
+        if (dict->id == id)
+            break;
+    if (dict == NULL) {
+        loaded->next = zfile->dicts;
+        zfile->dicts = dict = loaded;
+        loaded = NULL;
+    }
+    wt_api->spin_unlock(wt_api, session, &zfile->lock);
+
+    zstd_dict_free(loaded);
+    *dictp = dict;
+    return (0);
+}
+
+/*
+ * zstd_dict_sampling_start --
+ *     Start collecting samples to train a dictionary, called with the lock held.
+ */
+static void
+zstd_dict_sampling_start(ZSTD_FILE_COMPRESSOR *zfile)
+{
+    ZSTD_COMPRESSOR *zcompressor;
+
+    zcompressor = zfile->zcompressor;
+
+    /* Zstd recommends training from about 100 times the dictionary size of samples. */
+    zfile->samples_max = 100 * zcompressor->dict_size;
+    zfile->samples = malloc(zfile->samples_max);
+    zfile->sample_sizes = calloc(zcompressor->dict_samples, sizeof(size_t));
+    if (zfile->samples == NULL || zfile->sample_sizes == NULL) {
+        free(zfile->samples);
+        free(zfile->sample_sizes);
+        zfile->samples = NULL;
+        zfile->sample_sizes = NULL;
+        return;
+    }
+    zfile->samples_len = 0;
+    zfile->samples_count = 0;
+    zfile->sampling = 1;
+}
+
+/*
+ * zstd_dict_train --
+ *     Train a dictionary from the collected samples, store it and make it the file's current
+ *     dictionary. Failing to train a dictionary isn't an error, the file's pages continue to be
+ *     compressed as before.
+ */
+static void
+zstd_dict_train(ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_DICTIONARY *dict;
+    size_t len;
+    char *current_path, *path, *set_path, idbuf[32];
+    uint8_t *buf;
+
+    zcompressor = zfile->zcompressor;
+    wt_api = zcompressor->wt_api;
+    dict = NULL;
+    current_path = path = set_path = NULL;
+
+    if ((buf = malloc(zcompressor->dict_size)) == NULL)
+        goto done;
+    len = ZDICT_trainFromBuffer(
+      buf, zcompressor->dict_size, zfile->samples, zfile->sample_sizes, zfile->samples_count);
+    if (ZDICT_isError(len) || zstd_dict_create(zfile, session, buf, len, 1, &dict) != 0)
+        goto done;
+
+    /*
+     * The dictionary must be durable before any page compressed with it can be, write it before
+     * compressing with it. Dictionary IDs are random, in the unlikely case the ID is already in use
+     * for the file, give up on this dictionary.
+     */
+    if (zstd_dict_path(zfile, dict->id, "", &path) != 0 ||
+      zstd_dict_write_file(zfile, session, path, buf, len, 1) != 0)
+        goto done;
+
+    /*
+     * Record the current dictionary: write a new ID file and rename it into place. The ID is fixed
+     * width, overwriting a leftover file leaves no trailing bytes.
+     */
+    (void)snprintf(idbuf, sizeof(idbuf), "%010u\n", dict->id);
+    if (zstd_dict_path(zfile, 0, ".set", &set_path) != 0 ||
+      zstd_dict_write_file(zfile, session, set_path, idbuf, strlen(idbuf), 0) != 0)
+        goto done;
+    if (zstd_dict_path(zfile, 0, "", &current_path) != 0 ||
+      zfile->file_system->fs_rename(
+        zfile->file_system, session, set_path, current_path, WT_FS_DURABLE) != 0)
+        goto done;
+
+    wt_api->spin_lock(wt_api, session, &zfile->lock);
+    dict->next = zfile->dicts;
+    zfile->dicts = zfile->current = dict;
+    ++zfile->dicts_trained;
+    zfile->window_in = zfile->window_out = 0;
+    zfile->window_pages = 0;
+    zfile->baseline_pct = 0;
+    wt_api->spin_unlock(wt_api, session, &zfile->lock);
+    dict = NULL;
+
+done:
+    zstd_dict_free(dict);
+    free(buf);
+    free(current_path);
+    free(path);
+    free(set_path);
+
+    wt_api->spin_lock(wt_api, session, &zfile->lock);
+    free(zfile->samples);
+    free(zfile->sample_sizes);
+    zfile->samples = NULL;
+    zfile->sample_sizes = NULL;
+    zfile->sampling = zfile->training = 0;
+    wt_api->spin_unlock(wt_api, session, &zfile->lock);
+}
+
+/*
+ * zstd_dict_sample --
+ *     Add a page image to the samples, training a dictionary once there are enough.
+ */
+static void
+zstd_dict_sample(
+  ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session, const uint8_t *src, size_t src_len)
+{
+    WT_EXTENSION_API *wt_api;
+    int train;
+
+    wt_api = zfile->zcompressor->wt_api;
+    train = 0;
+
+    wt_api->spin_lock(wt_api, session, &zfile->lock);
+    if (zfile->sampling && !zfile->training) {
+        if (zfile->samples_len + src_len <= zfile->samples_max) {
+            memcpy(zfile->samples + zfile->samples_len, src, src_len);
+            zfile->samples_len += src_len;
+            zfile->sample_sizes[zfile->samples_count++] = src_len;
+        }
+
+        /* Train once there are enough samples, or the sample buffer has filled up. */
+        if (zfile->samples_count == zfile->zcompressor->dict_samples ||
+          zfile->samples_len + src_len > zfile->samples_max)
+            train = zfile->training = 1;
+    }
+    wt_api->spin_unlock(wt_api, session, &zfile->lock);
+
+    if (train)
+        zstd_dict_train(zfile, session);
+}
+
+/*
+ * zstd_dict_track --
+ *     Track how well the current dictionary compresses, and start collecting samples to retrain
+ *     the dictionary if its pages compress noticeably worse than they did just after training.
+ */
+static void
+zstd_dict_track(ZSTD_FILE_COMPRESSOR *zfile, WT_SESSION *session, ZSTD_DICTIONARY *dict,
+  size_t src_len, size_t result_len)
+{
+    WT_EXTENSION_API *wt_api;
+    uint64_t limit, pct;
+
+    wt_api = zfile->zcompressor->wt_api;
+
+    wt_api->spin_lock(wt_api, session, &zfile->lock);
+    if (dict == zfile->current) {
+        zfile->window_in += src_len;
+        zfile->window_out += result_len;
+        if (++zfile->window_pages >= zfile->zcompressor->dict_samples) {
+            pct = (zfile->window_out * 100) / (zfile->window_in == 0 ? 1 : zfile->window_in);
+            limit = zfile->baseline_pct + (zfile->baseline_pct * ZSTD_DICT_RETRAIN_PCT) / 100;
+            if (zfile->baseline_pct == 0)
+                zfile->baseline_pct = pct == 0 ? 1 : pct;
+            else if (pct > limit && !zfile->sampling && zfile->dicts_trained < ZSTD_DICT_MAX)
+                zstd_dict_sampling_start(zfile);
+            zfile->window_in = zfile->window_out = 0;
+            zfile->window_pages = 0;
+        }
+    }
+    wt_api->spin_unlock(wt_api, session, &zfile->lock);
+}
+
+/*
+ * zstd_file_compress --
+ *     WiredTiger Zstd compression of a file's page, using the file's current dictionary.
+ */
+static int
+zstd_file_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
+  uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_CCtx *cctx;
+    ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_CONTEXT *context = NULL;
+    ZSTD_DICTIONARY *dict;
+    ZSTD_FILE_COMPRESSOR *zfile;
+    size_t zstd_ret;
+    int ret, sampling;
+
+    zfile = (ZSTD_FILE_COMPRESSOR *)compressor;
+    zcompressor = zfile->zcompressor;
+    wt_api = zcompressor->wt_api;
+
+    wt_api->spin_lock(wt_api, session, &zfile->lock);
+    dict = zfile->current;
+    sampling = zfile->sampling;
+    wt_api->spin_unlock(wt_api, session, &zfile->lock);
+
+    if (sampling)
+        zstd_dict_sample(zfile, session, src, src_len);
+
+    if (dict == NULL)
+        return (zstd_compress(&zcompressor->compressor, session, src, src_len, dst, dst_len,
+          result_lenp, compression_failed));
+
+    /* Compress, starting past the prefix bytes. */
+    zstd_get_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, &context);
+    if (context != NULL)
+        zstd_ret = ZSTD_compress_usingCDict((ZSTD_CCtx *)context->ctx, dst + ZSTD_PREFIX,
+          dst_len - ZSTD_PREFIX, src, src_len, dict->cdict);
+    else {
+        if ((cctx = ZSTD_createCCtx()) == NULL)
+            return (ENOMEM);
+        zstd_ret = ZSTD_compress_usingCDict(
+          cctx, dst + ZSTD_PREFIX, dst_len - ZSTD_PREFIX, src, src_len, dict->cdict);
+        ZSTD_freeCCtx(cctx);
+    }
+    zstd_release_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, context);
+
+    ret = zstd_compress_finish(&zcompressor->compressor, session, zstd_ret, src_len, dst,
+      result_lenp, compression_failed);
+    if (ret == 0)
+        zstd_dict_track(
+          zfile, session, dict, src_len, *compression_failed ? src_len : *result_lenp);
+    return (ret);
+}
+
+/*
+ * zstd_file_decompress --
+ *     WiredTiger Zstd decompression of a file's page, using the dictionary the page was compressed
+ *     with, if any.
+ */
+static int
+zstd_file_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src,
+  size_t src_len, uint8_t *dst, size_t dst_len, size_t *result_lenp)
+{
+    ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_CONTEXT *context = NULL;
+    ZSTD_DCtx *dctx;
+    ZSTD_DICTIONARY *dict;
+    ZSTD_FILE_COMPRESSOR *zfile;
+    size_t zstd_ret;
+    uint64_t zstd_len;
+    unsigned id;
+    int ret;
+
+    zfile = (ZSTD_FILE_COMPRESSOR *)compressor;
+    zcompressor = zfile->zcompressor;
+
+    if ((ret = zstd_frame_len(&zcompressor->compressor, session, src, src_len, &zstd_len)) != 0)
+        return (ret);
+
+    /* Pages compressed without a dictionary have a dictionary ID of 0. */
+    if ((id = ZSTD_getDictID_fromFrame(src + ZSTD_PREFIX, (size_t)zstd_len)) == 0)
+        return (zstd_decompress(
+          &zcompressor->compressor, session, src, src_len, dst, dst_len, result_lenp));
+    if ((ret = zstd_dict_get(zfile, session, id, &dict)) != 0)
+        return (ret);
+
+    zstd_get_context(zcompressor, session, CONTEXT_TYPE_DECOMPRESS, &context);
+    if (context != NULL)
+        zstd_ret = ZSTD_decompress_usingDDict((ZSTD_DCtx *)context->ctx, dst, dst_len,
+          src + ZSTD_PREFIX, (size_t)zstd_len, dict->ddict);
+    else {
+        if ((dctx = ZSTD_createDCtx()) == NULL)
+            return (ENOMEM);
+        zstd_ret = ZSTD_decompress_usingDDict(
+          dctx, dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len, dict->ddict);
+        ZSTD_freeDCtx(dctx);
+    }
+    zstd_release_context(zcompressor, session, CONTEXT_TYPE_DECOMPRESS, context);
+
+    if (!ZSTD_isError(zstd_ret)) {
+        *result_lenp = zstd_ret;
+        return (0);
+    }
+    return (zstd_error(compressor, session, "ZSTD_decompress_usingDDict", zstd_ret));
+}
+
+/*
+ * zstd_file_terminate --
+ *     WiredTiger Zstd per-file compressor termination.
+ */
+static int
+zstd_file_terminate(WT_COMPRESSOR *compressor, WT_SESSION *session)
+{
+    WT_EXTENSION_API *wt_api;
+    ZSTD_DICTIONARY *dict;
+    ZSTD_FILE_COMPRESSOR *zfile;
+
+    (void)session; /* Unused parameters. */
+
+    zfile = (ZSTD_FILE_COMPRESSOR *)compressor;
+    wt_api = zfile->zcompressor->wt_api;
+
+    while ((dict = zfile->dicts) != NULL) {
+        zfile->dicts = dict->next;
+        zstd_dict_free(dict);
+    }
+    free(zfile->samples);
+    free(zfile->sample_sizes);
+    free(zfile->prefix);
+    wt_api->spin_destroy(wt_api, &zfile->lock);
+    free(zfile);
+    return (0);
+}
+
+/*
+ * zstd_customize --
+ *     WiredTiger Zstd compression per-file customization: create a compressor for the file that
+ *     can read pages compressed with the file's dictionaries, and trains and uses dictionaries if
+ *     configured.
+ */
+static int
+zstd_customize(WT_COMPRESSOR *compressor, WT_SESSION *session, const char *uri,
+  WT_CONFIG_ITEM *passcfg, WT_COMPRESSOR **customp)
+{
+    WT_CONNECTION *connection;
+    WT_EXTENSION_API *wt_api;
+    ZSTD_COMPRESSOR *zcompressor;
+    ZSTD_DICTIONARY *dict;
+    ZSTD_FILE_COMPRESSOR *zfile;
+    size_t home_len, len, uri_len;
+    unsigned id;
+    int ret;
+    const char *home;
+    char *path;
+    uint8_t *buf;
+    bool exist;
+
+    (void)passcfg; /* Unused parameters. */
+
+    zcompressor = (ZSTD_COMPRESSOR *)compressor;
+    wt_api = zcompressor->wt_api;
+    *customp = NULL;
+
+    /* Dictionary files are named for the file they belong to. */
+    if (strncmp(uri, "file:", strlen("file:")) != 0)
+        return (0);
+    uri += strlen("file:");
+
+    if ((zfile = calloc(1, sizeof(ZSTD_FILE_COMPRESSOR))) == NULL)
+        return (errno);
+    zfile->compressor.compress = zstd_file_compress;
+    zfile->compressor.decompress = zstd_file_decompress;
+    zfile->compressor.pre_size = zstd_pre_size;
+    zfile->compressor.terminate = zstd_file_terminate;
+    zfile->zcompressor = zcompressor;
+
+    if ((ret = wt_api->spin_init(wt_api, &zfile->lock, "zstd file")) != 0) {
+        free(zfile);
+        return (ret);
+    }
+
+    connection = session->connection;
+    home = connection->get_home(connection);
+    home_len = strlen(home);
+    uri_len = strlen(uri);
+    if ((zfile->prefix = malloc(home_len + uri_len + 2)) == NULL) {
+        ret = errno;
+        goto err;
+    }
+    memcpy(zfile->prefix, home, home_len);
+    zfile->prefix[home_len] = '/';
+    memcpy(zfile->prefix + home_len + 1, uri, uri_len + 1);
+    if ((ret = wt_api->file_system_get(wt_api, session, &zfile->file_system)) != 0)
+        goto err;
+
+    /* If training dictionaries, continue with the file's current dictionary, if it has one. */
+    if (zcompressor->dict_size != 0) {
+        path = NULL;
+        buf = NULL;
+        if ((ret = zstd_dict_path(zfile, 0, "", &path)) == 0 &&
+          (ret = zfile->file_system->fs_exist(zfile->file_system, session, path, &exist)) == 0 &&
+          exist && (ret = zstd_dict_read_file(zfile, session, path, &buf, &len)) == 0 &&
+          (id = (unsigned)strtoul((char *)buf, NULL, 10)) != 0 &&
+          (ret = zstd_dict_load(zfile, session, id, 1, &dict)) == 0)
+            zfile->dicts = zfile->current = dict;
+        free(path);
+        free(buf);
+        if (ret != 0)
+            goto err;
+
+        if (zfile->current == NULL)
+            zstd_dict_sampling_start(zfile);
+    }
+
+    *customp = &zfile->compressor;
+    return (0);
+
+err:
+    (void)zstd_file_terminate(&zfile->compressor, session);
+    return (ret);
+}
+
 /*
  *  zstd_init_context_pool --
  *	Initialize a given type of context pool.
@@ -419,7 +1116,8 @@ zstd_terminate(WT_COMPRESSOR *compressor, WT_SESSION *session)
  *     Handle zstd configuration.
  */
 static int
-zstd_init_config(WT_CONNECTION *connection, WT_CONFIG_ARG *config, int *compression_levelp)
+zstd_init_config(WT_CONNECTION *connection, WT_CONFIG_ARG *config, int *compression_levelp,
+  size_t *dict_sizep, uint32_t *dict_samplesp)
 {
     WT_CONFIG_ITEM v;
     WT_EXTENSION_API *wt_api;
@@ -435,13 +1133,39 @@ zstd_init_config(WT_CONNECTION *connection, WT_CONFIG_ARG *config, int *compress
     wt_api = connection->get_extension_api(connection);
     if ((ret = wt_api->config_get(wt_api, NULL, config, "compression_level", &v)) == 0)
         *compression_levelp = (int)v.val;
-    else if (ret != WT_NOTFOUND) {
-        (void)wt_api->err_printf(
-          wt_api, NULL, "zstd_init_config: %s", wt_api->strerror(wt_api, NULL, ret));
-        return (ret);
-    }
+    else if (ret != WT_NOTFOUND)
+        goto err;
+
+    /*
+     * Applications can have a dictionary trained for each file from samples of its pages, for
+     * better compression of small pages: review the dictionary size and the number of pages to
+     * sample.
+     */
+    if ((ret = wt_api->config_get(wt_api, NULL, config, "dictionary_size", &v)) == 0) {
+        if (v.val != 0 && (v.val < 1024 || v.val > 1024 * 1024)) {
+            (void)wt_api->err_printf(wt_api, NULL,
+              "zstd_init_config: dictionary_size must be 0, or between 1KB and 1MB");
+            return (EINVAL);
+        }
+        *dict_sizep = (size_t)v.val;
+    } else if (ret != WT_NOTFOUND)
+        goto err;
+    if ((ret = wt_api->config_get(wt_api, NULL, config, "dictionary_samples", &v)) == 0) {
+        if (v.val < 10 || v.val > 100 * 1000) {
+            (void)wt_api->err_printf(
+              wt_api, NULL, "zstd_init_config: dictionary_samples must be between 10 and 100000");
+            return (EINVAL);
+        }
+        *dict_samplesp = (uint32_t)v.val;
+    } else if (ret != WT_NOTFOUND)
+        goto err;
 
     return (0);
+
+err:
+    (void)wt_api->err_printf(
+      wt_api, NULL, "zstd_init_config: %s", wt_api->strerror(wt_api, NULL, ret));
+    return (ret);
 }
 
 int zstd_extension_init(WT_CONNECTION *, WT_CONFIG_ARG *);
@@ -455,6 +1179,8 @@ int
 zstd_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
 {
     ZSTD_COMPRESSOR *zstd_compressor;
+    size_t dict_size;
+    uint32_t dict_samples;
     int compression_level, ret;
 
     /*
@@ -482,7 +1208,10 @@ zstd_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
      * similar compression at much higher compression/decompression speeds.
      */
     compression_level = 6;
-    if ((ret = zstd_init_config(connection, config, &compression_level)) != 0)
+    dict_size = 0;
+    dict_samples = ZSTD_DICT_SAMPLES_DEFAULT;
+    if ((ret = zstd_init_config(
+           connection, config, &compression_level, &dict_size, &dict_samples)) != 0)
         return (ret);
 
     if ((zstd_compressor = calloc(1, sizeof(ZSTD_COMPRESSOR))) == NULL)
@@ -491,11 +1220,14 @@ zstd_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     zstd_compressor->compressor.compress = zstd_compress;
     zstd_compressor->compressor.decompress = zstd_decompress;
     zstd_compressor->compressor.pre_size = zstd_pre_size;
+    zstd_compressor->compressor.customize = zstd_customize;
     zstd_compressor->compressor.terminate = zstd_terminate;
 
     zstd_compressor->wt_api = connection->get_extension_api(connection);
 
     zstd_compressor->compression_level = compression_level;
+    zstd_compressor->dict_size = dict_size;
+    zstd_compressor->dict_samples = dict_samples;
 
     zstd_init_context_pool(
       zstd_compressor, CONTEXT_TYPE_COMPRESS, CONTEXT_POOL_SIZE, &(zstd_compressor->cctx_pool));
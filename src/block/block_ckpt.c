@@ -202,6 +202,7 @@ __wt_block_checkpoint_unload(WT_SESSION_IMPL *session, WT_BLOCK *block, bool che
         WT_TRET(__wti_block_truncate(session, block, block->size));
 
         __wt_spin_lock(session, &block->live_lock);
+        WT_TRET(__wti_block_arenas_drain(session, block));
         __wti_block_ckpt_destroy(session, &block->live);
         block->live_open = false;
         __wt_spin_unlock(session, &block->live_lock);
@@ -706,6 +707,12 @@ __ckpt_process(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckptbase)
      */
     __wt_spin_lock(session, &block->live_lock);
 
+    /*
+     * Return the allocation arenas' reserved space and freed blocks to the live system, the
+     * checkpoint's extent lists must account for them.
+     */
+    WT_ERR(__wti_block_arenas_drain(session, block));
+
     /*
      * We've allocated our last page, update the checkpoint size. We need to calculate the live
      * system's checkpoint size before merging checkpoint allocation and discard information from
@@ -615,6 +615,211 @@ append:
     return (0);
 }
 
+/*
+ * __block_arena_free_merge --
+ *     Merge an allocation arena's batch of freed blocks into the live checkpoint.
+ */
+static int
+__block_arena_free_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_ARENA *arena)
+{
+    WT_DECL_RET;
+    u_int i;
+
+    WT_ASSERT_SPINLOCK_OWNED(session, &block->live_lock);
+    WT_ASSERT_SPINLOCK_OWNED(session, &arena->lock);
+
+    for (i = 0; i < arena->free_entries; ++i)
+        WT_TRET(__wti_block_off_free(
+          session, block, block->objectid, arena->free[i].off, arena->free[i].size));
+    arena->free_entries = 0;
+    return (ret);
+}
+
+/*
+ * __block_arena_drain --
+ *     Return an allocation arena's reserved space and batch of freed blocks to the live checkpoint.
+ */
+static int
+__block_arena_drain(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_ARENA *arena)
+{
+    WT_DECL_RET;
+
+    /*
+     * The reserved space was allocated from the live checkpoint during this checkpoint, freeing it
+     * puts it back on the avail list.
+     */
+    if (arena->size != 0)
+        WT_TRET(__wti_block_off_free(session, block, block->objectid, arena->off, arena->size));
+    arena->off = arena->size = 0;
+
+    WT_TRET(__block_arena_free_merge(session, block, arena));
+    return (ret);
+}
+
+/*
+ * __wti_block_arenas_drain --
+ *     Return all of the allocation arenas' reserved space and batched frees to the live checkpoint.
+ */
+int
+__wti_block_arenas_drain(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+    WT_BLOCK_ARENA *arena;
+    WT_DECL_RET;
+    u_int i;
+
+    /* The live lock must be locked. */
+    WT_ASSERT_SPINLOCK_OWNED(session, &block->live_lock);
+
+    for (i = 0; i < block->arena_count; ++i) {
+        arena = &block->arenas[i];
+        __wt_spin_lock(session, &arena->lock);
+        WT_TRET(__block_arena_drain(session, block, arena));
+        __wt_spin_unlock(session, &arena->lock);
+    }
+    return (ret);
+}
+
+/*
+ * __block_arena_carve --
+ *     Carve a chunk of space from an allocation arena's reserved range.
+ */
+static WT_INLINE void
+__block_arena_carve(WT_SESSION_IMPL *session, WT_BLOCK_ARENA *arena, wt_off_t *offp, wt_off_t size)
+{
+    *offp = arena->off;
+    arena->off += size;
+    arena->size -= size;
+
+    WT_STAT_DSRC_INCR(session, block_arena_alloc);
+}
+
+/*
+ * __wti_block_arena_alloc --
+ *     Alloc a chunk of space from an allocation arena without locking the live checkpoint, return
+ *     false if the arena doesn't have enough space reserved.
+ */
+bool
+__wti_block_arena_alloc(
+  WT_SESSION_IMPL *session, WT_BLOCK_ARENA *arena, wt_off_t *offp, wt_off_t size)
+{
+    bool allocated;
+
+    /* If a sync is running, no other sessions can allocate blocks. */
+    WT_ASSERT(session, WT_SESSION_BTREE_SYNC_SAFE(session, S2BT(session)));
+
+    __wt_spin_lock(session, &arena->lock);
+    if ((allocated = arena->size >= size))
+        __block_arena_carve(session, arena, offp, size);
+    __wt_spin_unlock(session, &arena->lock);
+    return (allocated);
+}
+
+/*
+ * __wti_block_arena_refill --
+ *     Alloc a chunk of space for an allocation arena that doesn't have enough space reserved,
+ *     reserving a new range from the live checkpoint.
+ */
+int
+__wti_block_arena_refill(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_ARENA *arena, wt_off_t *offp, wt_off_t size)
+{
+    WT_DECL_RET;
+    WT_SIZE **sstack[WT_SKIP_MAXDEPTH], *szp;
+    wt_off_t chunk, off;
+
+    /* The live lock must be locked. */
+    WT_ASSERT_SPINLOCK_OWNED(session, &block->live_lock);
+
+    __wt_spin_lock(session, &arena->lock);
+
+    /* Another thread may have refilled the arena while we waited for the live lock. */
+    if (arena->size >= size) {
+        __block_arena_carve(session, arena, offp, size);
+        goto err;
+    }
+
+    /* Return the remainder of the arena's range and any freed blocks to the live checkpoint. */
+    WT_ERR(__block_arena_drain(session, block, arena));
+
+    /*
+     * Don't reserve space during compaction, its first-fit allocation is moving blocks to the
+     * beginning of the file.
+     */
+    if (block->allocfirst)
+        goto exact;
+
+    /*
+     * Reserve enough space for a number of blocks of the requested size, limited by the chunk size
+     * and by the size of the avail list's best-fit extent for the request: taking from the best-fit
+     * extent keeps allocation's preference for using the smallest suitable free space. If that
+     * extent is too small for the arena to serve more than a single allocation, allocate only the
+     * requested size from it. If the avail list has nothing large enough, the file is extended.
+     */
+    chunk = (wt_off_t)WT_ALIGN(WT_BLOCK_ARENA_CHUNK, block->allocsize);
+    chunk = WT_MIN(chunk, WT_BLOCK_ARENA_RESERVE * size);
+    if (block->live.avail.bytes >= (uint64_t)size) {
+        __block_size_srch(block->live.avail.sz, size, sstack);
+        if ((szp = *sstack[0]) != NULL) {
+            if (szp->size < 2 * size)
+                goto exact;
+            chunk = WT_MIN(chunk, szp->size);
+        }
+    }
+    if (chunk <= size) {
+exact:
+        ret = __wti_block_alloc(session, block, offp, size);
+        goto err;
+    }
+    WT_ERR(__wti_block_alloc(session, block, &off, chunk));
+    arena->off = off;
+    arena->size = chunk;
+    __block_arena_carve(session, arena, offp, size);
+
+err:
+    __wt_spin_unlock(session, &arena->lock);
+    return (ret);
+}
+
+/*
+ * __block_arena_free --
+ *     Free a chunk of space into an allocation arena's batch of freed blocks, merging the batch
+ *     into the live checkpoint when it's full.
+ */
+static int
+__block_arena_free(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_ARENA *arena, wt_off_t offset, wt_off_t size)
+{
+    WT_DECL_RET;
+
+    /* If a sync is running, no other sessions can free blocks. */
+    WT_ASSERT(session, WT_SESSION_BTREE_SYNC_SAFE(session, S2BT(session)));
+
+    __wt_spin_lock(session, &arena->lock);
+    if (arena->free_entries < WT_BLOCK_ARENA_FREE_MAX) {
+        arena->free[arena->free_entries].off = offset;
+        arena->free[arena->free_entries].size = size;
+        ++arena->free_entries;
+        __wt_spin_unlock(session, &arena->lock);
+
+        WT_STAT_DSRC_INCR(session, block_arena_free);
+        return (0);
+    }
+    __wt_spin_unlock(session, &arena->lock);
+
+    /*
+     * The batch is full, merge it and the freed block into the live checkpoint. The arena lock is
+     * acquired after the live lock, the same order as when the arena is refilled or drained.
+     */
+    WT_RET(__wti_block_ext_prealloc(session, 2 * WT_BLOCK_ARENA_FREE_MAX + 5));
+    __wt_spin_lock(session, &block->live_lock);
+    __wt_spin_lock(session, &arena->lock);
+    WT_TRET(__block_arena_free_merge(session, block, arena));
+    WT_TRET(__wti_block_off_free(session, block, block->objectid, offset, size));
+    __wt_spin_unlock(session, &arena->lock);
+    __wt_spin_unlock(session, &block->live_lock);
+    return (ret);
+}
+
 /*
  * __wt_block_free --
  *     Free a cookie-referenced chunk of space to the underlying file.
@@ -652,6 +857,11 @@ __wt_block_free(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint8_t *addr,
       session, block, "free", offset, size, true, __PRETTY_FUNCTION__, __LINE__));
 #endif
 
+    /* If configured, batch the free in the session's allocation arena. */
+    if (block->arena_count != 0)
+        return (__block_arena_free(session, block,
+          &block->arenas[session->id % block->arena_count], offset, (wt_off_t)size));
+
     WT_RET(__wti_block_ext_prealloc(session, 5));
     __wt_spin_lock(session, &block->live_lock);
     WT_TRET(__wti_block_off_free(session, block, objectid, offset, (wt_off_t)size));
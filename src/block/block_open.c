@@ -52,6 +52,25 @@ err:
     return (ret);
 }
 
+/*
+ * __block_direct_io_check --
+ *     Check a file's allocation size is compatible with direct I/O: reads and writes are allocation
+ *     size multiples at allocation size offsets, they must also be buffer alignment multiples.
+ */
+static int
+__block_direct_io_check(WT_SESSION_IMPL *session, WT_FH *fh, uint32_t allocsize)
+{
+    size_t alignment;
+
+    alignment = S2C(session)->buffer_alignment;
+    if (fh->direct_io && allocsize % alignment != 0)
+        WT_RET_MSG(session, EINVAL,
+          "%s: the allocation size of %" PRIu32 "B is not a multiple of the buffer alignment of %"
+          WT_SIZET_FMT "B required by direct I/O",
+          fh->name, allocsize, alignment);
+    return (0);
+}
+
 /*
  * __wt_block_manager_create --
  *     Create a file.
@@ -121,6 +140,7 @@ int
 __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
 {
     WT_DECL_RET;
+    u_int i;
 
     if (block == NULL) /* Safety check, if failed to initialize. */
         return (0);
@@ -137,6 +157,11 @@ __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
     __wt_spin_destroy(session, &block->live_lock);
     __wti_block_ckpt_destroy(session, &block->live);
 
+    if (block->arenas != NULL)
+        for (i = 0; i < block->arena_count; ++i)
+            __wt_spin_destroy(session, &block->arenas[i].lock);
+    __wt_free(session, block->arenas);
+
     __wt_overwrite_and_free(session, block);
 
     return (ret);
@@ -175,6 +200,7 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
     WT_DECL_RET;
     uint64_t bucket, hash;
     uint32_t flags;
+    u_int i;
 
     *blockp = NULL;
 
@@ -212,6 +238,10 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
     WT_ERR(__wt_config_gets(session, cfg, "block_allocation", &cval));
     block->allocfirst = WT_CONFIG_LIT_MATCH("first", cval) ? 1 : 0;
 
+    /* Configuration: optional allocation arenas. */
+    WT_ERR(__wt_config_gets(session, cfg, "block_allocation_arenas", &cval));
+    block->arena_count = (u_int)cval.val;
+
     /* Configuration: optional OS buffer cache maximum size. */
     WT_ERR(__wt_config_gets(session, cfg, "os_cache_max", &cval));
     block->os_cache_max = (size_t)cval.val;
@@ -244,6 +274,7 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
         block->readonly = true;
     }
     WT_ERR(__wt_open(session, filename, WT_FS_OPEN_FILE_TYPE_DATA, flags, &block->fh));
+    WT_ERR(__block_direct_io_check(session, block->fh, allocsize));
 
     /* Set the file's size. */
     WT_ERR(__wt_filesize(session, block->fh, &block->size));
@@ -258,6 +289,13 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename, uint32_t objecti
     /* Initialize the live checkpoint's lock. */
     WT_ERR(__wt_spin_init(session, &block->live_lock, "block manager"));
 
+    /* Initialize the allocation arenas. */
+    if (block->arena_count != 0) {
+        WT_ERR(__wt_calloc_def(session, block->arena_count, &block->arenas));
+        for (i = 0; i < block->arena_count; ++i)
+            WT_ERR(__wt_spin_init(session, &block->arenas[i].lock, "block allocation arena"));
+    }
+
     /*
      * Read the description information from the first block.
      *
@@ -297,6 +335,8 @@ __wti_desc_write(WT_SESSION_IMPL *session, WT_FH *fh, uint32_t allocsize)
     if (F_ISSET(S2C(session), WT_CONN_IN_MEMORY))
         return (0);
 
+    WT_RET(__block_direct_io_check(session, fh, allocsize));
+
     WT_RET(__wt_scr_alloc(session, allocsize, &buf));
     memset(buf->mem, 0, allocsize);
 
@@ -58,6 +58,68 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_bm_read_async --
+ *     Queue an asynchronous read of an address cookie referenced block into a pre-fetch slot. The
+ *     image is verified when it's consumed by a subsequent read of the same block. Returns ENOTSUP
+ *     for block managers that can't be read directly from their file handle.
+ */
+int
+__wt_bm_read_async(WT_BM *bm, WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_PREFETCH_READ *pr,
+  const uint8_t *addr, size_t addr_size, uint64_t user_data)
+{
+    WT_BLOCK *block;
+    wt_off_t offset;
+    uint32_t checksum, objectid, size;
+
+    block = bm->block;
+
+    /*
+     * Tiered and mapped objects have their own read paths, as do objects backed by the chunk
+     * cache. None of them benefit from asynchronous reads.
+     */
+    if (bm->is_multi_handle || bm->map != NULL ||
+      F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED))
+        return (__wt_set_return(session, ENOTSUP));
+
+    /* Crack the cookie. */
+    WT_RET(__wt_block_addr_unpack(
+      session, block, addr, addr_size, &objectid, &offset, &size, &checksum));
+    if (size < block->allocsize)
+        return (__wt_set_return(session, EINVAL));
+
+    WT_RET(__wt_buf_init_aligned(session, &pr->buf, size));
+    WT_RET(__wt_io_uring_read(session, ring, block->fh, offset, size, pr->buf.mem, user_data));
+
+    pr->block = block;
+    pr->offset = offset;
+    pr->size = size;
+    pr->inflight = true;
+    return (0);
+}
+
+/*
+ * __block_read_prefetched --
+ *     Copy a block read asynchronously by this pre-fetch thread into the caller's buffer.
+ */
+static bool
+__block_read_prefetched(
+  WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset, uint32_t size, void *buf)
+{
+    WT_PREFETCH_READ *pr;
+    uint32_t i;
+
+    for (i = 0, pr = session->pf.reads; i < session->pf.reads_count; ++i, ++pr)
+        if (pr->ready && pr->block == block && pr->offset == offset && pr->size == size) {
+            memcpy(buf, pr->buf.mem, size);
+            pr->ready = false;
+            --session->pf.reads_ready;
+            WT_STAT_CONN_INCR(session, prefetch_async_read_used);
+            return (true);
+        }
+    return (false);
+}
+
 /*
  * __bm_corrupt_dump --
  *     Dump a block into the log in 1KB chunks.
@@ -168,9 +230,9 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
     WT_BLOCK_HEADER *blk, swap;
     size_t bufsize, check_size;
     int failures, max_failures;
-    bool chunkcache_hit, full_checksum_mismatch;
+    bool chunkcache_hit, full_checksum_mismatch, prefetched;
 
-    chunkcache_hit = full_checksum_mismatch = false;
+    chunkcache_hit = full_checksum_mismatch = prefetched = false;
     check_size = 0;
     failures = 0;
     bufsize = size;
@@ -190,9 +252,21 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
           "%s: impossibly small block size of %" PRIu32 "B, less than allocation size of %" PRIu32,
           block->name, size, block->allocsize);
 
-    WT_RET(__wt_buf_init(session, buf, bufsize));
+    /* Page images are read directly into the buffer, allocate it aligned for direct I/O. */
+    WT_RET(__wt_buf_init_aligned(session, buf, bufsize));
     buf->size = size;
 
+    /*
+     * Pre-fetch threads read blocks asynchronously before bringing their pages into the cache. If
+     * the block is already here, check it like any other read, but if the checksum doesn't match,
+     * read it again before deciding it's corrupted.
+     */
+    if (session->pf.reads_ready != 0 &&
+      __block_read_prefetched(session, block, offset, size, buf->mem)) {
+        prefetched = true;
+        max_failures = 2;
+    }
+
     while (failures < max_failures) {
         full_checksum_mismatch = false;
         if (F_ISSET(&S2C(session)->chunkcache, WT_CHUNKCACHE_CONFIGURED)) {
@@ -209,7 +283,7 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
                   ENOSPC);
             }
         }
-        if (!chunkcache_hit || failures > 0) {
+        if ((!chunkcache_hit && !prefetched) || failures > 0) {
             __wt_capacity_throttle(session, size, WT_THROTTLE_READ);
             WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
         }
@@ -249,6 +323,13 @@ __wti_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, ui
          * immediately, so we will reload the data and retry one time.
          */
         if (failures < max_failures) {
+            if (prefetched) {
+                __wt_verbose(session, WT_VERB_BLOCK,
+                  "Reloading data due to checksum mismatch for block: %s, offset: %" PRIuMAX
+                  ", size: %" PRIu32 " read asynchronously by pre-fetch. Retrying once.",
+                  block->name, (uintmax_t)offset, size);
+                continue;
+            }
             __wt_verbose(session, WT_VERB_BLOCK,
               "Reloading data due to checksum mismatch for block: %s" PRIu32 ", offset: %" PRIuMAX
               ", size: %" PRIu32
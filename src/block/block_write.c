@@ -216,9 +216,12 @@ static int
 __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_off_t *offsetp,
   uint32_t *sizep, uint32_t *checksump, bool data_checksum, bool checkpoint_io, bool caller_locked)
 {
+    WT_BLOCK_ARENA *arena;
     WT_BLOCK_HEADER *blk;
+    WT_DECL_ITEM(tmp);
     WT_DECL_RET;
     WT_FH *fh;
+    WT_ITEM *write_buf;
     wt_off_t offset;
     size_t align_size;
     uint32_t checksum;
@@ -258,21 +261,32 @@ __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_of
     WT_RET(__wti_block_ext_prealloc(session, 5));
 
     /*
-     * Acquire a lock, if we don't already hold one. Allocate space for the write, and optionally
-     * extend the file (note the block-extend function may release the lock). Release any locally
-     * acquired lock.
+     * If configured and we don't already hold the live lock, allocate space for the write from the
+     * session's allocation arena, which only requires the arena's lock.
      */
-    local_locked = false;
-    if (!caller_locked) {
-        __wt_spin_lock(session, &block->live_lock);
-        local_locked = true;
+    arena = NULL;
+    if (!caller_locked && block->arena_count != 0)
+        arena = &block->arenas[session->id % block->arena_count];
+    if (arena == NULL || !__wti_block_arena_alloc(session, arena, &offset, (wt_off_t)align_size)) {
+        /*
+         * Acquire a lock, if we don't already hold one. Allocate space for the write (refilling the
+         * arena, if there is one), and optionally extend the file (note the block-extend function
+         * may release the lock). Release any locally acquired lock.
+         */
+        local_locked = false;
+        if (!caller_locked) {
+            __wt_spin_lock(session, &block->live_lock);
+            local_locked = true;
+        }
+        ret = arena == NULL ?
+          __wti_block_alloc(session, block, &offset, (wt_off_t)align_size) :
+          __wti_block_arena_refill(session, block, arena, &offset, (wt_off_t)align_size);
+        if (ret == 0)
+            ret = __block_extend(session, block, fh, offset, align_size, &local_locked);
+        if (local_locked)
+            __wt_spin_unlock(session, &block->live_lock);
+        WT_RET(ret);
     }
-    ret = __wti_block_alloc(session, block, &offset, (wt_off_t)align_size);
-    if (ret == 0)
-        ret = __block_extend(session, block, fh, offset, align_size, &local_locked);
-    if (local_locked)
-        __wt_spin_unlock(session, &block->live_lock);
-    WT_RET(ret);
 
     /*
      * The file has finished changing size. If this is the final write in a checkpoint, update the
@@ -321,8 +335,23 @@ __block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_of
     blk->checksum = __wt_bswap32(blk->checksum);
 #endif
 
+    /*
+     * Direct I/O requires an aligned buffer. Most write buffers are allocated aligned, copy any
+     * others into an aligned scratch buffer.
+     */
+    write_buf = buf;
+    if (fh->direct_io && !WT_PTR_ALIGNED(buf->mem, S2C(session)->buffer_alignment) &&
+      (ret = __wt_scr_alloc(session, align_size, &tmp)) == 0) {
+        memcpy(tmp->mem, buf->mem, align_size);
+        write_buf = tmp;
+        WT_STAT_CONN_INCR(session, block_write_aligned_copy);
+    }
+
     /* Write the block. */
-    if ((ret = __wt_write(session, fh, offset, align_size, buf->mem)) != 0) {
+    if (ret == 0)
+        ret = __wt_write(session, fh, offset, align_size, write_buf->mem);
+    __wt_scr_free(session, &tmp);
+    if (ret != 0) {
         if (!caller_locked)
             __wt_spin_lock(session, &block->live_lock);
         WT_TRET(
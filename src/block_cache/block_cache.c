@@ -140,6 +140,198 @@ __blkcache_high_overhead(WT_SESSION_IMPL *session)
     return (blkcache->lookups == 0 || ((ops * 100) / blkcache->lookups) > blkcache->overhead_pct);
 }
 
+/*
+ * __blkcache_sketch_key --
+ *     Return a block's key in the admission sketch: blocks with the same address cookie in
+ *     different files are different blocks.
+ */
+static WT_INLINE uint64_t
+__blkcache_sketch_key(uint64_t hash, uint32_t fid)
+{
+    return (hash ^ ((uint64_t)fid * 0x9e3779b97f4a7c15ULL));
+}
+
+/*
+ * __blkcache_sketch_counter --
+ *     Return a block's counter in a row of the admission sketch.
+ */
+static WT_INLINE uint8_t *
+__blkcache_sketch_counter(WT_BLKCACHE *blkcache, uint64_t key, u_int row)
+{
+    uint64_t h1, h2;
+
+    /* Derive a different counter position for each row from the two halves of the key. */
+    h1 = key;
+    h2 = (key >> 32) | 1;
+    return (&blkcache->sketch[row * blkcache->sketch_width +
+      ((h1 + row * h2) & (blkcache->sketch_width - 1))]);
+}
+
+/*
+ * __blkcache_sketch_estimate --
+ *     Estimate how often a block has been accessed.
+ */
+static uint8_t
+__blkcache_sketch_estimate(WT_BLKCACHE *blkcache, uint64_t key)
+{
+    u_int row;
+    uint8_t count, min;
+
+    for (min = WT_BLKCACHE_SKETCH_COUNTER_MAX, row = 0; row < WT_BLKCACHE_SKETCH_DEPTH; ++row)
+        if ((count = *__blkcache_sketch_counter(blkcache, key, row)) < min)
+            min = count;
+    return (min);
+}
+
+/*
+ * __blkcache_sketch_increment --
+ *     Record an access to a block in the admission sketch.
+ */
+static void
+__blkcache_sketch_increment(WT_SESSION_IMPL *session, uint64_t key)
+{
+    WT_BLKCACHE *blkcache;
+    u_int row;
+    uint64_t i;
+    uint8_t *counter, min;
+
+    blkcache = &S2C(session)->blkcache;
+
+    /*
+     * Only increment the block's smallest counters: the others are shared with more frequently
+     * accessed blocks and already overestimate the block's frequency.
+     */
+    if ((min = __blkcache_sketch_estimate(blkcache, key)) < WT_BLKCACHE_SKETCH_COUNTER_MAX)
+        for (row = 0; row < WT_BLKCACHE_SKETCH_DEPTH; ++row)
+            if (*(counter = __blkcache_sketch_counter(blkcache, key, row)) == min)
+                ++*counter;
+
+    /*
+     * Periodically halve all of the counters, so blocks that were accessed frequently in the past
+     * but no longer are don't keep more recently accessed blocks out of the cache.
+     */
+    if (__wt_atomic_add64(&blkcache->sketch_accesses, 1) % blkcache->sketch_age_accesses == 0) {
+        for (i = 0; i < WT_BLKCACHE_SKETCH_DEPTH * blkcache->sketch_width; ++i)
+            blkcache->sketch[i] >>= 1;
+        WT_STAT_CONN_INCR(session, block_cache_admission_sketch_resets);
+    }
+}
+
+/*
+ * __blkcache_evict_item --
+ *     Evict a block from the cache. The block's bucket must be locked.
+ */
+static void
+__blkcache_evict_item(WT_SESSION_IMPL *session, uint64_t bucket, WT_BLKCACHE_ITEM *blkcache_item)
+{
+    WT_BLKCACHE *blkcache;
+
+    blkcache = &S2C(session)->blkcache;
+
+    TAILQ_REMOVE(&blkcache->hash[bucket], blkcache_item, hashq);
+    __blkcache_free(session, blkcache_item->data);
+    __blkcache_update_ref_histogram(session, blkcache_item, WT_BLKCACHE_RM_EVICTION);
+    (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
+
+    /*
+     * Update the number of removals because it is used to estimate the overhead, and we want the
+     * overhead contributed by eviction to be part of that calculation.
+     */
+    blkcache->removals++;
+
+    WT_STAT_CONN_INCR(session, block_cache_blocks_evicted);
+    WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
+    WT_STAT_CONN_DECR(session, block_cache_blocks);
+    __wt_free(session, blkcache_item);
+}
+
+/*
+ * __blkcache_admission_victim --
+ *     Return the least frequently accessed unused block in a bucket. The bucket must be locked.
+ */
+static WT_BLKCACHE_ITEM *
+__blkcache_admission_victim(WT_BLKCACHE *blkcache, uint64_t bucket, uint8_t *freqp, u_int *countp)
+{
+    WT_BLKCACHE_ITEM *blkcache_item, *victim;
+    uint8_t freq;
+
+    victim = NULL;
+    TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq) {
+        /* Blocks in use cannot be evicted. */
+        if (blkcache_item->ref_count != 0)
+            continue;
+        ++*countp;
+        freq = __blkcache_sketch_estimate(blkcache,
+          __blkcache_sketch_key(
+            __wt_hash_city64(blkcache_item->addr, blkcache_item->addr_size), blkcache_item->fid));
+        if (victim == NULL || freq < *freqp) {
+            victim = blkcache_item;
+            *freqp = freq;
+        }
+    }
+    return (victim);
+}
+
+/*
+ * __blkcache_admit --
+ *     Decide if a block read into a full cache is admitted. With the TinyLFU policy, the block
+ *     replaces a sample's least frequently accessed block, if that block has been accessed less
+ *     often than the new one. A scan reads blocks once, so it can't flush the blocks being reused
+ *     from the cache.
+ */
+static bool
+__blkcache_admit(WT_SESSION_IMPL *session, uint64_t bucket, uint64_t key)
+{
+    WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_ITEM *victim;
+    uint64_t b, victim_bucket;
+    u_int count, i;
+    uint8_t bucket_freq, freq, victim_freq;
+
+    blkcache = &S2C(session)->blkcache;
+    freq = __blkcache_sketch_estimate(blkcache, key);
+
+    /*
+     * Sample the blocks in the buckets following the block's own bucket. Skip empty buckets without
+     * locking them, and don't wait for locked buckets: the sample doesn't have to be exact.
+     */
+    victim_bucket = bucket;
+    victim_freq = WT_BLKCACHE_SKETCH_COUNTER_MAX + 1;
+    for (count = i = 0;
+         i < WT_BLKCACHE_ADMISSION_BUCKETS_MAX && count < WT_BLKCACHE_ADMISSION_SAMPLE; ++i) {
+        b = (bucket + i) % blkcache->hash_size;
+        if (TAILQ_EMPTY(&blkcache->hash[b]) ||
+          __wt_spin_trylock(session, &blkcache->hash_locks[b]) != 0)
+            continue;
+        if (__blkcache_admission_victim(blkcache, b, &bucket_freq, &count) != NULL &&
+          bucket_freq < victim_freq) {
+            victim_bucket = b;
+            victim_freq = bucket_freq;
+        }
+        __wt_spin_unlock(session, &blkcache->hash_locks[b]);
+    }
+
+    /*
+     * Evict the victim if it has been accessed less often than the new block. The bucket was
+     * unlocked, find the bucket's victim again.
+     */
+    if (victim_freq < freq) {
+        __wt_spin_lock(session, &blkcache->hash_locks[victim_bucket]);
+        count = 0;
+        victim = __blkcache_admission_victim(blkcache, victim_bucket, &victim_freq, &count);
+        if (victim != NULL && victim_freq < freq) {
+            __blkcache_evict_item(session, victim_bucket, victim);
+            __wt_spin_unlock(session, &blkcache->hash_locks[victim_bucket]);
+            WT_STAT_CONN_INCR(session, block_cache_admission_accepted);
+            return (true);
+        }
+        __wt_spin_unlock(session, &blkcache->hash_locks[victim_bucket]);
+    }
+
+    WT_STAT_CONN_INCR(session, block_cache_admission_rejected);
+    return (false);
+}
+
 /*
  * __blkcache_should_evict --
  *     Decide if the block should be evicted.
@@ -242,25 +434,9 @@ __blkcache_eviction_thread(void *arg)
             __wt_spin_lock(session, &blkcache->hash_locks[i]);
             TAILQ_FOREACH_SAFE(blkcache_item, &blkcache->hash[i], hashq, blkcache_item_tmp)
             {
-                if (__blkcache_should_evict(session, blkcache_item, &reason)) {
-                    TAILQ_REMOVE(&blkcache->hash[i], blkcache_item, hashq);
-                    __blkcache_free(session, blkcache_item->data);
-                    __blkcache_update_ref_histogram(
-                      session, blkcache_item, WT_BLKCACHE_RM_EVICTION);
-                    (void)__wt_atomic_sub64(&blkcache->bytes_used, blkcache_item->data_size);
-
-                    /*
-                     * Update the number of removals because it is used to estimate the overhead,
-                     * and we want the overhead contributed by eviction to be part of that
-                     * calculation.
-                     */
-                    blkcache->removals++;
-
-                    WT_STAT_CONN_INCR(session, block_cache_blocks_evicted);
-                    WT_STAT_CONN_DECRV(session, block_cache_bytes, blkcache_item->data_size);
-                    WT_STAT_CONN_DECR(session, block_cache_blocks);
-                    __wt_free(session, blkcache_item);
-                } else {
+                if (__blkcache_should_evict(session, blkcache_item, &reason))
+                    __blkcache_evict_item(session, (uint64_t)i, blkcache_item);
+                else {
                     blkcache_item->freq_rec_counter--;
                     if (reason != WT_BLKCACHE_NOT_EVICTION_CANDIDATE)
                         no_eviction_candidates = false;
@@ -357,6 +533,11 @@ __wti_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_si
 
     hash = __wt_hash_city64(addr, addr_size);
     bucket = hash % blkcache->hash_size;
+
+    /* The TinyLFU policy tracks how often blocks are accessed, whether they're cached or not. */
+    if (blkcache->policy == WT_BLKCACHE_POLICY_TINYLFU)
+        __blkcache_sketch_increment(session, __blkcache_sketch_key(hash, S2BT(session)->id));
+
     __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
     TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq) {
         if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
@@ -401,10 +582,6 @@ __wti_blkcache_put(
     blkcache = &S2C(session)->blkcache;
     blkcache_store = NULL;
 
-    /* Are we within cache size limits? */
-    if (blkcache->bytes_used > blkcache->max_bytes)
-        return (0);
-
     /*
      * An NVRAM cache is slower than retrieving the block from the OS buffer cache, a DRAM cache is
      * faster than the OS buffer cache. In the case of NVRAM, if more than the configured fraction
@@ -423,6 +600,22 @@ __wti_blkcache_put(
         return (0);
     }
 
+    hash = __wt_hash_city64(addr, addr_size);
+    bucket = hash % blkcache->hash_size;
+
+    /*
+     * With the TinyLFU policy, a block read into a full cache must replace a less frequently
+     * accessed block. Blocks being written haven't been accessed, and are cached as configured.
+     */
+    if (blkcache->policy == WT_BLKCACHE_POLICY_TINYLFU && !write &&
+      blkcache->bytes_used + data->size > blkcache->full_target &&
+      !__blkcache_admit(session, bucket, __blkcache_sketch_key(hash, S2BT(session)->id)))
+        return (0);
+
+    /* Are we within cache size limits? */
+    if (blkcache->bytes_used > blkcache->max_bytes)
+        return (0);
+
     /*
      * Allocate and initialize space in the cache outside of the critical section. In the unlikely
      * event that we fail an allocation, free the space. NVRAM allocations can fail if there's no
@@ -439,8 +632,6 @@ __wti_blkcache_put(
     blkcache_store->addr_size = (uint8_t)addr_size;
     memcpy(blkcache_store->addr, addr, addr_size);
 
-    hash = __wt_hash_city64(addr, addr_size);
-    bucket = hash % blkcache->hash_size;
     __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
 
     /*
@@ -556,7 +747,8 @@ __wti_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
 static int
 __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_int type,
   char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache, bool cache_on_writes,
-  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint)
+  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint,
+  u_int policy)
 {
     WT_BLKCACHE *blkcache;
     WT_DECL_RET;
@@ -570,6 +762,7 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
     blkcache->full_target = full_target;
     blkcache->max_bytes = cache_size;
     blkcache->overhead_pct = overhead_pct;
+    blkcache->policy = policy;
     blkcache->system_ram = system_ram;
 
     if (type == WT_BLKCACHE_NVRAM) {
@@ -594,6 +787,18 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
         WT_RET(__wt_spin_init(session, &blkcache->hash_locks[i], "block cache bucket locks"));
     }
 
+    /* Size the admission sketch for the cache. */
+    if (policy == WT_BLKCACHE_POLICY_TINYLFU) {
+        for (blkcache->sketch_width = WT_BLKCACHE_SKETCH_WIDTH_MIN;
+             blkcache->sketch_width < cache_size / WT_BLKCACHE_SKETCH_BYTES_PER_COUNTER &&
+             blkcache->sketch_width < WT_BLKCACHE_SKETCH_WIDTH_MAX;
+             blkcache->sketch_width <<= 1)
+            ;
+        blkcache->sketch_age_accesses = WT_BLKCACHE_SKETCH_AGE_FACTOR * blkcache->sketch_width;
+        WT_RET(__wt_calloc_def(
+          session, WT_BLKCACHE_SKETCH_DEPTH * blkcache->sketch_width, &blkcache->sketch));
+    }
+
     /* Create the eviction thread */
     WT_RET(__wt_thread_create(
       session, &blkcache->evict_thread_tid, __blkcache_eviction_thread, (void *)session));
@@ -603,11 +808,12 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
     blkcache->type = type;
 
     __wt_verbose(session, WT_VERB_BLKCACHE,
-      "block cache initialized: type=%s, size=%" WT_SIZET_FMT " path=%s",
+      "block cache initialized: type=%s, size=%" WT_SIZET_FMT " path=%s policy=%s",
       (type == WT_BLKCACHE_NVRAM)  ? "nvram" :
         (type == WT_BLKCACHE_DRAM) ? "dram" :
                                      "unconfigured",
-      cache_size, (blkcache->nvram_device_path == NULL) ? "--" : blkcache->nvram_device_path);
+      cache_size, (blkcache->nvram_device_path == NULL) ? "--" : blkcache->nvram_device_path,
+      policy == WT_BLKCACHE_POLICY_TINYLFU ? "tinylfu" : "frequency");
 
     return (ret);
 }
@@ -676,6 +882,7 @@ __wt_blkcache_destroy(WT_SESSION_IMPL *session)
 #endif
     __wt_free(session, blkcache->hash);
     __wt_free(session, blkcache->hash_locks);
+    __wt_free(session, blkcache->sketch);
     /*
      * Zeroing the structure has the effect of setting the block cache type to unconfigured.
      */
@@ -691,7 +898,7 @@ static int
 __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size, size_t hash_size,
   u_int type, char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache,
   bool cache_on_writes, u_int overhead_pct, u_int evict_aggressive, uint64_t full_target,
-  bool cache_on_checkpoint)
+  bool cache_on_checkpoint, u_int policy)
 {
     WT_BLKCACHE *blkcache;
 
@@ -704,7 +911,8 @@ __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size,
       blkcache->cache_on_writes != cache_on_writes || blkcache->hash_size != hash_size ||
       blkcache->percent_file_in_os_cache != percent_file_in_os_cache ||
       blkcache->full_target != full_target || blkcache->max_bytes != cache_size ||
-      blkcache->overhead_pct != overhead_pct || blkcache->system_ram != system_ram ||
+      blkcache->overhead_pct != overhead_pct || blkcache->policy != policy ||
+      blkcache->system_ram != system_ram ||
       blkcache->evict_aggressive != -((int)evict_aggressive) || blkcache->type != type ||
       (nvram_device_path != NULL && blkcache->nvram_device_path == NULL) ||
       (nvram_device_path == NULL && blkcache->nvram_device_path != NULL) ||
@@ -774,7 +982,7 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_CONFIG_ITEM cval;
     WT_DECL_RET;
     uint64_t cache_size, full_target, system_ram;
-    u_int cache_type, evict_aggressive, hash_size, overhead_pct, percent_file_in_os_cache;
+    u_int cache_type, evict_aggressive, hash_size, overhead_pct, percent_file_in_os_cache, policy;
     char *nvram_device_path;
     bool cache_on_checkpoint, cache_on_writes;
 
@@ -846,11 +1054,17 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_RET(__wt_config_gets(session, cfg, "block_cache.max_percent_overhead", &cval));
     overhead_pct = (u_int)cval.val;
 
+    WT_RET(__wt_config_gets(session, cfg, "block_cache.policy", &cval));
+    if (WT_CONFIG_LIT_MATCH("tinylfu", cval))
+        policy = WT_BLKCACHE_POLICY_TINYLFU;
+    else
+        policy = WT_BLKCACHE_POLICY_FREQUENCY;
+
     WT_RET(__blkcache_reconfig(session, reconfig, cache_size, hash_size, cache_type,
       nvram_device_path, system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct,
-      evict_aggressive, full_target, cache_on_checkpoint));
+      evict_aggressive, full_target, cache_on_checkpoint, policy));
 
     return (__blkcache_init(session, cache_size, hash_size, cache_type, nvram_device_path,
       system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct, evict_aggressive,
-      full_target, cache_on_checkpoint));
+      full_target, cache_on_checkpoint, policy));
 }
@@ -259,7 +259,7 @@ __insert_update_stats(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
     WT_STAT_CONN_INCR(session, chunkcache_chunks_inuse);
     WT_STAT_CONN_INCRV(session, chunkcache_bytes_inuse, chunk->chunk_size);
     if (__name_in_pinned_list(session, chunk->hash_id.objectname)) {
-        F_SET(chunk, WT_CHUNK_PINNED);
+        F_SET_ATOMIC_8(chunk, WT_CHUNK_PINNED);
         WT_STAT_CONN_INCR(session, chunkcache_chunks_pinned);
         WT_STAT_CONN_INCRV(session, chunkcache_bytes_inuse_pinned, chunk->chunk_size);
     }
@@ -279,7 +279,7 @@ __delete_update_stats(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
     __wt_atomic_sub64(&chunkcache->bytes_used, chunk->chunk_size);
     WT_STAT_CONN_DECR(session, chunkcache_chunks_inuse);
     WT_STAT_CONN_DECRV(session, chunkcache_bytes_inuse, chunk->chunk_size);
-    if (F_ISSET(chunk, WT_CHUNK_PINNED)) {
+    if (F_ISSET_ATOMIC_8(chunk, WT_CHUNK_PINNED)) {
         WT_STAT_CONN_DECR(session, chunkcache_chunks_pinned);
         WT_STAT_CONN_DECRV(session, chunkcache_bytes_inuse_pinned, chunk->chunk_size);
     }
@@ -462,19 +462,45 @@ __chunkcache_free_chunk(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
     if (chunkcache->type == WT_CHUNKCACHE_IN_VOLATILE_MEMORY)
         __wt_free(session, chunk->chunk_memory);
     else {
-        /*
-         * Push the removal into the work queue so it can get removed from the chunk cache metadata.
-         */
-        WT_IGNORE_RET(__chunkcache_metadata_queue_delete(session, chunk));
-
         /* Update the bitmap, then free the chunk memory. */
         index = (size_t)(chunk->chunk_memory - chunkcache->memory) / chunkcache->chunk_size;
         __chunkcache_bitmap_free(session, index);
     }
 
+    __wt_free(session, chunk->hash_id.objectname);
     __wt_free(session, chunk);
 }
 
+/*
+ * __chunkcache_retired_discard --
+ *     Free the retired chunks no lookup can still be reading. When the chunk cache is torn down
+ *     there are no lookups, free all of them.
+ */
+static void
+__chunkcache_retired_discard(WT_SESSION_IMPL *session, bool final)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_CHUNK *chunk;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    __wt_spin_lock(session, &chunkcache->retired_lock);
+
+    /* Chunks are retired in generation order: if the newest can be freed, all of them can. */
+    if ((chunk = TAILQ_LAST(&chunkcache->retired, __wt_chunkcache_retired_head)) != NULL &&
+      !__wt_gen_active(session, WT_GEN_CHUNKCACHE, chunk->retire_gen))
+        final = true;
+
+    while ((chunk = TAILQ_FIRST(&chunkcache->retired)) != NULL) {
+        if (!final && __wt_gen_active(session, WT_GEN_CHUNKCACHE, chunk->retire_gen))
+            break;
+        TAILQ_REMOVE(&chunkcache->retired, chunk, next_retired);
+        __chunkcache_free_chunk(session, chunk);
+    }
+
+    __wt_spin_unlock(session, &chunkcache->retired_lock);
+}
+
 /*
  * __chunkcache_tmp_hash --
  *     Populate the hash data structure, which uniquely identifies the chunk. The hash ID we
@@ -527,6 +553,79 @@ __hash_id_eq(WT_CHUNKCACHE_HASHID *a, WT_CHUNKCACHE_HASHID *b)
       strcmp(a->objectname, b->objectname) == 0);
 }
 
+/*
+ * __chunkcache_bucket_find --
+ *     Find a chunk in its bucket. The caller either holds the bucket lock or is in the chunk cache
+ *     generation: chunks are only published once they are linked into the chain, and the links of
+ *     a removed chunk stay valid until it is freed.
+ */
+static WT_INLINE WT_CHUNKCACHE_CHUNK *
+__chunkcache_bucket_find(
+  WT_CHUNKCACHE *chunkcache, uint64_t bucket_id, WT_CHUNKCACHE_HASHID *hash_id)
+{
+    WT_CHUNKCACHE_CHUNK *chunk;
+
+    WT_ACQUIRE_READ(chunk, TAILQ_FIRST(WT_BUCKET_CHUNKS(chunkcache, bucket_id)));
+    while (chunk != NULL && !__hash_id_eq(&chunk->hash_id, hash_id))
+        WT_ACQUIRE_READ(chunk, TAILQ_NEXT(chunk, next_chunk));
+    return (chunk);
+}
+
+/*
+ * __chunkcache_bucket_insert --
+ *     Insert a chunk at the head of its bucket. Lookups walk the bucket without the lock: link the
+ *     chunk to the rest of the chain before publishing it.
+ */
+static WT_INLINE void
+__chunkcache_bucket_insert(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
+{
+    struct __wt_chunkchain_head *head;
+    WT_CHUNKCACHE *chunkcache;
+
+    chunkcache = &S2C(session)->chunkcache;
+    head = WT_BUCKET_CHUNKS(chunkcache, chunk->bucket_id);
+
+    WT_ASSERT_SPINLOCK_OWNED(session, WT_BUCKET_LOCK(chunkcache, chunk->bucket_id));
+
+    if ((TAILQ_NEXT(chunk, next_chunk) = TAILQ_FIRST(head)) != NULL)
+        TAILQ_FIRST(head)->next_chunk.tqe_prev = &TAILQ_NEXT(chunk, next_chunk);
+    else
+        head->tqh_last = &TAILQ_NEXT(chunk, next_chunk);
+    chunk->next_chunk.tqe_prev = &TAILQ_FIRST(head);
+    WT_RELEASE_WRITE(TAILQ_FIRST(head), chunk);
+}
+
+/*
+ * __chunkcache_remove_chunk --
+ *     Remove a chunk from its bucket and retire it: lookups may still be reading it, it's freed
+ *     once they have drained.
+ */
+static void
+__chunkcache_remove_chunk(WT_SESSION_IMPL *session, WT_CHUNKCACHE_CHUNK *chunk)
+{
+    WT_CHUNKCACHE *chunkcache;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    WT_ASSERT_SPINLOCK_OWNED(session, WT_BUCKET_LOCK(chunkcache, chunk->bucket_id));
+
+    TAILQ_REMOVE(WT_BUCKET_CHUNKS(chunkcache, chunk->bucket_id), chunk, next_chunk);
+    __delete_update_stats(session, chunk);
+
+    /* Push the removal into the work queue so it can get removed from the chunk cache metadata. */
+    if (chunkcache->type == WT_CHUNKCACHE_FILE)
+        WT_IGNORE_RET(__chunkcache_metadata_queue_delete(session, chunk));
+
+    /*
+     * Lookups that started before the generation switch may have found the chunk, lookups starting
+     * after it can't.
+     */
+    __wt_spin_lock(session, &chunkcache->retired_lock);
+    __wt_gen_next(session, WT_GEN_CHUNKCACHE, &chunk->retire_gen);
+    TAILQ_INSERT_TAIL(&chunkcache->retired, chunk, next_retired);
+    __wt_spin_unlock(session, &chunkcache->retired_lock);
+}
+
 /*
  * __chunkcache_should_evict --
  *     Decide if we can evict this chunk.
@@ -551,7 +650,7 @@ __chunkcache_should_evict(WT_CHUNKCACHE_CHUNK *chunk)
     if (!valid)
         return (false);
 
-    if (F_ISSET(chunk, WT_CHUNK_PINNED))
+    if (F_ISSET_ATOMIC_8(chunk, WT_CHUNK_PINNED))
         return (false);
 
     if (chunk->access_count == 0)
@@ -579,6 +678,8 @@ __chunkcache_eviction_thread(void *arg)
     chunkcache = &S2C(session)->chunkcache;
 
     while (!F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING)) {
+        __chunkcache_retired_discard(session, false);
+
         /* Do not evict if we are not close to exceeding capacity. */
         if ((chunkcache->bytes_used + chunkcache->chunk_size) <
           chunkcache->evict_trigger * chunkcache->capacity / 100) {
@@ -590,9 +691,7 @@ __chunkcache_eviction_thread(void *arg)
             TAILQ_FOREACH_SAFE(chunk, WT_BUCKET_CHUNKS(chunkcache, i), next_chunk, chunk_tmp)
             {
                 if (__chunkcache_should_evict(chunk)) {
-                    TAILQ_REMOVE(WT_BUCKET_CHUNKS(chunkcache, i), chunk, next_chunk);
-                    __delete_update_stats(session, chunk);
-                    __chunkcache_free_chunk(session, chunk);
+                    __chunkcache_remove_chunk(session, chunk);
                     WT_STAT_CONN_INCR(session, chunkcache_chunks_evicted);
                     __wt_verbose(session, WT_VERB_CHUNKCACHE,
                       "evicted chunk: %s(%u), offset=%" PRId64 ", size=%" PRIu64,
@@ -699,9 +798,7 @@ static int
 __chunkcache_insert(WT_SESSION_IMPL *session, wt_off_t offset, wt_off_t size,
   WT_CHUNKCACHE_HASHID *hash_id, uint64_t bucket_id, WT_CHUNKCACHE_CHUNK **new_chunk)
 {
-    WT_CHUNKCACHE *chunkcache;
-
-    chunkcache = &S2C(session)->chunkcache;
+    WT_UNUSED(bucket_id);
 
     /*
      * !!! (Don't format the comment.)
@@ -713,7 +810,8 @@ __chunkcache_insert(WT_SESSION_IMPL *session, wt_off_t offset, wt_off_t size,
      * Insert the invalid chunk into the bucket before releasing the lock and doing I/O. This way we
      * avoid two threads trying to cache the same chunk.
      */
-    TAILQ_INSERT_HEAD(WT_BUCKET_CHUNKS(chunkcache, bucket_id), *new_chunk, next_chunk);
+    WT_ASSERT(session, (*new_chunk)->bucket_id == bucket_id);
+    __chunkcache_bucket_insert(session, *new_chunk);
 
     return (0);
 }
@@ -740,10 +838,8 @@ __chunkcache_read_into_chunk(
     if ((ret = __wt_read(session, fh, new_chunk->chunk_offset, new_chunk->chunk_size,
            new_chunk->chunk_memory)) != 0) {
         __wt_spin_lock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
-        TAILQ_REMOVE(WT_BUCKET_CHUNKS(chunkcache, bucket_id), new_chunk, next_chunk);
+        __chunkcache_remove_chunk(session, new_chunk);
         __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
-        __delete_update_stats(session, new_chunk);
-        __chunkcache_free_chunk(session, new_chunk);
         WT_STAT_CONN_INCR(session, chunkcache_io_failed);
         return (ret);
     }
@@ -788,7 +884,7 @@ __chunkcache_unpin_old_versions(WT_SESSION_IMPL *session, const char *sp_obj_nam
             TAILQ_FOREACH_SAFE(chunk, WT_BUCKET_CHUNKS(chunkcache, i), next_chunk, chunk_tmp)
             {
                 if (strcmp(chunk->hash_id.objectname, sp_obj_name) == 0) {
-                    if (F_ISSET(chunk, WT_CHUNK_PINNED)) {
+                    if (F_ISSET_ATOMIC_8(chunk, WT_CHUNK_PINNED)) {
                         /*
                          * Decrement the stat when a chunk that was initially pinned becomes
                          * unpinned.
@@ -797,7 +893,7 @@ __chunkcache_unpin_old_versions(WT_SESSION_IMPL *session, const char *sp_obj_nam
                         WT_STAT_CONN_DECRV(
                           session, chunkcache_bytes_inuse_pinned, chunk->chunk_size);
                     }
-                    F_CLR(chunk, WT_CHUNK_PINNED);
+                    F_CLR_ATOMIC_8(chunk, WT_CHUNK_PINNED);
                 }
             }
             __wt_spin_unlock(session, &chunkcache->hashtable[i].bucket_lock);
@@ -809,18 +905,20 @@ __chunkcache_unpin_old_versions(WT_SESSION_IMPL *session, const char *sp_obj_nam
  * __wt_chunkcache_get --
  *     Return the data to the caller if we have it. Otherwise read it from storage and cache it.
  *
- * During these operations we are holding one or more bucket locks. A bucket lock protects the
- *     linked list (i.e., the chain) or chunks hashing into the same bucket. We hold the bucket lock
- *     whenever we are looking for and are inserting a new chunk into that bucket. We must hold the
- *     lock throughout the entire operation: realizing that the chunk is not present, deciding to
- *     cache it, allocating the chunks metadata and inserting it into the chain. If we release the
- *     lock during this process, another thread might cache the same chunk; we do not want that. We
- *     insert the new chunk into the cache in the not valid state. Once we insert the chunk, we can
- *     release the lock. As long as the chunk is marked as invalid, no other thread will try to
- *     re-cache it or to read it. As a result, we can read data from the remote storage into this
- *     chunk without holding the lock: this is what the current code does. We can even allocate the
- *     space for that chunk outside the critical section: the current code does not do that. Once we
- *     read the data into the chunk, we atomically set the valid flag, so other threads can use it.
+ * Lookups don't take the bucket lock, they walk the bucket's chain in the chunk cache
+ *     generation, which keeps chunks removed from the chain from being freed while the lookup may
+ *     be reading them. A bucket lock protects the linked list (i.e., the chain) of chunks hashing
+ *     into the same bucket against concurrent changes. If the lookup doesn't find the chunk, we
+ *     take the bucket lock and hold it throughout the entire operation: realizing that the chunk is
+ *     not present, deciding to cache it, allocating the chunks metadata and inserting it into the
+ *     chain. If we release the lock during this process, another thread might cache the same
+ *     chunk; we do not want that. We insert the new chunk into the cache in the not valid state.
+ *     Once we insert the chunk, we can release the lock. As long as the chunk is marked as invalid,
+ *     no other thread will try to re-cache it or to read it. As a result, we can read data from the
+ *     remote storage into this chunk without holding the lock: this is what the current code does.
+ *     We can even allocate the space for that chunk outside the critical section: the current code
+ *     does not do that. Once we read the data into the chunk, we atomically set the valid flag, so
+ *     other threads can use it.
  */
 int
 __wt_chunkcache_get(WT_SESSION_IMPL *session, WT_BLOCK *block, uint32_t objectid, wt_off_t offset,
@@ -833,7 +931,7 @@ __wt_chunkcache_get(WT_SESSION_IMPL *session, WT_BLOCK *block, uint32_t objectid
     size_t already_read, readable_in_chunk, remains_to_read, size_copied;
     uint64_t bucket_id, retries, sleep_usec;
     const char *object_name;
-    bool chunk_cached, valid;
+    bool valid;
 
     chunkcache = &S2C(session)->chunkcache;
     already_read = 0;
@@ -863,78 +961,84 @@ __wt_chunkcache_get(WT_SESSION_IMPL *session, WT_BLOCK *block, uint32_t objectid
         bucket_id = __chunkcache_tmp_hash(
           chunkcache, &hash_id, object_name, objectid, offset + (wt_off_t)already_read);
 retry:
-        chunk_cached = false;
-        __wt_spin_lock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
-        TAILQ_FOREACH (chunk, WT_BUCKET_CHUNKS(chunkcache, bucket_id), next_chunk) {
-            if (__hash_id_eq(&chunk->hash_id, &hash_id)) {
-                /* If the chunk is there, but invalid, there is I/O in progress. Retry. */
-                WT_ACQUIRE_READ_WITH_BARRIER(valid, chunk->valid);
-                if (!valid) {
-                    __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
-                    __wt_spin_backoff(&retries, &sleep_usec);
-                    WT_STAT_CONN_INCR(session, chunkcache_retries);
-                    if (retries > WT_CHUNKCACHE_MAX_RETRIES)
-                        WT_STAT_CONN_INCR(session, chunkcache_toomany_retries);
-                    goto retry;
-                }
-                /* Found the needed chunk. */
-                chunk_cached = true;
-                WT_ASSERT(session,
-                  WT_BLOCK_OVERLAPS_CHUNK(chunk->chunk_offset, offset + (wt_off_t)already_read,
-                    chunk->chunk_size, remains_to_read));
-
-                /* We can't read beyond the chunk's boundary. */
-                readable_in_chunk =
-                  (size_t)chunk->chunk_offset + chunk->chunk_size - (size_t)offset;
-                size_copied = WT_MIN(readable_in_chunk, remains_to_read);
-
-                /* Accessing this chunk's data is likely to cause a disk read - throttle. */
-                if (F_ISSET(chunk, WT_CHUNK_FROM_METADATA)) {
-                    __wt_capacity_throttle(session, size_copied, WT_THROTTLE_CHUNKCACHE);
-                    F_CLR(chunk, WT_CHUNK_FROM_METADATA);
-                }
-
-                /* Move the chunk's data to the user. */
-                memcpy((void *)((uint64_t)dst + already_read),
-                  chunk->chunk_memory + (offset + (wt_off_t)already_read - chunk->chunk_offset),
-                  size_copied);
-
-                /*
-                 * Increment the access count for eviction. If we are accessing the new chunk, the
-                 * access count would have been incremented on it when it was newly inserted to
-                 * avoid eviction before the chunk is accessed. So we are giving two access counts
-                 * to newly inserted chunks. Additionally, cap the access count to optimize the
-                 * eviction process. This capping helps particularly in focusing on evicting older
-                 * and potentially obsolete chunks, while retaining the more recently accessed ones.
-                 */
-                if (chunk->access_count < WT_CHUNK_ACCESS_CAP_LIMIT)
-                    chunk->access_count++;
-
-                __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
-
-                if (already_read > 0)
-                    WT_STAT_CONN_INCR(session, chunkcache_spans_chunks_read);
-                already_read += size_copied;
-                remains_to_read -= size_copied;
-
-                break;
+        __wt_session_gen_enter(session, WT_GEN_CHUNKCACHE);
+        if ((chunk = __chunkcache_bucket_find(chunkcache, bucket_id, &hash_id)) != NULL) {
+            /* If the chunk is there, but invalid, there is I/O in progress. Retry. */
+            WT_ACQUIRE_READ_WITH_BARRIER(valid, chunk->valid);
+            if (!valid) {
+                __wt_session_gen_leave(session, WT_GEN_CHUNKCACHE);
+                __wt_spin_backoff(&retries, &sleep_usec);
+                WT_STAT_CONN_INCR(session, chunkcache_retries);
+                if (retries > WT_CHUNKCACHE_MAX_RETRIES)
+                    WT_STAT_CONN_INCR(session, chunkcache_toomany_retries);
+                goto retry;
+            }
+            /* Found the needed chunk. */
+            WT_ASSERT(session,
+              WT_BLOCK_OVERLAPS_CHUNK(chunk->chunk_offset, offset + (wt_off_t)already_read,
+                chunk->chunk_size, remains_to_read));
+
+            /* We can't read beyond the chunk's boundary. */
+            readable_in_chunk = (size_t)chunk->chunk_offset + chunk->chunk_size - (size_t)offset;
+            size_copied = WT_MIN(readable_in_chunk, remains_to_read);
+
+            /*
+             * Accessing this chunk's data is likely to cause a disk read - throttle. The startup
+             * warm-up clears the flag once it has read the chunk back.
+             */
+            if (F_ISSET_ATOMIC_8(chunk, WT_CHUNK_FROM_METADATA)) {
+                __wt_capacity_throttle(session, size_copied, WT_THROTTLE_CHUNKCACHE);
+                F_CLR_ATOMIC_8(chunk, WT_CHUNK_FROM_METADATA);
             }
-        }
-        /* The chunk is not cached. Allocate space for it. Prepare for reading it from storage. */
-        if (!chunk_cached) {
-            WT_STAT_CONN_INCR(session, chunkcache_misses);
-            ret = __chunkcache_insert(
-              session, offset + (wt_off_t)already_read, block->size, &hash_id, bucket_id, &chunk);
-            __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
-            WT_RET(ret);
 
-            WT_RET(__chunkcache_read_into_chunk(session, bucket_id, block->fh, chunk));
+            /* Move the chunk's data to the user. */
+            memcpy((void *)((uint64_t)dst + already_read),
+              chunk->chunk_memory + (offset + (wt_off_t)already_read - chunk->chunk_offset),
+              size_copied);
+
+            /*
+             * Increment the access count for eviction. If we are accessing the new chunk, the
+             * access count would have been incremented on it when it was newly inserted to avoid
+             * eviction before the chunk is accessed. So we are giving two access counts to newly
+             * inserted chunks. Additionally, cap the access count to optimize the eviction process.
+             * This capping helps particularly in focusing on evicting older and potentially
+             * obsolete chunks, while retaining the more recently accessed ones. The count is only
+             * a hint for eviction, racing updates don't matter.
+             */
+            if (chunk->access_count < WT_CHUNK_ACCESS_CAP_LIMIT)
+                chunk->access_count++;
+
+            __wt_session_gen_leave(session, WT_GEN_CHUNKCACHE);
+
+            if (already_read > 0)
+                WT_STAT_CONN_INCR(session, chunkcache_spans_chunks_read);
+            already_read += size_copied;
+            remains_to_read -= size_copied;
+            continue;
+        }
+        __wt_session_gen_leave(session, WT_GEN_CHUNKCACHE);
 
-            __wt_verbose(session, WT_VERB_CHUNKCACHE,
-              "insert: %s(%u), offset=%" PRId64 ", size=%lu", (char *)block->name, objectid,
-              chunk->chunk_offset, chunk->chunk_size);
+        /*
+         * The chunk is not cached. Lock the bucket and check again, another thread may have cached
+         * it since we looked. Otherwise allocate space for it and prepare for reading it from
+         * storage.
+         */
+        __wt_spin_lock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
+        if (__chunkcache_bucket_find(chunkcache, bucket_id, &hash_id) != NULL) {
+            __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
             goto retry;
         }
+        WT_STAT_CONN_INCR(session, chunkcache_misses);
+        ret = __chunkcache_insert(
+          session, offset + (wt_off_t)already_read, block->size, &hash_id, bucket_id, &chunk);
+        __wt_spin_unlock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
+        WT_RET(ret);
+
+        WT_RET(__chunkcache_read_into_chunk(session, bucket_id, block->fh, chunk));
+
+        __wt_verbose(session, WT_VERB_CHUNKCACHE, "insert: %s(%u), offset=%" PRId64 ", size=%lu",
+          (char *)block->name, objectid, chunk->chunk_offset, chunk->chunk_size);
+        goto retry;
     }
 
     *cache_hit = true;
@@ -981,9 +1085,7 @@ __wt_chunkcache_free_external(
         {
             if (__hash_id_eq(&chunk->hash_id, &hash_id)) {
                 already_removed += chunk->chunk_size;
-                TAILQ_REMOVE(WT_BUCKET_CHUNKS(chunkcache, bucket_id), chunk, next_chunk);
-                __delete_update_stats(session, chunk);
-                __chunkcache_free_chunk(session, chunk);
+                __chunkcache_remove_chunk(session, chunk);
                 break;
             }
         }
@@ -1104,18 +1206,18 @@ __wt_chunkcache_reconfig(WT_SESSION_IMPL *session, const char **cfg)
         {
             if (__name_in_pinned_list(session, chunk->hash_id.objectname)) {
                 /* Increment the stat when a chunk that was initially unpinned becomes pinned. */
-                if (!F_ISSET(chunk, WT_CHUNK_PINNED)) {
+                if (!F_ISSET_ATOMIC_8(chunk, WT_CHUNK_PINNED)) {
                     WT_STAT_CONN_INCR(session, chunkcache_chunks_pinned);
                     WT_STAT_CONN_INCRV(session, chunkcache_bytes_inuse_pinned, chunk->chunk_size);
                 }
-                F_SET(chunk, WT_CHUNK_PINNED);
+                F_SET_ATOMIC_8(chunk, WT_CHUNK_PINNED);
             } else {
                 /* Decrement the stat when a chunk that was initially pinned becomes unpinned. */
-                if (F_ISSET(chunk, WT_CHUNK_PINNED)) {
+                if (F_ISSET_ATOMIC_8(chunk, WT_CHUNK_PINNED)) {
                     WT_STAT_CONN_DECR(session, chunkcache_chunks_pinned);
                     WT_STAT_CONN_DECRV(session, chunkcache_bytes_inuse_pinned, chunk->chunk_size);
                 }
-                F_CLR(chunk, WT_CHUNK_PINNED);
+                F_CLR_ATOMIC_8(chunk, WT_CHUNK_PINNED);
             }
         }
         __wt_spin_unlock(session, &chunkcache->hashtable[i].bucket_lock);
@@ -1155,7 +1257,7 @@ __wt_chunkcache_create_from_metadata(WT_SESSION_IMPL *session, const char *name,
     __wt_spin_lock(session, WT_BUCKET_LOCK(chunkcache, bucket_id));
     WT_ERR(__create_and_populate_chunk(
       session, &newchunk, file_offset, chunk_size, &hash_id, bucket_id));
-    F_SET(newchunk, WT_CHUNK_FROM_METADATA);
+    F_SET_ATOMIC_8(newchunk, WT_CHUNK_FROM_METADATA);
 
     /* Get the position of a specific bit index and link the chunk and its memory cached on disk. */
     bit_index = cache_offset / chunkcache->chunk_size;
@@ -1164,7 +1266,7 @@ __wt_chunkcache_create_from_metadata(WT_SESSION_IMPL *session, const char *name,
       "in place");
     newchunk->chunk_memory = chunkcache->memory + cache_offset;
 
-    TAILQ_INSERT_HEAD(WT_BUCKET_CHUNKS(chunkcache, bucket_id), newchunk, next_chunk);
+    __chunkcache_bucket_insert(session, newchunk);
     WT_RELEASE_WRITE_WITH_BARRIER(newchunk->valid, true);
 
     __wt_verbose_debug2(session, WT_VERB_CHUNKCACHE,
@@ -1182,6 +1284,95 @@ err:
     return (ret);
 }
 
+/*
+ * __chunkcache_warmup_bucket --
+ *     Read back the chunks of a bucket that were created from metadata.
+ */
+static void
+__chunkcache_warmup_bucket(WT_SESSION_IMPL *session, uint64_t bucket_id, size_t pagesize)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_CHUNKCACHE_CHUNK *chunk;
+    size_t i;
+
+    chunkcache = &S2C(session)->chunkcache;
+
+    __wt_session_gen_enter(session, WT_GEN_CHUNKCACHE);
+    WT_ACQUIRE_READ(chunk, TAILQ_FIRST(WT_BUCKET_CHUNKS(chunkcache, bucket_id)));
+    while (chunk != NULL) {
+        if (F_ISSET_ATOMIC_8(chunk, WT_CHUNK_FROM_METADATA)) {
+            __wt_capacity_throttle(session, chunk->chunk_size, WT_THROTTLE_CHUNKCACHE);
+
+            /* Touch each page of the chunk, faulting it in from the cache file. */
+            for (i = 0; i < chunk->chunk_size; i += pagesize)
+                (void)((volatile uint8_t *)chunk->chunk_memory)[i];
+            F_CLR_ATOMIC_8(chunk, WT_CHUNK_FROM_METADATA);
+
+            WT_STAT_CONN_INCR(session, chunkcache_chunks_warmed_up);
+            WT_STAT_CONN_INCRV(session, chunkcache_bytes_warmed_up, chunk->chunk_size);
+        }
+        WT_ACQUIRE_READ(chunk, TAILQ_NEXT(chunk, next_chunk));
+    }
+    __wt_session_gen_leave(session, WT_GEN_CHUNKCACHE);
+}
+
+/*
+ * __chunkcache_warmup_thread --
+ *     Read back the chunks created from metadata. The threads take buckets in turn until all of
+ *     them have been warmed up or the chunk cache is torn down.
+ */
+static WT_THREAD_RET
+__chunkcache_warmup_thread(void *arg)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_SESSION_IMPL *session;
+    size_t pagesize;
+    uint64_t bucket_id;
+
+    session = (WT_SESSION_IMPL *)arg;
+    chunkcache = &S2C(session)->chunkcache;
+    pagesize = (size_t)__wt_get_vm_pagesize();
+
+    while (!F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING)) {
+        bucket_id = __wt_atomic_add64(&chunkcache->warmup_next, 1) - 1;
+        if (bucket_id >= chunkcache->hashtable_size)
+            break;
+        __chunkcache_warmup_bucket(session, bucket_id, pagesize);
+    }
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_chunkcache_warmup --
+ *     Start reading back the chunks created from metadata at startup. Until a chunk is read back,
+ *     its data is only on disk and the first lookup of the chunk has to wait for it. Each thread
+ *     reads one chunk at a time, bounding the number of reads in flight.
+ */
+int
+__wt_chunkcache_warmup(WT_SESSION_IMPL *session)
+{
+    WT_CHUNKCACHE *chunkcache;
+    WT_CONNECTION_IMPL *conn;
+    u_int i;
+
+    conn = S2C(session);
+    chunkcache = &conn->chunkcache;
+
+    if (!F_ISSET(chunkcache, WT_CHUNKCACHE_CONFIGURED) || chunkcache->type != WT_CHUNKCACHE_FILE ||
+      chunkcache->warmup_threads == 0)
+        return (0);
+
+    WT_RET(__wt_calloc_def(session, chunkcache->warmup_threads, &chunkcache->warmup_tids));
+    WT_RET(__wt_calloc_def(session, chunkcache->warmup_threads, &chunkcache->warmup_sessions));
+    for (i = 0; i < chunkcache->warmup_threads; ++i) {
+        WT_RET(__wt_open_internal_session(
+          conn, "chunkcache-warmup", false, 0, 0, &chunkcache->warmup_sessions[i]));
+        WT_RET(__wt_thread_create(chunkcache->warmup_sessions[i], &chunkcache->warmup_tids[i],
+          __chunkcache_warmup_thread, chunkcache->warmup_sessions[i]));
+    }
+    return (0);
+}
+
 /*
  * __wt_chunkcache_setup --
  *     Set up the chunk cache.
@@ -1207,6 +1398,10 @@ __wt_chunkcache_setup(WT_SESSION_IMPL *session, const char *cfg[])
     if (cval.val == 0)
         return (0);
 
+    /* Chunks are read into unaligned memory, and the point of direct I/O is a single cache. */
+    if (FLD_ISSET(S2C(session)->direct_io, WT_FILE_TYPE_DATA))
+        WT_RET_MSG(session, EINVAL, "chunk cache is incompatible with direct I/O");
+
     WT_RET(__wt_config_gets(session, cfg, "chunk_cache.capacity", &cval));
     if ((chunkcache->capacity = (uint64_t)cval.val) <= 0)
         WT_RET_MSG(session, EINVAL, "chunk cache capacity must be greater than zero");
@@ -1267,6 +1462,9 @@ __wt_chunkcache_setup(WT_SESSION_IMPL *session, const char *cfg[])
     if (cval.val != 0)
         F_SET(chunkcache, WT_CHUNK_CACHE_FLUSHED_DATA_INSERTION);
 
+    WT_RET(__wt_config_gets(session, cfg, "chunk_cache.warmup_threads", &cval));
+    chunkcache->warmup_threads = (u_int)cval.val;
+
     WT_ERR(__wt_rwlock_init(session, &chunkcache->pinned_objects.array_lock));
     WT_ERR(__config_get_sorted_pinned_objects(session, cfg, &pinned_objects, &cnt));
     chunkcache->pinned_objects.array = pinned_objects;
@@ -1280,6 +1478,9 @@ __wt_chunkcache_setup(WT_SESSION_IMPL *session, const char *cfg[])
           session, &chunkcache->hashtable[i].bucket_lock, "chunk cache bucket lock"));
     }
 
+    TAILQ_INIT(&chunkcache->retired);
+    WT_ERR(__wt_spin_init(session, &chunkcache->retired_lock, "chunk cache retired chunks"));
+
     WT_ERR(__wt_thread_create(
       session, &chunkcache->evict_thread_tid, __chunkcache_eviction_thread, (void *)session));
 
@@ -1303,15 +1504,31 @@ __wt_chunkcache_teardown(WT_SESSION_IMPL *session)
 {
     WT_CHUNKCACHE *chunkcache;
     WT_DECL_RET;
+    u_int i;
 
     chunkcache = &S2C(session)->chunkcache;
 
-    if (!F_ISSET(chunkcache, WT_CHUNKCACHE_CONFIGURED))
+    /* Connection close tears the chunk cache down more than once. */
+    if (!F_ISSET(chunkcache, WT_CHUNKCACHE_CONFIGURED) ||
+      F_ISSET(chunkcache, WT_CHUNK_CACHE_EXITING))
         return (0);
 
     F_SET(chunkcache, WT_CHUNK_CACHE_EXITING);
     WT_TRET(__wt_thread_join(session, &chunkcache->evict_thread_tid));
 
+    if (chunkcache->warmup_sessions != NULL)
+        for (i = 0; i < chunkcache->warmup_threads; ++i) {
+            WT_TRET(__wt_thread_join(session, &chunkcache->warmup_tids[i]));
+            if (chunkcache->warmup_sessions[i] != NULL)
+                WT_TRET(__wt_session_close_internal(chunkcache->warmup_sessions[i]));
+        }
+    __wt_free(session, chunkcache->warmup_sessions);
+    __wt_free(session, chunkcache->warmup_tids);
+
+    /* There are no lookups left, free the retired chunks. */
+    __chunkcache_retired_discard(session, true);
+    __wt_spin_destroy(session, &chunkcache->retired_lock);
+
     __chunkcache_arr_free(session, &chunkcache->pinned_objects.array);
     __wt_rwlock_destroy(session, &chunkcache->pinned_objects.array_lock);
 
@@ -41,6 +41,13 @@ __wti_blkcache_map(WT_SESSION_IMPL *session, WT_BLOCK *block, void **mapped_regi
     if (block->os_cache_max != 0)
         return (0);
 
+    /*
+     * Turn off mapping when direct I/O is configured for the file, the Linux open(2) documentation
+     * says applications should avoid mixing mmap(2) of files with direct I/O to the same files.
+     */
+    if (block->fh->direct_io)
+        return (0);
+
     /*
      * There may be no underlying functionality.
      */
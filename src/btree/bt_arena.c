@@ -0,0 +1,250 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __arena_charge_tree --
+ *     Charge an arena no page owns to the tree.
+ */
+static void
+__arena_charge_tree(WT_SESSION_IMPL *session, size_t size)
+{
+    (void)__wt_atomic_add64(&S2C(session)->cache->bytes_inmem, size);
+    (void)__wt_atomic_add64(&S2BT(session)->bytes_inmem, size);
+}
+
+/*
+ * __arena_uncharge_tree --
+ *     Remove an arena no page owns from the tree's accounting.
+ */
+static void
+__arena_uncharge_tree(WT_SESSION_IMPL *session, size_t size)
+{
+    __wt_cache_decr_check_uint64(
+      session, &S2BT(session)->bytes_inmem, size, "WT_BTREE.bytes_inmem");
+    __wt_cache_decr_check_uint64(
+      session, &S2C(session)->cache->bytes_inmem, size, "WT_CACHE.bytes_inmem");
+}
+
+/*
+ * __arena_chunk_alloc --
+ *     Allocate a chunk for a page's arena.
+ */
+static int
+__arena_chunk_alloc(
+  WT_SESSION_IMPL *session, size_t size, size_t used, WT_PAGE_ARENA_CHUNK **chunkp)
+{
+    WT_PAGE_ARENA_CHUNK *chunk;
+
+    WT_RET(__wt_calloc(session, 1, sizeof(WT_PAGE_ARENA_CHUNK) + size, &chunk));
+    chunk->size = size;
+    chunk->used = used;
+
+    *chunkp = chunk;
+    return (0);
+}
+
+/*
+ * __arena_chunk_charge --
+ *     Charge a chunk installed in a page's arena to the page.
+ */
+static void
+__arena_chunk_charge(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_ARENA_CHUNK *chunk)
+{
+    size_t size;
+
+    size = sizeof(WT_PAGE_ARENA_CHUNK) + chunk->size;
+    (void)__wt_atomic_addsize(&page->modify->arena->bytes, size);
+    __wt_cache_page_inmem_incr(session, page, size);
+    WT_STAT_CONN_DSRC_INCR(session, cache_page_arena_chunk);
+}
+
+/*
+ * __arena_create --
+ *     Create a page's arena.
+ */
+static int
+__arena_create(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_ARENA **arenap)
+{
+    WT_PAGE_ARENA *arena;
+
+    WT_RET(__wt_calloc_one(session, &arena));
+    arena->bytes = sizeof(WT_PAGE_ARENA);
+    arena->ref = 1;
+
+    /* Multiple threads of control may be inserting into the page, another thread may win. */
+    if (__wt_atomic_cas_ptr(&page->modify->arena, NULL, arena))
+        __wt_cache_page_inmem_incr(session, page, sizeof(WT_PAGE_ARENA));
+    else
+        __wt_free(session, arena);
+
+    *arenap = page->modify->arena;
+    return (0);
+}
+
+/*
+ * __wt_page_arena_alloc --
+ *     Allocate cleared memory from a page's arena. The memory is charged to the page when the arena
+ *     allocates its chunks, not here.
+ */
+int
+__wt_page_arena_alloc(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size, void *retp)
+{
+    WT_PAGE_ARENA *arena;
+    WT_PAGE_ARENA_CHUNK *chunk, *new_chunk;
+    size_t chunk_size, offset;
+
+    *(void **)retp = NULL;
+
+    WT_RET(__wt_page_modify_init(session, page));
+    if ((arena = __wt_atomic_load_pointer(&page->modify->arena)) == NULL)
+        WT_RET(__arena_create(session, page, &arena));
+
+    size = WT_ALIGN(size, sizeof(uint64_t));
+
+    /* Large allocations get a chunk of their own, they'd waste most of a shared chunk. */
+    if (size > WT_PAGE_ARENA_LARGE) {
+        WT_RET(__arena_chunk_alloc(session, size, size, &new_chunk));
+        do
+            new_chunk->next = __wt_atomic_load_pointer(&arena->large);
+        while (!__wt_atomic_cas_ptr(&arena->large, new_chunk->next, new_chunk));
+        __arena_chunk_charge(session, page, new_chunk);
+
+        *(void **)retp = WT_PAGE_ARENA_CHUNK_DATA(new_chunk);
+        return (0);
+    }
+
+    for (;;) {
+        /*
+         * Claim space in the current chunk. Threads racing to claim the last of a chunk's space can
+         * push its used bytes past its size, those that do discard their claim and move on to a
+         * new chunk.
+         */
+        WT_ACQUIRE_READ(chunk, arena->chunk);
+        if (chunk != NULL) {
+            offset = __wt_atomic_addsize(&chunk->used, size) - size;
+            if (offset + size <= chunk->size) {
+                *(void **)retp = WT_PAGE_ARENA_CHUNK_DATA(chunk) + offset;
+                return (0);
+            }
+        }
+
+        /*
+         * Install a new chunk, twice the size of the last one. If another thread installed one
+         * first, discard ours and claim space in theirs.
+         */
+        chunk_size = chunk == NULL ? WT_PAGE_ARENA_CHUNK_MIN :
+                                     WT_MIN(2 * chunk->size, WT_PAGE_ARENA_CHUNK_MAX);
+        chunk_size = WT_MAX(chunk_size, size);
+        WT_RET(__arena_chunk_alloc(session, chunk_size, size, &new_chunk));
+        new_chunk->next = chunk;
+        if (__wt_atomic_cas_ptr(&arena->chunk, chunk, new_chunk)) {
+            __arena_chunk_charge(session, page, new_chunk);
+
+            *(void **)retp = WT_PAGE_ARENA_CHUNK_DATA(new_chunk);
+            return (0);
+        }
+        __wt_free(session, new_chunk);
+    }
+}
+
+/*
+ * __wt_page_arena_inherit --
+ *     A page's insert lists or update chains are moving to a new page: reference the original
+ *     page's arenas from the new page, so their memory lives as long as the new page.
+ */
+int
+__wt_page_arena_inherit(WT_SESSION_IMPL *session, WT_PAGE *orig, WT_PAGE *page)
+{
+    WT_PAGE_ARENA *arena;
+    WT_PAGE_MODIFY *mod, *orig_mod;
+    size_t allocated;
+    uint32_t i;
+
+    if ((orig_mod = orig->modify) == NULL ||
+      (orig_mod->arena == NULL && orig_mod->arena_inherit_entries == 0))
+        return (0);
+
+    WT_RET(__wt_page_modify_init(session, page));
+    mod = page->modify;
+
+    allocated = mod->arena_inherit_allocated;
+    WT_RET(__wt_realloc_def(session, &mod->arena_inherit_allocated,
+      mod->arena_inherit_entries + orig_mod->arena_inherit_entries + 1, &mod->arena_inherit));
+    __wt_cache_page_inmem_incr(session, page, mod->arena_inherit_allocated - allocated);
+
+    /*
+     * The original page is locked for the split, it can't be discarded and its arenas can't change
+     * underneath us.
+     */
+    for (i = 0; i <= orig_mod->arena_inherit_entries; ++i) {
+        arena =
+          i < orig_mod->arena_inherit_entries ? orig_mod->arena_inherit[i] : orig_mod->arena;
+        if (arena == NULL)
+            continue;
+        (void)__wt_atomic_add32(&arena->ref, 1);
+        mod->arena_inherit[mod->arena_inherit_entries++] = arena;
+    }
+    return (0);
+}
+
+/*
+ * __arena_release --
+ *     Release a page's reference to an arena, freeing the arena with the last reference.
+ */
+static void
+__arena_release(WT_SESSION_IMPL *session, WT_PAGE_ARENA *arena, bool owner)
+{
+    WT_PAGE_ARENA_CHUNK *chunk, *next;
+
+    /*
+     * Discarding the owning page removed the arena's memory from the cache. If other pages still
+     * reference the arena, charge its memory to the tree until the last of them is discarded. Only
+     * pages referencing an arena can pass it on, so if the owning page holds the only reference,
+     * the arena can be freed now.
+     */
+    if (owner && __wt_atomic_load32(&arena->ref) > 1) {
+        __arena_charge_tree(session, arena->bytes);
+        arena->orphan = true;
+    }
+    if (__wt_atomic_sub32(&arena->ref, 1) != 0)
+        return;
+
+    if (arena->orphan)
+        __arena_uncharge_tree(session, arena->bytes);
+
+    for (chunk = arena->chunk; chunk != NULL; chunk = next) {
+        next = chunk->next;
+        __wt_free(session, chunk);
+    }
+    for (chunk = arena->large; chunk != NULL; chunk = next) {
+        next = chunk->next;
+        __wt_free(session, chunk);
+    }
+    __wt_free(session, arena);
+}
+
+/*
+ * __wt_page_arena_discard --
+ *     Release a page's arenas as the page is discarded.
+ */
+void
+__wt_page_arena_discard(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    WT_PAGE_MODIFY *mod;
+    uint32_t i;
+
+    mod = page->modify;
+
+    if (mod->arena != NULL)
+        __arena_release(session, mod->arena, true);
+    for (i = 0; i < mod->arena_inherit_entries; ++i)
+        __arena_release(session, mod->arena_inherit[i], false);
+    __wt_free(session, mod->arena_inherit);
+}
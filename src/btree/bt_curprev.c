@@ -652,6 +652,8 @@ restart_read_insert:
                 continue;
             }
             __wt_value_return(cbt, cbt->upd_value);
+            if (__wt_btcur_value_out_of_bounds(cbt))
+                continue;
             return (0);
         }
 
@@ -713,6 +715,8 @@ restart_read_page:
             continue;
         }
         __wt_value_return(cbt, cbt->upd_value);
+        if (__wt_btcur_value_out_of_bounds(cbt))
+            continue;
         return (0);
     }
     /* NOTREACHED */
@@ -743,8 +747,10 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, bool truncating)
     key_out_of_bounds = need_walk = newpage = repositioned = false;
     session = CUR2S(cbt);
     total_skipped = 0;
+    walk_skip_stats.cbt = cbt;
     walk_skip_stats.total_del_pages_skipped = 0;
     walk_skip_stats.total_inmem_del_pages_skipped = 0;
+    walk_skip_stats.total_zone_pages_skipped = 0;
     WT_NOT_READ(time_start, 0);
 
     WT_STAT_CONN_DSRC_INCR(session, cursor_prev);
@@ -763,7 +769,7 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, bool truncating)
      * positioned. It is possible that the positioning function can directly return the record. For
      * that to happen, the cursor must be placed on a valid record and must be positioned on the
      * first record within the bounds. If the record is not valid or is not positioned within the
-     * bounds, continue the prev traversal logic.
+     * bounds, or its value is outside any value bounds, continue the prev traversal logic.
      */
     if (F_ISSET(cursor, WT_CURSTD_BOUND_UPPER) && !WT_CURSOR_IS_POSITIONED(cbt)) {
         repositioned = true;
@@ -771,7 +777,8 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, bool truncating)
         WT_ERR(__wti_btcur_bounds_position(session, cbt, false, &need_walk));
         if (!need_walk) {
             __wt_value_return(cbt, cbt->upd_value);
-            goto done;
+            if (!__wt_btcur_value_out_of_bounds(cbt))
+                goto done;
         }
     }
 
@@ -907,6 +914,9 @@ err:
     if (walk_skip_stats.total_inmem_del_pages_skipped != 0)
         WT_STAT_CONN_DSRC_INCRV(session, cursor_tree_walk_inmem_del_page_skip,
           walk_skip_stats.total_inmem_del_pages_skipped);
+    if (walk_skip_stats.total_zone_pages_skipped != 0)
+        WT_STAT_CONN_DSRC_INCRV(
+          session, cursor_tree_walk_zone_page_skip, walk_skip_stats.total_zone_pages_skipped);
 
     /*
      * If we positioned the cursor using bounds, which is similar to a search, update the read
@@ -20,6 +20,23 @@ typedef struct {
     uint64_t flags;
 } WT_CURFILE_STATE;
 
+/*
+ * A key of a batch search: sorting the keys requires the collator, and the keys' original slots are
+ * needed to return the results in the caller's order.
+ */
+typedef struct {
+    WT_SESSION_IMPL *session;
+    WT_COLLATOR *collator;
+
+    const WT_ITEM *key; /* Row-store key */
+    uint64_t recno;     /* Column-store key */
+    size_t slot;        /* Caller's array slot */
+
+    size_t value_offset; /* Value's offset in the cursor's batch buffer */
+    size_t value_size;
+    bool found;
+} WT_CURFILE_BATCH;
+
 /*
  * __btcur_bounds_contains_key --
  *     Determine if a given key is within the bounds set on a cursor.
@@ -875,6 +892,271 @@ err:
     return (ret);
 }
 
+/*
+ * __btcur_search_batch_cmp --
+ *     Qsort function: sort batch search keys.
+ */
+static int WT_CDECL
+__btcur_search_batch_cmp(const void *a, const void *b)
+{
+    const WT_CURFILE_BATCH *ba, *bb;
+    int cmp;
+
+    ba = a;
+    bb = b;
+
+    if (ba->key == NULL)
+        cmp = ba->recno < bb->recno ? -1 : (ba->recno == bb->recno ? 0 : 1);
+    else if (ba->collator == NULL)
+        cmp = __wt_lex_compare(ba->key, bb->key);
+    else if (__wt_compare(ba->session, ba->collator, ba->key, bb->key, &cmp) != 0)
+        cmp = 0;
+
+    /* Keep the order stable, duplicate keys are returned in the order they were passed. */
+    if (cmp == 0)
+        cmp = ba->slot < bb->slot ? -1 : 1;
+    return (cmp);
+}
+
+/*
+ * __btcur_search_batch_prefetch --
+ *     Queue pre-fetch of the leaf pages that later keys of a batch fall on, taken from the internal
+ *     page the cursor's leaf page belongs to. Keys are sorted, so a single pass over the internal
+ *     page's children and the remaining keys finds the pages, the page a key falls on is the last
+ *     child whose starting key is less than or equal to the key.
+ */
+static int
+__btcur_search_batch_prefetch(
+  WT_CURSOR_BTREE *cbt, WT_CURFILE_BATCH *batch, size_t next, size_t count)
+{
+    WT_BTREE *btree;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_ITEM start_key;
+    WT_PAGE *home;
+    WT_PAGE_INDEX *pindex;
+    WT_REF *child, *ref;
+    WT_SESSION_IMPL *session;
+    uint64_t queued;
+    uint32_t slot;
+    int cmp;
+    bool needed;
+
+    btree = CUR2BT(cbt);
+    session = CUR2S(cbt);
+    conn = S2C(session);
+    ref = cbt->ref;
+    queued = 0;
+
+    /* The batch says which pages will be read, there's no need to wait for sequential reads. */
+    if (!__wt_session_prefetch_check(session, ref, false))
+        return (0);
+
+    WT_ENTER_GENERATION(session, WT_GEN_SPLIT);
+    home = ref->home;
+    WT_INTL_INDEX_GET(session, home, pindex);
+
+    /*
+     * The last child's key range extends past the internal page's range, which isn't known here:
+     * stop before it, rather than queuing a page none of the keys need.
+     */
+    for (slot = 0; slot + 1 < pindex->entries && next < count; ++slot) {
+        if (conn->prefetch_queue_count > WT_MAX_PREFETCH_QUEUE ||
+          queued > WT_PREFETCH_QUEUE_PER_TRIGGER)
+            break;
+
+        /* Consume the keys that sort before the next child's starting key. */
+        needed = false;
+        for (; next < count; ++next) {
+            if (btree->type == BTREE_ROW) {
+                __wt_ref_key(home, pindex->index[slot + 1], &start_key.data, &start_key.size);
+                WT_ERR(__wt_compare(session, btree->collator, batch[next].key, &start_key, &cmp));
+            } else
+                cmp = batch[next].recno < pindex->index[slot + 1]->ref_recno ? -1 : 0;
+            if (cmp >= 0)
+                break;
+            needed = true;
+        }
+
+        /* Queue the same pages as a cursor traversal: leaf pages on disk, not fast deleted. */
+        child = pindex->index[slot];
+        if (!needed || child == ref || WT_REF_GET_STATE(child) != WT_REF_DISK ||
+          !F_ISSET(child, WT_REF_FLAG_LEAF) || child->page_del != NULL ||
+          F_ISSET_ATOMIC_8(child, WT_REF_FLAG_PREFETCH))
+            continue;
+        if ((ret = __wt_conn_prefetch_queue_push(session, child)) == EBUSY) {
+            ret = 0;
+            break;
+        }
+        WT_ERR(ret);
+        ++queued;
+    }
+
+err:
+    WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
+    WT_STAT_CONN_INCRV(session, prefetch_pages_queued, queued);
+    return (ret);
+}
+
+/*
+ * __wt_btcur_search_batch --
+ *     Search for a batch of keys. The keys are searched in sorted order so keys on the same leaf
+ *     page are found using the page pinned by the previous search rather than by descending the
+ *     tree. The values found are copied into a cursor buffer, so the page can be released as the
+ *     search moves on.
+ */
+int
+__wt_btcur_search_batch(
+  WT_CURSOR_BTREE *cbt, const WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+    WT_BTREE *btree;
+    WT_CURFILE_BATCH *batch, *bp;
+    WT_CURSOR *cursor;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    WT_ITEM *buf;
+    WT_PAGE *prefetch_home;
+    WT_SESSION_IMPL *session;
+    size_t i;
+    bool key_out_of_bounds, leaf_found, valid;
+
+    btree = CUR2BT(cbt);
+    cursor = &cbt->iface;
+    session = CUR2S(cbt);
+    buf = &cbt->batch_values;
+    prefetch_home = NULL;
+
+    WT_STAT_CONN_DSRC_INCR(session, cursor_search_batch);
+
+    WT_RET(__wt_txn_search_check(session));
+
+    /* Values are copied into a cursor buffer, discard any values from a previous batch. */
+    WT_RET(__wt_buf_init(session, buf, 0));
+
+    WT_RET(__wt_scr_alloc(session, count * sizeof(WT_CURFILE_BATCH), &tmp));
+    batch = tmp->mem;
+    for (i = 0; i < count; ++i) {
+        bp = &batch[i];
+        bp->session = session;
+        bp->collator = btree->collator;
+        bp->slot = i;
+        bp->found = false;
+        if (btree->type == BTREE_ROW) {
+            if (keys[i].size == 0)
+                WT_ERR_MSG(session, EINVAL, "Empty keys not permitted");
+            bp->key = &keys[i];
+            bp->recno = WT_RECNO_OOB;
+        } else {
+            WT_ERR(__wt_struct_unpack(session, keys[i].data, keys[i].size, "q", &bp->recno));
+            if (bp->recno == WT_RECNO_OOB)
+                WT_ERR_MSG(session, EINVAL, "%d is an invalid record number", WT_RECNO_OOB);
+            bp->key = NULL;
+        }
+    }
+    __wt_qsort(batch, count, sizeof(WT_CURFILE_BATCH), __btcur_search_batch_cmp);
+
+    for (i = 0; i < count; ++i) {
+        bp = &batch[i];
+        __cursor_novalue(cursor);
+        F_CLR(cursor, WT_CURSTD_KEY_SET);
+        if (bp->key == NULL)
+            cursor->recno = bp->recno;
+        else {
+            cursor->key.data = bp->key->data;
+            cursor->key.size = bp->key->size;
+        }
+        F_SET(cursor, WT_CURSTD_KEY_EXT);
+
+        WT_ERR(__btcur_bounds_contains_key(
+          session, cursor, &cursor->key, cursor->recno, &key_out_of_bounds, NULL));
+        if (key_out_of_bounds) {
+            WT_STAT_CONN_DSRC_INCR(session, cursor_bounds_search_early_exit);
+            continue;
+        }
+
+        /*
+         * Search the page pinned by the previous key first: keys are sorted, the next key is often
+         * on the same page. Like search, search from the root if that doesn't find an exact match.
+         * Unlike search, the page the search ends on stays pinned even if the key isn't found, as
+         * the next key is likely to be on it too.
+         */
+        valid = false;
+        if (__cursor_page_pinned(cbt, true)) {
+            __wt_txn_cursor_op(session);
+
+            if (btree->type == BTREE_ROW)
+                WT_ERR(__cursor_row_search(cbt, false, cbt->ref, &leaf_found));
+            else
+                WT_ERR(__cursor_col_search(cbt, cbt->ref, &leaf_found));
+
+            if (leaf_found && cbt->compare == 0)
+                WT_ERR(__wti_cursor_valid(cbt, &valid, false));
+        }
+        if (!valid) {
+            WT_ERR(__wt_cursor_func_init(cbt, true));
+
+            if (btree->type == BTREE_ROW)
+                WT_ERR(__cursor_row_search(cbt, false, NULL, NULL));
+            else
+                WT_ERR(__cursor_col_search(cbt, NULL, NULL));
+
+            if (cbt->compare == 0)
+                WT_ERR(__wti_cursor_valid(cbt, &valid, false));
+
+            /*
+             * Searching from the root lands on a new leaf page: queue pre-fetch of any other pages
+             * the rest of the batch needs from the same internal page, once per internal page.
+             */
+            if (cbt->ref->home != prefetch_home && i + 1 < count) {
+                prefetch_home = cbt->ref->home;
+                WT_ERR(__btcur_search_batch_prefetch(cbt, batch, i + 1, count));
+            }
+        }
+
+        if (valid)
+            __wt_value_return(cbt, cbt->upd_value);
+        else if (__cursor_fix_implicit(btree, cbt)) {
+            /*
+             * Creating a record past the end of the tree in a fixed-length column-store implicitly
+             * fills the gap with empty records.
+             */
+            cbt->v = 0;
+            cursor->value.data = &cbt->v;
+            cursor->value.size = 1;
+        } else
+            continue;
+
+        bp->found = true;
+        bp->value_offset = buf->size;
+        bp->value_size = cursor->value.size;
+        WT_ERR(__wt_buf_extend(session, buf, buf->size + cursor->value.size));
+        if (cursor->value.size != 0)
+            memcpy((uint8_t *)buf->mem + buf->size, cursor->value.data, cursor->value.size);
+        buf->size += cursor->value.size;
+    }
+
+    /* The buffer may have moved as it grew, point the values into it once it's complete. */
+    for (i = 0; i < count; ++i) {
+        bp = &batch[i];
+        if (bp->found) {
+            values[bp->slot].data = (uint8_t *)buf->mem + bp->value_offset;
+            values[bp->slot].size = bp->value_size;
+            results[bp->slot] = 0;
+        } else {
+            values[bp->slot].data = NULL;
+            values[bp->slot].size = 0;
+            results[bp->slot] = WT_NOTFOUND;
+        }
+    }
+
+err:
+    /* The cursor ends with no position, the keys belong to the caller. */
+    WT_TRET(__cursor_reset(cbt));
+    F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
+
 /*
  * __btcur_search_neighboring --
  *     Search for a valid record around the cursor location.
@@ -2275,6 +2557,25 @@ __wt_btcur_free_cached_memory(WT_CURSOR_BTREE *cbt)
     __wt_buf_free(session, &cbt->_tmp);
     __wt_buf_free(session, &cbt->_modify_update.buf);
     __wt_buf_free(session, &cbt->_upd_value.buf);
+    __wt_buf_free(session, &cbt->batch_values);
+}
+
+/*
+ * __wt_btcur_value_bound_reset --
+ *     Clear any value bounds on the cursor.
+ */
+void
+__wt_btcur_value_bound_reset(WT_CURSOR_BTREE *cbt)
+{
+    WT_SESSION_IMPL *session;
+
+    session = CUR2S(cbt);
+
+    F_CLR(cbt,
+      WT_CBT_VALUE_LOWER | WT_CBT_VALUE_LOWER_INCLUSIVE | WT_CBT_VALUE_UPPER |
+        WT_CBT_VALUE_UPPER_INCLUSIVE);
+    __wt_buf_free(session, &cbt->value_lower);
+    __wt_buf_free(session, &cbt->value_upper);
 }
 
 /*
@@ -1246,6 +1246,10 @@ __debug_page_metadata(WT_DBG *ds, WT_REF *ref)
             WT_RET(flag_num == 0 ? ds->f(ds, "disk-alloc") : ds->f(ds, ", disk-alloc"));
             flag_num++;
         }
+        if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_ARENA)) {
+            WT_RET(flag_num == 0 ? ds->f(ds, "disk-arena") : ds->f(ds, ", disk-arena"));
+            flag_num++;
+        }
         if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_MAPPED)) {
             WT_RET(flag_num == 0 ? ds->f(ds, "disk-mapped") : ds->f(ds, ", disk-mapped"));
             flag_num++;
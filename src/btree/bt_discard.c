@@ -134,7 +134,9 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
     }
 
     /* Discard any allocated disk image. */
-    if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_ALLOC))
+    if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_ARENA))
+        __wt_cache_arena_free(session, dsk, dsk->mem_size);
+    else if (F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_ALLOC))
         __wt_overwrite_and_free_len(session, dsk, dsk->mem_size);
 
     __wt_overwrite_and_free(session, page);
@@ -229,6 +231,9 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
         break;
     }
 
+    /* Free the arenas, after the insert lists and update chains allocated from them. */
+    __wt_page_arena_discard(session, page);
+
     /* Free the overflow on-page and reuse skiplists. */
     __wt_ovfl_reuse_free(session, page);
     __wt_ovfl_discard_free(session, page);
@@ -318,6 +323,7 @@ __wt_ref_addr_free(WT_SESSION_IMPL *session, WT_REF *ref)
 void
 __wti_free_ref(WT_SESSION_IMPL *session, WT_REF *ref, int page_type, bool free_pages)
 {
+    WT_BTREE *btree;
     WT_IKEY *ikey;
 
     if (ref == NULL)
@@ -363,7 +369,16 @@ __wti_free_ref(WT_SESSION_IMPL *session, WT_REF *ref, int page_type, bool free_p
     /* Free any backing fast-truncate memory. */
     __wt_free(session, ref->page_del);
 
-    __wt_overwrite_and_free_len(session, ref, WT_REF_CLEAR_SIZE);
+    /*
+     * Searches using the tree's adaptive hash index can reach a WT_REF without holding its parent
+     * page: invalidate the index, then free the WT_REF once no search can be looking at it.
+     */
+    btree = S2BT_SAFE(session);
+    if (btree != NULL && btree->ahi != NULL) {
+        __wt_btree_ahi_invalidate(btree);
+        __wti_ref_addr_safe_free(session, ref, WT_REF_CLEAR_SIZE);
+    } else
+        __wt_overwrite_and_free_len(session, ref, WT_REF_CLEAR_SIZE);
 }
 
 /*
@@ -451,6 +466,9 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
     /* Free any allocated memory used by instantiated keys. */
     WT_ROW_FOREACH (page, rip, i)
         __wt_row_leaf_key_free(session, page, rip);
+
+    /* Free the key prefix directory. */
+    __wt_free(session, page->pg_row_keydir);
 }
 
 /*
@@ -491,7 +509,7 @@ __free_skip_list(WT_SESSION_IMPL *session, WT_INSERT *ins, bool update_ignore)
         if (!update_ignore)
             __wt_free_update_list(session, &ins->upd);
         next = WT_SKIP_NEXT(ins);
-        __wt_free(session, ins);
+        __wt_insert_free(session, &ins);
     }
 }
 
@@ -529,7 +547,7 @@ __wt_free_update_list(WT_SESSION_IMPL *session, WT_UPDATE **updp)
 
     for (upd = *updp; upd != NULL; upd = next) {
         next = upd->next;
-        __wt_free(session, upd);
+        __wt_upd_free(session, &upd);
     }
     *updp = NULL;
 }
@@ -36,6 +36,10 @@ __btree_clear(WT_SESSION_IMPL *session)
     if (btree->collator_owned && btree->collator->terminate != NULL)
         WT_TRET(btree->collator->terminate(btree->collator, &session->iface));
 
+    /* Terminate any customized compressor. */
+    if (btree->compressor_owned && btree->compressor->terminate != NULL)
+        WT_TRET(btree->compressor->terminate(btree->compressor, &session->iface));
+
     /* Destroy locks. */
     __wt_rwlock_destroy(session, &btree->ovfl_lock);
     __wt_spin_destroy(session, &btree->flush_lock);
@@ -47,6 +51,59 @@ __btree_clear(WT_SESSION_IMPL *session)
     return (ret);
 }
 
+/*
+ * __btree_ahi_alloc --
+ *     Allocate the adaptive hash index.
+ */
+static int
+__btree_ahi_alloc(WT_SESSION_IMPL *session)
+{
+    WT_BTREE *btree;
+    WT_CACHE *cache;
+    size_t size;
+
+    btree = S2BT(session);
+    cache = S2C(session)->cache;
+
+    WT_RET(__wt_calloc_def(session, btree->ahi_entries, &btree->ahi));
+
+    /*
+     * The index stays in memory as long as the tree is open, account for it in the cache as
+     * internal page memory, eviction can't reclaim it.
+     */
+    size = btree->ahi_entries * sizeof(WT_AHI_ENTRY);
+    (void)__wt_atomic_add64(&cache->bytes_inmem, size);
+    (void)__wt_atomic_add64(&btree->bytes_inmem, size);
+    (void)__wt_atomic_add64(&cache->bytes_internal, size);
+    (void)__wt_atomic_add64(&btree->bytes_internal, size);
+    return (0);
+}
+
+/*
+ * __btree_ahi_free --
+ *     Discard the adaptive hash index.
+ */
+static void
+__btree_ahi_free(WT_SESSION_IMPL *session)
+{
+    WT_BTREE *btree;
+    WT_CACHE *cache;
+    size_t size;
+
+    btree = S2BT(session);
+    cache = S2C(session)->cache;
+
+    if (btree->ahi == NULL)
+        return;
+
+    size = btree->ahi_entries * sizeof(WT_AHI_ENTRY);
+    __wt_cache_decr_check_uint64(session, &btree->bytes_inmem, size, "WT_BTREE.bytes_inmem");
+    __wt_cache_decr_check_uint64(session, &cache->bytes_inmem, size, "WT_CACHE.bytes_inmem");
+    __wt_cache_decr_check_uint64(session, &btree->bytes_internal, size, "WT_BTREE.bytes_internal");
+    __wt_cache_decr_check_uint64(session, &cache->bytes_internal, size, "WT_CACHE.bytes_internal");
+    __wt_free(session, btree->ahi);
+}
+
 /*
  * __wt_btree_open --
  *     Open a Btree.
@@ -110,6 +167,10 @@ __wt_btree_open(WT_SESSION_IMPL *session, const char *op_cfg[])
     /* Initialize and configure the WT_BTREE structure. */
     WT_ERR(__btree_conf(session, &ckpt, WT_DHANDLE_IS_CHECKPOINT(dhandle)));
 
+    /* Allocate the adaptive hash index, if configured. */
+    if (btree->ahi_entries != 0)
+        WT_ERR(__btree_ahi_alloc(session));
+
     /* Connect to the underlying block manager. */
     WT_ERR(__wt_blkcache_open(
       session, dhandle->name, dhandle->cfg, forced_salvage, false, btree->allocsize, &btree->bm));
@@ -219,6 +280,9 @@ __wt_btree_close(WT_SESSION_IMPL *session)
     /* Clear the saved checkpoint information. */
     __wt_ckptlist_saved_free(session);
 
+    /* Discard the adaptive hash index, the tree's pages are gone. */
+    __btree_ahi_free(session);
+
     /*
      * If we turned eviction off and never turned it back on, do that now, otherwise the counter
      * will be off.
@@ -374,6 +438,9 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
     else
         F_CLR(btree, WT_BTREE_IN_MEMORY);
 
+    WT_RET(__wt_config_gets(session, cfg, "page_arena", &cval));
+    btree->page_arena = cval.val != 0;
+
     WT_RET(__wt_config_gets(session, cfg, "ignore_in_memory_cache_size", &cval));
     if (cval.val) {
         if (!F_ISSET(conn, WT_CONN_IN_MEMORY))
@@ -462,11 +529,22 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
      *	Page-split percentage
      *	Prefix compression (row-store)
      *	Suffix compression (row-store)
+     *	Value zone maps (row-store)
      */
     switch (btree->type) {
     case BTREE_COL_FIX:
         break;
     case BTREE_ROW:
+        WT_RET(__wt_config_gets(session, cfg, "internal_key_prefix_search", &cval));
+        btree->intl_prefix_search = cval.val != 0 && btree->collator == NULL;
+
+        WT_RET(__wt_config_gets(session, cfg, "leaf_key_prefix_search", &cval));
+        btree->leaf_prefix_searches = btree->collator == NULL ? (uint32_t)cval.val : 0;
+
+        WT_RET(__wt_config_gets(session, cfg, "adaptive_hash_index", &cval));
+        if (!F_ISSET(btree, WT_BTREE_SALVAGE | WT_BTREE_VERIFY))
+            btree->ahi_entries = (uint32_t)cval.val;
+
         WT_RET(__wt_config_gets(session, cfg, "internal_key_truncate", &cval));
         btree->internal_key_truncate = cval.val != 0;
 
@@ -474,6 +552,9 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
         btree->prefix_compression = cval.val != 0;
         WT_RET(__wt_config_gets(session, cfg, "prefix_compression_min", &cval));
         btree->prefix_compression_min = (u_int)cval.val;
+
+        WT_RET(__wt_config_gets(session, cfg, "value_zone_maps", &cval));
+        btree->value_zone_maps = cval.val != 0;
     /* FALLTHROUGH */
     case BTREE_COL_VAR:
         WT_RET(__wt_config_gets(session, cfg, "dictionary", &cval));
@@ -483,6 +564,11 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
 
     WT_RET(__wt_config_gets_none(session, cfg, "block_compressor", &cval));
     WT_RET(__wt_compressor_config(session, &cval, &btree->compressor));
+    if (btree->compressor != NULL && btree->compressor->customize != NULL) {
+        WT_RET(__wt_config_gets(session, cfg, "app_metadata", &metadata));
+        WT_RET(__wt_compressor_customize(session, btree->dhandle->name, &metadata,
+          &btree->compressor, &btree->compressor_owned));
+    }
 
     /*
      * Configure compression adjustment.
@@ -74,8 +74,8 @@ __wt_page_alloc(
          * array of references and optionally, the objects to which they point.
          */
         WT_ERR(
-          __wt_calloc(session, 1, sizeof(WT_PAGE_INDEX) + alloc_entries * sizeof(WT_REF *), &p));
-        size += sizeof(WT_PAGE_INDEX) + alloc_entries * sizeof(WT_REF *);
+          __wt_calloc(session, 1, WT_PAGE_INDEX_SIZE(S2BT(session), type, alloc_entries), &p));
+        size += WT_PAGE_INDEX_SIZE(S2BT(session), type, alloc_entries);
         pindex = p;
         pindex->index = (WT_REF **)((WT_PAGE_INDEX *)p + 1);
         pindex->entries = alloc_entries;
@@ -118,6 +118,44 @@ err:
     return (0);
 }
 
+/*
+ * __wti_page_index_prefix_set --
+ *     Fill in the key prefixes of a row-store internal page's index, if the tree is configured to
+ *     search them. The index must not yet be visible to other threads.
+ */
+void
+__wti_page_index_prefix_set(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_INDEX *pindex)
+{
+    size_t first_size, last_size, size, skip;
+    uint64_t *prefix;
+    uint32_t i;
+    uint8_t *first, *last, *p;
+
+    /* The 0th key is never compared, there's nothing to search on pages without another. */
+    if (!WT_PAGE_INDEX_PREFIX(S2BT(session), page->type) || pindex->entries < 2)
+        return;
+
+    /* The array was allocated with the page index, following the references. */
+    prefix = (uint64_t *)(pindex->index + pindex->entries);
+
+    /*
+     * The keys are sorted, so the bytes the first and last keys share (ignoring the 0th key) are
+     * shared by every key on the page: skip them, so the prefixes hold bytes that differ.
+     */
+    __wt_ref_key(page, pindex->index[1], &first, &first_size);
+    __wt_ref_key(page, pindex->index[pindex->entries - 1], &last, &last_size);
+    for (skip = 0; skip < WT_MIN(first_size, last_size) && first[skip] == last[skip]; ++skip)
+        ;
+
+    prefix[0] = 0;
+    for (i = 1; i < pindex->entries; ++i) {
+        __wt_ref_key(page, pindex->index[i], &p, &size);
+        prefix[i] = __wt_key_prefix(p + skip, size - skip);
+    }
+    pindex->prefix_skip = (uint32_t)skip;
+    pindex->prefix = prefix;
+}
+
 /*
  * __page_inmem_prepare_update --
  *     Create the actual update for a prepared value.
@@ -925,6 +963,8 @@ __inmem_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *sizep)
     if (overflow_keys)
         F_SET_ATOMIC_16(page, WT_PAGE_INTL_OVERFLOW_KEYS);
 
+    __wti_page_index_prefix_set(session, page, pindex);
+
 err:
     __wt_scr_free(session, &current);
     return (ret);
@@ -145,7 +145,9 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
     WT_ITEM tmp;
     WT_PAGE *notused;
     WT_REF_STATE previous_state;
-    uint32_t page_flags;
+    uint32_t mem_size, page_flags;
+    const void *image;
+    void *arena_image;
     bool prepare;
 
     /*
@@ -231,22 +233,40 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
     /* There's an address, read the backing disk page and build an in-memory version of the page. */
     WT_ERR(__wt_blkcache_read(session, &tmp, addr.addr, addr.size));
 
+    /*
+     * If the cache has a page image arena, move an allocated disk image into it: the arena places
+     * the image on the reading thread's NUMA node, in memory backed by huge pages.
+     */
+    image = tmp.data;
+    page_flags = WT_DATA_IN_ITEM(&tmp) ? WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED;
+    if (WT_DATA_IN_ITEM(&tmp) && S2C(session)->cache->arena != NULL) {
+        mem_size = ((const WT_PAGE_HEADER *)tmp.data)->mem_size;
+        if (__wt_cache_arena_alloc(session, mem_size, &arena_image)) {
+            memcpy(arena_image, tmp.data, mem_size);
+            image = arena_image;
+            FLD_SET(page_flags, WT_PAGE_DISK_ARENA);
+        }
+    }
+
     /*
      * Build the in-memory version of the page. Clear our local reference to the allocated copy of
-     * the disk image on return, the in-memory object steals it.
+     * the disk image on return, the in-memory object steals it. If the image was copied into the
+     * arena, the read buffer is no longer needed.
      *
      * If a page is read with eviction disabled, we don't count evicting it as progress. Since
      * disabling eviction allows pages to be read even when the cache is full, we want to avoid
      * workloads repeatedly reading a page with eviction disabled (e.g., a metadata page), then
      * evicting that page and deciding that is a sign that eviction is unstuck.
      */
-    page_flags = WT_DATA_IN_ITEM(&tmp) ? WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED;
     if (LF_ISSET(WT_READ_IGNORE_CACHE_SIZE))
         FLD_SET(page_flags, WT_PAGE_EVICT_NO_PROGRESS);
     if (LF_ISSET(WT_READ_PREFETCH))
         FLD_SET(page_flags, WT_PAGE_PREFETCH);
-    WT_ERR(__wti_page_inmem(session, ref, tmp.data, page_flags, &notused, &prepare));
-    tmp.mem = NULL;
+    WT_ERR(__wti_page_inmem(session, ref, image, page_flags, &notused, &prepare));
+    if (FLD_ISSET(page_flags, WT_PAGE_DISK_ARENA))
+        __wt_buf_free(session, &tmp);
+    else
+        tmp.mem = NULL;
     if (prepare)
         WT_ERR(__wti_page_inmem_prepare(session, ref));
 
@@ -442,7 +442,7 @@ __split_root(WT_SESSION_IMPL *session, WT_PAGE *root)
      * Allocate a new WT_PAGE_INDEX and set of WT_REF objects to be inserted into the root page,
      * replacing the root's page-index.
      */
-    size = sizeof(WT_PAGE_INDEX) + children * sizeof(WT_REF *);
+    size = WT_PAGE_INDEX_SIZE(btree, root->type, children);
     WT_ERR(__wt_calloc(session, 1, size, &alloc_index));
     root_incr += size;
     alloc_index->index = (WT_REF **)(alloc_index + 1);
@@ -492,11 +492,13 @@ __split_root(WT_SESSION_IMPL *session, WT_PAGE *root)
         child_incr = 0;
         for (child_refp = child_pindex->index, j = 0; j < slots; ++child_refp, ++root_refp, ++j)
             WT_ERR(__split_ref_move(session, root, root_refp, &root_decr, child_refp, &child_incr));
+        __wti_page_index_prefix_set(session, child, child_pindex);
 
         __wt_cache_page_inmem_incr(session, child, child_incr);
     }
     WT_ASSERT(session, alloc_refp - alloc_index->index == (ptrdiff_t)alloc_index->entries);
     WT_ASSERT(session, root_refp - pindex->index == (ptrdiff_t)pindex->entries);
+    __wti_page_index_prefix_set(session, root, alloc_index);
 
     /*
      * Flush our writes and start making real changes to the tree, errors are fatal.
@@ -511,13 +513,16 @@ __split_root(WT_SESSION_IMPL *session, WT_PAGE *root)
 
     /*
      * Confirm the root page's index hasn't moved, then update it, which makes the split visible to
-     * threads descending the tree.
+     * threads descending the tree. Change the root page's split version on either side of the
+     * update, threads validating split versions restart their descent.
      */
 #ifdef HAVE_DIAGNOSTIC
     WT_INTL_INDEX_GET_SAFE(root, check_root);
     WT_ASSERT(session, check_root == pindex);
 #endif
+    __wt_page_split_version_bump(root);
     WT_INTL_INDEX_SET(root, alloc_index);
+    __wt_page_split_version_bump(root);
     alloc_index = NULL;
 
     /* Encourage a race */
@@ -553,7 +558,7 @@ __split_root(WT_SESSION_IMPL *session, WT_PAGE *root)
      * may already be using the new index.
      */
     WT_SPLIT_PAGE_SAVE_STATE(root, session, root->entries, split_gen);
-    size = sizeof(WT_PAGE_INDEX) + pindex->entries * sizeof(WT_REF *);
+    size = WT_PAGE_INDEX_SIZE(btree, root->type, pindex->entries);
     WT_TRET(__split_safe_free(session, split_gen, false, pindex, size));
     root_decr += size;
 
@@ -747,7 +752,7 @@ __split_parent(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF **ref_new, uint32_t
      * based on an older page-index, and the change isn't backed out in the case of an error, so
      * there ways for the hint to be wrong; OK because it's just a hint.
      */
-    size = sizeof(WT_PAGE_INDEX) + result_entries * sizeof(WT_REF *);
+    size = WT_PAGE_INDEX_SIZE(btree, parent->type, result_entries);
     WT_ERR(__wt_calloc(session, 1, size, &alloc_index));
     parent_incr += size;
     alloc_index->index = (WT_REF **)(alloc_index + 1);
@@ -779,6 +784,8 @@ __split_parent(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF **ref_new, uint32_t
     /* Check we filled in the expected number of entries. */
     WT_ASSERT(session, alloc_refp - alloc_index->index == (ptrdiff_t)result_entries);
 
+    __wti_page_index_prefix_set(session, parent, alloc_index);
+
     /* Start making real changes to the tree, errors are fatal. */
     WT_NOT_READ(complete, WT_ERR_PANIC);
 
@@ -787,18 +794,28 @@ __split_parent(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF **ref_new, uint32_t
 
     /*
      * Confirm the parent page's index hasn't moved then update it, which makes the split visible to
-     * threads descending the tree.
+     * threads descending the tree. Change the parent page's split version on either side of the
+     * update, threads validating split versions restart their descent.
      */
 #ifdef HAVE_DIAGNOSTIC
     WT_INTL_INDEX_GET_SAFE(parent, check_pindex);
     WT_ASSERT(session, check_pindex == pindex);
 #endif
+    __wt_page_split_version_bump(parent);
     WT_INTL_INDEX_SET(parent, alloc_index);
+    __wt_page_split_version_bump(parent);
     alloc_index = NULL;
 
     /* Encourage a race */
     __wt_timing_stress(session, WT_TIMING_STRESS_SPLIT_4, NULL);
 
+    /*
+     * The adaptive hash index reaches WT_REFs without the page index: if we're discarding WT_REFs,
+     * invalidate it before getting the generation that protects them.
+     */
+    if (discard || deleted_entries != 0)
+        __wt_btree_ahi_invalidate(btree);
+
     /*
      * Get a generation for this split, mark the page. This must be after the new index is swapped
      * into place in order to know that no readers with the new generation will look at the old
@@ -851,7 +868,7 @@ __split_parent(WT_SESSION_IMPL *session, WT_REF *ref, WT_REF **ref_new, uint32_t
      * discard list, to be freed when it's safe.
      */
     WT_SPLIT_PAGE_SAVE_STATE(parent, session, parent_entries, split_gen);
-    size = sizeof(WT_PAGE_INDEX) + pindex->entries * sizeof(WT_REF *);
+    size = WT_PAGE_INDEX_SIZE(btree, parent->type, pindex->entries);
     WT_TRET(__split_safe_free(session, split_gen, exclusive, pindex, size));
     parent_decr += size;
 
@@ -972,13 +989,14 @@ __split_internal(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_PAGE *page)
      *
      * Create and initialize a replacement WT_PAGE_INDEX for the original page.
      */
-    size = sizeof(WT_PAGE_INDEX) + chunk * sizeof(WT_REF *);
+    size = WT_PAGE_INDEX_SIZE(btree, page->type, chunk);
     WT_ERR(__wt_calloc(session, 1, size, &replace_index));
     page_incr += size;
     replace_index->index = (WT_REF **)(replace_index + 1);
     replace_index->entries = chunk;
     for (page_refp = pindex->index, i = 0; i < chunk; ++i)
         replace_index->index[i] = *page_refp++;
+    __wti_page_index_prefix_set(session, page, replace_index);
 
     /*
      * Allocate a new WT_PAGE_INDEX and set of WT_REF objects to be inserted into the page's parent,
@@ -1039,6 +1057,7 @@ __split_internal(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_PAGE *page)
         child_incr = 0;
         for (child_refp = child_pindex->index, j = 0; j < slots; ++child_refp, ++page_refp, ++j)
             WT_ERR(__split_ref_move(session, page, page_refp, &page_decr, child_refp, &child_incr));
+        __wti_page_index_prefix_set(session, child, child_pindex);
 
         __wt_cache_page_inmem_incr(session, child, child_incr);
     }
@@ -1056,6 +1075,13 @@ __split_internal(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_PAGE *page)
     /* Encourage a race */
     __wt_timing_stress(session, WT_TIMING_STRESS_SPLIT_5, NULL);
 
+    /*
+     * The page's split version changes before the split into the parent and again once the page's
+     * index is truncated: a thread that read the page's original index before the split, and holds
+     * it as the parent of its descent, sees the change.
+     */
+    __wt_page_split_version_bump(page);
+
     /* Split into the parent. */
     WT_ERR(__split_parent(
       session, page_ref, alloc_index->index, alloc_index->entries, parent_incr, false, false));
@@ -1069,6 +1095,7 @@ __split_internal(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_PAGE *page)
     WT_ASSERT(session, check_pindex == pindex);
 #endif
     WT_INTL_INDEX_SET(page, replace_index);
+    __wt_page_split_version_bump(page);
 
     /* Encourage a race */
     __wt_timing_stress(session, WT_TIMING_STRESS_SPLIT_6, NULL);
@@ -1108,7 +1135,7 @@ __split_internal(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_PAGE *page)
      * using the new parent page.
      */
     WT_SPLIT_PAGE_SAVE_STATE(page, session, page->entries, split_gen);
-    size = sizeof(WT_PAGE_INDEX) + pindex->entries * sizeof(WT_REF *);
+    size = WT_PAGE_INDEX_SIZE(btree, page->type, pindex->entries);
     WT_TRET(__split_safe_free(session, split_gen, false, pindex, size));
     page_decr += size;
 
@@ -1542,6 +1569,9 @@ __split_multi_inmem(WT_SESSION_IMPL *session, WT_PAGE *orig, WT_MULTI *multi, WT
         }
     }
 
+    /* The restored update chains can reference memory allocated from the original page's arenas. */
+    WT_ERR(__wt_page_arena_inherit(session, orig, page));
+
     /*
      * When modifying the page we set the first dirty transaction to the last transaction currently
      * running. However, the updates we made might be older than that. Set the first dirty
@@ -1748,6 +1778,7 @@ __wt_multi_to_ref(WT_SESSION_IMPL *session, WT_PAGE *page, WT_MULTI *multi, WT_R
         WT_RET(__wt_calloc_one(session, &addr));
         ref->addr = addr;
         WT_TIME_AGGREGATE_COPY(&addr->ta, &multi->addr.ta);
+        addr->zone = multi->addr.zone;
         WT_RET(__wt_memdup(session, multi->addr.addr, multi->addr.size, &addr->addr));
         addr->size = multi->addr.size;
         addr->type = multi->addr.type;
@@ -1846,6 +1877,9 @@ __split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
     WT_ERR(__wt_page_modify_init(session, right));
     __wt_page_modify_set(session, right);
 
+    /* The moved insert list entry can reference memory allocated from the page's arenas. */
+    WT_ERR(__wt_page_arena_inherit(session, page, right));
+
     if (type == WT_PAGE_ROW_LEAF) {
         WT_ERR(__wt_calloc_one(session, &right->modify->mod_row_insert));
         WT_ERR(__wt_calloc_one(session, &right->modify->mod_row_insert[0]));
@@ -1881,14 +1915,18 @@ __split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
 
     /*
      * Calculate how much memory we're moving: figure out how deep the skip list stack is for the
-     * element we are moving, and the memory used by the item's list of updates.
+     * element we are moving, and the memory used by the item's list of updates. Memory allocated
+     * from the page's arena stays charged to the page with the arena.
      */
     for (i = 0; i < WT_SKIP_MAXDEPTH && ins_head->tail[i] == moved_ins; ++i)
         ;
-    WT_MEM_TRANSFER(page_decr, right_incr, sizeof(WT_INSERT) + (size_t)i * sizeof(WT_INSERT *));
-    if (type == WT_PAGE_ROW_LEAF)
-        WT_MEM_TRANSFER(page_decr, right_incr, WT_INSERT_KEY_SIZE(moved_ins));
-    WT_MEM_TRANSFER(page_decr, right_incr, __wt_update_list_memsize(moved_ins->upd));
+    if (!S2BT(session)->page_arena) {
+        WT_MEM_TRANSFER(
+          page_decr, right_incr, sizeof(WT_INSERT) + (size_t)i * sizeof(WT_INSERT *));
+        if (type == WT_PAGE_ROW_LEAF)
+            WT_MEM_TRANSFER(page_decr, right_incr, WT_INSERT_KEY_SIZE(moved_ins));
+    }
+    WT_MEM_TRANSFER(page_decr, right_incr, __wt_update_list_page_memsize(moved_ins->upd));
 
     /*
      * Move the last insert list item from the original page to the new page.
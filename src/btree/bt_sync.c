@@ -124,6 +124,124 @@ __sync_dup_walk(WT_SESSION_IMPL *session, WT_REF *walk, uint32_t flags, WT_REF *
     return (0);
 }
 
+/*
+ * __sync_leaf_queue --
+ *     Hand a dirty leaf page to a checkpoint helper thread if there's a free slot. The page stays
+ *     pinned by a duplicate hazard pointer until the checkpoint collects it.
+ */
+static int
+__sync_leaf_queue(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t rec_flags, bool *queuedp)
+{
+    WT_CKPT_CONNECTION *ckpt;
+    WT_CKPT_LEAF *leaf;
+    uint32_t i;
+
+    *queuedp = false;
+    ckpt = &S2C(session)->ckpt;
+
+    if (ckpt->leaf_entries == 0 || !WT_SESSION_IS_CHECKPOINT(session))
+        return (0);
+
+    for (i = 0, leaf = ckpt->leaf; i < ckpt->leaf_entries; ++i, ++leaf)
+        if (__wt_atomic_load32(&leaf->state) == WT_CKPT_LEAF_EMPTY)
+            break;
+    if (i == ckpt->leaf_entries)
+        return (0);
+
+    WT_RET(__sync_dup_hazard_pointer(session, ref));
+    leaf->ref = ref;
+    leaf->dhandle = session->dhandle;
+    leaf->session = session;
+    leaf->rec_flags = rec_flags;
+    WT_RELEASE_WRITE(leaf->state, WT_CKPT_LEAF_QUEUED);
+    __wt_cond_signal(session, ckpt->thread_group.wait_cond);
+
+    *queuedp = true;
+    return (0);
+}
+
+/*
+ * __sync_leaf_drain --
+ *     Wait for the leaf pages handed to helper threads, write any page a helper didn't get to or
+ *     failed to write, and release the pages. Internal pages are only written after a drain, so
+ *     they are always written after their children. If abandoning the sync, don't write anything.
+ */
+static int
+__sync_leaf_drain(WT_SESSION_IMPL *session, uint32_t flags, bool abandon)
+{
+    WT_CKPT_CONNECTION *ckpt;
+    WT_CKPT_LEAF *leaf;
+    WT_DECL_RET;
+    uint32_t i, state;
+
+    ckpt = &S2C(session)->ckpt;
+
+    for (i = 0, leaf = ckpt->leaf; i < ckpt->leaf_entries; ++i, ++leaf) {
+        for (;;) {
+            WT_ACQUIRE_READ(state, leaf->state);
+            if (state == WT_CKPT_LEAF_EMPTY || state == WT_CKPT_LEAF_DONE ||
+              state == WT_CKPT_LEAF_RETRY)
+                break;
+
+            /* Take back pages no helper has started on. */
+            if (state == WT_CKPT_LEAF_QUEUED &&
+              __wt_atomic_cas32(&leaf->state, WT_CKPT_LEAF_QUEUED, WT_CKPT_LEAF_RETRY)) {
+                state = WT_CKPT_LEAF_RETRY;
+                break;
+            }
+            __wt_yield();
+        }
+        if (state == WT_CKPT_LEAF_EMPTY)
+            continue;
+
+        if (state == WT_CKPT_LEAF_RETRY && !abandon && ret == 0)
+            ret = __wt_reconcile(session, leaf->ref, NULL, leaf->rec_flags);
+        WT_TRET(__wt_page_release(session, leaf->ref, flags));
+
+        leaf->ref = NULL;
+        leaf->dhandle = NULL;
+        leaf->session = NULL;
+        WT_RELEASE_WRITE(leaf->state, WT_CKPT_LEAF_EMPTY);
+    }
+
+    return (ret);
+}
+
+/*
+ * __wt_sync_leaf_help --
+ *     Write the leaf pages a checkpoint's tree sync has handed off. Called by checkpoint helper
+ *     threads, running with the checkpoint's snapshot.
+ */
+void
+__wt_sync_leaf_help(WT_SESSION_IMPL *session, bool *workedp)
+{
+    WT_CKPT_CONNECTION *ckpt;
+    WT_CKPT_LEAF *leaf;
+    WT_DECL_RET;
+    uint32_t i;
+
+    ckpt = &S2C(session)->ckpt;
+
+    for (i = 0, leaf = ckpt->leaf; i < ckpt->leaf_entries; ++i, ++leaf) {
+        if (__wt_atomic_load32(&leaf->state) != WT_CKPT_LEAF_QUEUED ||
+          !__wt_atomic_cas32(&leaf->state, WT_CKPT_LEAF_QUEUED, WT_CKPT_LEAF_BUSY))
+            continue;
+
+        /*
+         * Act as the syncing session while writing the page, the checkpoint is relying on this
+         * write the same way it relies on its own.
+         */
+        session->ckpt.sync_owner = leaf->session;
+        WT_WITH_DHANDLE(
+          session, leaf->dhandle, ret = __wt_reconcile(session, leaf->ref, NULL, leaf->rec_flags));
+        session->ckpt.sync_owner = NULL;
+
+        /* The checkpoint writes the page itself if we failed. */
+        WT_RELEASE_WRITE(leaf->state, ret == 0 ? WT_CKPT_LEAF_DONE : WT_CKPT_LEAF_RETRY);
+        *workedp = true;
+    }
+}
+
 /*
  * __wt_sync_file --
  *     Flush pages for a specific file.
@@ -141,13 +259,13 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
     uint64_t internal_bytes, internal_pages, leaf_bytes, leaf_pages;
     uint64_t oldest_id, saved_pinned_id, time_start, time_stop;
     uint32_t flags, rec_flags;
-    bool dirty, is_hs, is_internal, tried_eviction;
+    bool dirty, is_hs, is_internal, queued, queued_leaves, tried_eviction;
 
     conn = S2C(session);
     btree = S2BT(session);
     prev = walk = NULL;
     txn = session->txn;
-    tried_eviction = false;
+    queued_leaves = tried_eviction = false;
 
     /* Don't bump page read generations. */
     flags = WT_READ_INTERNAL_OP;
@@ -181,6 +299,14 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
          */
         oldest_id = __wt_txn_oldest_id(session);
 
+        /*
+         * Older versions of the updates being written have to go to the history store, exactly as
+         * in the checkpoint pass that will follow.
+         */
+        rec_flags = WT_REC_CHECKPOINT;
+        if (!WT_IS_HS(btree->dhandle) && !WT_IS_METADATA(btree->dhandle))
+            rec_flags |= WT_REC_HS;
+
         LF_SET(WT_READ_CACHE | WT_READ_NO_WAIT | WT_READ_SKIP_INTL);
         if (!F_ISSET(txn, WT_TXN_HAS_SNAPSHOT))
             LF_SET(WT_READ_VISIBLE_ALL);
@@ -202,7 +328,7 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
                     __wt_txn_get_snapshot(session);
                 leaf_bytes += __wt_atomic_loadsize(&page->memory_footprint);
                 ++leaf_pages;
-                WT_ERR(__wt_reconcile(session, walk, NULL, WT_REC_CHECKPOINT));
+                WT_ERR(__wt_reconcile(session, walk, NULL, rec_flags));
             }
         }
         break;
@@ -272,10 +398,20 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
             WT_ERR(__sync_dup_walk(session, walk, flags, &prev));
             WT_ERR(__wt_tree_walk_custom_skip(session, &walk, NULL, NULL, flags));
 
+            is_internal = walk == NULL || F_ISSET(walk, WT_REF_FLAG_INTERNAL);
+
+            /*
+             * Wait for any leaf pages written by helper threads before looking at an internal page:
+             * they dirty the parent when they finish.
+             */
+            if (is_internal && queued_leaves) {
+                queued_leaves = false;
+                WT_ERR(__sync_leaf_drain(session, flags, false));
+            }
+
             if (walk == NULL)
                 break;
 
-            is_internal = F_ISSET(walk, WT_REF_FLAG_INTERNAL);
             page = walk->page;
 
             if (is_internal)
@@ -357,7 +493,13 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
             if (FLD_ISSET(rec_flags, WT_REC_HS))
                 WT_STAT_CONN_INCR(session, checkpoint_hs_pages_reconciled);
 
-            WT_ERR(__wt_reconcile(session, walk, NULL, rec_flags));
+            queued = false;
+            if (!is_internal)
+                WT_ERR(__sync_leaf_queue(session, walk, rec_flags, &queued));
+            if (queued)
+                queued_leaves = true;
+            else
+                WT_ERR(__wt_reconcile(session, walk, NULL, rec_flags));
 
             /*
              * Update checkpoint IO tracking data if configured to log verbose progress messages.
@@ -404,6 +546,10 @@ __wt_sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
     }
 
 err:
+    /* On error, collect any leaf pages still with the helper threads. */
+    if (queued_leaves)
+        WT_TRET(__sync_leaf_drain(session, flags, true));
+
     /* On error, clear any left-over tree walk. */
     WT_TRET(__wt_page_release(session, walk, flags));
     WT_TRET(__wt_page_release(session, prev, flags));
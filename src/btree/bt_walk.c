@@ -267,7 +267,7 @@ restart:
                 *refp = ref;
                 WT_ASSERT(session, ref != ref_orig);
 
-                if (__wt_session_prefetch_check(session, ref))
+                if (__wt_session_prefetch_check(session, ref, true))
                     WT_ERR(__wti_btree_prefetch(session, ref));
 
                 goto done;
@@ -338,7 +338,7 @@ descend:
                 /* Success, so "couple" has been released. */
                 couple = NULL;
 
-                if (__wt_session_prefetch_check(session, ref))
+                if (__wt_session_prefetch_check(session, ref, true))
                     WT_ERR(__wti_btree_prefetch(session, ref));
 
                 /* Return leaf pages to our caller. */
@@ -8,7 +8,8 @@
 
 #include "wt_internal.h"
 
-static int __col_insert_alloc(WT_SESSION_IMPL *, uint64_t, u_int, WT_INSERT **, size_t *);
+static int __col_insert_alloc(
+  WT_SESSION_IMPL *, WT_PAGE *, uint64_t, u_int, WT_INSERT **, size_t *);
 
 /*
  * __wt_col_modify --
@@ -131,7 +132,7 @@ __wt_col_modify(WT_CURSOR_BTREE *cbt, uint64_t recno, const WT_ITEM *value, WT_U
             WT_ERR(__wt_txn_modify_check(session, cbt, old_upd, &prev_upd_ts, modify_type));
 
             /* Allocate a WT_UPDATE structure and transaction ID. */
-            WT_ERR(__wt_upd_alloc(session, value, modify_type, &upd, &upd_size));
+            WT_ERR(__wt_upd_alloc_pool(session, value, modify_type, &upd, &upd_size));
             upd->prev_durable_ts = prev_upd_ts;
             WT_ERR(__wt_txn_modify(session, upd));
             added_to_txn = true;
@@ -139,7 +140,7 @@ __wt_col_modify(WT_CURSOR_BTREE *cbt, uint64_t recno, const WT_ITEM *value, WT_U
             /* Avoid WT_CURSOR.update data copy. */
             __wt_upd_value_assign(cbt->modify_update, upd);
         } else {
-            upd_size = __wt_update_list_memsize(upd);
+            upd_size = __wt_update_list_page_memsize(upd);
 
             /* If there are existing updates, append them after the new updates. */
             for (last_upd = upd; last_upd->next != NULL; last_upd = last_upd->next)
@@ -200,7 +201,7 @@ __wt_col_modify(WT_CURSOR_BTREE *cbt, uint64_t recno, const WT_ITEM *value, WT_U
          * Allocate a WT_INSERT/WT_UPDATE pair and transaction ID, and update the cursor to
          * reference it (the WT_INSERT_HEAD might be allocated, the WT_INSERT was allocated).
          */
-        WT_ERR(__col_insert_alloc(session, recno, skipdepth, &ins, &ins_size));
+        WT_ERR(__col_insert_alloc(session, page, recno, skipdepth, &ins, &ins_size));
         cbt->ins_head = ins_head;
         cbt->ins = ins;
 
@@ -213,7 +214,7 @@ __wt_col_modify(WT_CURSOR_BTREE *cbt, uint64_t recno, const WT_ITEM *value, WT_U
             (recno != WT_RECNO_OOB && mod->mod_col_split_recno > recno));
 
         if (upd_arg == NULL) {
-            WT_ERR(__wt_upd_alloc(session, value, modify_type, &upd, &upd_size));
+            WT_ERR(__wt_upd_alloc_arena(session, page, value, modify_type, &upd, &upd_size));
             upd->prev_durable_ts = prev_upd_ts;
             WT_ERR(__wt_txn_modify(session, upd));
             added_to_txn = true;
@@ -221,7 +222,7 @@ __wt_col_modify(WT_CURSOR_BTREE *cbt, uint64_t recno, const WT_ITEM *value, WT_U
             /* Avoid WT_CURSOR.update data copy. */
             __wt_upd_value_assign(cbt->modify_update, upd);
         } else
-            upd_size = __wt_update_list_memsize(upd);
+            upd_size = __wt_update_list_page_memsize(upd);
         ins->upd = upd;
         ins_size += upd_size;
 
@@ -294,13 +295,13 @@ err:
                 __wt_txn_unmodify(session);
 
             /* Free any allocated insert list object. */
-            __wt_free(session, ins);
+            __wt_insert_free(session, &ins);
 
             cbt->ins = NULL;
 
             /* Discard any allocated update, unless we failed after linking it into page memory. */
             if (upd_arg == NULL)
-                __wt_free(session, upd);
+                __wt_upd_free(session, &upd);
 
             /*
              * When prepending a list of updates to an update chain, we link them together; sever
@@ -326,8 +327,8 @@ err:
  *     Column-store insert: allocate a WT_INSERT structure and fill it in.
  */
 static int
-__col_insert_alloc(
-  WT_SESSION_IMPL *session, uint64_t recno, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep)
+__col_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page, uint64_t recno, u_int skipdepth,
+  WT_INSERT **insp, size_t *ins_sizep)
 {
     WT_INSERT *ins;
     size_t ins_size;
@@ -337,11 +338,15 @@ __col_insert_alloc(
      * place.
      */
     ins_size = sizeof(WT_INSERT) + skipdepth * sizeof(WT_INSERT *);
-    WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+    if (S2BT(session)->page_arena)
+        WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
+    else
+        WT_RET(__wt_calloc(session, 1, ins_size, &ins));
 
     WT_INSERT_RECNO(ins) = recno;
 
+    /* The arena's memory is charged to the page as the arena grows. */
     *insp = ins;
-    *ins_sizep = ins_size;
+    *ins_sizep = S2BT(session)->page_arena ? 0 : ins_size;
     return (0);
 }
@@ -357,6 +357,91 @@ next:
     return (0);
 }
 
+/*
+ * __wti_row_leaf_keydir --
+ *     Build a row-store leaf page's directory of key prefixes.
+ */
+int
+__wti_row_leaf_keydir(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    WT_DECL_ITEM(key);
+    WT_DECL_ITEM(last);
+    WT_DECL_RET;
+    WT_ROW *rip;
+    WT_ROW_KEYDIR *keydir;
+    size_t key_size, size, skip;
+    uint32_t i;
+    uint8_t key_prefix;
+    void *copy;
+    const void *key_data;
+
+    keydir = NULL;
+
+    if (page->entries == 0)
+        return (0);
+
+    WT_ERR(__wt_scr_alloc(session, 0, &key));
+    WT_ERR(__wt_scr_alloc(session, 0, &last));
+
+    /*
+     * The keys are sorted, so the bytes the first and last keys share are shared by every key on
+     * the page: skip them, so the prefixes hold bytes that differ.
+     */
+    WT_ERR(__wt_row_leaf_key_copy(session, page, page->pg_row, last));
+    WT_ERR(__wt_row_leaf_key(session, page, page->pg_row + (page->entries - 1), key, false));
+    for (skip = 0; skip < WT_MIN(key->size, last->size) &&
+         ((const uint8_t *)key->data)[skip] == ((const uint8_t *)last->data)[skip];
+         ++skip)
+        ;
+
+    /* Allocate the directory, the prefixes and the shared bytes in a single chunk. */
+    size = sizeof(WT_ROW_KEYDIR) + page->entries * sizeof(uint64_t) + skip;
+    WT_ERR(__wt_calloc(session, 1, size, &keydir));
+    keydir->prefix = (uint64_t *)(keydir + 1);
+    keydir->skip_data = (uint8_t *)(keydir->prefix + page->entries);
+    memcpy(keydir->skip_data, last->data, skip);
+    keydir->skip = (uint32_t)skip;
+    keydir->entries = page->entries;
+
+    /*
+     * Walk the keys in order, building each prefix-compressed key from the key before it, rather
+     * than rolling forward from an instantiated key for every slot. Keys that aren't cheaply
+     * available (for example, overflow keys), take the slow path.
+     */
+    WT_ROW_FOREACH (page, rip, i) {
+        /* The row-store key can change underfoot; explicitly take a copy. */
+        copy = WT_ROW_KEY_COPY(rip);
+        __wt_row_leaf_key_info(page, copy, NULL, NULL, &key_data, &key_size, &key_prefix);
+        if (key_data == NULL) {
+            WT_ERR(__wt_row_leaf_key(session, page, rip, key, false));
+            WT_ERR(__wt_buf_set(session, last, key->data, key->size));
+        } else {
+            WT_ERR(__wt_buf_grow(session, last, key_prefix + key_size));
+            memcpy((uint8_t *)last->data + key_prefix, key_data, key_size);
+            last->size = key_prefix + key_size;
+        }
+        WT_ASSERT(session, last->size >= skip);
+        keydir->prefix[WT_ROW_SLOT(page, rip)] =
+          __wt_key_prefix((const uint8_t *)last->data + skip, last->size - skip);
+    }
+
+    /*
+     * Serialize the swap of the directory into place: on success, update the page's memory
+     * footprint, on failure, free the allocated memory.
+     */
+    if (__wt_atomic_cas_ptr(&page->pg_row_keydir, NULL, keydir))
+        __wt_cache_page_inmem_incr(session, page, size);
+    else
+        __wt_free(session, keydir);
+    keydir = NULL;
+
+err:
+    __wt_free(session, keydir);
+    __wt_scr_free(session, &key);
+    __wt_scr_free(session, &last);
+    return (ret);
+}
+
 /*
  * __wt_row_ikey_alloc --
  *     Instantiate a key in a WT_IKEY structure.
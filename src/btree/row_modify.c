@@ -41,8 +41,8 @@ err:
  *     Row-store insert: allocate a WT_INSERT structure and fill it in.
  */
 static int
-__row_insert_alloc(WT_SESSION_IMPL *session, const WT_ITEM *key, u_int skipdepth, WT_INSERT **insp,
-  size_t *ins_sizep)
+__row_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page, const WT_ITEM *key, u_int skipdepth,
+  WT_INSERT **insp, size_t *ins_sizep)
 {
     WT_INSERT *ins;
     size_t ins_size;
@@ -52,15 +52,19 @@ __row_insert_alloc(WT_SESSION_IMPL *session, const WT_ITEM *key, u_int skipdepth
      * copy the key into place.
      */
     ins_size = sizeof(WT_INSERT) + skipdepth * sizeof(WT_INSERT *) + key->size;
-    WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+    if (S2BT(session)->page_arena)
+        WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
+    else
+        WT_RET(__wt_calloc(session, 1, ins_size, &ins));
 
     ins->u.key.offset = WT_STORE_SIZE(ins_size - key->size);
     WT_INSERT_KEY_SIZE(ins) = WT_STORE_SIZE(key->size);
     memcpy(WT_INSERT_KEY(ins), key->data, key->size);
 
+    /* The arena's memory is charged to the page as the arena grows. */
     *insp = ins;
     if (ins_sizep != NULL)
-        *ins_sizep = ins_size;
+        *ins_sizep = S2BT(session)->page_arena ? 0 : ins_size;
     return (0);
 }
 
@@ -139,7 +143,7 @@ __wt_row_modify(WT_CURSOR_BTREE *cbt, const WT_ITEM *key, const WT_ITEM *value,
               __wt_txn_modify_check(session, cbt, old_upd = *upd_entry, &prev_upd_ts, modify_type));
 
             /* Allocate a WT_UPDATE structure and transaction ID. */
-            WT_ERR(__wt_upd_alloc(session, value, modify_type, &upd, &upd_size));
+            WT_ERR(__wt_upd_alloc_pool(session, value, modify_type, &upd, &upd_size));
             upd->prev_durable_ts = prev_upd_ts;
             WT_ERR(__wt_txn_modify(session, upd));
             added_to_txn = true;
@@ -166,7 +170,7 @@ __wt_row_modify(WT_CURSOR_BTREE *cbt, const WT_ITEM *key, const WT_ITEM *value,
                 (upd_arg->type == WT_UPDATE_TOMBSTONE && upd_arg->next != NULL &&
                   upd_arg->next->type == WT_UPDATE_STANDARD && upd_arg->next->next == NULL));
 
-            upd_size = __wt_update_list_memsize(upd);
+            upd_size = __wt_update_list_page_memsize(upd);
 
             /* If there are existing updates, append them after the new updates. */
             for (last_upd = upd; last_upd->next != NULL; last_upd = last_upd->next)
@@ -224,12 +228,12 @@ __wt_row_modify(WT_CURSOR_BTREE *cbt, const WT_ITEM *key, const WT_ITEM *value,
          * Allocate a WT_INSERT/WT_UPDATE pair and transaction ID, and update the cursor to
          * reference it (the WT_INSERT_HEAD might be allocated, the WT_INSERT was allocated).
          */
-        WT_ERR(__row_insert_alloc(session, key, skipdepth, &ins, &ins_size));
+        WT_ERR(__row_insert_alloc(session, page, key, skipdepth, &ins, &ins_size));
         cbt->ins_head = ins_head;
         cbt->ins = ins;
 
         if (upd_arg == NULL) {
-            WT_ERR(__wt_upd_alloc(session, value, modify_type, &upd, &upd_size));
+            WT_ERR(__wt_upd_alloc_arena(session, page, value, modify_type, &upd, &upd_size));
             WT_ERR(__wt_txn_modify(session, upd));
             added_to_txn = true;
 
@@ -246,7 +250,7 @@ __wt_row_modify(WT_CURSOR_BTREE *cbt, const WT_ITEM *key, const WT_ITEM *value,
                   upd_arg->next->type == WT_UPDATE_STANDARD && upd_arg->next->next == NULL) ||
                 (upd_arg->type == WT_UPDATE_STANDARD && upd_arg->next == NULL));
 
-            upd_size = __wt_update_list_memsize(upd);
+            upd_size = __wt_update_list_page_memsize(upd);
         }
 
         ins->upd = upd;
@@ -315,13 +319,13 @@ err:
                 __wt_txn_unmodify(session);
 
             /* Free any allocated insert list object. */
-            __wt_free(session, ins);
+            __wt_insert_free(session, &ins);
 
             cbt->ins = NULL;
 
             /* Discard any allocated update, unless we failed after linking it into page memory. */
             if (upd_arg == NULL)
-                __wt_free(session, upd);
+                __wt_upd_free(session, &upd);
 
             /*
              * When prepending a list of updates to an update chain, we link them together; sever
@@ -419,8 +423,7 @@ __wt_update_obsolete_check(
          * checkpoints cleaning a page.
          */
         if (update_accounting) {
-            for (size = 0, upd = next; upd != NULL; upd = upd->next)
-                size += WT_UPDATE_MEMSIZE(upd);
+            size = __wt_update_list_page_memsize(next);
             if (size != 0)
                 __wt_cache_page_inmem_decr(session, page, size);
         }
@@ -347,6 +347,188 @@ __check_leaf_key_range(
     return (0);
 }
 
+/*
+ * __search_prefix --
+ *     Narrow a binary search using an array of key prefixes. Keys with smaller prefixes sort before
+ *     the search key and keys with larger prefixes sort after it, so only keys with the same prefix
+ *     need to be compared.
+ */
+static WT_INLINE void
+__search_prefix(const uint64_t *prefix, const void *skip_data, size_t skip, WT_ITEM *srch_key,
+  uint32_t *basep, uint32_t *limitp)
+{
+    uint64_t srch_prefix;
+    uint32_t base, end, high, indx, limit;
+    int cmp;
+
+    base = *basep;
+    end = base + *limitp;
+
+    /*
+     * Compare the bytes every key in the range shares: if the search key doesn't share them, it
+     * sorts before or after every key in the range.
+     */
+    if (skip != 0) {
+        cmp = memcmp(srch_key->data, skip_data, WT_MIN(srch_key->size, skip));
+        if (cmp < 0 || (cmp == 0 && srch_key->size < skip)) {
+            *limitp = 0;
+            return;
+        }
+        if (cmp > 0) {
+            *basep = end;
+            *limitp = 0;
+            return;
+        }
+    }
+    srch_prefix = __wt_key_prefix((const uint8_t *)srch_key->data + skip, srch_key->size - skip);
+
+    /* Find the first slot with a prefix not less than the search key's. */
+    for (limit = end - base; limit != 0; limit >>= 1) {
+        indx = base + (limit >> 1);
+        if (prefix[indx] < srch_prefix) {
+            base = indx + 1;
+            --limit;
+        }
+    }
+
+    /* Then the first slot with a larger prefix. */
+    for (high = base, limit = end - base; limit != 0; limit >>= 1) {
+        indx = high + (limit >> 1);
+        if (prefix[indx] <= srch_prefix) {
+            high = indx + 1;
+            --limit;
+        }
+    }
+
+    *basep = base;
+    *limitp = high - base;
+}
+
+/*
+ * __search_leaf_prefix --
+ *     Narrow the binary search of a row-store leaf page using the page's key prefix directory,
+ *     building the directory if the page has been searched often enough.
+ */
+static WT_INLINE int
+__search_leaf_prefix(WT_SESSION_IMPL *session, WT_BTREE *btree, WT_PAGE *page, WT_ITEM *srch_key,
+  uint32_t *basep, uint32_t *limitp)
+{
+    WT_ROW_KEYDIR *keydir;
+
+    WT_ACQUIRE_READ(keydir, page->pg_row_keydir);
+    if (keydir == NULL) {
+        /* Only the search reaching the configured count builds the directory. */
+        if (__wt_atomic_add32(&page->u.row.keydir_searches, 1) != btree->leaf_prefix_searches)
+            return (0);
+        WT_RET(__wti_row_leaf_keydir(session, page));
+        WT_ACQUIRE_READ(keydir, page->pg_row_keydir);
+        if (keydir == NULL)
+            return (0);
+    }
+
+    __search_prefix(keydir->prefix, keydir->skip_data, keydir->skip, srch_key, basep, limitp);
+    return (0);
+}
+
+/*
+ * __search_ahi --
+ *     Check the tree's adaptive hash index for the key's leaf page and slot, and if the key is
+ *     still there, position the cursor on it.
+ */
+static WT_INLINE int
+__search_ahi(WT_SESSION_IMPL *session, WT_BTREE *btree, WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key,
+  uint64_t hash, uint64_t epoch, bool *foundp)
+{
+    WT_AHI_ENTRY *entry;
+    WT_DECL_RET;
+    WT_PAGE *page;
+    WT_REF *ref;
+    uint64_t version;
+    uint32_t slot;
+    int cmp;
+
+    *foundp = false;
+
+    /*
+     * Read the entry under its sequence lock. Ignore entries installed before the index was last
+     * invalidated, their WT_REF may have been freed. Our caller read the epoch inside a split
+     * generation, so WT_REFs freed since then haven't been discarded.
+     */
+    entry = &btree->ahi[hash % btree->ahi_entries];
+    WT_ACQUIRE_READ(version, entry->version);
+    if ((version & 1) != 0 || entry->hash != hash || entry->epoch != epoch)
+        return (0);
+    ref = entry->ref;
+    slot = entry->slot;
+    WT_ACQUIRE_BARRIER();
+    if (ref == NULL || __wt_atomic_load64(&entry->version) != version)
+        return (0);
+
+    /*
+     * Only use the page if it's in memory, and check the key is still in the slot: the page may
+     * have been evicted and read again, or the entry may be for another key with the same hash.
+     */
+    if ((ret = __wt_page_in(session, ref, WT_READ_CACHE | WT_READ_NO_SPLIT | WT_READ_NO_WAIT)) !=
+      0)
+        return (ret == WT_NOTFOUND || ret == WT_RESTART ? 0 : ret);
+    page = ref->page;
+    if (page->type == WT_PAGE_ROW_LEAF && slot < page->entries) {
+        WT_ERR(__wt_row_leaf_key(session, page, page->pg_row + slot, cbt->tmp, true));
+        WT_ERR(__wt_compare(session, btree->collator, srch_key, cbt->tmp, &cmp));
+        if (cmp == 0) {
+            cbt->ref = ref;
+            cbt->compare = 0;
+            cbt->slot = slot;
+            *foundp = true;
+            return (0);
+        }
+    }
+
+err:
+    WT_TRET(__wt_page_release(session, ref, 0));
+    return (ret);
+}
+
+/*
+ * __search_ahi_update --
+ *     Count a search descending the tree to find a key on its leaf page, installing the key's leaf
+ *     page and slot in the tree's adaptive hash index once the key has been found often enough.
+ */
+static WT_INLINE void
+__search_ahi_update(WT_BTREE *btree, WT_REF *ref, uint32_t slot, uint64_t hash, uint64_t epoch)
+{
+    WT_AHI_ENTRY *entry;
+    uint64_t version;
+
+    /* The index is only a hint, skip the update if another thread is updating the entry. */
+    entry = &btree->ahi[hash % btree->ahi_entries];
+    WT_ACQUIRE_READ(version, entry->version);
+    if ((version & 1) != 0 || !__wt_atomic_cas64(&entry->version, version, version + 1))
+        return;
+
+    /*
+     * Install the entry when its key has been found often enough. If the entry belongs to another
+     * key, age it, and only replace it once its searches no longer outnumber ours.
+     */
+    if (entry->hash == hash) {
+        if (entry->hits < WT_AHI_INSTALL_HITS)
+            ++entry->hits;
+        if (entry->hits == WT_AHI_INSTALL_HITS) {
+            entry->ref = ref;
+            entry->slot = slot;
+            entry->epoch = epoch;
+        }
+    } else if (entry->hits > 1)
+        --entry->hits;
+    else {
+        entry->hash = hash;
+        entry->hits = 1;
+        entry->ref = NULL;
+    }
+
+    WT_RELEASE_WRITE(entry->version, version + 2);
+}
+
 /*
  * __wt_row_search --
  *     Search a row-store tree for a specific key.
@@ -362,19 +544,23 @@ __wt_row_search(WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key, bool insert, WT_REF *le
     WT_ITEM *item;
     WT_PAGE *page;
     WT_PAGE_INDEX *parent_pindex, *pindex;
-    WT_REF *current, *descent;
+    WT_REF *current, *descent, *parent;
     WT_ROW *rip;
     WT_SESSION_IMPL *session;
     size_t match, skiphigh, skiplow;
+    uint64_t ahi_epoch, ahi_hash, parent_version, split_version;
     uint32_t base, indx, limit, read_flags;
     int cmp, depth;
-    bool append_check, descend_right, done;
+    bool ahi, append_check, descend_right, done, validate;
 
     session = CUR2S(cbt);
     btree = S2BT(session);
     collator = btree->collator;
     item = cbt->tmp;
-    current = NULL;
+    current = parent = NULL;
+    parent_version = split_version = 0;
+    ahi = false;
+    ahi_epoch = ahi_hash = 0;
 
     /*
      * Assert the session and cursor have the right relationship (not search specific, but search is
@@ -413,12 +599,41 @@ __wt_row_search(WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key, bool insert, WT_REF *le
         goto leaf_only;
     }
 
+    /*
+     * Point searches of trees with an adaptive hash index check the index first, which may let them
+     * skip the tree descent. Read the index epoch before searching, searches descending the tree
+     * install entries with it.
+     */
+    ahi = !insert && btree->ahi != NULL;
+    if (ahi) {
+        WT_ACQUIRE_READ(ahi_epoch, btree->ahi_epoch);
+        ahi_hash = __wt_hash_city64(srch_key->data, srch_key->size);
+        WT_RET(__search_ahi(session, btree, cbt, srch_key, ahi_hash, ahi_epoch, &done));
+        if (done) {
+            WT_STAT_CONN_DSRC_INCR(session, cursor_search_ahi_hit);
+            return (0);
+        }
+        WT_STAT_CONN_DSRC_INCR(session, cursor_search_ahi_miss);
+    }
+
+    /*
+     * Searches validating split versions hold each internal page until they have read its child's
+     * index, and restart if the internal page's split version changed in the meantime.
+     */
+    validate = S2C(session)->heuristic_controls.descent_version_validation;
+
     if (0) {
 restart:
         /*
-         * Discard the currently held page and restart the search from the root.
+         * Discard the currently held pages and restart the search from the root.
          */
-        WT_RET(__wt_page_release(session, current, 0));
+        if (parent != NULL) {
+            ret = __wt_page_release(session, parent, 0);
+            parent = NULL;
+            WT_TRET(__wt_page_release(session, current, 0));
+            WT_RET(ret);
+        } else
+            WT_RET(__wt_page_release(session, current, 0));
     }
 
     /* Search the internal pages of the tree. */
@@ -426,11 +641,29 @@ restart:
     for (depth = 2, pindex = NULL;; ++depth) {
         parent_pindex = pindex;
         page = current->page;
+        if (page->type == WT_PAGE_ROW_INT) {
+            if (validate)
+                WT_ACQUIRE_READ(split_version, page->pg_intl_split_version);
+            WT_INTL_INDEX_GET(session, page, pindex);
+        }
+
+        /*
+         * If the parent page's index was replaced after we read its split version, its child page
+         * may have split into it, and we may have read the child page's truncated index: restart.
+         * Otherwise, the page's index is the one the parent page's index led us to, release the
+         * parent page.
+         */
+        if (parent != NULL) {
+            if (__wt_atomic_load64(&parent->page->pg_intl_split_version) != parent_version)
+                goto restart;
+            ret = __wt_page_release(session, parent, 0);
+            parent = NULL;
+            WT_ERR(ret);
+        }
+
         if (page->type != WT_PAGE_ROW_INT)
             break;
 
-        WT_INTL_INDEX_GET(session, page, pindex);
-
         /*
          * Fast-path appends.
          *
@@ -467,6 +700,17 @@ restart:
          */
         base = 1;
         limit = pindex->entries - 1;
+
+        /*
+         * If the page has key prefixes, use them to narrow the search before comparing keys. They
+         * are only built for trees without a collator.
+         */
+        if (pindex->prefix != NULL) {
+            __wt_ref_key(page, pindex->index[1], &item->data, &item->size);
+            __search_prefix(
+              pindex->prefix, item->data, pindex->prefix_skip, srch_key, &base, &limit);
+        }
+
         if (collator == NULL && srch_key->size <= WT_COMPARE_SHORT_MAXLEN)
             for (; limit != 0; limit >>= 1) {
                 indx = base + (limit >> 1);
@@ -548,7 +792,7 @@ restart:
          */
         if (pindex->entries == base) {
 append:
-            if (__wt_split_descent_race(session, current, parent_pindex))
+            if (!validate && __wt_split_descent_race(session, current, parent_pindex))
                 goto restart;
         }
 
@@ -568,6 +812,18 @@ descend:
         read_flags = WT_READ_RESTART_OK;
         if (F_ISSET(cbt, WT_CBT_READ_ONCE))
             FLD_SET(read_flags, WT_READ_WONT_NEED);
+        if (validate) {
+            /* Keep the current page, its split version is checked once the child page is read. */
+            if ((ret = __wt_page_in(session, descent, read_flags)) == 0) {
+                parent = current;
+                parent_version = split_version;
+                current = descent;
+                continue;
+            }
+            if (ret == WT_RESTART)
+                goto restart;
+            WT_ERR(ret);
+        }
         if ((ret = __wt_page_swap(session, current, descent, read_flags)) == 0) {
             current = descent;
             continue;
@@ -629,6 +885,14 @@ leaf_only:
      */
     base = 0;
     limit = page->entries;
+
+    /*
+     * If the tree builds key prefix directories for leaf pages, use the page's directory to narrow
+     * the search before building keys. They are only built for trees without a collator.
+     */
+    if (btree->leaf_prefix_searches != 0 && limit != 0)
+        WT_ERR(__search_leaf_prefix(session, btree, page, srch_key, &base, &limit));
+
     if (collator == NULL && srch_key->size <= WT_COMPARE_SHORT_MAXLEN)
         for (; limit != 0; limit >>= 1) {
             indx = base + (limit >> 1);
@@ -699,6 +963,8 @@ leaf_only:
 leaf_match:
         cbt->compare = 0;
         cbt->slot = WT_ROW_SLOT(page, rip);
+        if (ahi)
+            __search_ahi_update(btree, cbt->ref, cbt->slot, ahi_hash, ahi_epoch);
         return (0);
     }
 
@@ -752,6 +1018,8 @@ leaf_match:
     return (0);
 
 err:
+    if (parent != NULL)
+        WT_TRET(__wt_page_release(session, parent, 0));
     WT_TRET(__wt_page_release(session, current, 0));
     return (ret);
 }
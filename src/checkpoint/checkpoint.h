@@ -31,6 +31,9 @@ struct __wt_ckpt_session {
 
     /* Checkpoint time of current checkpoint, during a checkpoint */
     uint64_t current_sec;
+
+    /* Checkpoint session whose tree sync a helper thread is writing pages for */
+    WT_SESSION_IMPL *sync_owner;
 };
 
 /*
@@ -65,6 +68,25 @@ struct __wt_ckpt_thread {
     uint64_t usecs;             /* thread timer */
 };
 
+/*
+ * WT_CKPT_LEAF --
+ *     A dirty leaf page a checkpoint's tree sync handed to a helper thread. The page is pinned by
+ *     the checkpoint's hazard pointer until the checkpoint collects it.
+ */
+struct __wt_ckpt_leaf {
+    WT_REF *ref;              /* Leaf page */
+    WT_DATA_HANDLE *dhandle;  /* Tree being synced */
+    WT_SESSION_IMPL *session; /* Checkpoint session syncing the tree */
+    uint32_t rec_flags;       /* Reconciliation flags */
+
+#define WT_CKPT_LEAF_EMPTY 0  /* Slot unused */
+#define WT_CKPT_LEAF_QUEUED 1 /* Waiting for a helper */
+#define WT_CKPT_LEAF_BUSY 2   /* A helper is writing the page */
+#define WT_CKPT_LEAF_DONE 3   /* The page was written */
+#define WT_CKPT_LEAF_RETRY 4  /* The checkpoint must write the page itself */
+    wt_shared uint32_t state;
+};
+
 /*
  * WT_CKPT_CONNECTION --
  *     Checkpoint information.
@@ -72,6 +94,21 @@ struct __wt_ckpt_thread {
 struct __wt_ckpt_connection {
     WT_CKPT_THREAD server; /* Checkpoint thread.*/
 
+    /*
+     * Helper threads writing leaf pages for the checkpoint. The checkpoint walks its handle list
+     * from the front, the helpers claim handles from the back until the two meet. While the
+     * checkpoint syncs a tree, it also hands that tree's dirty leaf pages to the helpers.
+     */
+    WT_THREAD_GROUP thread_group;
+    uint32_t threads_num;               /* Configured helper threads */
+    wt_shared bool threads_run;         /* Helper threads should keep running */
+    WT_DATA_HANDLE **threads_handle;    /* Checkpoint's handle list */
+    WT_TXN *threads_txn;                /* Checkpoint's transaction, for its snapshot */
+    wt_shared uint32_t threads_next;    /* Helpers claim handles below this slot */
+    wt_shared uint32_t threads_reached; /* Handles the checkpoint has started */
+    WT_CKPT_LEAF *leaf;                 /* Leaf pages handed to the helpers */
+    uint32_t leaf_entries;              /* Leaf page slots */
+
     wt_shared uint64_t most_recent; /* Clock value of most recent checkpoint */
 
     WT_CKPT_HANDLE_STATS handle_stats;
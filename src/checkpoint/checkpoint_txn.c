@@ -342,6 +342,236 @@ __checkpoint_apply_to_dhandles(
     return (0);
 }
 
+/*
+ * __checkpoint_thread_chk --
+ *     Check to decide if the checkpoint helper threads should continue running.
+ */
+static bool
+__checkpoint_thread_chk(WT_SESSION_IMPL *session)
+{
+    return (__wt_atomic_loadbool(&S2C(session)->ckpt.threads_run));
+}
+
+/*
+ * __checkpoint_thread_claim --
+ *     Claim the next handle for a checkpoint helper thread, working back from the end of the
+ *     checkpoint's handle list. Return false once the checkpoint itself has reached the handles
+ *     that are left.
+ */
+static bool
+__checkpoint_thread_claim(WT_SESSION_IMPL *session, WT_DATA_HANDLE **dhandlep)
+{
+    WT_CKPT_CONNECTION *ckpt;
+    uint32_t next;
+
+    *dhandlep = NULL;
+    ckpt = &S2C(session)->ckpt;
+
+    for (;;) {
+        next = __wt_atomic_load32(&ckpt->threads_next);
+        if (next <= __wt_atomic_load32(&ckpt->threads_reached))
+            return (false);
+        if (__wt_atomic_cas32(&ckpt->threads_next, next, next - 1)) {
+            *dhandlep = ckpt->threads_handle[next - 1];
+            return (true);
+        }
+    }
+}
+
+/*
+ * __checkpoint_thread_work --
+ *     Write leaf pages for the checkpoint: first any pages handed off by the tree the checkpoint is
+ *     syncing, then the leaf pages of trees the checkpoint hasn't reached yet.
+ */
+static void
+__checkpoint_thread_work(WT_SESSION_IMPL *session, bool *workedp)
+{
+    WT_BTREE *btree;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+
+    for (;;) {
+        /* The checkpoint is waiting for the pages it handed off, they come first. */
+        __wt_sync_leaf_help(session, workedp);
+
+        if (!__checkpoint_thread_claim(session, &dhandle))
+            break;
+
+        /*
+         * Only ordinary trees are worth writing ahead: bulk-loadable and in-memory trees don't
+         * write leaf pages, and the history store and metadata are checkpointed separately.
+         */
+        if (dhandle == NULL || __wt_atomic_load_enum(&dhandle->type) != WT_DHANDLE_TYPE_BTREE ||
+          WT_IS_HS(dhandle) || WT_IS_METADATA(dhandle))
+            continue;
+        btree = dhandle->handle;
+        if (btree->original || F_ISSET(btree, WT_BTREE_IN_MEMORY))
+            continue;
+
+        WT_WITH_DHANDLE(session, dhandle, ret = __wt_sync_file(session, WT_SYNC_WRITE_LEAVES));
+
+        /*
+         * Helper writes are an optimization, the checkpoint writes anything left behind. Don't fail
+         * the checkpoint for a page that couldn't be written here.
+         */
+        if (ret != 0 && ret != EBUSY)
+            __wt_err(session, ret, "checkpoint helper thread failed to write leaf pages of %s",
+              dhandle->name);
+        ret = 0;
+        *workedp = true;
+    }
+}
+
+/*
+ * __checkpoint_thread_run --
+ *     Entry function for a checkpoint helper thread. This is called repeatedly from the thread
+ *     group code so it does not need to loop itself.
+ */
+static int
+__checkpoint_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CKPT_CONNECTION *ckpt;
+    WT_TXN *ckpt_txn, *txn;
+    bool worked;
+
+    WT_UNUSED(thread);
+
+    ckpt = &S2C(session)->ckpt;
+    ckpt_txn = ckpt->threads_txn;
+    txn = session->txn;
+    worked = false;
+
+    /*
+     * Write pages using the checkpoint's snapshot so nothing the checkpoint can't see is written.
+     * The checkpoint pins its snapshot for as long as the helpers run, there's no need to publish
+     * it again. Forcing the isolation keeps the snapshot in place when a tree walk releases its
+     * last page.
+     */
+    txn->snapshot_data.snap_min = ckpt_txn->snapshot_data.snap_min;
+    txn->snapshot_data.snap_max = ckpt_txn->snapshot_data.snap_max;
+    txn->snapshot_data.snapshot_count = ckpt_txn->snapshot_data.snapshot_count;
+    if (txn->snapshot_data.snapshot_count != 0)
+        memcpy(txn->snapshot_data.snapshot, ckpt_txn->snapshot_data.snapshot,
+          sizeof(txn->snapshot_data.snapshot[0]) * txn->snapshot_data.snapshot_count);
+    F_SET(txn, WT_TXN_HAS_SNAPSHOT);
+
+    WT_WITH_TXN_ISOLATION(session, WT_ISO_SNAPSHOT, __checkpoint_thread_work(session, &worked));
+    F_CLR(txn, WT_TXN_HAS_SNAPSHOT);
+
+    /* Wait for more work if there was nothing to do. */
+    if (!worked)
+        __wt_cond_wait(session, ckpt->thread_group.wait_cond, 10 * WT_THOUSAND,
+          __checkpoint_thread_chk);
+
+    return (0);
+}
+
+/*
+ * __checkpoint_threads_start --
+ *     Start the checkpoint helper threads, if configured.
+ */
+static int
+__checkpoint_threads_start(WT_SESSION_IMPL *session, bool *startedp)
+{
+    WT_CKPT_CONNECTION *ckpt;
+    WT_DECL_RET;
+    uint32_t threads;
+
+    *startedp = false;
+    ckpt = &S2C(session)->ckpt;
+
+    threads = ckpt->threads_num;
+    if (threads == 0 || session->ckpt.handle_next == 0)
+        return (0);
+
+    /* Allow a couple of leaf pages per helper to be in flight while the checkpoint syncs a tree. */
+    WT_RET(__wt_calloc_def(session, 2 * threads, &ckpt->leaf));
+    ckpt->leaf_entries = 2 * threads;
+
+    ckpt->threads_handle = session->ckpt.handle;
+    ckpt->threads_txn = session->txn;
+    __wt_atomic_store32(&ckpt->threads_reached, 0);
+    __wt_atomic_store32(&ckpt->threads_next, session->ckpt.handle_next);
+
+    /* Set first, the threads might run before we finish up. */
+    __wt_atomic_storebool(&ckpt->threads_run, true);
+
+    WT_ERR(__wt_thread_group_create(session, &ckpt->thread_group, "checkpoint-threads", threads,
+      threads, WT_THREAD_CAN_WAIT, __checkpoint_thread_chk, __checkpoint_thread_run, NULL));
+    __wt_cond_signal(session, ckpt->thread_group.wait_cond);
+
+    *startedp = true;
+
+err:
+    if (ret != 0) {
+        __wt_atomic_storebool(&ckpt->threads_run, false);
+        __wt_free(session, ckpt->leaf);
+        ckpt->leaf_entries = 0;
+    }
+    return (ret);
+}
+
+/*
+ * __checkpoint_threads_stop --
+ *     Stop the checkpoint helper threads.
+ */
+static int
+__checkpoint_threads_stop(WT_SESSION_IMPL *session)
+{
+    WT_CKPT_CONNECTION *ckpt;
+    WT_DECL_RET;
+
+    ckpt = &S2C(session)->ckpt;
+
+    /* Wait for any thread group changes to stabilize. */
+    __wt_writelock(session, &ckpt->thread_group.lock);
+
+    /* Signal the threads to finish. */
+    __wt_atomic_storebool(&ckpt->threads_run, false);
+    __wt_cond_signal(session, ckpt->thread_group.wait_cond);
+
+    /* We call the destroy function still holding the write lock. It assumes it is called locked. */
+    WT_TRET(__wt_thread_group_destroy(session, &ckpt->thread_group));
+
+    ckpt->threads_handle = NULL;
+    ckpt->threads_txn = NULL;
+    __wt_free(session, ckpt->leaf);
+    ckpt->leaf_entries = 0;
+
+    return (ret);
+}
+
+/*
+ * __checkpoint_apply_trees --
+ *     Checkpoint all handles locked for a checkpoint, with helper threads writing leaf pages of the
+ *     tree being checkpointed and of the trees the checkpoint hasn't reached yet.
+ */
+static int
+__checkpoint_apply_trees(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_DECL_RET;
+    u_int i;
+    bool started;
+
+    WT_RET(__checkpoint_threads_start(session, &started));
+
+    for (i = 0; i < session->ckpt.handle_next; ++i) {
+        /* Keep the helpers off the trees we've started. */
+        if (started)
+            __wt_atomic_store32(&S2C(session)->ckpt.threads_reached, i + 1);
+        if (session->ckpt.handle[i] == NULL)
+            continue;
+        WT_WITH_DHANDLE(
+          session, session->ckpt.handle[i], ret = __checkpoint_tree_helper(session, cfg));
+        WT_ERR(ret);
+    }
+
+err:
+    if (started)
+        WT_TRET(__checkpoint_threads_stop(session));
+    return (ret);
+}
+
 /*
  * __checkpoint_data_source --
  *     Checkpoint all data sources.
@@ -1237,7 +1467,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
     __checkpoint_verbose_track(session, "checkpointing individual trees");
 
     time_start_ckpt_tree = __wt_clock(session);
-    WT_ERR(__checkpoint_apply_to_dhandles(session, cfg, __checkpoint_tree_helper));
+    WT_ERR(__checkpoint_apply_trees(session, cfg));
     time_stop_ckpt_tree = __wt_clock(session);
     ckpt_tree_duration_usecs = WT_CLOCKDIFF_US(time_stop_ckpt_tree, time_start_ckpt_tree);
     WT_STAT_CONN_SET(session, checkpoint_tree_duration, ckpt_tree_duration_usecs);
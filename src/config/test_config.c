@@ -1049,6 +1049,50 @@ static const uint8_t confchk_search_near_03_jump[WT_CONFIG_JUMP_TABLE_SIZE] = {0
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 5, 6, 6, 6, 6,
   7, 7, 7, 7, 8, 8, 9, 9, 9, 10, 12, 13, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15};
 
+static const WT_CONFIG_CHECK confchk_split_descent_benchmarks[] = {
+  {"background_compact_debug_mode", "boolean", NULL, NULL, NULL, 0, NULL,
+    WT_CONFIG_COMPILED_TYPE_BOOLEAN, 0, INT64_MIN, INT64_MAX, NULL},
+  {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_INT, 1, 0,
+    INT64_MAX, NULL},
+  {"cache_size_mb", "int", NULL, "min=0,max=100000000000", NULL, 0, NULL,
+    WT_CONFIG_COMPILED_TYPE_INT, 2, 0, 100000000000, NULL},
+  {"compression_enabled", "boolean", NULL, NULL, NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_BOOLEAN, 3,
+    INT64_MIN, INT64_MAX, NULL},
+  {"duration_seconds", "int", NULL, "min=0,max=1000000", NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_INT,
+    4, 0, 1000000, NULL},
+  {"enable_logging", "boolean", NULL, NULL, NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_BOOLEAN, 5,
+    INT64_MIN, INT64_MAX, NULL},
+  {"in_memory", "boolean", NULL, NULL, NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_BOOLEAN, 6, INT64_MIN,
+    INT64_MAX, NULL},
+  {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6,
+    confchk_metrics_monitor_subconfigs_jump, WT_CONFIG_COMPILED_TYPE_CATEGORY, 7, INT64_MIN,
+    INT64_MAX, NULL},
+  {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4,
+    confchk_operation_tracker_subconfigs_jump, WT_CONFIG_COMPILED_TYPE_CATEGORY, 19, INT64_MIN,
+    INT64_MAX, NULL},
+  {"reverse_collator", "boolean", NULL, NULL, NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_BOOLEAN, 22,
+    INT64_MIN, INT64_MAX, NULL},
+  {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2,
+    confchk_statistics_config_subconfigs_jump, WT_CONFIG_COMPILED_TYPE_CATEGORY, 23, INT64_MIN,
+    INT64_MAX, NULL},
+  {"sweep_interval", "string", NULL, NULL, NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_STRING, 25,
+    INT64_MIN, INT64_MAX, NULL},
+  {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4,
+    confchk_timestamp_manager_subconfigs_jump, WT_CONFIG_COMPILED_TYPE_CATEGORY, 26, INT64_MIN,
+    INT64_MAX, NULL},
+  {"validate", "boolean", NULL, NULL, NULL, 0, NULL, WT_CONFIG_COMPILED_TYPE_BOOLEAN, 29, INT64_MIN,
+    INT64_MAX, NULL},
+  {"workload_manager", "category", NULL, NULL, confchk_workload_manager_subconfigs, 10,
+    confchk_workload_manager_subconfigs_jump, WT_CONFIG_COMPILED_TYPE_CATEGORY, 30, INT64_MIN,
+    INT64_MAX, NULL},
+  {NULL, NULL, NULL, NULL, NULL, 0, NULL, 0, 0, 0, 0, NULL}};
+
+static const uint8_t confchk_split_descent_benchmarks_jump[WT_CONFIG_JUMP_TABLE_SIZE] = {0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 5, 6,
+  6, 6, 6, 7, 7, 7, 7, 8, 8, 9, 9, 9, 10, 12, 13, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15};
+
 static const WT_CONFIG_CHECK confchk_test_template[] = {
   {"background_compact_debug_mode", "boolean", NULL, NULL, NULL, 0, NULL,
     WT_CONFIG_COMPILED_TYPE_BOOLEAN, 0, INT64_MIN, INT64_MAX, NULL},
@@ -1551,6 +1595,35 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "thread_count=0),update_config=(key_size=5,op_rate=1s,"
     "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
     confchk_search_near_03, 15, confchk_search_near_03_jump, 15, WT_CONF_SIZING_NONE, false},
+  {"split_descent_benchmarks",
+    "background_compact_debug_mode=false,cache_max_wait_ms=0,"
+    "cache_size_mb=0,compression_enabled=false,duration_seconds=0,"
+    "enable_logging=false,in_memory=false,"
+    "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false),cc_pages_removed=(max=1,min=0,"
+    "postrun=false,runtime=false,save=false),enabled=true,op_rate=1s,"
+    "stat_cache_size=(max=1,min=0,postrun=false,runtime=false,"
+    "save=false),stat_db_size=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false)),operation_tracker=(enabled=true,"
+    "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
+    "reverse_collator=false,statistics_config=(enable_logging=true,"
+    "type=all),sweep_interval=10,timestamp_manager=(enabled=true,"
+    "oldest_lag=1,op_rate=1s,stable_lag=1),validate=true,"
+    "workload_manager=(background_compact_config=(free_space_target_mb=20"
+    ",op_rate=1s,thread_count=0),checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_split_descent_benchmarks, 15, confchk_split_descent_benchmarks_jump, 16,
+    WT_CONF_SIZING_NONE, false},
   {"test_template",
     "background_compact_debug_mode=false,cache_max_wait_ms=0,"
     "cache_size_mb=0,compression_enabled=false,duration_seconds=0,"
@@ -1578,7 +1651,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
     "thread_count=0),update_config=(key_size=5,op_rate=1s,"
     "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
-    confchk_test_template, 15, confchk_test_template_jump, 16, WT_CONF_SIZING_NONE, false},
+    confchk_test_template, 15, confchk_test_template_jump, 17, WT_CONF_SIZING_NONE, false},
   {NULL, NULL, NULL, 0, NULL, 0, WT_CONF_SIZING_NONE, false}};
 
 /*
@@ -212,6 +212,29 @@ __wt_compressor_config(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_COMPRE
     return (__compressor_confchk(session, cval, compressorp));
 }
 
+/*
+ * __wt_compressor_customize --
+ *     Customize a compressor for a file.
+ */
+int
+__wt_compressor_customize(WT_SESSION_IMPL *session, const char *uri, WT_CONFIG_ITEM *metadata,
+  WT_COMPRESSOR **compressorp, int *ownp)
+{
+    WT_COMPRESSOR *compressor, *custom;
+
+    compressor = *compressorp;
+    *ownp = 0;
+
+    custom = NULL;
+    WT_RET(compressor->customize(compressor, &session->iface, uri, metadata, &custom));
+    if (custom != NULL) {
+        *compressorp = custom;
+        *ownp = 1;
+    }
+
+    return (0);
+}
+
 /*
  * __conn_add_compressor --
  *     WT_CONNECTION->add_compressor method.
@@ -2166,6 +2189,9 @@ __wti_heuristic_controls_config(WT_SESSION_IMPL *session, const char *cfg[])
     WT_RET(__wt_config_gets(session, cfg, "heuristic_controls.obsolete_tw_btree_max", &cval));
     conn->heuristic_controls.obsolete_tw_btree_max = (uint32_t)cval.val;
 
+    WT_RET(__wt_config_gets(session, cfg, "heuristic_controls.descent_validation", &cval));
+    conn->heuristic_controls.descent_version_validation = WT_CONFIG_LIT_MATCH("version", cval);
+
     return (0);
 }
 
@@ -2564,6 +2590,9 @@ __conn_session_size(WT_SESSION_IMPL *session, const char *cfg[], uint32_t *vp)
     /* Then, add in the thread counts applications can configure. */
     v += WT_EVICT_MAX_WORKERS;
 
+    /* Each eviction shard has a walk session, and may have a walker thread. */
+    v += 2 * WT_EVICT_MAX_SHARDS;
+
     /* If live restore is enabled add its thread count. */
     if (F_ISSET(S2C(session), WT_CONN_LIVE_RESTORE_FS)) {
         WT_RET(__wt_config_gets(session, cfg, "live_restore.threads_max", &cval));
@@ -2571,6 +2600,7 @@ __conn_session_size(WT_SESSION_IMPL *session, const char *cfg[], uint32_t *vp)
     }
 
     v += WT_RTS_MAX_WORKERS;
+    v += WT_RECOVERY_MAX_WORKERS;
 
     WT_RET(__wt_config_gets(session, cfg, "session_max", &cval));
     v += cval.val;
@@ -2975,6 +3005,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     WT_ERR(__conn_session_size(session, cfg, &conn->session_array.size));
     WT_ERR(__wt_config_gets(session, cfg, "session_scratch_max", &cval));
     conn->session_scratch_max = (size_t)cval.val;
+    WT_ERR(__wt_config_gets(session, cfg, "update_pool.session_max", &cval));
+    conn->update_pool_session_max = (size_t)cval.val;
+    WT_ERR(__wt_config_gets(session, cfg, "update_pool.shared_max", &cval));
+    conn->update_pool_shared_max = (size_t)cval.val;
 
     WT_ERR(__wt_config_gets(session, cfg, "write_through", &cval));
     for (ft = file_types; ft->name != NULL; ft++) {
@@ -2986,6 +3020,32 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
             WT_ERR_NOTFOUND_OK(ret, false);
     }
 
+    /*
+     * Direct I/O is only supported for data files, any other configured file types are ignored.
+     * Configure an alignment for I/O buffers if direct I/O is configured and the application didn't
+     * choose one.
+     */
+    WT_ERR(__wt_config_gets(session, cfg, "direct_io", &cval));
+    WT_ERR_NOTFOUND_OK(__wt_config_subgets(session, &cval, "data", &sval), true);
+    if (ret == 0 && sval.val)
+        FLD_SET(conn->direct_io, WT_FILE_TYPE_DATA);
+    WT_ERR(__wt_config_gets(session, cfg, "buffer_alignment", &cval));
+    if (cval.val == -1) {
+        conn->buffer_alignment = 0;
+        if (conn->direct_io != 0)
+            conn->buffer_alignment = WT_BUFFER_ALIGNMENT_DEFAULT;
+    } else
+        conn->buffer_alignment = (size_t)cval.val;
+    if (conn->buffer_alignment == 0 && conn->direct_io != 0)
+        WT_ERR_MSG(session, EINVAL, "direct I/O requires a non-zero buffer_alignment");
+    if (conn->buffer_alignment != 0 && !__wt_ispo2((uint32_t)conn->buffer_alignment))
+        WT_ERR_MSG(session, EINVAL, "buffer_alignment %" WT_SIZET_FMT " is not a power of two",
+          conn->buffer_alignment);
+#ifndef HAVE_POSIX_MEMALIGN
+    if (conn->buffer_alignment != 0)
+        WT_ERR_MSG(session, EINVAL, "buffer_alignment requires posix_memalign");
+#endif
+
     WT_ERR(__wt_config_gets(session, cfg, "cache_cursors", &cval));
     if (cval.val)
         F_SET(conn, WT_CONN_CACHE_CURSORS);
@@ -3043,6 +3103,8 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     if (conn->prefetch_auto_on && !conn->prefetch_available)
         WT_ERR_MSG(session, EINVAL,
           "pre-fetching cannot be enabled if pre-fetching is configured as unavailable");
+    WT_ERR(__wt_config_gets(session, cfg, "prefetch.async_read_depth", &cval));
+    conn->prefetch_async_depth = (uint32_t)cval.val;
 
     WT_ERR(__wt_config_gets(session, cfg, "salvage", &cval));
     if (cval.val) {
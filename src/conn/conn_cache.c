@@ -68,6 +68,9 @@ __wti_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
     /* Use a common routine for run-time configuration options. */
     WT_RET(__wti_cache_config(session, cfg, false));
 
+    /* The page image arena can only be configured when the connection is opened. */
+    WT_RET(__wti_cache_arena_create(session, cfg));
+
     /*
      * We get/set some values in the cache statistics (rather than have two copies), configure them.
      */
@@ -126,6 +129,8 @@ __wti_cache_stats_update(WT_SESSION_IMPL *session)
     WT_STATP_CONN_SET(session, stats, rec_maximum_image_build_milliseconds,
       conn->rec_maximum_image_build_milliseconds);
     WT_STATP_CONN_SET(session, stats, rec_maximum_milliseconds, conn->rec_maximum_milliseconds);
+
+    __wti_cache_arena_stats_update(session);
 }
 
 /*
@@ -137,6 +142,7 @@ __wti_cache_destroy(WT_SESSION_IMPL *session)
 {
     WT_CACHE *cache;
     WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
 
     conn = S2C(session);
     cache = conn->cache;
@@ -166,6 +172,7 @@ __wti_cache_destroy(WT_SESSION_IMPL *session)
             __wt_atomic_load64(&cache->bytes_dirty_leaf),
           cache->pages_dirty_intl + cache->pages_dirty_leaf);
 
+    WT_TRET(__wti_cache_arena_destroy(session));
     __wt_free(session, conn->cache);
-    return (0);
+    return (ret);
 }
@@ -0,0 +1,316 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __cache_arena_class --
+ *     Return the size class of an allocation.
+ */
+static WT_INLINE uint32_t
+__cache_arena_class(size_t size)
+{
+    uint32_t bits;
+
+    if (size <= WT_CACHE_ARENA_CLASS_MIN)
+        return (0);
+
+    /*
+     * The smallest power of two not less than the size is 1 << bits, the midpoint between it and
+     * the power of two below is 3 << (bits - 2).
+     */
+    bits = __wt_log2_int((uint32_t)size - 1) + 1;
+    if (size <= (size_t)3 << (bits - 2))
+        return (2 * (bits - 10) + 1);
+    return (2 * (bits - 9));
+}
+
+/*
+ * __cache_arena_class_size --
+ *     Return the object size of a size class.
+ */
+static WT_INLINE size_t
+__cache_arena_class_size(uint32_t size_class)
+{
+    return ((size_t)(size_class % 2 == 0 ? 512 : 768) << (size_class / 2));
+}
+
+/*
+ * __cache_arena_node_alloc --
+ *     Allocate an object of a size class from a node of the arena.
+ */
+static bool
+__cache_arena_node_alloc(
+  WT_SESSION_IMPL *session, WT_CACHE_ARENA_NODE *node, uint32_t size_class, size_t size, void **pp)
+{
+    WT_CACHE_ARENA_SLAB *slab;
+    size_t class_size;
+    uint8_t *p;
+
+    class_size = __cache_arena_class_size(size_class);
+
+    __wt_spin_lock(session, &node->lock);
+
+    /*
+     * Allocate from a slab of the size class with free objects. If there isn't one, take a slab no
+     * other size class is using, preferring slabs that have been used before: their memory has
+     * already been faulted in.
+     */
+    if ((slab = TAILQ_FIRST(&node->partial[size_class])) == NULL) {
+        if ((slab = TAILQ_FIRST(&node->empty)) != NULL)
+            TAILQ_REMOVE(&node->empty, slab, q);
+        else if (node->slab_next < node->slab_count)
+            slab = &node->slabs[node->slab_next++];
+        else {
+            __wt_spin_unlock(session, &node->lock);
+            return (false);
+        }
+
+        slab->freelist = NULL;
+        slab->next = 0;
+        slab->nobjs = (uint32_t)(WT_CACHE_ARENA_SLAB_SIZE / class_size);
+        slab->inuse = 0;
+        slab->size_class = size_class;
+        TAILQ_INSERT_HEAD(&node->partial[size_class], slab, q);
+        node->bytes_slab += WT_CACHE_ARENA_SLAB_SIZE;
+    }
+
+    /* Reuse a freed object, otherwise carve the next object from the slab. */
+    if ((p = slab->freelist) != NULL)
+        slab->freelist = *(void **)p;
+    else
+        p = node->mem + (size_t)(slab - node->slabs) * WT_CACHE_ARENA_SLAB_SIZE +
+          slab->next++ * class_size;
+
+    /* Full slabs leave the partial list until an object is freed. */
+    if (++slab->inuse == slab->nobjs)
+        TAILQ_REMOVE(&node->partial[size_class], slab, q);
+    node->bytes_inuse += size;
+
+    __wt_spin_unlock(session, &node->lock);
+
+    *pp = p;
+    return (true);
+}
+
+/*
+ * __wt_cache_arena_alloc --
+ *     Allocate memory for a page image from the cache arena, preferring the NUMA node of the
+ *     running thread. Return false if the arena can't satisfy the request, the caller allocates the
+ *     memory from the system allocator instead.
+ */
+bool
+__wt_cache_arena_alloc(WT_SESSION_IMPL *session, size_t size, void *retp)
+{
+    WT_CACHE_ARENA *arena;
+    u_int i, local;
+    uint32_t size_class;
+
+    *(void **)retp = NULL;
+
+    if ((arena = S2C(session)->cache->arena) == NULL)
+        return (false);
+
+    if (size == 0 || size > WT_CACHE_ARENA_CLASS_MAX) {
+        WT_STAT_CONN_INCR(session, cache_arena_alloc_fallback);
+        return (false);
+    }
+    size_class = __cache_arena_class(size);
+
+    /* Try the local node first, then the others in turn. */
+    local = arena->node_count == 1 ? 0 : __wt_numa_node() % arena->node_count;
+    for (i = 0; i < arena->node_count; ++i)
+        if (__cache_arena_node_alloc(session, &arena->nodes[(local + i) % arena->node_count],
+              size_class, size, retp)) {
+            WT_STAT_CONN_INCR(session, cache_arena_alloc);
+            if (i != 0)
+                WT_STAT_CONN_INCR(session, cache_arena_alloc_remote);
+            return (true);
+        }
+
+    WT_STAT_CONN_INCR(session, cache_arena_alloc_fallback);
+    return (false);
+}
+
+/*
+ * __wt_cache_arena_free --
+ *     Return a page image allocated from the cache arena. The size must match the allocation.
+ */
+void
+__wt_cache_arena_free(WT_SESSION_IMPL *session, void *p, size_t size)
+{
+    WT_CACHE_ARENA *arena;
+    WT_CACHE_ARENA_NODE *node;
+    WT_CACHE_ARENA_SLAB *slab;
+    size_t offset;
+    bool full;
+
+    arena = S2C(session)->cache->arena;
+    offset = WT_PTRDIFF(p, arena->mem);
+    WT_ASSERT(
+      session, (uint8_t *)p >= arena->mem && offset < arena->node_size * arena->node_count);
+
+    node = &arena->nodes[offset / arena->node_size];
+    slab = &node->slabs[WT_PTRDIFF(p, node->mem) / WT_CACHE_ARENA_SLAB_SIZE];
+    WT_ASSERT(session, slab->inuse != 0 && __cache_arena_class(size) == slab->size_class);
+
+#ifdef HAVE_DIAGNOSTIC
+    __wt_explicit_overwrite(p, size);
+#endif
+
+    __wt_spin_lock(session, &node->lock);
+
+    full = slab->inuse == slab->nobjs;
+    *(void **)p = slab->freelist;
+    slab->freelist = p;
+    node->bytes_inuse -= size;
+
+    /*
+     * A slab with no objects allocated can be reused by any size class, a full slab with an object
+     * freed can be allocated from again.
+     */
+    if (--slab->inuse == 0) {
+        if (!full)
+            TAILQ_REMOVE(&node->partial[slab->size_class], slab, q);
+        TAILQ_INSERT_HEAD(&node->empty, slab, q);
+        node->bytes_slab -= WT_CACHE_ARENA_SLAB_SIZE;
+    } else if (full)
+        TAILQ_INSERT_HEAD(&node->partial[slab->size_class], slab, q);
+
+    __wt_spin_unlock(session, &node->lock);
+}
+
+/*
+ * __wti_cache_arena_stats_update --
+ *     Update the cache arena statistics for return to the application.
+ */
+void
+__wti_cache_arena_stats_update(WT_SESSION_IMPL *session)
+{
+    WT_CACHE_ARENA *arena;
+    WT_CONNECTION_STATS **stats;
+    uint64_t bytes_inuse, bytes_slab;
+    u_int i;
+
+    if ((arena = S2C(session)->cache->arena) == NULL)
+        return;
+    stats = S2C(session)->stats;
+
+    for (bytes_inuse = bytes_slab = 0, i = 0; i < arena->node_count; ++i) {
+        bytes_inuse += __wt_atomic_load64(&arena->nodes[i].bytes_inuse);
+        bytes_slab += __wt_atomic_load64(&arena->nodes[i].bytes_slab);
+    }
+
+    /* The values are read without locking, don't report negative fragmentation. */
+    WT_STATP_CONN_SET(session, stats, cache_arena_bytes, bytes_slab);
+    WT_STATP_CONN_SET(session, stats, cache_arena_bytes_inuse, bytes_inuse);
+    WT_STATP_CONN_SET(session, stats, cache_arena_bytes_fragmented,
+      bytes_slab > bytes_inuse ? bytes_slab - bytes_inuse : 0);
+    WT_STATP_CONN_SET(session, stats, cache_arena_hugepages, arena->hugepages ? 1 : 0);
+}
+
+/*
+ * __wti_cache_arena_create --
+ *     Create the cache arena, if configured.
+ */
+int
+__wti_cache_arena_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CACHE *cache;
+    WT_CACHE_ARENA *arena;
+    WT_CACHE_ARENA_NODE *node;
+    WT_CONFIG_ITEM cval;
+    WT_DECL_RET;
+    size_t size;
+    u_int i;
+    uint32_t j;
+    bool hugepages, numa;
+
+    cache = S2C(session)->cache;
+
+    WT_RET(__wt_config_gets(session, cfg, "cache_arena.size", &cval));
+    if (cval.val == 0)
+        return (0);
+    size = (size_t)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "cache_arena.hugepages", &cval));
+    hugepages = cval.val != 0;
+    WT_RET(__wt_config_gets(session, cfg, "cache_arena.numa", &cval));
+    numa = cval.val != 0;
+
+    WT_RET(__wt_calloc_one(session, &arena));
+    arena->node_count = numa ? __wt_numa_node_count() : 1;
+
+    /* Divide the arena evenly between the nodes, each node has at least one slab. */
+    arena->node_size = WT_MAX(WT_CACHE_ARENA_SLAB_SIZE,
+      (size / arena->node_count) / WT_CACHE_ARENA_SLAB_SIZE * WT_CACHE_ARENA_SLAB_SIZE);
+
+    /*
+     * Explicitly reserved huge pages are aligned to the huge page size, other mappings are aligned
+     * to the system page size: map an extra slab to align the arena to the slab size, so slabs can
+     * be backed by transparent huge pages.
+     */
+    arena->maplen = arena->node_size * arena->node_count + WT_CACHE_ARENA_SLAB_SIZE;
+    WT_ERR(__wt_map_anonymous(session, arena->maplen, hugepages, &arena->map, &arena->hugepages));
+    arena->mem = (uint8_t *)WT_ALIGN((uintptr_t)arena->map, WT_CACHE_ARENA_SLAB_SIZE);
+
+    WT_ERR(__wt_calloc_def(session, arena->node_count, &arena->nodes));
+    for (i = 0; i < arena->node_count; ++i) {
+        node = &arena->nodes[i];
+        WT_ERR(__wt_spin_init(session, &node->lock, "cache arena"));
+        node->mem = arena->mem + i * arena->node_size;
+        node->slab_count = (uint32_t)(arena->node_size / WT_CACHE_ARENA_SLAB_SIZE);
+        WT_ERR(__wt_calloc_def(session, node->slab_count, &node->slabs));
+        for (j = 0; j < WT_CACHE_ARENA_CLASSES; ++j)
+            TAILQ_INIT(&node->partial[j]);
+        TAILQ_INIT(&node->empty);
+
+        /*
+         * The arena's memory hasn't been touched yet, binding each node's memory to its NUMA node
+         * places it there as it's faulted in.
+         */
+        if (arena->node_count > 1)
+            __wt_map_anonymous_bind(session, node->mem, arena->node_size, i);
+    }
+
+    cache->arena = arena;
+    return (0);
+
+err:
+    cache->arena = arena;
+    WT_TRET(__wti_cache_arena_destroy(session));
+    return (ret);
+}
+
+/*
+ * __wti_cache_arena_destroy --
+ *     Discard the cache arena.
+ */
+int
+__wti_cache_arena_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CACHE *cache;
+    WT_CACHE_ARENA *arena;
+    WT_DECL_RET;
+    u_int i;
+
+    cache = S2C(session)->cache;
+    if ((arena = cache->arena) == NULL)
+        return (0);
+    cache->arena = NULL;
+
+    if (arena->nodes != NULL)
+        for (i = 0; i < arena->node_count; ++i) {
+            __wt_spin_destroy(session, &arena->nodes[i].lock);
+            __wt_free(session, arena->nodes[i].slabs);
+        }
+    __wt_free(session, arena->nodes);
+    if (arena->map != NULL)
+        WT_TRET(__wt_unmap_anonymous(session, arena->map, arena->maplen));
+    __wt_free(session, arena);
+    return (ret);
+}
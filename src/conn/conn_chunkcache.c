@@ -287,6 +287,7 @@ __wti_chunkcache_metadata_create(WT_SESSION_IMPL *session)
     WT_ERR(__wt_cond_alloc(session, "chunk cache metadata", &conn->chunkcache_metadata_cond));
 
     WT_ERR(__chunkcache_apply_metadata_content(session));
+    WT_ERR(__wt_chunkcache_warmup(session));
 
     /* Start the thread. */
     WT_ERR(__wt_thread_create(
@@ -858,13 +858,15 @@ __conn_dhandle_remove(WT_SESSION_IMPL *session, bool final)
     WT_CONNECTION_IMPL *conn;
     WT_DATA_HANDLE *dhandle;
     uint64_t bucket;
+    uint32_t i;
 
     conn = S2C(session);
     dhandle = session->dhandle;
     bucket = dhandle->name_hash & (conn->dh_hash_size - 1);
 
     WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE));
-    WT_ASSERT(session, dhandle != conn->evict->walk_tree);
+    for (i = 0; i < conn->evict->evict_shard_count; ++i)
+        WT_ASSERT(session, dhandle != conn->evict->evict_shards[i].walk_tree);
 
     /* Check if the handle was reacquired by a session while we waited. */
     if (!final &&
@@ -56,6 +56,7 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
     WT_RET(__wt_spin_init(session, &conn->tiered_lock, "tiered work unit list"));
     WT_RET(__wt_spin_init(session, &conn->turtle_lock, "turtle file"));
     WT_RET(__wt_spin_init(session, &conn->prefetch_lock, "prefetch"));
+    WT_RET(__wt_spin_init(session, &conn->update_pool_lock, "update pool"));
 
     /* Read-write locks */
     WT_RET(__wt_rwlock_init(session, &conn->debug_log_retention_lock));
@@ -125,6 +126,7 @@ __wti_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_spin_destroy(session, &conn->tiered_lock);
     __wt_spin_destroy(session, &conn->turtle_lock);
     __wt_spin_destroy(session, &conn->prefetch_lock);
+    __wt_spin_destroy(session, &conn->update_pool_lock);
 
     /* Free allocated hash buckets. */
     __wt_free(session, conn->blockhash);
@@ -104,6 +104,8 @@ __wti_connection_close(WT_CONNECTION_IMPL *conn)
 
     /* The eviction server is shut down last. */
     WT_TRET(__wt_evict_threads_destroy(session));
+    /* Reconciliation can't run once eviction stops, there's nothing left to write. */
+    WT_TRET(__wt_rec_pipeline_destroy(session));
     /* The capacity server can only be shut down after all I/O is complete. */
     WT_TRET(__wti_capacity_server_destroy(session));
 
@@ -179,6 +181,9 @@ __wti_connection_close(WT_CONNECTION_IMPL *conn)
         session = conn->default_session = &conn->dummy_session;
     }
 
+    /* Free the updates the sessions' update pools returned to the connection. */
+    __wt_update_pool_destroy(session);
+
     /*
      * The session split stash, hazard information and handle arrays aren't discarded during normal
      * session close, they persist past the life of the session. Discard them now.
@@ -272,6 +277,9 @@ __wti_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
      */
     WT_RET(__wt_evict_threads_create(session));
 
+    /* Start the optional write pipeline threads. */
+    WT_RET(__wt_rec_pipeline_create(session, cfg));
+
     /* Start the handle sweep thread. */
     WT_RET(__wti_sweep_create(session));
 
@@ -18,6 +18,112 @@ __prefetch_thread_chk(WT_SESSION_IMPL *session)
     return (F_ISSET(S2C(session), WT_CONN_PREFETCH_RUN));
 }
 
+/*
+ * __prefetch_read_async_queue --
+ *     Queue an asynchronous read of a pre-fetch slot's block. Must be called while holding the
+ *     slot's dhandle.
+ */
+static int
+__prefetch_read_async_queue(WT_SESSION_IMPL *session, WT_PREFETCH_READ *pr, uint64_t slot)
+{
+    WT_ADDR_COPY addr;
+    WT_BTREE *btree;
+
+    btree = S2BT(session);
+
+    /* Fast deleted pages aren't read, and pages without an address were never written. */
+    if (pr->pe->ref->page_del != NULL || WT_REF_GET_STATE(pr->pe->ref) != WT_REF_DISK ||
+      !__wt_ref_addr_copy(session, pr->pe->ref, &addr))
+        return (0);
+
+    return (__wt_bm_read_async(
+      btree->bm, session, session->pf.ring, pr, addr.addr, (size_t)addr.size, slot));
+}
+
+/*
+ * __prefetch_read_async --
+ *     Read the blocks of a batch of queued pages concurrently, leaving the images for the block
+ *     read path to consume when each page is brought into the cache. This is an optimization only,
+ *     any page whose block couldn't be read asynchronously is read synchronously as usual.
+ */
+static void
+__prefetch_read_async(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    WT_PREFETCH_READ *pr;
+    uint64_t slot;
+    uint32_t i, submitted;
+    int result;
+
+    submitted = 0;
+
+    /* Reading the page's address requires a split generation, see __wt_prefetch_page_in. */
+    WT_ENTER_GENERATION(session, WT_GEN_SPLIT);
+    for (i = 0; i < session->pf.reads_count; ++i) {
+        pr = &session->pf.reads[i];
+        WT_WITH_DHANDLE(
+          session, pr->pe->dhandle, WT_IGNORE_RET(__prefetch_read_async_queue(session, pr, i)));
+        if (pr->inflight)
+            ++submitted;
+    }
+    WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
+
+    if (submitted == 0)
+        return;
+    WT_STAT_CONN_INCR(session, prefetch_async_read_batches);
+    WT_STAT_CONN_INCRV(session, prefetch_async_read_submitted, submitted);
+
+    /* Wait for every read: the kernel owns the buffers until they complete. */
+    while ((ret = __wt_io_uring_reap(session, session->pf.ring, true, &slot, &result)) == 0) {
+        pr = &session->pf.reads[slot];
+        pr->inflight = false;
+        if (result == (int)pr->size) {
+            pr->ready = true;
+            ++session->pf.reads_ready;
+        } else
+            WT_STAT_CONN_INCR(session, prefetch_async_read_failed);
+    }
+
+    /*
+     * If the ring failed, stop using it: discarding the ring waits for any reads still in flight,
+     * and the thread reads synchronously from now on.
+     */
+    if (ret != WT_NOTFOUND) {
+        __wt_verbose_warning(session, WT_VERB_PREFETCH,
+          "asynchronous pre-fetch reads failed, reading synchronously: %s",
+          __wt_strerror(session, ret, NULL, 0));
+        __wt_io_uring_destroy(session, &session->pf.ring);
+        session->pf.async_unsupported = true;
+    }
+}
+
+/*
+ * __prefetch_read_async_init --
+ *     Set up asynchronous reads for a pre-fetch thread, if configured and supported.
+ */
+static int
+__prefetch_read_async_init(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    if (conn->prefetch_async_depth == 0 || session->pf.ring != NULL ||
+      session->pf.async_unsupported)
+        return (0);
+
+    if ((ret = __wt_io_uring_create(session, conn->prefetch_async_depth, &session->pf.ring)) ==
+      ENOTSUP) {
+        __wt_verbose_notice(session, WT_VERB_PREFETCH, "%s",
+          "asynchronous pre-fetch reads are not supported, reading synchronously");
+        session->pf.async_unsupported = true;
+        return (0);
+    }
+    WT_RET(ret);
+    return (__wt_calloc_def(session, conn->prefetch_async_depth, &session->pf.reads));
+}
+
 /*
  * __prefetch_thread_run --
  *     Entry function for a prefetch thread. This is called repeatedly from the thread group code so
@@ -29,6 +135,8 @@ __prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_PREFETCH_QUEUE_ENTRY *pe;
+    WT_PREFETCH_READ *pr, single;
+    uint32_t batch_max, i;
 
     WT_UNUSED(thread);
     WT_ASSERT(session, session->id != 0);
@@ -40,84 +148,145 @@ __prefetch_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
     if (F_ISSET(conn, WT_CONN_PREFETCH_RUN))
         __wt_cond_wait(session, conn->prefetch_threads.wait_cond, WT_THOUSAND * WT_THOUSAND, NULL);
 
+    /*
+     * Without asynchronous reads, pages are processed one at a time. With them, a batch of queued
+     * pages is taken at once so their reads can be in flight concurrently.
+     */
+    WT_RET(__prefetch_read_async_init(session));
+    if (session->pf.ring != NULL)
+        batch_max = conn->prefetch_async_depth;
+    else {
+        batch_max = 1;
+        if (session->pf.reads == NULL) {
+            WT_CLEAR(single);
+            session->pf.reads = &single;
+        }
+    }
+
     while (!TAILQ_EMPTY(&conn->pfqh)) {
+        session->pf.reads_count = 0;
+
         /* Encourage races. */
         __wt_timing_stress(session, WT_TIMING_STRESS_PREFETCH_1, NULL);
 
         __wt_spin_lock(session, &conn->prefetch_lock);
-        pe = TAILQ_FIRST(&conn->pfqh);
-
-        /* If there is no work for the thread to do - return back to the thread pool */
-        if (pe == NULL) {
-            __wt_spin_unlock(session, &conn->prefetch_lock);
-            break;
-        }
+        while (session->pf.reads_count < batch_max) {
+            /* If there is no more work for the thread to do, process what we have. */
+            if ((pe = TAILQ_FIRST(&conn->pfqh)) == NULL)
+                break;
 
-        TAILQ_REMOVE(&conn->pfqh, pe, q);
-        --conn->prefetch_queue_count;
+            TAILQ_REMOVE(&conn->pfqh, pe, q);
+            --conn->prefetch_queue_count;
 
-        /*
-         * If the cache is getting close to its eviction clean trigger, don't attempt to pre-fetch
-         * the current ref as we may hang if the cache becomes full and we need to wait until space
-         * in the cache clears up. Repeat this process until either eviction has evicted enough
-         * eligible pages (allowing pre-fetch to read into the cache), or we iterate through and
-         * remove all the refs from the pre-fetch queue and pre-fetch becomes a no-op.
-         */
-        if (__wt_evict_clean_pressure(session)) {
-            F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
-            __wt_spin_unlock(session, &conn->prefetch_lock);
-            __wt_free(session, pe);
-            continue;
+            /*
+             * If the cache is getting close to its eviction clean trigger, don't attempt to
+             * pre-fetch the current ref as we may hang if the cache becomes full and we need to
+             * wait until space in the cache clears up. Repeat this process until either eviction
+             * has evicted enough eligible pages (allowing pre-fetch to read into the cache), or we
+             * iterate through and remove all the refs from the pre-fetch queue and pre-fetch
+             * becomes a no-op.
+             */
+            if (__wt_evict_clean_pressure(session)) {
+                F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
+                __wt_free(session, pe);
+                continue;
+            }
+
+            /* Encourage races. */
+            __wt_timing_stress(session, WT_TIMING_STRESS_PREFETCH_2, NULL);
+
+            /*
+             * We increment this while in the prefetch lock as the thread reading from the queue
+             * expects that behavior.
+             */
+            (void)__wt_atomic_addv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
+
+            WT_PREFETCH_ASSERT(session, F_ISSET_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH),
+              prefetch_skipped_no_flag_set);
+
+            pr = &session->pf.reads[session->pf.reads_count++];
+            pr->pe = pe;
+            pr->inflight = pr->ready = false;
         }
-
-        /* Encourage races. */
-        __wt_timing_stress(session, WT_TIMING_STRESS_PREFETCH_2, NULL);
-
-        /*
-         * We increment this while in the prefetch lock as the thread reading from the queue expects
-         * that behavior.
-         */
-        (void)__wt_atomic_addv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
-
-        WT_PREFETCH_ASSERT(
-          session, F_ISSET_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH), prefetch_skipped_no_flag_set);
         __wt_spin_unlock(session, &conn->prefetch_lock);
 
+        if (session->pf.reads_count == 0)
+            break;
+
         /*
          * It's a weird case, but if verify is utilizing prefetch and encounters a corrupted block,
          * stop using prefetch. Some of the guarantees about ref and page freeing are ignored in
-         * that case, which can invalidate entries on the prefetch queue. Don't prefetch fast
-         * deleted pages - they have special performance and visibility considerations associated
-         * with them. Don't prefetch fast deleted pages to avoid wasted effort. We can skip reading
-         * these deleted pages into the cache if the fast truncate information is visible in the
-         * session transaction snapshot.
+         * that case, which can invalidate entries on the prefetch queue.
          */
-        if (!F_ISSET(conn, WT_CONN_DATA_CORRUPTION) && pe->ref->page_del == NULL)
-            WT_WITH_DHANDLE(session, pe->dhandle, ret = __wt_prefetch_page_in(session, pe));
-
-        /*
-         * It is now safe to clear the flag. The prefetch worker is done interacting with the ref
-         * and the associated internal page can be safely evicted from now on.
-         */
-        F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
-        (void)__wt_atomic_subv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
-
-        __wt_free(session, pe);
+        if (session->pf.ring != NULL && !F_ISSET(conn, WT_CONN_DATA_CORRUPTION))
+            __prefetch_read_async(session);
+
+        for (i = 0; i < session->pf.reads_count; ++i) {
+            pe = session->pf.reads[i].pe;
+
+            /*
+             * Don't prefetch fast deleted pages - they have special performance and visibility
+             * considerations associated with them. Don't prefetch fast deleted pages to avoid
+             * wasted effort. We can skip reading these deleted pages into the cache if the fast
+             * truncate information is visible in the session transaction snapshot.
+             */
+            if (ret == 0 && !F_ISSET(conn, WT_CONN_DATA_CORRUPTION) && pe->ref->page_del == NULL) {
+                WT_WITH_DHANDLE(session, pe->dhandle, ret = __wt_prefetch_page_in(session, pe));
+
+                /*
+                 * Ignore specific errors that prevented prefetch from making progress, they are
+                 * harmless.
+                 */
+                if (ret == WT_NOTFOUND || ret == WT_RESTART) {
+                    WT_STAT_CONN_INCR(session, prefetch_skipped_error_ok);
+                    ret = 0;
+                }
+            }
+
+            /*
+             * It is now safe to clear the flag. The prefetch worker is done interacting with the
+             * ref and the associated internal page can be safely evicted from now on.
+             */
+            F_CLR_ATOMIC_8(pe->ref, WT_REF_FLAG_PREFETCH);
+            (void)__wt_atomic_subv32(&((WT_BTREE *)pe->dhandle->handle)->prefetch_busy, 1);
 
-        /*
-         * Ignore specific errors that prevented prefetch from making progress, they are harmless.
-         */
-        if (ret == WT_NOTFOUND || ret == WT_RESTART) {
-            WT_STAT_CONN_INCR(session, prefetch_skipped_error_ok);
-            ret = 0;
+            __wt_free(session, pe);
         }
+
+        /* Images not consumed by a page read are discarded, the buffers are reused. */
+        session->pf.reads_count = session->pf.reads_ready = 0;
         WT_ERR(ret);
     }
 
 err:
+    if (session->pf.reads == &single) {
+        __wt_buf_free(session, &single.buf);
+        session->pf.reads = NULL;
+    }
     return (ret);
 }
 
+/*
+ * __prefetch_thread_stop --
+ *     Shutdown function for a prefetch thread, discard any asynchronous read resources.
+ */
+static int
+__prefetch_thread_stop(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_PREFETCH_READ *pr;
+    uint32_t i;
+
+    WT_UNUSED(thread);
+
+    __wt_io_uring_destroy(session, &session->pf.ring);
+    if ((pr = session->pf.reads) != NULL) {
+        for (i = 0; i < S2C(session)->prefetch_async_depth; ++i)
+            __wt_buf_free(session, &pr[i].buf);
+        __wt_free(session, session->pf.reads);
+    }
+    return (0);
+}
+
 /*
  * __wti_prefetch_create --
  *     Start the pre-fetch server.
@@ -151,7 +320,7 @@ __wti_prefetch_create(WT_SESSION_IMPL *session, const char *cfg[])
     session_flags = WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL;
     WT_ERR(__wt_thread_group_create(session, &conn->prefetch_threads, "prefetch-server",
       WT_PREFETCH_THREAD_COUNT, WT_PREFETCH_THREAD_COUNT, session_flags, __prefetch_thread_chk,
-      __prefetch_thread_run, NULL));
+      __prefetch_thread_run, __prefetch_thread_stop));
     return (0);
 
 err:
@@ -54,6 +54,7 @@ __wt_curconfig_open(
       __wt_cursor_config_notsup,                      /* reconfigure */
       __wt_cursor_notsup,                             /* largest_key */
       __wt_cursor_config_notsup,                      /* bound */
+      __wt_cursor_search_batch_notsup,                /* search_batch */
       __wt_cursor_notsup,                             /* cache */
       __wt_cursor_reopen_notsup,                      /* reopen */
       __wt_cursor_checkpoint_id,                      /* checkpoint ID */
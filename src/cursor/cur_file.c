@@ -281,8 +281,10 @@ __curfile_reset(WT_CURSOR *cursor)
      * guarding the call to cursor bound reset with the API_USER_ENTRY macro. Doing so prevents
      * internal API calls from resetting cursor bounds unintentionally, e.g. cursor->remove.
      */
-    if (API_USER_ENTRY(session))
+    if (API_USER_ENTRY(session)) {
         __wt_cursor_bound_reset(cursor);
+        __wt_btcur_value_bound_reset(cbt);
+    }
 
     /* Reset maintains no position, key or value. */
     WT_ASSERT(session,
@@ -331,6 +333,37 @@ err:
     API_END_RET_STAT(session, ret, cursor_search);
 }
 
+/*
+ * __curfile_search_batch --
+ *     WT_CURSOR->search_batch method for the btree cursor type.
+ */
+static int
+__curfile_search_batch(
+  WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+    WT_CURSOR_BTREE *cbt;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cbt = (WT_CURSOR_BTREE *)cursor;
+    CURSOR_API_CALL(cursor, session, ret, search_batch, CUR2BT(cbt));
+    API_RETRYABLE(session);
+    WT_ERR(__cursor_copy_release(cursor));
+
+    WT_ERR(__curfile_check_cbt_txn(session, cbt));
+
+    WT_WITH_CHECKPOINT(
+      session, cbt, ret = __wt_btcur_search_batch(cbt, keys, values, results, count));
+    WT_ERR(ret);
+
+    /* Search batch doesn't maintain a position. */
+    WT_ASSERT(session, !F_ISSET(cbt, WT_CBT_ACTIVE));
+
+err:
+    API_RETRYABLE_END(session, ret);
+    API_END_RET_STAT(session, ret, cursor_search_batch);
+}
+
 /*
  * __curfile_search_near --
  *     WT_CURSOR->search_near method for the btree cursor type.
@@ -619,6 +652,8 @@ __curfile_close(WT_CURSOR *cursor)
     CURSOR_API_CALL_PREPARE_ALLOWED(cursor, session, close, CUR2BT(cbt));
     WT_ERR(__cursor_copy_release(cursor));
 err:
+    /* Value bounds are cleared with the key bounds, whether the cursor is cached or closed. */
+    __wt_btcur_value_bound_reset(cbt);
 
     /* Only try to cache the cursor if there's no error. */
     if (ret == 0) {
@@ -966,6 +1001,7 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
       __wti_cursor_reconfigure,                       /* reconfigure */
       __wti_cursor_largest_key,                       /* largest_key */
       __wti_cursor_bound,                             /* bound */
+      __curfile_search_batch,                         /* search_batch */
       __curfile_cache,                                /* cache */
       __curfile_reopen,                               /* reopen */
       __wt_cursor_checkpoint_id,                      /* checkpoint ID */
@@ -418,6 +418,10 @@ __curindex_bound(WT_CURSOR *cursor, const char *config)
 
     /* When setting bounds, we need to check that the key is set. */
     if (WT_CONFIG_LIT_MATCH("set", cval)) {
+        WT_ERR(__wt_config_gets(session, cfg, "value", &cval));
+        if (cval.val != 0)
+            WT_ERR_MSG(session, ENOTSUP, "value bounds are not supported by index cursors");
+
         WT_ERR(__cursor_checkkey(cursor));
 
         /* Point the public cursor to the key in the child. */
@@ -580,6 +584,7 @@ __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
       __wt_cursor_config_notsup,                      /* reconfigure */
       __wt_cursor_notsup,                             /* largest_key */
       __curindex_bound,                               /* bound */
+      __wt_cursor_search_batch_notsup,                /* search_batch */
       __wt_cursor_notsup,                             /* cache */
       __wt_cursor_reopen_notsup,                      /* reopen */
       __wt_cursor_checkpoint_id,                      /* checkpoint ID */
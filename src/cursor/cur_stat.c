@@ -33,6 +33,45 @@ __curstat_print_value(WT_SESSION_IMPL *session, uint64_t v, WT_ITEM *buf)
     return (0);
 }
 
+/*
+ * __curstat_refresh --
+ *     Gather the statistics again if the cursor was reset. Delta cursors first save the statistics
+ *     they last gathered, so values that haven't changed since can be skipped.
+ */
+static int
+__curstat_refresh(WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_CURSOR_STAT *cst)
+{
+    if (!cst->notinitialized)
+        return (0);
+
+    cst->delta_count = 0;
+    if (F_ISSET(cst, WT_STAT_DELTA) && cst->next_set == NULL) {
+        WT_RET(__wt_realloc_def(session, &cst->delta_alloc, (size_t)cst->stats_count, &cst->delta));
+        memcpy(cst->delta, cst->stats, (size_t)cst->stats_count * sizeof(int64_t));
+        cst->delta_count = cst->stats_count;
+    }
+
+    WT_RET(__wt_curstat_init(session, cursor->internal_uri, cst->cfg, cst));
+    cst->notinitialized = false;
+
+    /* Statistics returned in multiple sets aren't compared, return all of them. */
+    if (cst->next_set != NULL || cst->stats_count != cst->delta_count)
+        cst->delta_count = 0;
+    return (0);
+}
+
+/*
+ * __curstat_unchanged --
+ *     Return if a delta cursor is positioned on a value that hasn't changed since the statistics
+ *     were last gathered.
+ */
+static WT_INLINE bool
+__curstat_unchanged(WT_CURSOR_STAT *cst)
+{
+    return (cst->delta_count != 0 &&
+      cst->stats[WT_STAT_KEY_OFFSET(cst)] == cst->delta[WT_STAT_KEY_OFFSET(cst)]);
+}
+
 /*
  * __curstat_get_key --
  *     WT_CURSOR->get_key for statistics cursors.
@@ -197,23 +236,22 @@ __curstat_next(WT_CURSOR *cursor)
     CURSOR_API_CALL(cursor, session, ret, next, NULL);
 
     /* Initialize on demand. */
-    if (cst->notinitialized) {
-        WT_ERR(__wt_curstat_init(session, cursor->internal_uri, cst->cfg, cst));
-        cst->notinitialized = false;
-    }
-
-    /* Move to the next item. */
-    if (cst->notpositioned) {
-        cst->notpositioned = false;
-        cst->key = WT_STAT_KEY_MIN(cst);
-        if (cst->next_set != NULL)
-            WT_ERR((*cst->next_set)(session, cst, true, true));
-    } else if (cst->key < WT_STAT_KEY_MAX(cst))
-        ++cst->key;
-    else if (cst->next_set != NULL)
-        WT_ERR((*cst->next_set)(session, cst, true, false));
-    else
-        WT_ERR(WT_NOTFOUND);
+    WT_ERR(__curstat_refresh(session, cursor, cst));
+
+    /* Move to the next item, delta cursors skip values that haven't changed. */
+    do {
+        if (cst->notpositioned) {
+            cst->notpositioned = false;
+            cst->key = WT_STAT_KEY_MIN(cst);
+            if (cst->next_set != NULL)
+                WT_ERR((*cst->next_set)(session, cst, true, true));
+        } else if (cst->key < WT_STAT_KEY_MAX(cst))
+            ++cst->key;
+        else if (cst->next_set != NULL)
+            WT_ERR((*cst->next_set)(session, cst, true, false));
+        else
+            WT_ERR(WT_NOTFOUND);
+    } while (__curstat_unchanged(cst));
 
     cst->v = (uint64_t)cst->stats[WT_STAT_KEY_OFFSET(cst)];
     F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
@@ -240,23 +278,22 @@ __curstat_prev(WT_CURSOR *cursor)
     CURSOR_API_CALL(cursor, session, ret, prev, NULL);
 
     /* Initialize on demand. */
-    if (cst->notinitialized) {
-        WT_ERR(__wt_curstat_init(session, cursor->internal_uri, cst->cfg, cst));
-        cst->notinitialized = false;
-    }
-
-    /* Move to the previous item. */
-    if (cst->notpositioned) {
-        cst->notpositioned = false;
-        cst->key = WT_STAT_KEY_MAX(cst);
-        if (cst->next_set != NULL)
-            WT_ERR((*cst->next_set)(session, cst, false, true));
-    } else if (cst->key > WT_STAT_KEY_MIN(cst))
-        --cst->key;
-    else if (cst->next_set != NULL)
-        WT_ERR((*cst->next_set)(session, cst, false, false));
-    else
-        WT_ERR(WT_NOTFOUND);
+    WT_ERR(__curstat_refresh(session, cursor, cst));
+
+    /* Move to the previous item, delta cursors skip values that haven't changed. */
+    do {
+        if (cst->notpositioned) {
+            cst->notpositioned = false;
+            cst->key = WT_STAT_KEY_MAX(cst);
+            if (cst->next_set != NULL)
+                WT_ERR((*cst->next_set)(session, cst, false, true));
+        } else if (cst->key > WT_STAT_KEY_MIN(cst))
+            --cst->key;
+        else if (cst->next_set != NULL)
+            WT_ERR((*cst->next_set)(session, cst, false, false));
+        else
+            WT_ERR(WT_NOTFOUND);
+    } while (__curstat_unchanged(cst));
 
     cst->v = (uint64_t)cst->stats[WT_STAT_KEY_OFFSET(cst)];
     F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
@@ -311,10 +348,7 @@ __curstat_search(WT_CURSOR *cursor)
     F_CLR(cursor, WT_CURSTD_VALUE_SET | WT_CURSTD_VALUE_SET);
 
     /* Initialize on demand. */
-    if (cst->notinitialized) {
-        WT_ERR(__wt_curstat_init(session, cursor->internal_uri, cst->cfg, cst));
-        cst->notinitialized = false;
-    }
+    WT_ERR(__curstat_refresh(session, cursor, cst));
 
     if (cst->key < WT_STAT_KEY_MIN(cst) || cst->key > WT_STAT_KEY_MAX(cst))
         WT_ERR(WT_NOTFOUND);
@@ -349,6 +383,7 @@ err:
     }
 
     __wt_buf_free(session, &cst->pv);
+    __wt_free(session, cst->delta);
     __wt_free(session, cst->desc_buf);
 
     __wt_cursor_close(cursor);
@@ -372,7 +407,6 @@ __curstat_conn_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
      * connection statistics.
      */
     __wt_conn_stat_init(session);
-    __wt_stat_connection_init_single(&cst->u.conn_stats);
     __wt_stat_connection_aggregate(conn->stats, &cst->u.conn_stats);
     if (F_ISSET(cst, WT_STAT_CLEAR))
         __wt_stat_connection_clear_all(conn->stats);
@@ -418,7 +452,6 @@ __curstat_file_init(
      * source statistics.
      */
     if ((ret = __wt_btree_stat_init(session, cst)) == 0) {
-        __wt_stat_dsrc_init_single(&cst->u.dsrc_stats);
         __wt_stat_dsrc_aggregate(dhandle->stats, &cst->u.dsrc_stats);
         if (F_ISSET(cst, WT_STAT_CLEAR))
             __wt_stat_dsrc_clear_all(dhandle->stats);
@@ -546,6 +579,7 @@ __wt_curstat_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg[],
       __wt_cursor_config_notsup,                    /* reconfigure */
       __wt_cursor_notsup,                           /* largest_key */
       __wt_cursor_config_notsup,                    /* bound */
+      __wt_cursor_search_batch_notsup,              /* search_batch */
       __wt_cursor_notsup,                           /* cache */
       __wt_cursor_reopen_notsup,                    /* reopen */
       __wt_cursor_checkpoint_id,                    /* checkpoint ID */
@@ -636,6 +670,14 @@ __wt_curstat_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg[],
         /* If the connection configures clear, so do we. */
         if (FLD_ISSET(conn->stat_flags, WT_STAT_CLEAR))
             F_SET(cst, WT_STAT_CLEAR);
+
+        /*
+         * Delta cursors only return the statistics that changed since they were last gathered. It
+         * doesn't select statistics, check it after the connection's configuration is copied.
+         */
+        if ((ret = __wt_config_subgets(session, &cval, "delta", &sval)) == 0 && sval.val != 0)
+            F_SET(cst, WT_STAT_DELTA);
+        WT_ERR_NOTFOUND_OK(ret, false);
     }
 
     /*
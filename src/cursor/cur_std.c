@@ -175,6 +175,22 @@ __wt_cursor_search_near_notsup(WT_CURSOR *cursor, int *exact)
     return (__wt_cursor_notsup(cursor));
 }
 
+/*
+ * __wt_cursor_search_batch_notsup --
+ *     Unsupported cursor search-batch.
+ */
+int
+__wt_cursor_search_batch_notsup(
+  WT_CURSOR *cursor, const WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+    WT_UNUSED(keys);
+    WT_UNUSED(values);
+    WT_UNUSED(results);
+    WT_UNUSED(count);
+
+    return (__wt_cursor_notsup(cursor));
+}
+
 /*
  * __wt_cursor_config_notsup --
  *     Unsupported cursor API call which takes config.
@@ -1331,6 +1347,66 @@ err:
     API_END_RET_STAT(session, ret, cursor_largest_key);
 }
 
+/*
+ * __cursor_bound_value --
+ *     Set a lower or upper bound on the values a row-store btree cursor returns.
+ */
+static int
+__cursor_bound_value(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_CONF *conf)
+{
+    WT_CONFIG_ITEM cval;
+    WT_ITEM value;
+    int exact;
+    bool inclusive;
+
+    if (CUR2BT(cbt)->type != BTREE_ROW)
+        WT_RET_MSG(session, ENOTSUP, "value bounds are only supported by row-store cursors");
+
+    /* The cursor must have a value set to place the lower or upper bound. */
+    WT_RET(__cursor_checkvalue(&cbt->iface));
+    WT_RET(__wt_cursor_get_raw_value(&cbt->iface, &value));
+
+    WT_RET(__wt_conf_gets_def(session, conf, inclusive, true, &cval));
+    inclusive = cval.val != 0;
+
+    /* Values are compared byte-wise, the order the page zone maps are built in. */
+    WT_RET(__wt_conf_gets(session, conf, bound, &cval));
+    if (WT_CONF_STRING_MATCH(upper, cval)) {
+        if (F_ISSET(cbt, WT_CBT_VALUE_LOWER)) {
+            exact = __wt_lex_compare(&value, &cbt->value_lower);
+            if (exact < 0)
+                WT_RET_MSG(session, EINVAL, "The provided cursor bounds are overlapping");
+            if (exact == 0 && (!F_ISSET(cbt, WT_CBT_VALUE_LOWER_INCLUSIVE) || !inclusive))
+                WT_RET_MSG(
+                  session, EINVAL, "The provided cursor bounds are equal but not inclusive");
+        }
+        WT_RET(__wt_buf_set(session, &cbt->value_upper, value.data, value.size));
+        F_SET(cbt, WT_CBT_VALUE_UPPER);
+        if (inclusive)
+            F_SET(cbt, WT_CBT_VALUE_UPPER_INCLUSIVE);
+        else
+            F_CLR(cbt, WT_CBT_VALUE_UPPER_INCLUSIVE);
+    } else if (WT_CONF_STRING_MATCH(lower, cval)) {
+        if (F_ISSET(cbt, WT_CBT_VALUE_UPPER)) {
+            exact = __wt_lex_compare(&value, &cbt->value_upper);
+            if (exact > 0)
+                WT_RET_MSG(session, EINVAL, "The provided cursor bounds are overlapping");
+            if (exact == 0 && (!F_ISSET(cbt, WT_CBT_VALUE_UPPER_INCLUSIVE) || !inclusive))
+                WT_RET_MSG(
+                  session, EINVAL, "The provided cursor bounds are equal but not inclusive");
+        }
+        WT_RET(__wt_buf_set(session, &cbt->value_lower, value.data, value.size));
+        F_SET(cbt, WT_CBT_VALUE_LOWER);
+        if (inclusive)
+            F_SET(cbt, WT_CBT_VALUE_LOWER_INCLUSIVE);
+        else
+            F_CLR(cbt, WT_CBT_VALUE_LOWER_INCLUSIVE);
+    } else
+        WT_RET_MSG(session, EINVAL,
+          "a bound must be specified when setting bounds, either \"lower\" or \"upper\"");
+    return (0);
+}
+
 /*
  * __wti_cursor_bound --
  *     WT_CURSOR->bound default implementation.
@@ -1364,6 +1440,13 @@ __wti_cursor_bound(WT_CURSOR *cursor, const char *config)
         if (WT_CURSOR_IS_POSITIONED(cbt))
             WT_ERR_MSG(session, EINVAL, "setting bounds on a positioned cursor is not allowed");
 
+        /* Value bounds are kept by the btree cursor, separately from the key bounds. */
+        WT_ERR(__wt_conf_gets_def(session, conf, value, false, &cval));
+        if (cval.val != 0) {
+            ret = __cursor_bound_value(session, cbt, conf);
+            goto err;
+        }
+
         /* The cursor must have a key set to place the lower or upper bound. */
         WT_ERR(__cursor_checkkey(cursor));
 
@@ -1438,6 +1521,7 @@ __wti_cursor_bound(WT_CURSOR *cursor, const char *config)
         __wt_buf_free(session, &cursor->lower_bound);
         WT_CLEAR(cursor->upper_bound);
         WT_CLEAR(cursor->lower_bound);
+        __wt_btcur_value_bound_reset(cbt);
     }
 err:
     API_END_RET_STAT(session, ret, cursor_bound);
@@ -22,6 +22,22 @@ static int __curtable_update(WT_CURSOR *cursor);
         }                                                                               \
     } while (0)
 
+/*
+ * Apply a read operation to the column groups a projection references: the others aren't moved.
+ */
+#define APPLY_CG_PROJ(ctable, f)                                                        \
+    do {                                                                                \
+        WT_CURSOR **__cp;                                                               \
+        u_int __i;                                                                      \
+        for (__i = 0, __cp = (ctable)->cg_cursors; __i < WT_COLGROUPS((ctable)->table); \
+             __i++, __cp++) {                                                           \
+            if ((ctable)->cg_skip != NULL && (ctable)->cg_skip[__i])                    \
+                continue;                                                               \
+            WT_TRET((*__cp)->f(*__cp));                                                 \
+            WT_ERR_NOTFOUND_OK(ret, true);                                              \
+        }                                                                               \
+    } while (0)
+
 /*
  * __wt_apply_single_idx --
  *     Apply an operation to a single index of a table.
@@ -70,6 +86,41 @@ __apply_idx(WT_CURSOR_TABLE *ctable, size_t func_off, bool skip_immutable)
     return (0);
 }
 
+/*
+ * __curtable_position_skipped --
+ *     Position the column groups a projection doesn't reference on the primary's record before a
+ *     write, reads only moved the column groups the projection references.
+ */
+static int
+__curtable_position_skipped(WT_CURSOR_TABLE *ctable)
+{
+    WT_CURSOR **cp, *primary;
+    u_int i;
+
+    if (ctable->cg_skip == NULL)
+        return (0);
+
+    /*
+     * If the primary was positioned by a read, the other column groups must be written with the
+     * record's current values, as if they had been moved along with it. If the application set the
+     * key, it was copied to all of the column groups and there's nothing to do.
+     */
+    primary = *ctable->cg_cursors;
+    if (!F_ISSET(primary, WT_CURSTD_KEY_INT))
+        return (0);
+
+    for (i = 1, cp = ctable->cg_cursors + 1; i < WT_COLGROUPS(ctable->table); i++, cp++) {
+        if (!ctable->cg_skip[i])
+            continue;
+        (*cp)->key.data = primary->key.data;
+        (*cp)->key.size = primary->key.size;
+        (*cp)->recno = primary->recno;
+        F_SET(*cp, WT_CURSTD_KEY_EXT);
+        WT_RET((*cp)->search(*cp));
+    }
+    return (0);
+}
+
 /*
  * __curtable_get_key --
  *     WT_CURSOR->get_key implementation for tables.
@@ -267,7 +318,7 @@ __curtable_next(WT_CURSOR *cursor)
     CURSOR_API_CALL(cursor, session, ret, next, NULL);
     API_RETRYABLE(session);
     CURSOR_REPOSITION_ENTER(cursor, session);
-    APPLY_CG(ctable, next);
+    APPLY_CG_PROJ(ctable, next);
 
 err:
     CURSOR_REPOSITION_END(cursor, session);
@@ -298,6 +349,8 @@ __curtable_next_random(WT_CURSOR *cursor)
 
     /* Fill in the rest of the columns. */
     for (i = 1; i < WT_COLGROUPS(ctable->table); i++, cp++) {
+        if (ctable->cg_skip != NULL && ctable->cg_skip[i])
+            continue;
         (*cp)->key.data = primary->key.data;
         (*cp)->key.size = primary->key.size;
         (*cp)->recno = primary->recno;
@@ -324,7 +377,7 @@ __curtable_prev(WT_CURSOR *cursor)
     CURSOR_API_CALL(cursor, session, ret, prev, NULL);
     API_RETRYABLE(session);
     CURSOR_REPOSITION_ENTER(cursor, session);
-    APPLY_CG(ctable, prev);
+    APPLY_CG_PROJ(ctable, prev);
 
 err:
     CURSOR_REPOSITION_END(cursor, session);
@@ -381,7 +434,7 @@ __curtable_search(WT_CURSOR *cursor)
     CURSOR_API_CALL(cursor, session, ret, search, NULL);
     API_RETRYABLE(session);
     CURSOR_REPOSITION_ENTER(cursor, session);
-    APPLY_CG(ctable, search);
+    APPLY_CG_PROJ(ctable, search);
 
 err:
     CURSOR_REPOSITION_END(cursor, session);
@@ -411,7 +464,9 @@ __curtable_search_near(WT_CURSOR *cursor, int *exact)
     primary = *cp;
     WT_ERR(primary->search_near(primary, exact));
 
-    for (i = 1, ++cp; i < WT_COLGROUPS(ctable->table); i++) {
+    for (i = 1, ++cp; i < WT_COLGROUPS(ctable->table); i++, cp++) {
+        if (ctable->cg_skip != NULL && ctable->cg_skip[i])
+            continue;
         (*cp)->key.data = primary->key.data;
         (*cp)->key.size = primary->key.size;
         (*cp)->recno = primary->recno;
@@ -442,6 +497,7 @@ __curtable_insert(WT_CURSOR *cursor)
     ctable = (WT_CURSOR_TABLE *)cursor;
     CURSOR_UPDATE_API_CALL(cursor, session, ret, insert);
     WT_ERR(__curtable_open_indices(ctable));
+    WT_ERR(__curtable_position_skipped(ctable));
 
     cp = ctable->cg_cursors;
     primary = *cp++;
@@ -520,6 +576,7 @@ __curtable_update(WT_CURSOR *cursor)
     ctable = (WT_CURSOR_TABLE *)cursor;
     CURSOR_UPDATE_API_CALL(cursor, session, ret, update);
     WT_ERR(__curtable_open_indices(ctable));
+    WT_ERR(__curtable_position_skipped(ctable));
 
     /*
      * If the table has indices, first delete any old index keys, then update the primary, then
@@ -572,6 +629,7 @@ __curtable_remove(WT_CURSOR *cursor)
     ctable = (WT_CURSOR_TABLE *)cursor;
     CURSOR_REMOVE_API_CALL(cursor, session, ret, NULL);
     WT_ERR(__curtable_open_indices(ctable));
+    WT_ERR(__curtable_position_skipped(ctable));
 
     /* Check if the cursor was positioned. */
     primary = *ctable->cg_cursors;
@@ -627,6 +685,7 @@ __curtable_reserve(WT_CURSOR *cursor)
      */
     WT_ERR(__wt_txn_context_check(session, true));
     WT_ERR(__curtable_open_indices(ctable));
+    WT_ERR(__curtable_position_skipped(ctable));
 
     /* Reserve in column groups, ignore indices. */
     APPLY_CG(ctable, reserve);
@@ -754,6 +813,7 @@ err:
 static int
 __curtable_bound(WT_CURSOR *cursor, const char *config)
 {
+    WT_CONFIG_ITEM cval;
     WT_CURSOR **cp, *primary;
     WT_CURSOR_BOUNDS_STATE saved_bounds;
     WT_CURSOR_TABLE *ctable;
@@ -764,7 +824,12 @@ __curtable_bound(WT_CURSOR *cursor, const char *config)
     WT_CLEAR(saved_bounds);
     ctable = (WT_CURSOR_TABLE *)cursor;
     primary = *ctable->cg_cursors;
-    CURSOR_API_CALL(cursor, session, ret, bound, NULL);
+    CURSOR_API_CALL_CONF(cursor, session, ret, bound, config, cfg, NULL);
+
+    /* Value bounds are kept by the btree cursor of a file, table cursors don't support them. */
+    WT_ERR(__wt_config_gets(session, cfg, "value", &cval));
+    if (cval.val != 0)
+        WT_ERR_MSG(session, ENOTSUP, "value bounds are not supported by table cursors");
 
     /* Save the current state of the bounds in case we fail to apply the new state. */
     WT_ERR(__wt_cursor_bounds_save(session, primary, &saved_bounds));
@@ -827,6 +892,7 @@ err:
     __wt_free(session, ctable->cg_cursors);
     __wt_free(session, ctable->cg_valcopy);
     __wt_free(session, ctable->idx_cursors);
+    __wt_free(session, ctable->cg_skip);
 
     WT_TRET(__wt_schema_release_table(session, &ctable->table));
     /* The URI is owned by the table. */
@@ -939,6 +1005,43 @@ err:
     return (ret);
 }
 
+/*
+ * __curtable_projection_skip --
+ *     Find the column groups a projection's plan doesn't reference, reads won't move them.
+ */
+static int
+__curtable_projection_skip(WT_CURSOR_TABLE *ctable)
+{
+    WT_SESSION_IMPL *session;
+    u_long arg;
+    u_int i, skipped;
+    char *proj;
+
+    session = CUR2S(ctable);
+
+    if (WT_COLGROUPS(ctable->table) == 1)
+        return (0);
+
+    WT_RET(__wt_calloc_def(session, WT_COLGROUPS(ctable->table), &ctable->cg_skip));
+    for (i = 0; i < WT_COLGROUPS(ctable->table); i++)
+        ctable->cg_skip[i] = true;
+
+    /* The primary column group is always moved, it holds the cursor's key. */
+    ctable->cg_skip[0] = false;
+    for (proj = (char *)ctable->plan; *proj != '\0'; proj++) {
+        arg = strtoul(proj, &proj, 10);
+        if (*proj == WT_PROJ_KEY || *proj == WT_PROJ_VALUE)
+            ctable->cg_skip[arg] = false;
+    }
+
+    for (i = skipped = 0; i < WT_COLGROUPS(ctable->table); i++)
+        if (ctable->cg_skip[i])
+            ++skipped;
+    if (skipped == 0)
+        __wt_free(session, ctable->cg_skip);
+    return (0);
+}
+
 /*
  * __wt_curtable_open --
  *     WT_SESSION->open_cursor method for table cursors.
@@ -967,6 +1070,7 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
       __wti_cursor_reconfigure,                      /* reconfigure */
       __curtable_largest_key,                        /* largest_key */
       __curtable_bound,                              /* bound */
+      __wt_cursor_search_batch_notsup,               /* search_batch */
       __wt_cursor_notsup,                            /* cache */
       __wt_cursor_reopen_notsup,                     /* reopen */
       __wt_cursor_checkpoint_id,                     /* checkpoint ID */
@@ -1029,6 +1133,7 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
         WT_ERR(__wt_buf_init(session, tmp, 0));
         WT_ERR(__wt_struct_plan(session, table, columns, strlen(columns), false, tmp));
         WT_ERR(__wt_strndup(session, tmp->data, tmp->size, &ctable->plan));
+        WT_ERR(__curtable_projection_skip(ctable));
     }
 
     /*
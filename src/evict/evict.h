@@ -33,8 +33,7 @@ struct __wt_evict {
     /*
      * Eviction thread information.
      */
-    WT_CONDVAR *evict_cond;      /* Eviction server condition */
-    WT_SPINLOCK evict_walk_lock; /* Eviction walk location */
+    WT_CONDVAR *evict_cond; /* Eviction server condition */
 
     /*
      * Eviction threshold percentages use double type to allow for specifying percentages less than
@@ -74,22 +73,26 @@ struct __wt_evict {
     /*
      * LRU eviction list information.
      */
-    WT_SPINLOCK evict_pass_lock;   /* Eviction pass lock */
-    WT_SESSION_IMPL *walk_session; /* Eviction pass session */
-    WT_DATA_HANDLE *walk_tree;     /* LRU walk current tree */
-
-    WT_SPINLOCK evict_queue_lock; /* Eviction current queue lock */
-    WT_EVICT_QUEUE evict_queues[WT_EVICT_QUEUE_MAX];
-    WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
-    WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill.
-                                            This is usually the same as the
-                                            "other" queue but under heavy
-                                            load the eviction server will
-                                            start filling the current queue
-                                            before it switches. */
-    WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
-    WT_EVICT_QUEUE *evict_urgent_queue;  /* LRU urgent queue */
-    uint32_t evict_slots;                /* LRU list eviction slots */
+    WT_SPINLOCK evict_pass_lock; /* Eviction pass lock */
+
+    WT_SPINLOCK evict_queue_lock;       /* Eviction queues lock */
+    WT_EVICT_QUEUE *evict_queues;       /* Shard queues, then the urgent queue */
+    uint32_t evict_queue_count;         /* Number of queues */
+    WT_EVICT_QUEUE *evict_urgent_queue; /* LRU urgent queue */
+    uint32_t evict_slots;               /* LRU list eviction slots */
+
+    WT_EVICT_SHARD *evict_shards; /* Eviction shards */
+    uint32_t evict_shard_count;   /* Number of eviction shards */
+
+    /*
+     * Eviction walker threads: the eviction server starts a walk generation and waits for the
+     * walkers to finish walking their shards.
+     */
+    WT_THREAD_GROUP walk_threads;
+    WT_CONDVAR *walk_done_cond;      /* Signalled as walkers finish */
+    wt_shared uint64_t walk_gen;     /* Current walk generation */
+    wt_shared uint32_t walkers_busy; /* Walkers yet to finish the generation */
+    wt_shared bool walk_threads_run; /* Walker threads are running */
 
 #define WT_EVICT_PRESSURE_THRESHOLD 0.95
 #define WT_EVICT_SCORE_BUMP 10
@@ -105,7 +108,7 @@ struct __wt_evict {
     /*
      * Score of how often LRU queues are empty on refill. This score varies between 0 (if the queue
      * hasn't been empty for a long time) and 100 (if the queue has been empty the last 10 times we
-     * filled up.
+     * filled up. It is the highest score of the eviction shards.
      */
     uint32_t evict_empty_score;
 
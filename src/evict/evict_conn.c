@@ -264,7 +264,8 @@ __wt_evict_create(WT_SESSION_IMPL *session, const char *cfg[])
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_EVICT *evict;
-    int i;
+    WT_EVICT_SHARD *shard;
+    uint32_t i;
 
     conn = S2C(session);
 
@@ -285,24 +286,42 @@ __wt_evict_create(WT_SESSION_IMPL *session, const char *cfg[])
 
     WT_RET(__wt_cond_auto_alloc(
       session, "evict server", 10 * WT_THOUSAND, WT_MILLION, &evict->evict_cond));
+    WT_RET(__wt_cond_alloc(session, "evict walk done", &evict->walk_done_cond));
     WT_RET(__wt_spin_init(session, &evict->evict_pass_lock, "evict pass"));
     WT_RET(__wt_spin_init(session, &evict->evict_queue_lock, "evict queues"));
-    WT_RET(__wt_spin_init(session, &evict->evict_walk_lock, "evict walk"));
-    if ((ret = __wt_open_internal_session(
-           conn, "evict pass", false, WT_SESSION_NO_DATA_HANDLES, 0, &evict->walk_session)) != 0)
-        WT_RET_MSG(NULL, ret, "Failed to create session for eviction walks");
 
-    /* Allocate the LRU eviction queue. */
+    /*
+     * The number of eviction shards is fixed when the connection is opened, reconfiguring the
+     * maximum number of eviction threads doesn't change it.
+     */
+    evict->evict_shard_count =
+      WT_MAX(1, WT_MIN(WT_EVICT_MAX_SHARDS, conn->evict_threads_max / WT_EVICT_SHARD_THREADS));
+
+    /* Allocate the LRU eviction queues: two for each shard plus the urgent queue. */
     evict->evict_slots = WT_EVICT_WALK_BASE + WT_EVICT_WALK_INCR;
-    for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
+    evict->evict_queue_count = 2 * evict->evict_shard_count + 1;
+    WT_RET(__wt_calloc_def(session, evict->evict_queue_count, &evict->evict_queues));
+    for (i = 0; i < evict->evict_queue_count; ++i) {
         WT_RET(__wt_calloc_def(session, evict->evict_slots, &evict->evict_queues[i].evict_queue));
         WT_RET(__wt_spin_init(session, &evict->evict_queues[i].evict_lock, "evict queue"));
     }
-
-    /* Ensure there are always non-NULL queues. */
-    evict->evict_current_queue = evict->evict_fill_queue = &evict->evict_queues[0];
-    evict->evict_other_queue = &evict->evict_queues[1];
-    evict->evict_urgent_queue = &evict->evict_queues[WT_EVICT_URGENT_QUEUE];
+    evict->evict_urgent_queue = &evict->evict_queues[evict->evict_queue_count - 1];
+
+    WT_RET(__wt_calloc_def(session, evict->evict_shard_count, &evict->evict_shards));
+    for (i = 0; i < evict->evict_shard_count; ++i) {
+        shard = &evict->evict_shards[i];
+        shard->id = i;
+        WT_RET(__wt_spin_init(session, &shard->evict_walk_lock, "evict walk"));
+        WT_RET(__wt_spin_init(session, &shard->evict_queue_lock, "evict shard queues"));
+        if ((ret = __wt_open_internal_session(conn, "evict pass", false,
+               WT_SESSION_NO_DATA_HANDLES, 0, &shard->walk_session)) != 0)
+            WT_RET_MSG(NULL, ret, "Failed to create session for eviction walks");
+
+        /* Ensure there are always non-NULL queues. */
+        shard->evict_queues = &evict->evict_queues[2 * i];
+        shard->evict_current_queue = shard->evict_fill_queue = &shard->evict_queues[0];
+        shard->evict_other_queue = &shard->evict_queues[1];
+    }
 
     /*
      * We get/set some values in the evict statistics (rather than have two copies), configure them.
@@ -325,7 +344,8 @@ __wt_evict_destroy(WT_SESSION_IMPL *session)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_EVICT *evict;
-    int i;
+    WT_EVICT_SHARD *shard;
+    uint32_t i;
 
     conn = S2C(session);
     evict = conn->evict;
@@ -334,16 +354,26 @@ __wt_evict_destroy(WT_SESSION_IMPL *session)
         return (0);
 
     __wt_cond_destroy(session, &evict->evict_cond);
+    __wt_cond_destroy(session, &evict->walk_done_cond);
     __wt_spin_destroy(session, &evict->evict_pass_lock);
     __wt_spin_destroy(session, &evict->evict_queue_lock);
-    __wt_spin_destroy(session, &evict->evict_walk_lock);
-    if (evict->walk_session != NULL)
-        WT_TRET(__wt_session_close_internal(evict->walk_session));
 
-    for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
-        __wt_spin_destroy(session, &evict->evict_queues[i].evict_lock);
-        __wt_free(session, evict->evict_queues[i].evict_queue);
-    }
+    if (evict->evict_shards != NULL)
+        for (i = 0; i < evict->evict_shard_count; ++i) {
+            shard = &evict->evict_shards[i];
+            __wt_spin_destroy(session, &shard->evict_walk_lock);
+            __wt_spin_destroy(session, &shard->evict_queue_lock);
+            if (shard->walk_session != NULL)
+                WT_TRET(__wt_session_close_internal(shard->walk_session));
+        }
+    __wt_free(session, evict->evict_shards);
+
+    if (evict->evict_queues != NULL)
+        for (i = 0; i < evict->evict_queue_count; ++i) {
+            __wt_spin_destroy(session, &evict->evict_queues[i].evict_lock);
+            __wt_free(session, evict->evict_queues[i].evict_queue);
+        }
+    __wt_free(session, evict->evict_queues);
     __wt_free(session, conn->evict);
     return (ret);
 }
@@ -363,6 +393,8 @@ __wt_evict_stats_update(WT_SESSION_IMPL *session)
     WT_CONNECTION_IMPL *conn;
     WT_CONNECTION_STATS **stats;
     WT_EVICT *evict;
+    uint64_t walks_active;
+    uint32_t i;
 
     conn = S2C(session);
     evict = conn->evict;
@@ -385,10 +417,13 @@ __wt_evict_stats_update(WT_SESSION_IMPL *session)
       session, stats, eviction_stable_state_workers, evict->evict_tune_workers_best);
 
     /*
-     * The number of files with active walks ~= number of hazard pointers in the walk session. Note:
-     * reading without locking.
+     * The number of files with active walks ~= number of hazard pointers in the walk sessions.
+     * Note: reading without locking.
      */
-    if (__wt_atomic_loadbool(&conn->evict_server_running))
-        WT_STATP_CONN_SET(
-          session, stats, eviction_walks_active, evict->walk_session->hazards.num_active);
+    if (__wt_atomic_loadbool(&conn->evict_server_running)) {
+        walks_active = 0;
+        for (i = 0; i < evict->evict_shard_count; ++i)
+            walks_active += evict->evict_shards[i].walk_session->hazards.num_active;
+        WT_STATP_CONN_SET(session, stats, eviction_walks_active, walks_active);
+    }
 }
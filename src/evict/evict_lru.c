@@ -13,15 +13,29 @@ static void __evict_list_clear_page_locked(WT_SESSION_IMPL *, WT_REF *, bool);
 static int WT_CDECL __evict_lru_cmp(const void *, const void *);
 static int __evict_lru_pages(WT_SESSION_IMPL *, bool);
 static int __evict_lru_walk(WT_SESSION_IMPL *);
+static int __evict_lru_walk_shard(WT_SESSION_IMPL *, WT_EVICT_SHARD *);
 static int __evict_page(WT_SESSION_IMPL *, bool);
 static int __evict_pass(WT_SESSION_IMPL *);
 static int __evict_server(WT_SESSION_IMPL *, bool *);
 static void __evict_tune_workers(WT_SESSION_IMPL *session);
-static int __evict_walk(WT_SESSION_IMPL *, WT_EVICT_QUEUE *);
+static int __evict_walk(WT_SESSION_IMPL *, WT_EVICT_SHARD *, WT_EVICT_QUEUE *);
 static int __evict_walk_tree(WT_SESSION_IMPL *, WT_EVICT_QUEUE *, u_int, u_int *);
 
 #define WT_EVICT_HAS_WORKERS(s) (__wt_atomic_load32(&S2C(s)->evict_threads.current_threads) > 1)
 
+/*
+ * __evict_shard --
+ *     Return the eviction shard a tree belongs to.
+ */
+static WT_INLINE WT_EVICT_SHARD *
+__evict_shard(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+    WT_EVICT *evict;
+
+    evict = S2C(session)->evict;
+    return (&evict->evict_shards[btree->id % evict->evict_shard_count]);
+}
+
 /*
  * __evict_lock_handle_list --
  *     Try to get the handle list lock, with yield and sleep back off. Keep timing statistics
@@ -169,8 +183,8 @@ __evict_list_clear_page_locked(WT_SESSION_IMPL *session, WT_REF *ref, bool exclu
     uint32_t elem, i, q, last_queue_idx;
     bool found;
 
-    last_queue_idx = exclude_urgent ? WT_EVICT_URGENT_QUEUE : WT_EVICT_QUEUE_MAX;
     evict = S2C(session)->evict;
+    last_queue_idx = exclude_urgent ? evict->evict_queue_count - 1 : evict->evict_queue_count;
     found = false;
 
     WT_ASSERT_SPINLOCK_OWNED(session, &evict->evict_queue_lock);
@@ -304,6 +318,7 @@ __evict_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WT_EVICT *evict;
+    uint32_t i;
     bool did_work, was_intr;
 
     conn = S2C(session);
@@ -322,13 +337,16 @@ __evict_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
       __wt_spin_trylock(session, &evict->evict_pass_lock) == 0) {
         /*
          * Cannot use WT_WITH_PASS_LOCK because this is a try lock. Fix when that is supported. We
-         * set the flag on both sessions because we may call clear_walk when we are walking with the
-         * walk session, locked.
+         * set the flag on the walk sessions too because we may call clear_walk when we are walking
+         * with a walk session, locked. The shard walkers only run while the server waits for them
+         * during its pass, so they are covered by the server holding the lock.
          */
         FLD_SET(session->lock_flags, WT_SESSION_LOCKED_PASS);
-        FLD_SET(evict->walk_session->lock_flags, WT_SESSION_LOCKED_PASS);
+        for (i = 0; i < evict->evict_shard_count; ++i)
+            FLD_SET(evict->evict_shards[i].walk_session->lock_flags, WT_SESSION_LOCKED_PASS);
         ret = __evict_server(session, &did_work);
-        FLD_CLR(evict->walk_session->lock_flags, WT_SESSION_LOCKED_PASS);
+        for (i = 0; i < evict->evict_shard_count; ++i)
+            FLD_CLR(evict->evict_shards[i].walk_session->lock_flags, WT_SESSION_LOCKED_PASS);
         FLD_CLR(session->lock_flags, WT_SESSION_LOCKED_PASS);
         was_intr = __wt_atomic_loadv32(&evict->pass_intr) != 0;
         __wt_spin_unlock(session, &evict->evict_pass_lock);
@@ -361,16 +379,16 @@ err:
 
 /*
  * __evict_set_saved_walk_tree --
- *     Set saved walk tree maintaining use count. Call it with NULL to clear the saved walk tree.
+ *     Set a shard's saved walk tree maintaining use count. Call it with NULL to clear the saved
+ *     walk tree.
  */
 static void
-__evict_set_saved_walk_tree(WT_SESSION_IMPL *session, WT_DATA_HANDLE *new_dhandle)
+__evict_set_saved_walk_tree(
+  WT_SESSION_IMPL *session, WT_EVICT_SHARD *shard, WT_DATA_HANDLE *new_dhandle)
 {
     WT_DATA_HANDLE *old_dhandle;
-    WT_EVICT *evict;
 
-    evict = S2C(session)->evict;
-    old_dhandle = evict->walk_tree;
+    old_dhandle = shard->walk_tree;
 
     if (old_dhandle == new_dhandle)
         return;
@@ -378,7 +396,7 @@ __evict_set_saved_walk_tree(WT_SESSION_IMPL *session, WT_DATA_HANDLE *new_dhandl
     if (new_dhandle != NULL)
         (void)__wt_atomic_addi32(&new_dhandle->session_inuse, 1);
 
-    evict->walk_tree = new_dhandle;
+    shard->walk_tree = new_dhandle;
 
     if (old_dhandle != NULL) {
         WT_ASSERT(session, __wt_atomic_loadi32(&old_dhandle->session_inuse) > 0);
@@ -386,6 +404,95 @@ __evict_set_saved_walk_tree(WT_SESSION_IMPL *session, WT_DATA_HANDLE *new_dhandl
     }
 }
 
+/*
+ * __evict_clear_saved_walk_trees --
+ *     Clear the saved walk tree of every shard.
+ */
+static void
+__evict_clear_saved_walk_trees(WT_SESSION_IMPL *session)
+{
+    WT_EVICT *evict;
+    uint32_t i;
+
+    evict = S2C(session)->evict;
+    for (i = 0; i < evict->evict_shard_count; ++i)
+        __evict_set_saved_walk_tree(session, &evict->evict_shards[i], NULL);
+}
+
+/*
+ * __evict_walker_chk --
+ *     Check to decide if an eviction walker thread should continue running.
+ */
+static bool
+__evict_walker_chk(WT_SESSION_IMPL *session)
+{
+    return (__wt_atomic_loadbool(&S2C(session)->evict->walk_threads_run));
+}
+
+/*
+ * __evict_walker_wait --
+ *     Condition variable callback: keep an eviction walker waiting until the eviction server starts
+ *     a new walk generation.
+ */
+static bool
+__evict_walker_wait(WT_SESSION_IMPL *session)
+{
+    WT_EVICT *evict;
+    uint32_t i;
+
+    evict = S2C(session)->evict;
+    if (!__wt_atomic_loadbool(&evict->walk_threads_run))
+        return (false);
+    for (i = 1; i < evict->evict_shard_count; ++i)
+        if (evict->evict_shards[i].walker_session == session)
+            return (evict->evict_shards[i].walk_gen == __wt_atomic_load64(&evict->walk_gen));
+    return (true);
+}
+
+/*
+ * __evict_walker_run --
+ *     Entry function for an eviction walker thread. Each walker owns one of the shards after the
+ *     first, and fills the shard's queues whenever the eviction server starts a walk generation.
+ *     This is called repeatedly from the thread group code so it does not need to loop itself.
+ */
+static int
+__evict_walker_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_DECL_RET;
+    WT_EVICT *evict;
+    WT_EVICT_SHARD *shard;
+    uint64_t walk_gen;
+
+    evict = S2C(session)->evict;
+    shard = &evict->evict_shards[thread->id + 1];
+    shard->walker_session = session;
+
+    walk_gen = __wt_atomic_load64(&evict->walk_gen);
+    if (shard->walk_gen != walk_gen) {
+        shard->walk_gen = walk_gen;
+        ret = __evict_lru_walk_shard(session, shard);
+
+        /* The eviction server waits for every walker, let it know even if the walk failed. */
+        if (__wt_atomic_subv32(&evict->walkers_busy, 1) == 0)
+            __wt_cond_signal(session, evict->walk_done_cond);
+        if (ret != 0)
+            WT_RET_PANIC(session, ret, "eviction walker error");
+    }
+
+    __wt_cond_wait(session, evict->walk_threads.wait_cond, 10 * WT_THOUSAND, __evict_walker_wait);
+    return (0);
+}
+
+/*
+ * __evict_walkers_busy --
+ *     Condition variable callback: keep the eviction server waiting while walkers are busy.
+ */
+static bool
+__evict_walkers_busy(WT_SESSION_IMPL *session)
+{
+    return (__wt_atomic_load32(&S2C(session)->evict->walkers_busy) != 0);
+}
+
 /*
  * __evict_thread_stop --
  *     Shutdown function for an eviction thread.
@@ -463,7 +570,7 @@ __evict_server(WT_SESSION_IMPL *session, bool *did_work)
 
     if (!__wt_evict_cache_stuck(session)) {
         if (evict->use_npos_in_pass)
-            __evict_set_saved_walk_tree(session, NULL);
+            __evict_clear_saved_walk_trees(session);
         else {
             /*
              * Try to get the handle list lock: if we give up, that indicates a session is waiting
@@ -570,9 +677,11 @@ int
 __wt_evict_threads_create(WT_SESSION_IMPL *session)
 {
     WT_CONNECTION_IMPL *conn;
+    WT_EVICT *evict;
     uint32_t session_flags;
 
     conn = S2C(session);
+    evict = conn->evict;
     __wt_verbose_info(session, WT_VERB_EVICTION, "%s", "starting eviction threads");
 
     /*
@@ -587,9 +696,20 @@ __wt_evict_threads_create(WT_SESSION_IMPL *session)
     F_SET(conn, WT_CONN_EVICTION_RUN);
 
     /*
-     * Create the eviction thread group. Set the group size to the maximum allowed sessions.
+     * Create the eviction walker thread group before the eviction server can run: one walker for
+     * each shard the server doesn't walk itself.
      */
     session_flags = WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL;
+    if (evict->evict_shard_count > 1) {
+        __wt_atomic_storebool(&evict->walk_threads_run, true);
+        WT_RET(__wt_thread_group_create(session, &evict->walk_threads, "eviction-walker",
+          evict->evict_shard_count - 1, evict->evict_shard_count - 1, session_flags,
+          __evict_walker_chk, __evict_walker_run, NULL));
+    }
+
+    /*
+     * Create the eviction thread group. Set the group size to the maximum allowed sessions.
+     */
     WT_RET(__wt_thread_group_create(session, &conn->evict_threads, "eviction-server",
       conn->evict_threads_min, conn->evict_threads_max, session_flags, __evict_thread_chk,
       __evict_thread_run, __evict_thread_stop));
@@ -622,8 +742,10 @@ int
 __wt_evict_threads_destroy(WT_SESSION_IMPL *session)
 {
     WT_CONNECTION_IMPL *conn;
+    WT_EVICT *evict;
 
     conn = S2C(session);
+    evict = conn->evict;
 
     /* We are done if the eviction server didn't start successfully. */
     if (!__wt_atomic_loadbool(&conn->evict_server_running))
@@ -648,6 +770,14 @@ __wt_evict_threads_destroy(WT_SESSION_IMPL *session)
      */
     WT_RET(__wt_thread_group_destroy(session, &conn->evict_threads));
 
+    /* The eviction server is no longer running, stop the walkers. */
+    if (__wt_atomic_loadbool(&evict->walk_threads_run)) {
+        __wt_writelock(session, &evict->walk_threads.lock);
+        __wt_atomic_storebool(&evict->walk_threads_run, false);
+        __wt_cond_signal(session, evict->walk_threads.wait_cond);
+        WT_RET(__wt_thread_group_destroy(session, &evict->walk_threads));
+    }
+
     return (0);
 }
 
@@ -906,6 +1036,7 @@ __evict_clear_walk(WT_SESSION_IMPL *session, bool clear_pos)
     WT_DECL_RET;
     WT_EVICT *evict;
     WT_REF *ref;
+    WT_SESSION_IMPL *walk_session;
 #define PATH_STR_MAX 1024
     char path_str[PATH_STR_MAX];
     const char *where;
@@ -973,8 +1104,9 @@ __evict_clear_walk(WT_SESSION_IMPL *session, bool clear_pos)
         }
     }
 
-    WT_WITH_DHANDLE(evict->walk_session, session->dhandle,
-      (ret = __wt_page_release(evict->walk_session, ref, WT_READ_NO_EVICT)));
+    walk_session = __evict_shard(session, btree)->walk_session;
+    WT_WITH_DHANDLE(walk_session, session->dhandle,
+      (ret = __wt_page_release(walk_session, ref, WT_READ_NO_EVICT)));
     return (ret);
 #undef PATH_STR_MAX
 }
@@ -995,7 +1127,7 @@ __evict_clear_all_walks_and_saved_tree(WT_SESSION_IMPL *session)
     TAILQ_FOREACH (dhandle, &conn->dhqh, q)
         if (WT_DHANDLE_BTREE(dhandle))
             WT_WITH_DHANDLE(session, dhandle, WT_TRET(__evict_clear_walk(session, true)));
-    __evict_set_saved_walk_tree(session, NULL);
+    __evict_clear_saved_walk_trees(session);
     return (ret);
 }
 
@@ -1006,9 +1138,12 @@ __evict_clear_all_walks_and_saved_tree(WT_SESSION_IMPL *session)
 static int
 __evict_clear_walk_and_saved_tree_if_current_locked(WT_SESSION_IMPL *session)
 {
+    WT_EVICT_SHARD *shard;
+
     WT_ASSERT_SPINLOCK_OWNED(session, &S2C(session)->evict->evict_pass_lock);
-    if (session->dhandle == S2C(session)->evict->walk_tree)
-        __evict_set_saved_walk_tree(session, NULL);
+    shard = __evict_shard(session, S2BT(session));
+    if (session->dhandle == shard->walk_tree)
+        __evict_set_saved_walk_tree(session, shard, NULL);
     return (__evict_clear_walk(session, false));
 }
 
@@ -1033,15 +1168,17 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
     WT_DECL_RET;
     WT_EVICT *evict;
     WT_EVICT_ENTRY *evict_entry;
+    WT_EVICT_SHARD *shard;
     u_int elem, i, q;
 
     btree = S2BT(session);
     evict = S2C(session)->evict;
+    shard = __evict_shard(session, btree);
 
-    /* Hold the walk lock to turn off eviction. */
-    __wt_spin_lock(session, &evict->evict_walk_lock);
+    /* Hold the shard's walk lock to turn off eviction. */
+    __wt_spin_lock(session, &shard->evict_walk_lock);
     if (++btree->evict_disabled > 1) {
-        __wt_spin_unlock(session, &evict->evict_walk_lock);
+        __wt_spin_unlock(session, &shard->evict_walk_lock);
         return (0);
     }
 
@@ -1073,7 +1210,7 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
      */
     __wt_spin_lock(session, &evict->evict_queue_lock);
 
-    for (q = 0; q < WT_EVICT_QUEUE_MAX; q++) {
+    for (q = 0; q < evict->evict_queue_count; q++) {
         __wt_spin_lock(session, &evict->evict_queues[q].evict_lock);
         elem = evict->evict_queues[q].evict_max;
         for (i = 0, evict_entry = evict->evict_queues[q].evict_queue; i < elem; i++, evict_entry++)
@@ -1094,7 +1231,7 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
 err:
         --btree->evict_disabled;
     }
-    __wt_spin_unlock(session, &evict->evict_walk_lock);
+    __wt_spin_unlock(session, &shard->evict_walk_lock);
     return (ret);
 }
 
@@ -1342,10 +1479,48 @@ __evict_lru_pages(WT_SESSION_IMPL *session, bool is_server)
 
 /*
  * __evict_lru_walk --
- *     Add pages to the LRU queue to be evicted from cache.
+ *     Add pages to the LRU queues to be evicted from cache. The eviction server walks the first
+ *     shard while the walker threads walk the others, and waits for them to finish.
  */
 static int
 __evict_lru_walk(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    WT_EVICT *evict;
+    uint32_t empty_score, i;
+
+    evict = S2C(session)->evict;
+
+    if (evict->evict_shard_count > 1 && __wt_atomic_loadbool(&evict->walk_threads_run)) {
+        __wt_atomic_store32(&evict->walkers_busy, evict->evict_shard_count - 1);
+        (void)__wt_atomic_add64(&evict->walk_gen, 1);
+        __wt_cond_signal(session, evict->walk_threads.wait_cond);
+
+        ret = __evict_lru_walk_shard(session, &evict->evict_shards[0]);
+
+        /*
+         * Wait for the walkers even if our own walk failed: they hold no locks of their own and
+         * rely on the eviction pass lock we hold.
+         */
+        while (__evict_walkers_busy(session) && !F_ISSET(S2C(session), WT_CONN_PANIC))
+            __wt_cond_wait(session, evict->walk_done_cond, 10 * WT_THOUSAND, __evict_walkers_busy);
+    } else
+        for (i = 0; i < evict->evict_shard_count && ret == 0; ++i)
+            ret = __evict_lru_walk_shard(session, &evict->evict_shards[i]);
+
+    for (empty_score = 0, i = 0; i < evict->evict_shard_count; ++i)
+        empty_score = WT_MAX(empty_score, evict->evict_shards[i].evict_empty_score);
+    evict->evict_empty_score = empty_score;
+
+    return (ret);
+}
+
+/*
+ * __evict_lru_walk_shard --
+ *     Add pages to a shard's LRU queue to be evicted from cache.
+ */
+static int
+__evict_lru_walk_shard(WT_SESSION_IMPL *session, WT_EVICT_SHARD *shard)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
@@ -1360,13 +1535,13 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
     evict = conn->evict;
 
     /* Age out the score of how much the queue has been empty recently. */
-    if (evict->evict_empty_score > 0)
-        --evict->evict_empty_score;
+    if (shard->evict_empty_score > 0)
+        --shard->evict_empty_score;
 
     /* Fill the next queue (that isn't the urgent queue). */
-    queue = evict->evict_fill_queue;
-    other_queue = evict->evict_queues + (1 - (queue - evict->evict_queues));
-    evict->evict_fill_queue = other_queue;
+    queue = shard->evict_fill_queue;
+    other_queue = shard->evict_queues + (1 - (queue - shard->evict_queues));
+    shard->evict_fill_queue = other_queue;
 
     /* If this queue is full, try the other one. */
     if (__evict_queue_full(queue) && !__evict_queue_full(other_queue))
@@ -1375,7 +1550,7 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
     /*
      * If both queues are full and haven't been empty on recent refills, we're done.
      */
-    if (__evict_queue_full(queue) && evict->evict_empty_score < WT_EVICT_SCORE_CUTOFF) {
+    if (__evict_queue_full(queue) && shard->evict_empty_score < WT_EVICT_SCORE_CUTOFF) {
         WT_STAT_CONN_INCR(session, eviction_queue_not_empty);
         goto err;
     }
@@ -1385,8 +1560,8 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
      */
     if (__evict_queue_empty(queue, false)) {
         if (F_ISSET(evict, WT_EVICT_CACHE_HARD))
-            evict->evict_empty_score =
-              WT_MIN(evict->evict_empty_score + WT_EVICT_SCORE_BUMP, WT_EVICT_SCORE_MAX);
+            shard->evict_empty_score =
+              WT_MIN(shard->evict_empty_score + WT_EVICT_SCORE_BUMP, WT_EVICT_SCORE_MAX);
         WT_STAT_CONN_INCR(session, eviction_queue_empty);
     } else
         WT_STAT_CONN_INCR(session, eviction_queue_not_empty);
@@ -1397,7 +1572,7 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
      * If the walk is interrupted, we still need to sort the queue: the next walk assumes there are
      * no entries beyond WT_EVICT_WALK_BASE.
      */
-    if ((ret = __evict_walk(evict->walk_session, queue)) == EBUSY)
+    if ((ret = __evict_walk(shard->walk_session, shard, queue)) == EBUSY)
         ret = 0;
     WT_ERR_NOTFOUND_OK(ret, false);
 
@@ -1408,7 +1583,7 @@ __evict_lru_walk(WT_SESSION_IMPL *session)
      * We have locked the queue: in the (unusual) case where we are filling the current queue, mark
      * it empty so that subsequent requests switch to the other queue.
      */
-    if (queue == evict->evict_current_queue)
+    if (queue == shard->evict_current_queue)
         queue->evict_current = NULL;
 
     entries = queue->evict_entries;
@@ -1604,10 +1779,10 @@ __evict_btree_dominating_cache(WT_SESSION_IMPL *session, WT_BTREE *btree)
 
 /*
  * __evict_walk --
- *     Fill in the array by walking the next set of pages.
+ *     Fill in the array by walking the next set of pages in a shard's trees.
  */
 static int
-__evict_walk(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue)
+__evict_walk(WT_SESSION_IMPL *session, WT_EVICT_SHARD *shard, WT_EVICT_QUEUE *queue)
 {
     WT_BTREE *btree;
     WT_CACHE *cache;
@@ -1674,12 +1849,12 @@ retry:
              * On entry, continue from wherever we got to in the scan last time through. If we don't
              * have a saved handle, pick one randomly from the list.
              */
-            if ((dhandle = evict->walk_tree) != NULL)
-                __evict_set_saved_walk_tree(session, NULL);
+            if ((dhandle = shard->walk_tree) != NULL)
+                __evict_set_saved_walk_tree(session, shard, NULL);
             else
                 __evict_walk_choose_dhandle(session, &dhandle);
         } else {
-            __evict_set_saved_walk_tree(session, NULL);
+            __evict_set_saved_walk_tree(session, shard, NULL);
             __evict_walk_choose_dhandle(session, &dhandle);
         }
 
@@ -1691,8 +1866,12 @@ retry:
         if (!WT_DHANDLE_BTREE(dhandle) || !F_ISSET(dhandle, WT_DHANDLE_OPEN))
             continue;
 
-        /* Skip files that don't allow eviction. */
+        /* Skip trees belonging to other shards. */
         btree = dhandle->handle;
+        if (__evict_shard(session, btree) != shard)
+            continue;
+
+        /* Skip files that don't allow eviction. */
         if (btree->evict_disabled > 0) {
             WT_STAT_CONN_INCR(session, eviction_server_skip_trees_eviction_disabled);
             continue;
@@ -1744,7 +1923,7 @@ retry:
         }
         btree->evict_walk_skips = 0;
 
-        __evict_set_saved_walk_tree(session, dhandle);
+        __evict_set_saved_walk_tree(session, shard, dhandle);
         __wt_readunlock(session, &conn->dhandle_lock);
         dhandle_list_locked = false;
 
@@ -1758,14 +1937,14 @@ retry:
          *
          * If a handle is being discarded, it will still be marked open, but won't have a root page.
          */
-        if (btree->evict_disabled == 0 && !__wt_spin_trylock(session, &evict->evict_walk_lock)) {
+        if (btree->evict_disabled == 0 && !__wt_spin_trylock(session, &shard->evict_walk_lock)) {
             if (btree->evict_disabled == 0 && btree->root.page != NULL) {
                 WT_WITH_DHANDLE(
                   session, dhandle, ret = __evict_walk_tree(session, queue, max_entries, &slot));
 
                 WT_ASSERT(session, __wt_session_gen(session, WT_GEN_SPLIT) == 0);
             }
-            __wt_spin_unlock(session, &evict->evict_walk_lock);
+            __wt_spin_unlock(session, &shard->evict_walk_lock);
             WT_ERR(ret);
             /*
              * If there is a checkpoint thread gathering handles, which means it is holding the
@@ -2391,7 +2570,7 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, u_int max_ent
     give_up = urgent_queued = false;
     txn = session->txn;
 
-    WT_ASSERT_SPINLOCK_OWNED(session, &evict->evict_walk_lock);
+    WT_ASSERT_SPINLOCK_OWNED(session, &__evict_shard(session, btree)->evict_walk_lock);
 
     start = queue->evict_queue + *slotp;
     target_pages = __evict_get_target_pages(session, max_entries, *slotp);
@@ -2533,7 +2712,7 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, u_int max_ent
           __wt_atomic_loadsize(&ref->page->memory_footprint) >= btree->splitmempage) {
             if (restarts == 0)
                 WT_STAT_CONN_INCR(session, eviction_walks_abandoned);
-            WT_RET(__wt_page_release(evict->walk_session, ref, walk_flags));
+            WT_RET(__wt_page_release(session, ref, walk_flags));
             ref = NULL;
         } else {
             while (ref != NULL &&
@@ -2568,9 +2747,10 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
     WT_EVICT *evict;
     WT_EVICT_ENTRY *evict_entry;
     WT_EVICT_QUEUE *queue, *other_queue, *urgent_queue;
+    WT_EVICT_SHARD *shard;
     WT_REF_STATE previous_state;
-    uint32_t candidates;
-    bool is_app, server_only, urgent_ok;
+    uint32_t candidates, home, i;
+    bool empty, is_app, server_only, urgent_ok;
 
     *btreep = NULL;
     /*
@@ -2588,52 +2768,73 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
       (is_app && F_ISSET(evict, WT_EVICT_CACHE_DIRTY_HARD));
     urgent_queue = evict->evict_urgent_queue;
 
-    /* Avoid the LRU lock if no pages are available. */
-    if (__evict_queue_empty(evict->evict_current_queue, is_server) &&
-      __evict_queue_empty(evict->evict_other_queue, is_server) &&
-      (!urgent_ok || __evict_queue_empty(urgent_queue, false))) {
+    /* Avoid the LRU locks if no pages are available. */
+    empty = !urgent_ok || __evict_queue_empty(urgent_queue, false);
+    for (i = 0; empty && i < evict->evict_shard_count; ++i) {
+        shard = &evict->evict_shards[i];
+        empty = __evict_queue_empty(shard->evict_current_queue, is_server) &&
+          __evict_queue_empty(shard->evict_other_queue, is_server);
+    }
+    if (empty) {
         WT_STAT_CONN_INCR(session, eviction_get_ref_empty);
         return (WT_NOTFOUND);
     }
 
     /*
-     * The server repopulates whenever the other queue is not full, as long as at least one page has
-     * been evicted out of the current queue.
+     * The server repopulates whenever the other queue of any shard is not full, as long as at least
+     * one page has been evicted out of the shard's current queue.
      *
      * Note that there are pathological cases where there are only enough eviction candidates in the
      * cache to fill one queue. In that case, we will continually evict one page and attempt to
      * refill the queues. Such cases are extremely rare in real applications.
      */
-    if (is_server && (!urgent_ok || __evict_queue_empty(urgent_queue, false)) &&
-      !__evict_queue_full(evict->evict_current_queue) &&
-      !__evict_queue_full(evict->evict_fill_queue) &&
-      (evict->evict_empty_score > WT_EVICT_SCORE_CUTOFF ||
-        __evict_queue_empty(evict->evict_fill_queue, false)))
-        return (WT_NOTFOUND);
-
-    __wt_spin_lock(session, &evict->evict_queue_lock);
+    if (is_server && (!urgent_ok || __evict_queue_empty(urgent_queue, false)))
+        for (i = 0; i < evict->evict_shard_count; ++i) {
+            shard = &evict->evict_shards[i];
+            if (!__evict_queue_full(shard->evict_current_queue) &&
+              !__evict_queue_full(shard->evict_fill_queue) &&
+              (shard->evict_empty_score > WT_EVICT_SCORE_CUTOFF ||
+                __evict_queue_empty(shard->evict_fill_queue, false)))
+                return (WT_NOTFOUND);
+        }
 
-    /* Check the urgent queue first. */
+    /*
+     * Check the urgent queue first. Otherwise start from the session's home shard, so threads
+     * spread across the shards' locks and queues, and steal from the other shards if its queues are
+     * empty.
+     */
+    queue = NULL;
     if (urgent_ok && !__evict_queue_empty(urgent_queue, false))
         queue = urgent_queue;
     else {
-        /*
-         * Check if the current queue needs to change.
-         *
-         * The server will only evict half of the pages before looking for more, but should only
-         * switch queues if there are no other eviction workers.
-         */
-        queue = evict->evict_current_queue;
-        other_queue = evict->evict_other_queue;
-        if (__evict_queue_empty(queue, server_only) &&
-          !__evict_queue_empty(other_queue, server_only)) {
-            evict->evict_current_queue = other_queue;
-            evict->evict_other_queue = queue;
+        home = is_server ? 0 : session->id % evict->evict_shard_count;
+        for (i = 0; i < evict->evict_shard_count; ++i) {
+            shard = &evict->evict_shards[(home + i) % evict->evict_shard_count];
+
+            /*
+             * Check if the current queue needs to change.
+             *
+             * The server will only evict half of the pages before looking for more, but should only
+             * switch queues if there are no other eviction workers.
+             */
+            __wt_spin_lock(session, &shard->evict_queue_lock);
+            queue = shard->evict_current_queue;
+            other_queue = shard->evict_other_queue;
+            if (__evict_queue_empty(queue, server_only) &&
+              !__evict_queue_empty(other_queue, server_only)) {
+                shard->evict_current_queue = other_queue;
+                shard->evict_other_queue = queue;
+                queue = other_queue;
+            }
+            __wt_spin_unlock(session, &shard->evict_queue_lock);
+
+            if (!__evict_queue_empty(queue, is_server))
+                break;
         }
+        if (i != 0 && i < evict->evict_shard_count)
+            WT_STAT_CONN_INCR(session, eviction_get_ref_steal);
     }
 
-    __wt_spin_unlock(session, &evict->evict_queue_lock);
-
     /*
      * We got the queue lock, which should be fast, and chose a queue. Now we want to get the lock
      * on the individual queue.
@@ -2992,7 +3193,7 @@ __wt_evict_page_urgent(WT_SESSION_IMPL *session, WT_REF *ref)
         return (false);
 
     /* Append to the urgent queue if we can. */
-    urgent_queue = &evict->evict_queues[WT_EVICT_URGENT_QUEUE];
+    urgent_queue = evict->evict_urgent_queue;
     queued = false;
 
     __wt_spin_lock(session, &evict->evict_queue_lock);
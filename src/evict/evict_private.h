@@ -26,9 +26,6 @@ struct __wt_evict_entry {
     uint64_t score;  /* Relative eviction priority */
 };
 
-#define WT_EVICT_QUEUE_MAX 3    /* Two ordinary queues plus urgent */
-#define WT_EVICT_URGENT_QUEUE 2 /* Urgent queue index */
-
 /*
  * WT_EVICT_QUEUE --
  *	Encapsulation of an eviction candidate queue.
@@ -42,6 +39,47 @@ struct __wt_evict_queue {
     wt_shared volatile uint32_t evict_max; /* LRU maximum eviction slot used */
 };
 
+/*
+ * Eviction state is partitioned into shards, one for every WT_EVICT_SHARD_THREADS eviction threads
+ * configured when the connection is opened. Each tree belongs to a single shard, chosen by its file
+ * ID: the shard's walker finds candidates in the shard's trees and queues them on the shard's two
+ * ordinary queues. The eviction server walks the first shard, and a thread in the eviction walker
+ * group walks each of the others while the server walks. There is a single urgent queue.
+ */
+#define WT_EVICT_SHARD_THREADS 4
+#define WT_EVICT_MAX_SHARDS (WT_EVICT_MAX_WORKERS / WT_EVICT_SHARD_THREADS)
+
+/*
+ * WT_EVICT_SHARD --
+ *	A partition of the eviction walk state and queues.
+ */
+struct __wt_evict_shard {
+    uint32_t id; /* Shard index */
+
+    WT_SPINLOCK evict_walk_lock;   /* Eviction walk location */
+    WT_SESSION_IMPL *walk_session; /* Eviction pass session */
+    WT_DATA_HANDLE *walk_tree;     /* LRU walk current tree */
+
+    WT_SPINLOCK evict_queue_lock;        /* Eviction current queue lock */
+    WT_EVICT_QUEUE *evict_queues;        /* The shard's two ordinary queues */
+    WT_EVICT_QUEUE *evict_current_queue; /* LRU current queue in use */
+    WT_EVICT_QUEUE *evict_fill_queue;    /* LRU next queue to fill.
+                                            This is usually the same as the
+                                            "other" queue but under heavy
+                                            load the walk will start filling
+                                            the current queue before it
+                                            switches. */
+    WT_EVICT_QUEUE *evict_other_queue;   /* LRU queue not in use */
+
+    /*
+     * Score of how often the shard's queues are empty on refill, see the connection-wide score.
+     */
+    uint32_t evict_empty_score;
+
+    WT_SESSION_IMPL *walker_session; /* Walker thread's session */
+    uint64_t walk_gen;               /* Last walk generation walked */
+};
+
 #define WT_WITH_PASS_LOCK(session, op)                                                   \
     do {                                                                                 \
         WT_WITH_LOCK_WAIT(session, &evict->evict_pass_lock, WT_SESSION_LOCKED_PASS, op); \
@@ -104,6 +104,28 @@ struct __wt_size {
     WT_SIZE *next[WT_SKIP_MAXDEPTH]; /* Size skiplist */
 };
 
+/*
+ * WT_BLOCK_ARENA --
+ *	A block allocation arena: a range of file space reserved from the live checkpoint's avail
+ * list that threads allocate from, and a batch of freed blocks not yet merged into the live
+ * checkpoint's extent lists, both protected by the arena's lock rather than the live lock.
+ */
+#define WT_BLOCK_ARENA_CHUNK WT_MEGABYTE /* Maximum space reserved by an arena */
+#define WT_BLOCK_ARENA_FREE_MAX 32       /* Freed blocks batched by an arena */
+#define WT_BLOCK_ARENA_RESERVE 16        /* Blocks reserved by an arena */
+struct __wt_block_arena {
+    WT_SPINLOCK lock; /* Arena lock */
+
+    wt_off_t off;  /* Reserved range's file offset */
+    wt_off_t size; /* Reserved range's size */
+
+    struct {
+        wt_off_t off;  /* Freed block's file offset */
+        wt_off_t size; /* Freed block's size */
+    } free[WT_BLOCK_ARENA_FREE_MAX];
+    u_int free_entries; /* Freed blocks */
+};
+
 /*
  * Per session handle cached block manager information.
  */
@@ -303,6 +325,13 @@ struct __wt_block {
 
     WT_CKPT *final_ckpt; /* Final live checkpoint write */
 
+    /*
+     * Allocation arenas, threads allocate and free blocks in their arena instead of contending for
+     * the live lock. Arenas are returned to the live checkpoint before it's written.
+     */
+    WT_BLOCK_ARENA *arenas; /* Allocation arenas */
+    u_int arena_count;      /* Allocation arena count */
+
     /* Compaction support */
     bool compact_estimated;                    /* If compaction work has been estimated */
     int compact_pct_tenths;                    /* Percent to compact */
@@ -34,6 +34,31 @@
 #define WT_BLKCACHE_EVICT_OTHER 0            /* Not evicting for various reasons */
 #define WT_BLKCACHE_NOT_EVICTION_CANDIDATE 1 /* Not evicting because of frequency counter */
 
+/* Block replacement policies. */
+#define WT_BLKCACHE_POLICY_FREQUENCY 0
+#define WT_BLKCACHE_POLICY_TINYLFU 1
+
+/*
+ * The TinyLFU admission sketch. Each block maps to a counter in each row of the sketch, the block's
+ * estimated access frequency is the smallest of its counters. Rows have a counter for each kilobyte
+ * of the cache, several for each block the cache holds, which keeps collisions rare. The sketch is
+ * aged by halving all of the counters after a number of accesses proportional to its width, so
+ * that old accesses are forgotten.
+ */
+#define WT_BLKCACHE_SKETCH_DEPTH 4                             /* Rows */
+#define WT_BLKCACHE_SKETCH_BYTES_PER_COUNTER (1 * WT_KILOBYTE) /* Cache bytes per counter */
+#define WT_BLKCACHE_SKETCH_WIDTH_MIN 1024                      /* Minimum counters per row */
+#define WT_BLKCACHE_SKETCH_WIDTH_MAX (16 * WT_MEGABYTE)        /* Maximum counters per row */
+#define WT_BLKCACHE_SKETCH_COUNTER_MAX 15                      /* Counters saturate */
+#define WT_BLKCACHE_SKETCH_AGE_FACTOR 10                       /* Accesses per counter per aging */
+
+/*
+ * The number of blocks sampled for a block to replace with an admitted block, and the maximum
+ * number of hash buckets searched for them.
+ */
+#define WT_BLKCACHE_ADMISSION_SAMPLE 8
+#define WT_BLKCACHE_ADMISSION_BUCKETS_MAX 1024
+
 /* Block access operations. */
 #define WT_BLKCACHE_RM_EXIT 1
 #define WT_BLKCACHE_RM_FREE 2
@@ -105,6 +130,17 @@ struct __wt_blkcache {
      */
     u_int percent_file_in_os_cache;
 
+    /*
+     * The block replacement policy, and the TinyLFU policy's count-min sketch of block access
+     * frequencies. The counters are updated without synchronization: the sketch is an estimate,
+     * and lost updates don't matter.
+     */
+    u_int policy;                       /* Block replacement policy */
+    uint8_t *sketch;                    /* Sketch counters, WT_BLKCACHE_SKETCH_DEPTH rows */
+    uint64_t sketch_width;              /* Counters per row, a power of two */
+    wt_shared uint64_t sketch_accesses; /* Accesses recorded in the sketch */
+    uint64_t sketch_age_accesses;       /* Accesses between sketch agings */
+
     u_int hash_size;               /* Number of block cache hash buckets */
     u_int type;                    /* Type of block cache (NVRAM or DRAM) */
     wt_shared uint64_t bytes_used; /* Bytes in the block cache */
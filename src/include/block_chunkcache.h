@@ -61,13 +61,21 @@ struct __wt_chunkcache_chunk {
     size_t chunk_size;
     wt_shared volatile bool valid; /* Availability to read data from the chunk marked. */
 
+    TAILQ_ENTRY(__wt_chunkcache_chunk) next_retired;
+    uint64_t retire_gen; /* Generation the chunk was removed from its bucket in */
+
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CHUNK_FROM_METADATA 0x1u
 #define WT_CHUNK_PINNED 0x2u
-    /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
-    uint8_t flags;
+                                    /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
+    wt_shared uint8_t flags_atomic; /* Atomic flags, use F_*_ATOMIC_8 */
 };
 
+/*
+ * Lookups walk a bucket's chain without the bucket lock, only inserting and removing chunks lock
+ * the bucket. Removed chunks are retired and freed once no lookup in the chunk cache generation can
+ * still be reading them.
+ */
 struct __wt_chunkcache_bucket {
     /* This queue contains all chunks that mapped to this bucket. */
     TAILQ_HEAD(__wt_chunkchain_head, __wt_chunkcache_chunk) colliding_chunks;
@@ -85,7 +93,8 @@ struct __wt_chunkcache_pinned_list {
  *     The chunk cache is a hash table of chunks. Each chunk list
  *     is uniquely identified by the file name, object id and offset.
  *     If more than one chunk maps to the same hash bucket, the colliding
- *     chunks are placed into a linked list. There is a per-bucket spinlock.
+ *     chunks are placed into a linked list. There is a per-bucket spinlock,
+ *     taken to insert and remove chunks but not to look them up.
  */
 #define WT_CHUNKCACHE_MAX_RETRIES 32 * 1024
 #define WT_CHUNKCACHE_BITMAP_SIZE(capacity, chunk_size) \
@@ -119,6 +128,16 @@ struct __wt_chunkcache {
     unsigned int evict_trigger; /* When this percent of cache is full, we trigger eviction. */
     WT_CHUNKCACHE_PINNED_LIST pinned_objects;
 
+    /* Chunks removed from the hash table, waiting for lookups to drain. */
+    TAILQ_HEAD(__wt_chunkcache_retired_head, __wt_chunkcache_chunk) retired;
+    WT_SPINLOCK retired_lock;
+
+    /* Startup warm-up of the chunks created from metadata. */
+    WT_SESSION_IMPL **warmup_sessions;
+    wt_thread_t *warmup_tids;
+    u_int warmup_threads;           /* Number of threads, bounds the warm-up's I/O depth */
+    wt_shared uint64_t warmup_next; /* Next bucket to warm up */
+
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CHUNKCACHE_CONFIGURED 0x1u
 #define WT_CHUNK_CACHE_EXITING 0x2u
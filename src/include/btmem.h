@@ -139,12 +139,29 @@ __wt_page_header_byteswap(WT_PAGE_HEADER *dsk)
 #define WT_PAGE_HEADER_BYTE(btree, dsk) \
     ((void *)((uint8_t *)(dsk) + WT_PAGE_HEADER_BYTE_SIZE(btree)))
 
+/*
+ * WT_ADDR_ZONE --
+ *	A row-store leaf block's zone map: the smallest and largest values written to the block,
+ * compared byte-wise. The values are truncated to a fixed length: a truncated minimum is still a
+ * lower bound of the block's values, a truncated maximum only bounds their prefixes.
+ */
+struct __wt_addr_zone {
+#define WT_ADDR_ZONE_MAX 16
+    uint8_t min[WT_ADDR_ZONE_MAX];
+    uint8_t max[WT_ADDR_ZONE_MAX];
+    uint8_t min_size;
+    uint8_t max_size;
+    bool max_truncated; /* The maximum is a prefix */
+    bool set;           /* The zone map is valid */
+};
+
 /*
  * WT_ADDR --
  *	An in-memory structure to hold a block's location.
  */
 struct __wt_addr {
     WT_TIME_AGGREGATE ta;
+    WT_ADDR_ZONE zone; /* Leaf block value zone map */
 
     uint8_t *addr; /* Block-manager's cookie */
     uint8_t size;  /* Block-manager's cookie length */
@@ -309,6 +326,44 @@ struct __wt_ovfl_track {
     size_t discard_allocated;
 };
 
+/*
+ * WT_PAGE_ARENA_CHUNK --
+ *	A block of memory allocations are carved out of.
+ */
+struct __wt_page_arena_chunk {
+    WT_PAGE_ARENA_CHUNK *next; /* Older chunks */
+    size_t size;               /* Chunk size, excluding this structure */
+    wt_shared size_t used;     /* Bytes allocated, can overshoot the size */
+
+/* The chunk's memory immediately follows the WT_PAGE_ARENA_CHUNK structure. */
+#define WT_PAGE_ARENA_CHUNK_DATA(chunk) ((uint8_t *)(chunk) + sizeof(WT_PAGE_ARENA_CHUNK))
+};
+
+/*
+ * WT_PAGE_ARENA --
+ *	The WT_INSERT structures of keys inserted into a page, and the first WT_UPDATE of each, are
+ * allocated from the page's arena rather than individually, and freed in bulk with the arena.
+ * Insert lists and update chains can move to other pages when a page splits: the new pages
+ * reference the arenas of the page they split from, and an arena is freed when the last page
+ * referencing it is discarded.
+ *
+ * The arena's memory is charged to the page that owns it; if the page is discarded while other
+ * pages still reference the arena, the memory is charged to the tree until the arena is freed.
+ */
+struct __wt_page_arena {
+    wt_shared WT_PAGE_ARENA_CHUNK *chunk; /* Current chunk, linked to older chunks */
+    wt_shared WT_PAGE_ARENA_CHUNK *large; /* Chunks holding a single large allocation */
+
+    wt_shared size_t bytes; /* Memory allocated, including this structure */
+    wt_shared uint32_t ref; /* Pages referencing the arena */
+    wt_shared bool orphan;  /* The owning page is gone, charged to the tree */
+};
+
+#define WT_PAGE_ARENA_CHUNK_MIN 512               /* First chunk size */
+#define WT_PAGE_ARENA_CHUNK_MAX (64 * WT_KILOBYTE) /* Largest shared chunk size */
+#define WT_PAGE_ARENA_LARGE (WT_PAGE_ARENA_CHUNK_MAX / 4)
+#define WT_PAGE_ARENA_UPDATE_MAX 256 /* Largest update allocated from an arena */
+
 /*
  * WT_PAGE_MODIFY --
  *	When a page is modified, there's additional information to maintain.
@@ -446,6 +501,15 @@ struct __wt_page_modify {
     /* Overflow record tracking for reconciliation. */
     WT_OVFL_TRACK *ovfl_track;
 
+    /*
+     * The page's arena, and the arenas of the pages it split from, whose memory the page's insert
+     * lists and update chains can reference.
+     */
+    wt_shared WT_PAGE_ARENA *arena;
+    WT_PAGE_ARENA **arena_inherit;
+    uint32_t arena_inherit_entries;
+    size_t arena_inherit_allocated;
+
     /*
      * Stop aggregated timestamp information when all the keys on the page are removed. This time
      * aggregate information is used to skip these deleted pages as part of the tree walk if the
@@ -525,8 +589,22 @@ struct __wt_page_index {
     uint32_t entries;
     wt_shared uint32_t deleted_entries;
     WT_REF **index;
+
+    /*
+     * Row-store internal pages in trees configured for prefix search have an array of key prefixes
+     * following the array of references: for each key, the 8 bytes after the bytes every key on the
+     * page shares, as an integer sorting in the same order as the keys. Set once it's filled in.
+     */
+    uint64_t *prefix;
+    uint32_t prefix_skip; /* Bytes shared by every key */
 };
 
+#define WT_PAGE_INDEX_PREFIX(btree, type) ((type) == WT_PAGE_ROW_INT && (btree)->intl_prefix_search)
+#define WT_PAGE_INDEX_SIZE(btree, type, entries)                 \
+    (sizeof(WT_PAGE_INDEX) +                                     \
+      (size_t)(entries) *                                        \
+        (sizeof(WT_REF *) + (WT_PAGE_INDEX_PREFIX(btree, type) ? sizeof(uint64_t) : 0)))
+
 /*
  * WT_COL_VAR_REPEAT --
  *  Variable-length column-store pages have an array of page entries with RLE counts
@@ -611,8 +689,9 @@ struct __wt_page {
          * doesn't read it multiple times).
          */
         struct {
-            WT_REF *parent_ref; /* Parent reference */
-            uint64_t split_gen; /* Generation of last split */
+            WT_REF *parent_ref;               /* Parent reference */
+            uint64_t split_gen;               /* Generation of last split */
+            wt_shared uint64_t split_version; /* Changes around index replacement */
 
             wt_shared WT_PAGE_INDEX *volatile __index; /* Collated children */
         } intl;
@@ -620,6 +699,8 @@ struct __wt_page {
 #define pg_intl_parent_ref u.intl.parent_ref
 #undef pg_intl_split_gen
 #define pg_intl_split_gen u.intl.split_gen
+#undef pg_intl_split_version
+#define pg_intl_split_version u.intl.split_version
 
 /*
  * Macros to copy/set the index because the name is obscured to ensure the field isn't read multiple
@@ -689,9 +770,15 @@ struct __wt_page {
     while (0)
 
         /* Row-store leaf page. */
-        WT_ROW *row; /* Key/value pairs */
+        struct {
+            WT_ROW *row;                        /* Key/value pairs */
+            wt_shared WT_ROW_KEYDIR *keydir;    /* Key prefix directory */
+            wt_shared uint32_t keydir_searches; /* Searches of the page without a directory */
+        } row;
 #undef pg_row
-#define pg_row u.row
+#define pg_row u.row.row
+#undef pg_row_keydir
+#define pg_row_keydir u.row.keydir
 
         /* Fixed-length column-store leaf page. */
         struct {
@@ -736,14 +823,15 @@ struct __wt_page {
 #define WT_PAGE_BUILD_KEYS 0x001u         /* Keys have been built in memory */
 #define WT_PAGE_COMPACTION_WRITE 0x002u   /* Writing the page for compaction */
 #define WT_PAGE_DISK_ALLOC 0x004u         /* Disk image in allocated memory */
-#define WT_PAGE_DISK_MAPPED 0x008u        /* Disk image in mapped memory */
-#define WT_PAGE_EVICT_LRU 0x010u          /* Page is on the LRU queue */
-#define WT_PAGE_EVICT_LRU_URGENT 0x020u   /* Page is in the urgent queue */
-#define WT_PAGE_EVICT_NO_PROGRESS 0x040u  /* Eviction doesn't count as progress */
-#define WT_PAGE_INTL_OVERFLOW_KEYS 0x080u /* Internal page has overflow keys (historic only) */
-#define WT_PAGE_PREFETCH 0x100u           /* The page is being pre-fetched */
-#define WT_PAGE_SPLIT_INSERT 0x200u       /* A leaf page was split for append */
-#define WT_PAGE_UPDATE_IGNORE 0x400u      /* Ignore updates on page discard */
+#define WT_PAGE_DISK_ARENA 0x008u         /* Allocated disk image is in the cache arena */
+#define WT_PAGE_DISK_MAPPED 0x010u        /* Disk image in mapped memory */
+#define WT_PAGE_EVICT_LRU 0x020u          /* Page is on the LRU queue */
+#define WT_PAGE_EVICT_LRU_URGENT 0x040u   /* Page is in the urgent queue */
+#define WT_PAGE_EVICT_NO_PROGRESS 0x080u  /* Eviction doesn't count as progress */
+#define WT_PAGE_INTL_OVERFLOW_KEYS 0x100u /* Internal page has overflow keys (historic only) */
+#define WT_PAGE_PREFETCH 0x200u           /* The page is being pre-fetched */
+#define WT_PAGE_SPLIT_INSERT 0x400u       /* A leaf page was split for append */
+#define WT_PAGE_UPDATE_IGNORE 0x800u      /* Ignore updates on page discard */
                                           /* AUTOMATIC FLAG VALUE GENERATION STOP 16 */
     wt_shared uint16_t flags_atomic;      /* Atomic flags, use F_*_ATOMIC_16 */
 
@@ -833,11 +921,15 @@ struct __wt_page {
 
 /*
  * WT_PAGE_WALK_SKIP_STATS --
- *	Statistics to track how many deleted pages are skipped as part of the tree walk.
+ *	Statistics to track how many pages are skipped as part of the tree walk, and the cursor walking
+ * the tree, whose value bounds can also skip pages.
  */
 struct __wt_page_walk_skip_stats {
+    WT_CURSOR_BTREE *cbt;
+
     size_t total_del_pages_skipped;
     size_t total_inmem_del_pages_skipped;
+    size_t total_zone_pages_skipped;
 };
 
 /*
@@ -1089,6 +1181,7 @@ struct __wt_addr_copy {
     uint8_t size;
 
     WT_TIME_AGGREGATE ta;
+    WT_ADDR_ZONE zone; /* Leaf block value zone map */
 
     WT_PAGE_DELETED del; /* Fast-truncate page information */
     bool del_set;
@@ -1118,6 +1211,23 @@ struct __wt_prefetch_queue_entry {
     TAILQ_ENTRY(__wt_prefetch_queue_entry) q; /* List of pages queued for pre-fetch. */
 };
 
+/*
+ * WT_PREFETCH_READ --
+ *	A pre-fetch batch slot: the queued page and, if its block was read asynchronously, the block
+ * image waiting to be consumed when the page is brought into the cache.
+ */
+struct __wt_prefetch_read {
+    WT_PREFETCH_QUEUE_ENTRY *pe;
+
+    WT_BLOCK *block; /* Block handle, offset and size of the read */
+    wt_off_t offset;
+    uint32_t size;
+    WT_ITEM buf; /* Block image, reused across batches */
+
+    bool inflight; /* Read submitted, not yet completed */
+    bool ready;    /* Read completed, image not yet consumed */
+};
+
 /*
  * WT_REF --
  *	A single in-memory page and state information.
@@ -1369,6 +1479,21 @@ struct __wt_row { /* On-page key, on-page cell, or off-page WT_IKEY */
  */
 #define WT_ROW_SLOT(page, rip) ((uint32_t)((rip) - (page)->pg_row))
 
+/*
+ * WT_ROW_KEYDIR --
+ *	Row-store leaf pages searched often enough get a directory of key prefixes, built from the
+ * page's WT_ROW array: for each slot, the 8 bytes after the bytes every key on the page shares, as
+ * an integer sorting in the same order as the keys. The WT_ROW array doesn't change while the page
+ * is in memory (reconciliation replaces the page, it doesn't rewrite it), so the directory is
+ * built once and discarded with the page.
+ */
+struct __wt_row_keydir {
+    uint64_t *prefix;   /* Key prefixes, one per slot */
+    uint8_t *skip_data; /* Bytes shared by every key */
+    uint32_t skip;      /* Length of the shared bytes */
+    uint32_t entries;   /* Slots */
+};
+
 /*
  * WT_COL -- Each in-memory variable-length column-store leaf page has an array of WT_COL
  * structures: this is created from on-page data when a page is read from the file. It's fixed in
@@ -1495,6 +1620,14 @@ struct __wt_update {
                                                  /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
     uint8_t flags;
 
+    /*
+     * How the update was allocated: on its own, from a page arena (it's freed with the arena), or
+     * from a session's update pool (it's returned to a pool, and the pool's size class is added).
+     */
+#define WT_UPDATE_ALLOC_ARENA 1
+#define WT_UPDATE_ALLOC_POOL 2
+    uint8_t alloc;
+
 /* There are several cases we should select the update irrespective of visibility to write to the
  * disk image:
  *
@@ -1530,7 +1663,7 @@ struct __wt_update {
  * WT_UPDATE_SIZE is the expected structure size excluding the payload data -- we verify the build
  * to ensure the compiler hasn't inserted padding.
  */
-#define WT_UPDATE_SIZE 47
+#define WT_UPDATE_SIZE 48
 
 /*
  * If there is no value, ensure that the memory allocation size matches that returned by sizeof().
@@ -1544,6 +1677,21 @@ struct __wt_update {
  */
 #define WT_UPDATE_MEMSIZE(upd) WT_ALIGN(WT_UPDATE_SIZE + (upd)->size, 32)
 
+/*
+ * WT_UPDATE_POOL --
+ *	Discarded updates kept for reuse, in lists by size class. Each session allocates updates from
+ * and frees them into its own pool without locking. Sessions move updates to the connection's pool
+ * when their pools grow past their maximum, and refill their pools from the connection's pool when
+ * they run dry, so memory freed by eviction threads is reused by application threads.
+ */
+#define WT_UPDATE_POOL_CLASSES 4
+#define WT_UPDATE_POOL_CLASS_SIZE(class) ((size_t)64 << (class))
+#define WT_UPDATE_POOL_MAX WT_UPDATE_POOL_CLASS_SIZE(WT_UPDATE_POOL_CLASSES - 1)
+struct __wt_update_pool {
+    wt_shared WT_UPDATE *free[WT_UPDATE_POOL_CLASSES]; /* Discarded updates, linked through next */
+    size_t bytes;                                      /* Bytes held */
+};
+
 /*
  * WT_UPDATE_VALUE --
  *
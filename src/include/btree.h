@@ -99,6 +99,25 @@ typedef enum { /* Start position for eviction walk */
 /* An invalid btree file ID value. ID 0 is reserved for the metadata file. */
 #define WT_BTREE_ID_INVALID UINT32_MAX
 
+/*
+ * WT_AHI_ENTRY --
+ *	An adaptive hash index entry: the leaf page WT_REF and slot where a key with the entry's hash
+ * was last found. Entries are written under a sequence lock, odd while an entry is being written,
+ * and are only trusted while the tree's adaptive hash index epoch matches the entry's: the epoch
+ * is incremented before any of the tree's WT_REFs is freed.
+ */
+struct __wt_ahi_entry {
+    wt_shared uint64_t version; /* Sequence lock */
+    wt_shared uint64_t hash;    /* Key hash */
+    wt_shared uint64_t epoch;   /* Tree epoch when the entry was installed */
+    wt_shared WT_REF *ref;      /* Leaf page, NULL if not installed */
+    wt_shared uint32_t slot;    /* Leaf page slot */
+    wt_shared uint32_t hits;    /* Searches finding the key */
+};
+
+/* Searches finding a key on its leaf page before the key's entry is installed. */
+#define WT_AHI_INSTALL_HITS 4
+
 /*
  * WT_BTREE --
  *	A btree handle.
@@ -115,8 +134,16 @@ struct __wt_btree {
     const char *value_format; /* Value format */
     uint8_t bitcnt;           /* Fixed-length field size in bits */
 
-    WT_COLLATOR *collator; /* Row-store comparator */
-    int collator_owned;    /* The collator needs to be freed */
+    WT_COLLATOR *collator;         /* Row-store comparator */
+    int collator_owned;            /* The collator needs to be freed */
+    bool intl_prefix_search;       /* Search internal pages using key prefixes */
+    uint32_t leaf_prefix_searches; /* Leaf searches before building a key directory */
+
+    WT_AHI_ENTRY *ahi;            /* Adaptive hash index */
+    uint32_t ahi_entries;         /* Adaptive hash index entries */
+    wt_shared uint64_t ahi_epoch; /* Adaptive hash index invalidations */
+
+    bool page_arena; /* Allocate inserts from page arenas */
 
     uint32_t id; /* File ID, for logging */
 
@@ -144,8 +171,10 @@ struct __wt_btree {
 #define WT_SPLIT_DEEPEN_PER_CHILD_DEF 100
     u_int split_deepen_per_child; /* Entries per child when deepened */
     int split_pct;                /* Split page percent */
+    bool value_zone_maps;         /* Record leaf page value zone maps */
 
     WT_COMPRESSOR *compressor;    /* Page compressor */
+    int compressor_owned;         /* The compressor needs to be freed */
                                   /*
                                    * When doing compression, the pre-compression in-memory byte size
                                    * is optionally adjusted based on previous compression results.
@@ -189,16 +218,19 @@ struct __wt_btree {
 /*
  * Helper macros: WT_BTREE_SYNCING indicates if a sync is active (either waiting to start or already
  * running), so no new operations should start that would conflict with the sync.
- * WT_SESSION_BTREE_SYNC indicates if the session is performing a sync on its current tree.
+ * WT_SESSION_BTREE_SYNC indicates if the session is performing a sync on its current tree, either
+ * itself or as a checkpoint helper thread writing pages on behalf of the syncing session.
  * WT_SESSION_BTREE_SYNC_SAFE checks whether it is safe to perform an operation that would conflict
  * with a sync.
  */
 #define WT_BTREE_SYNCING(btree) (__wt_atomic_load_enum(&(btree)->syncing) != WT_BTREE_SYNC_OFF)
+#define WT_SESSION_SYNC_OWNER(session) \
+    ((session)->ckpt.sync_owner != NULL ? (session)->ckpt.sync_owner : (session))
 #define WT_SESSION_BTREE_SYNC(session) \
-    (__wt_atomic_load_pointer(&S2BT(session)->sync_session) == (session))
+    (__wt_atomic_load_pointer(&S2BT(session)->sync_session) == WT_SESSION_SYNC_OWNER(session))
 #define WT_SESSION_BTREE_SYNC_SAFE(session, btree)                        \
     (__wt_atomic_load_enum(&(btree)->syncing) != WT_BTREE_SYNC_RUNNING || \
-      __wt_atomic_load_pointer(&(btree)->sync_session) == (session))
+      __wt_atomic_load_pointer(&(btree)->sync_session) == WT_SESSION_SYNC_OWNER(session))
 
     wt_shared uint64_t bytes_dirty_intl;  /* Bytes in dirty internal pages. */
     wt_shared uint64_t bytes_dirty_leaf;  /* Bytes in dirty leaf pages. */
@@ -265,6 +265,18 @@ __wt_btree_bytes_updates(WT_SESSION_IMPL *session)
     return (__wt_cache_bytes_plus_overhead(cache, __wt_atomic_load64(&btree->bytes_updates)));
 }
 
+/*
+ * __wt_btree_ahi_invalidate --
+ *     Invalidate a tree's adaptive hash index before freeing any of the tree's WT_REFs, searches
+ *     don't trust entries installed before the invalidation.
+ */
+static WT_INLINE void
+__wt_btree_ahi_invalidate(WT_BTREE *btree)
+{
+    if (btree->ahi != NULL)
+        (void)__wt_atomic_add64(&btree->ahi_epoch, 1);
+}
+
 /*
  * __wt_cache_page_inmem_incr --
  *     Increment a page's memory footprint in the cache.
@@ -609,6 +621,36 @@ __wt_update_list_memsize(WT_UPDATE *upd)
     return (upd_size);
 }
 
+/*
+ * __wt_update_list_page_memsize --
+ *     The size in memory of a list of updates charged to the page holding them: updates allocated
+ *     from a page arena are charged with the arena.
+ */
+static WT_INLINE size_t
+__wt_update_list_page_memsize(WT_UPDATE *upd)
+{
+    size_t upd_size;
+
+    for (upd_size = 0; upd != NULL; upd = upd->next)
+        if (upd->alloc != WT_UPDATE_ALLOC_ARENA)
+            upd_size += WT_UPDATE_MEMSIZE(upd);
+
+    return (upd_size);
+}
+
+/*
+ * __wt_insert_free --
+ *     Free a WT_INSERT structure, unless the tree allocates inserts from page arenas.
+ */
+static WT_INLINE void
+__wt_insert_free(WT_SESSION_IMPL *session, WT_INSERT **insp)
+{
+    if (S2BT(session)->page_arena)
+        *insp = NULL;
+    else
+        __wt_free(session, *insp);
+}
+
 /*
  * __wt_page_modify_init --
  *     A page is about to be modified, allocate the modification structure.
@@ -835,6 +877,25 @@ __wt_off_page(WT_PAGE *page, const void *p)
       p >= (void *)((uint8_t *)page->dsk + page->dsk->mem_size));
 }
 
+/*
+ * __wt_key_prefix --
+ *     Return the first 8 bytes of a key, padded with zeroes, as an integer sorting in the same order
+ *     as the key bytes.
+ */
+static WT_INLINE uint64_t
+__wt_key_prefix(const void *data, size_t size)
+{
+    uint64_t v;
+
+    v = 0;
+    if (size != 0)
+        memcpy(&v, data, WT_MIN(size, sizeof(v)));
+#ifndef WORDS_BIGENDIAN
+    v = __wt_bswap64(v);
+#endif
+    return (v);
+}
+
 /*
  * __wt_ref_key --
  *     Return a reference to a row-store internal page key as cheaply as possible.
@@ -1456,6 +1517,7 @@ __wt_ref_addr_copy(WT_SESSION_IMPL *session, WT_REF *ref, WT_ADDR_COPY *copy)
     unpack = &_unpack;
     page = ref->home;
     copy->del_set = false;
+    copy->zone.set = false;
 
     WT_ASSERT_ALWAYS(session, __wt_session_gen(session, WT_GEN_SPLIT) != 0,
       "Any thread accessing ref address must hold a valid split generation");
@@ -1477,6 +1539,8 @@ __wt_ref_addr_copy(WT_SESSION_IMPL *session, WT_REF *ref, WT_ADDR_COPY *copy)
     /* If off-page, the pointer references a WT_ADDR structure. */
     if (__wt_off_page(page, addr)) {
         WT_TIME_AGGREGATE_COPY(&copy->ta, &addr->ta);
+        if (addr->zone.set)
+            copy->zone = addr->zone;
         copy->type = addr->type;
         memcpy(copy->addr, addr->addr, copy->size = addr->size);
         return (true);
@@ -2002,6 +2066,16 @@ __wt_skip_choose_depth(WT_SESSION_IMPL *session)
     return (depth);
 }
 
+/*
+ * __wt_page_split_version_bump --
+ *     Change an internal page's split version, on either side of replacing the page's index.
+ */
+static WT_INLINE void
+__wt_page_split_version_bump(WT_PAGE *page)
+{
+    (void)__wt_atomic_add64(&page->pg_intl_split_version, 1);
+}
+
 /*
  * __wt_split_descent_race --
  *     Return if we raced with an internal page split when descending the tree.
@@ -2182,6 +2256,74 @@ __wt_btcur_bounds_early_exit(
     return (0);
 }
 
+/*
+ * __wt_btcur_value_out_of_bounds --
+ *     Return if the cursor's value falls outside the cursor's value bounds.
+ */
+static WT_INLINE bool
+__wt_btcur_value_out_of_bounds(WT_CURSOR_BTREE *cbt)
+{
+    int cmp;
+
+    if (!F_ISSET(cbt, WT_CBT_VALUE_LOWER | WT_CBT_VALUE_UPPER))
+        return (false);
+
+    if (F_ISSET(cbt, WT_CBT_VALUE_LOWER)) {
+        cmp = __wt_lex_compare(&cbt->iface.value, &cbt->value_lower);
+        if (cmp < 0 || (cmp == 0 && !F_ISSET(cbt, WT_CBT_VALUE_LOWER_INCLUSIVE)))
+            return (true);
+    }
+    if (F_ISSET(cbt, WT_CBT_VALUE_UPPER)) {
+        cmp = __wt_lex_compare(&cbt->iface.value, &cbt->value_upper);
+        if (cmp > 0 || (cmp == 0 && !F_ISSET(cbt, WT_CBT_VALUE_UPPER_INCLUSIVE)))
+            return (true);
+    }
+    return (false);
+}
+
+/*
+ * __wt_btcur_zone_out_of_bounds --
+ *     Return if no value in a page's zone map falls within the cursor's value bounds.
+ */
+static WT_INLINE bool
+__wt_btcur_zone_out_of_bounds(WT_CURSOR_BTREE *cbt, WT_ADDR_ZONE *zone)
+{
+    WT_ITEM bound, max, min;
+    int cmp;
+
+    min.data = zone->min;
+    min.size = zone->min_size;
+    max.data = zone->max;
+    max.size = zone->max_size;
+
+    /*
+     * The minimum is a prefix of the page's smallest value, so it sorts at or before every value on
+     * the page, and can be compared with the upper bound as is.
+     */
+    if (F_ISSET(cbt, WT_CBT_VALUE_UPPER)) {
+        cmp = __wt_lex_compare(&min, &cbt->value_upper);
+        if (cmp > 0 || (cmp == 0 && !F_ISSET(cbt, WT_CBT_VALUE_UPPER_INCLUSIVE)))
+            return (true);
+    }
+
+    /*
+     * A truncated maximum is a prefix of the page's largest value: values on the page may sort
+     * after it, but not after the bound unless the bound's prefix of the same length sorts after
+     * it.
+     */
+    if (F_ISSET(cbt, WT_CBT_VALUE_LOWER)) {
+        if (zone->max_truncated) {
+            bound.data = cbt->value_lower.data;
+            bound.size = WT_MIN(cbt->value_lower.size, max.size);
+            return (__wt_lex_compare(&max, &bound) < 0);
+        }
+        cmp = __wt_lex_compare(&max, &cbt->value_lower);
+        if (cmp < 0 || (cmp == 0 && !F_ISSET(cbt, WT_CBT_VALUE_LOWER_INCLUSIVE)))
+            return (true);
+    }
+    return (false);
+}
+
 /*
  * __wt_btcur_skip_page --
  *     Return if the cursor is pointing to a page with deleted records and can be skipped for cursor
@@ -2272,6 +2414,22 @@ __wt_btcur_skip_page(
             addr.ta.newest_stop_durable_ts)) {
             *skipp = true;
             walk_skip_stats->total_del_pages_skipped++;
+            goto unlock;
+        }
+
+        /*
+         * If the cursor has value bounds, check the page's zone map. The zone map only describes
+         * the values written to the page, older values are in the history store: the page can only
+         * be skipped if the reader sees everything written to it.
+         */
+        if (walk_skip_stats->cbt != NULL &&
+          F_ISSET(walk_skip_stats->cbt, WT_CBT_VALUE_LOWER | WT_CBT_VALUE_UPPER) && addr.zone.set &&
+          !addr.ta.prepare &&
+          __wt_txn_snap_min_visible(session, addr.ta.newest_txn,
+            addr.ta.newest_start_durable_ts, addr.ta.newest_start_durable_ts) &&
+          __wt_btcur_zone_out_of_bounds(walk_skip_stats->cbt, &addr.zone)) {
+            *skipp = true;
+            walk_skip_stats->total_zone_pages_skipped++;
         }
     } else if (clean_page && __wt_get_page_modify_ta(session, ref->page, &ta) &&
       __wt_txn_snap_min_visible(
@@ -71,6 +71,25 @@ __wt_buf_initsize(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t size)
     return (0);
 }
 
+/*
+ * __wt_buf_init_aligned --
+ *     Create an empty buffer at a specific size, in memory aligned for direct I/O.
+ */
+static WT_INLINE int
+__wt_buf_init_aligned(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t size)
+{
+    /*
+     * Flag the buffer so it's always allocated aligned. Existing memory that isn't aligned is
+     * discarded rather than reallocated, there's no data to copy.
+     */
+    if (!WT_PTR_ALIGNED(buf->mem, S2C(session)->buffer_alignment)) {
+        __wt_free(session, buf->mem);
+        buf->memsize = 0;
+    }
+    F_SET(buf, WT_ITEM_ALIGNED);
+    return (__wt_buf_init(session, buf, size));
+}
+
 /*
  * __wt_buf_set --
  *     Set the contents of the buffer.
@@ -18,6 +18,68 @@ typedef enum __wt_cache_op {
 
 #define WT_HS_FILE_MIN (100 * WT_MEGABYTE)
 
+/*
+ * Arena slabs are the size of a huge page. Size classes are the powers of two from 512B to 1MB and
+ * the midpoints between them, larger page images are allocated from the system allocator.
+ */
+#define WT_CACHE_ARENA_SLAB_SIZE (2 * WT_MEGABYTE)
+#define WT_CACHE_ARENA_CLASS_MIN 512
+#define WT_CACHE_ARENA_CLASS_MAX WT_MEGABYTE
+#define WT_CACHE_ARENA_CLASSES 23
+
+/*
+ * WT_CACHE_ARENA_SLAB --
+ *	A slab of the cache arena, carved into objects of a single size class. The slab's description
+ * is kept apart from its memory so the memory is entirely available to objects.
+ */
+struct __wt_cache_arena_slab {
+    TAILQ_ENTRY(__wt_cache_arena_slab) q; /* Partial or empty slab list */
+
+    void *freelist;      /* Freed objects */
+    uint32_t next;       /* Next object never allocated */
+    uint32_t nobjs;      /* Objects in the slab */
+    uint32_t inuse;      /* Objects allocated */
+    uint32_t size_class; /* Size class */
+};
+
+/*
+ * WT_CACHE_ARENA_NODE --
+ *	The part of the cache arena placed on a single NUMA node.
+ */
+struct __wt_cache_arena_node {
+    WT_SPINLOCK lock;
+
+    uint8_t *mem;               /* Node's memory */
+    WT_CACHE_ARENA_SLAB *slabs; /* Slab descriptions */
+    uint32_t slab_count;        /* Slabs in the node */
+    uint32_t slab_next;         /* Next slab never used */
+
+    /* Locked: slabs with free objects, by size class, and slabs with no objects allocated. */
+    TAILQ_HEAD(__wt_cache_arena_partial_qh, __wt_cache_arena_slab) partial[WT_CACHE_ARENA_CLASSES];
+    TAILQ_HEAD(__wt_cache_arena_empty_qh, __wt_cache_arena_slab) empty;
+
+    wt_shared uint64_t bytes_slab;  /* Bytes of slabs assigned to a size class */
+    wt_shared uint64_t bytes_inuse; /* Bytes requested by allocations */
+};
+
+/*
+ * WT_CACHE_ARENA --
+ *	A memory arena for the images of pages read into the cache. The arena is a single anonymous
+ * mapping divided between the system's NUMA nodes; each node's part is divided into huge-page sized
+ * slabs, and each slab is carved into objects of one of a set of size classes.
+ */
+struct __wt_cache_arena {
+    void *map;     /* Mapping */
+    size_t maplen; /* Mapping length */
+
+    uint8_t *mem;     /* Slab-aligned start of the arena */
+    size_t node_size; /* Bytes in each node */
+    bool hugepages;   /* Backed by explicitly reserved huge pages */
+
+    WT_CACHE_ARENA_NODE *nodes;
+    u_int node_count;
+};
+
 /*
  * WiredTiger cache structure.
  */
@@ -55,6 +117,8 @@ struct __wt_cache {
 
     u_int overhead_pct; /* Cache percent adjustment */
 
+    WT_CACHE_ARENA *arena; /* Page image arena */
+
     uint32_t hs_fileid; /* History store table file ID */
 
     /*
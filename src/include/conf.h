@@ -142,17 +142,17 @@ WT_CONF_API_DECLARE(WT_CONNECTION, debug_info, 1, 7);
 WT_CONF_API_DECLARE(WT_CONNECTION, load_extension, 1, 4);
 WT_CONF_API_DECLARE(WT_CONNECTION, open_session, 3, 9);
 WT_CONF_API_DECLARE(WT_CONNECTION, query_timestamp, 1, 1);
-WT_CONF_API_DECLARE(WT_CONNECTION, reconfigure, 18, 104);
+WT_CONF_API_DECLARE(WT_CONNECTION, reconfigure, 19, 112);
 WT_CONF_API_DECLARE(WT_CONNECTION, rollback_to_stable, 1, 2);
 WT_CONF_API_DECLARE(WT_CONNECTION, set_timestamp, 1, 4);
-WT_CONF_API_DECLARE(WT_CURSOR, bound, 1, 3);
+WT_CONF_API_DECLARE(WT_CURSOR, bound, 1, 4);
 WT_CONF_API_DECLARE(WT_CURSOR, reconfigure, 1, 3);
 WT_CONF_API_DECLARE(WT_SESSION, alter, 3, 16);
 WT_CONF_API_DECLARE(WT_SESSION, begin_transaction, 2, 11);
 WT_CONF_API_DECLARE(WT_SESSION, checkpoint, 3, 12);
 WT_CONF_API_DECLARE(WT_SESSION, commit_transaction, 1, 4);
 WT_CONF_API_DECLARE(WT_SESSION, compact, 1, 6);
-WT_CONF_API_DECLARE(WT_SESSION, create, 6, 67);
+WT_CONF_API_DECLARE(WT_SESSION, create, 6, 73);
 WT_CONF_API_DECLARE(WT_SESSION, drop, 1, 5);
 WT_CONF_API_DECLARE(WT_SESSION, log_flush, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, open_cursor, 3, 29);
@@ -164,17 +164,17 @@ WT_CONF_API_DECLARE(WT_SESSION, salvage, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, timestamp_transaction, 1, 4);
 WT_CONF_API_DECLARE(WT_SESSION, verify, 1, 12);
 WT_CONF_API_DECLARE(colgroup, meta, 2, 12);
-WT_CONF_API_DECLARE(file, config, 5, 55);
-WT_CONF_API_DECLARE(file, meta, 5, 62);
+WT_CONF_API_DECLARE(file, config, 5, 61);
+WT_CONF_API_DECLARE(file, meta, 5, 68);
 WT_CONF_API_DECLARE(index, meta, 2, 15);
-WT_CONF_API_DECLARE(object, meta, 5, 64);
+WT_CONF_API_DECLARE(object, meta, 5, 70);
 WT_CONF_API_DECLARE(table, meta, 2, 13);
-WT_CONF_API_DECLARE(tier, meta, 5, 65);
-WT_CONF_API_DECLARE(tiered, meta, 5, 67);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 24, 173);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 24, 174);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 24, 168);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 24, 167);
+WT_CONF_API_DECLARE(tier, meta, 5, 71);
+WT_CONF_API_DECLARE(tiered, meta, 5, 73);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 28, 194);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 28, 195);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 28, 189);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 28, 188);
 
 #define WT_CONF_API_ELEMENTS 52
 
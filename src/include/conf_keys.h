@@ -16,305 +16,328 @@
  * API configuration keys: BEGIN
  */
 #define WT_CONF_ID_Assert 1ULL
-#define WT_CONF_ID_Block_cache 154ULL
-#define WT_CONF_ID_Checkpoint 169ULL
-#define WT_CONF_ID_Checkpoint_cleanup 172ULL
-#define WT_CONF_ID_Chunk_cache 174ULL
-#define WT_CONF_ID_Compatibility 176ULL
-#define WT_CONF_ID_Debug 98ULL
-#define WT_CONF_ID_Debug_mode 178ULL
-#define WT_CONF_ID_Encryption 19ULL
-#define WT_CONF_ID_Eviction 197ULL
-#define WT_CONF_ID_File_manager 210ULL
-#define WT_CONF_ID_Flush_tier 143ULL
-#define WT_CONF_ID_Hash 273ULL
-#define WT_CONF_ID_Heuristic_controls 215ULL
-#define WT_CONF_ID_History_store 219ULL
-#define WT_CONF_ID_Import 84ULL
-#define WT_CONF_ID_Incremental 103ULL
-#define WT_CONF_ID_Io_capacity 221ULL
-#define WT_CONF_ID_Live_restore 278ULL
-#define WT_CONF_ID_Log 36ULL
-#define WT_CONF_ID_Operation_tracking 231ULL
-#define WT_CONF_ID_Prefetch 253ULL
-#define WT_CONF_ID_Rollback_to_stable 233ULL
-#define WT_CONF_ID_Roundup_timestamps 136ULL
-#define WT_CONF_ID_Shared_cache 235ULL
-#define WT_CONF_ID_Statistics_log 239ULL
-#define WT_CONF_ID_Tiered_storage 47ULL
-#define WT_CONF_ID_Transaction_sync 293ULL
+#define WT_CONF_ID_Block_cache 161ULL
+#define WT_CONF_ID_Cache_arena 271ULL
+#define WT_CONF_ID_Checkpoint 177ULL
+#define WT_CONF_ID_Checkpoint_cleanup 181ULL
+#define WT_CONF_ID_Chunk_cache 183ULL
+#define WT_CONF_ID_Compatibility 185ULL
+#define WT_CONF_ID_Debug 105ULL
+#define WT_CONF_ID_Debug_mode 187ULL
+#define WT_CONF_ID_Encryption 21ULL
+#define WT_CONF_ID_Eviction 206ULL
+#define WT_CONF_ID_File_manager 219ULL
+#define WT_CONF_ID_Flush_tier 150ULL
+#define WT_CONF_ID_Group_commit 236ULL
+#define WT_CONF_ID_Hash 290ULL
+#define WT_CONF_ID_Heuristic_controls 224ULL
+#define WT_CONF_ID_History_store 229ULL
+#define WT_CONF_ID_Import 91ULL
+#define WT_CONF_ID_Incremental 110ULL
+#define WT_CONF_ID_Io_capacity 231ULL
+#define WT_CONF_ID_Live_restore 295ULL
+#define WT_CONF_ID_Log 40ULL
+#define WT_CONF_ID_Operation_tracking 245ULL
+#define WT_CONF_ID_Prefetch 266ULL
+#define WT_CONF_ID_Rollback_to_stable 247ULL
+#define WT_CONF_ID_Roundup_timestamps 143ULL
+#define WT_CONF_ID_Shared_cache 248ULL
+#define WT_CONF_ID_Statistics_log 252ULL
+#define WT_CONF_ID_Tiered_storage 52ULL
+#define WT_CONF_ID_Transaction_sync 312ULL
+#define WT_CONF_ID_Update_pool 313ULL
+#define WT_CONF_ID_Write_pipeline 318ULL
 #define WT_CONF_ID_access_pattern_hint 12ULL
-#define WT_CONF_ID_action 73ULL
-#define WT_CONF_ID_allocation_size 13ULL
+#define WT_CONF_ID_action 79ULL
+#define WT_CONF_ID_adaptive_hash_index 13ULL
+#define WT_CONF_ID_allocation_size 14ULL
 #define WT_CONF_ID_app_metadata 0ULL
-#define WT_CONF_ID_append 70ULL
-#define WT_CONF_ID_archive 225ULL
-#define WT_CONF_ID_auth_token 48ULL
-#define WT_CONF_ID_available 286ULL
-#define WT_CONF_ID_background 77ULL
-#define WT_CONF_ID_background_compact 179ULL
-#define WT_CONF_ID_backup 147ULL
-#define WT_CONF_ID_backup_restore_target 255ULL
-#define WT_CONF_ID_blkcache_eviction_aggression 157ULL
-#define WT_CONF_ID_block_allocation 14ULL
-#define WT_CONF_ID_block_compressor 15ULL
-#define WT_CONF_ID_bound 74ULL
-#define WT_CONF_ID_bucket 49ULL
-#define WT_CONF_ID_bucket_prefix 50ULL
-#define WT_CONF_ID_buckets 274ULL
-#define WT_CONF_ID_buffer_alignment 256ULL
-#define WT_CONF_ID_builtin_extension_config 257ULL
-#define WT_CONF_ID_bulk 96ULL
-#define WT_CONF_ID_cache 148ULL
-#define WT_CONF_ID_cache_cursors 249ULL
-#define WT_CONF_ID_cache_directory 51ULL
-#define WT_CONF_ID_cache_max_wait_ms 165ULL
-#define WT_CONF_ID_cache_on_checkpoint 155ULL
-#define WT_CONF_ID_cache_on_writes 156ULL
-#define WT_CONF_ID_cache_overhead 166ULL
-#define WT_CONF_ID_cache_resident 16ULL
-#define WT_CONF_ID_cache_size 167ULL
-#define WT_CONF_ID_cache_stuck_timeout_ms 168ULL
-#define WT_CONF_ID_capacity 259ULL
-#define WT_CONF_ID_checkpoint 56ULL
-#define WT_CONF_ID_checkpoint_backup_info 57ULL
-#define WT_CONF_ID_checkpoint_cleanup 140ULL
-#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 216ULL
-#define WT_CONF_ID_checkpoint_crash_point 141ULL
-#define WT_CONF_ID_checkpoint_fail_before_turtle_update 250ULL
-#define WT_CONF_ID_checkpoint_lsn 58ULL
-#define WT_CONF_ID_checkpoint_read_timestamp 99ULL
-#define WT_CONF_ID_checkpoint_retention 181ULL
-#define WT_CONF_ID_checkpoint_sync 258ULL
-#define WT_CONF_ID_checkpoint_use_history 97ULL
-#define WT_CONF_ID_checkpoint_wait 90ULL
-#define WT_CONF_ID_checksum 17ULL
-#define WT_CONF_ID_chunk 236ULL
-#define WT_CONF_ID_chunk_cache 223ULL
-#define WT_CONF_ID_chunk_cache_evict_trigger 260ULL
-#define WT_CONF_ID_chunk_size 261ULL
-#define WT_CONF_ID_close_handle_minimum 211ULL
-#define WT_CONF_ID_close_idle_time 212ULL
-#define WT_CONF_ID_close_scan_interval 213ULL
-#define WT_CONF_ID_colgroups 66ULL
+#define WT_CONF_ID_append 76ULL
+#define WT_CONF_ID_archive 235ULL
+#define WT_CONF_ID_async_read_depth 304ULL
+#define WT_CONF_ID_auth_token 53ULL
+#define WT_CONF_ID_available 305ULL
+#define WT_CONF_ID_background 84ULL
+#define WT_CONF_ID_background_compact 188ULL
+#define WT_CONF_ID_backup 154ULL
+#define WT_CONF_ID_backup_restore_target 268ULL
+#define WT_CONF_ID_blkcache_eviction_aggression 164ULL
+#define WT_CONF_ID_block_allocation 15ULL
+#define WT_CONF_ID_block_allocation_arenas 16ULL
+#define WT_CONF_ID_block_compressor 17ULL
+#define WT_CONF_ID_bound 80ULL
+#define WT_CONF_ID_bucket 54ULL
+#define WT_CONF_ID_bucket_prefix 55ULL
+#define WT_CONF_ID_buckets 291ULL
+#define WT_CONF_ID_buffer_alignment 269ULL
+#define WT_CONF_ID_builtin_extension_config 270ULL
+#define WT_CONF_ID_bulk 103ULL
+#define WT_CONF_ID_cache 155ULL
+#define WT_CONF_ID_cache_cursors 262ULL
+#define WT_CONF_ID_cache_directory 56ULL
+#define WT_CONF_ID_cache_max_wait_ms 173ULL
+#define WT_CONF_ID_cache_on_checkpoint 162ULL
+#define WT_CONF_ID_cache_on_writes 163ULL
+#define WT_CONF_ID_cache_overhead 174ULL
+#define WT_CONF_ID_cache_resident 18ULL
+#define WT_CONF_ID_cache_size 175ULL
+#define WT_CONF_ID_cache_stuck_timeout_ms 176ULL
+#define WT_CONF_ID_capacity 275ULL
+#define WT_CONF_ID_checkpoint 62ULL
+#define WT_CONF_ID_checkpoint_backup_info 63ULL
+#define WT_CONF_ID_checkpoint_cleanup 147ULL
+#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 225ULL
+#define WT_CONF_ID_checkpoint_crash_point 148ULL
+#define WT_CONF_ID_checkpoint_fail_before_turtle_update 263ULL
+#define WT_CONF_ID_checkpoint_lsn 64ULL
+#define WT_CONF_ID_checkpoint_read_timestamp 106ULL
+#define WT_CONF_ID_checkpoint_retention 190ULL
+#define WT_CONF_ID_checkpoint_sync 274ULL
+#define WT_CONF_ID_checkpoint_use_history 104ULL
+#define WT_CONF_ID_checkpoint_wait 97ULL
+#define WT_CONF_ID_checksum 19ULL
+#define WT_CONF_ID_chunk 249ULL
+#define WT_CONF_ID_chunk_cache 233ULL
+#define WT_CONF_ID_chunk_cache_evict_trigger 276ULL
+#define WT_CONF_ID_chunk_size 277ULL
+#define WT_CONF_ID_close_handle_minimum 220ULL
+#define WT_CONF_ID_close_idle_time 221ULL
+#define WT_CONF_ID_close_scan_interval 222ULL
+#define WT_CONF_ID_colgroups 72ULL
 #define WT_CONF_ID_collator 6ULL
 #define WT_CONF_ID_columns 7ULL
 #define WT_CONF_ID_commit_timestamp 2ULL
-#define WT_CONF_ID_compare_timestamp 85ULL
-#define WT_CONF_ID_compile_configuration_count 266ULL
-#define WT_CONF_ID_compressor 280ULL
-#define WT_CONF_ID_config 245ULL
-#define WT_CONF_ID_config_base 267ULL
-#define WT_CONF_ID_configuration 182ULL
-#define WT_CONF_ID_consolidate 104ULL
-#define WT_CONF_ID_corruption_abort 180ULL
-#define WT_CONF_ID_create 268ULL
-#define WT_CONF_ID_cursor_copy 183ULL
-#define WT_CONF_ID_cursor_reposition 184ULL
-#define WT_CONF_ID_cursors 149ULL
-#define WT_CONF_ID_default 287ULL
-#define WT_CONF_ID_dhandle_buckets 275ULL
-#define WT_CONF_ID_dictionary 18ULL
-#define WT_CONF_ID_direct_io 269ULL
-#define WT_CONF_ID_do_not_clear_txn_id 119ULL
-#define WT_CONF_ID_drop 142ULL
-#define WT_CONF_ID_dryrun 78ULL
-#define WT_CONF_ID_dump 102ULL
-#define WT_CONF_ID_dump_address 120ULL
-#define WT_CONF_ID_dump_all_data 121ULL
-#define WT_CONF_ID_dump_blocks 122ULL
-#define WT_CONF_ID_dump_key_data 123ULL
-#define WT_CONF_ID_dump_layout 124ULL
-#define WT_CONF_ID_dump_offsets 125ULL
-#define WT_CONF_ID_dump_pages 126ULL
-#define WT_CONF_ID_dump_tree_shape 127ULL
-#define WT_CONF_ID_dump_version 100ULL
+#define WT_CONF_ID_compare_timestamp 92ULL
+#define WT_CONF_ID_compile_configuration_count 283ULL
+#define WT_CONF_ID_compressor 297ULL
+#define WT_CONF_ID_config 258ULL
+#define WT_CONF_ID_config_base 284ULL
+#define WT_CONF_ID_configuration 191ULL
+#define WT_CONF_ID_consolidate 111ULL
+#define WT_CONF_ID_corruption_abort 189ULL
+#define WT_CONF_ID_create 285ULL
+#define WT_CONF_ID_cursor_copy 192ULL
+#define WT_CONF_ID_cursor_reposition 193ULL
+#define WT_CONF_ID_cursors 156ULL
+#define WT_CONF_ID_default 306ULL
+#define WT_CONF_ID_descent_validation 226ULL
+#define WT_CONF_ID_dhandle_buckets 292ULL
+#define WT_CONF_ID_dictionary 20ULL
+#define WT_CONF_ID_direct_io 286ULL
+#define WT_CONF_ID_do_not_clear_txn_id 126ULL
+#define WT_CONF_ID_drop 149ULL
+#define WT_CONF_ID_dryrun 85ULL
+#define WT_CONF_ID_dump 109ULL
+#define WT_CONF_ID_dump_address 127ULL
+#define WT_CONF_ID_dump_all_data 128ULL
+#define WT_CONF_ID_dump_blocks 129ULL
+#define WT_CONF_ID_dump_key_data 130ULL
+#define WT_CONF_ID_dump_layout 131ULL
+#define WT_CONF_ID_dump_offsets 132ULL
+#define WT_CONF_ID_dump_pages 133ULL
+#define WT_CONF_ID_dump_tree_shape 134ULL
+#define WT_CONF_ID_dump_version 107ULL
 #define WT_CONF_ID_durable_timestamp 3ULL
-#define WT_CONF_ID_early_load 246ULL
-#define WT_CONF_ID_enabled 37ULL
-#define WT_CONF_ID_entry 247ULL
-#define WT_CONF_ID_error_prefix 196ULL
-#define WT_CONF_ID_evict_sample_inmem 200ULL
-#define WT_CONF_ID_evict_use_softptr 201ULL
-#define WT_CONF_ID_eviction 185ULL
-#define WT_CONF_ID_eviction_checkpoint_target 202ULL
-#define WT_CONF_ID_eviction_checkpoint_ts_ordering 195ULL
-#define WT_CONF_ID_eviction_dirty_target 203ULL
-#define WT_CONF_ID_eviction_dirty_trigger 204ULL
-#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 217ULL
-#define WT_CONF_ID_eviction_target 205ULL
-#define WT_CONF_ID_eviction_trigger 206ULL
-#define WT_CONF_ID_eviction_updates_target 207ULL
-#define WT_CONF_ID_eviction_updates_trigger 208ULL
-#define WT_CONF_ID_exclude 79ULL
-#define WT_CONF_ID_exclusive 83ULL
-#define WT_CONF_ID_exclusive_refreshed 76ULL
-#define WT_CONF_ID_extensions 271ULL
-#define WT_CONF_ID_extra_diagnostics 209ULL
-#define WT_CONF_ID_file 105ULL
-#define WT_CONF_ID_file_extend 272ULL
-#define WT_CONF_ID_file_max 220ULL
-#define WT_CONF_ID_file_metadata 86ULL
-#define WT_CONF_ID_fill_holes_on_close 279ULL
-#define WT_CONF_ID_final_flush 145ULL
-#define WT_CONF_ID_flush_time 64ULL
-#define WT_CONF_ID_flush_timestamp 65ULL
-#define WT_CONF_ID_flushed_data_cache_insertion 263ULL
-#define WT_CONF_ID_force 91ULL
-#define WT_CONF_ID_force_stop 106ULL
-#define WT_CONF_ID_force_write_wait 281ULL
-#define WT_CONF_ID_format 22ULL
-#define WT_CONF_ID_free_space_target 80ULL
-#define WT_CONF_ID_full_target 158ULL
-#define WT_CONF_ID_generation_drain_timeout_ms 214ULL
-#define WT_CONF_ID_get 118ULL
-#define WT_CONF_ID_granularity 107ULL
-#define WT_CONF_ID_handles 150ULL
-#define WT_CONF_ID_hashsize 160ULL
-#define WT_CONF_ID_hazard_max 276ULL
-#define WT_CONF_ID_huffman_key 23ULL
-#define WT_CONF_ID_huffman_value 24ULL
-#define WT_CONF_ID_id 59ULL
-#define WT_CONF_ID_ignore_cache_size 252ULL
-#define WT_CONF_ID_ignore_in_memory_cache_size 25ULL
-#define WT_CONF_ID_ignore_prepare 131ULL
-#define WT_CONF_ID_immutable 63ULL
-#define WT_CONF_ID_in_memory 277ULL
-#define WT_CONF_ID_inclusive 75ULL
-#define WT_CONF_ID_internal_item_max 26ULL
-#define WT_CONF_ID_internal_key_max 27ULL
-#define WT_CONF_ID_internal_key_truncate 28ULL
-#define WT_CONF_ID_internal_page_max 29ULL
-#define WT_CONF_ID_interval 292ULL
-#define WT_CONF_ID_isolation 132ULL
-#define WT_CONF_ID_json 240ULL
-#define WT_CONF_ID_json_output 224ULL
-#define WT_CONF_ID_key_format 30ULL
-#define WT_CONF_ID_key_gap 31ULL
-#define WT_CONF_ID_keyid 21ULL
-#define WT_CONF_ID_last 67ULL
-#define WT_CONF_ID_leaf_item_max 32ULL
-#define WT_CONF_ID_leaf_key_max 33ULL
-#define WT_CONF_ID_leaf_page_max 34ULL
-#define WT_CONF_ID_leaf_value_max 35ULL
-#define WT_CONF_ID_leak_memory 146ULL
-#define WT_CONF_ID_local_retention 52ULL
-#define WT_CONF_ID_lock_wait 92ULL
-#define WT_CONF_ID_log 151ULL
-#define WT_CONF_ID_log_retention 186ULL
-#define WT_CONF_ID_log_size 170ULL
-#define WT_CONF_ID_max_percent_overhead 161ULL
-#define WT_CONF_ID_memory_page_image_max 38ULL
-#define WT_CONF_ID_memory_page_max 39ULL
-#define WT_CONF_ID_metadata_file 87ULL
-#define WT_CONF_ID_method 173ULL
-#define WT_CONF_ID_mmap 283ULL
-#define WT_CONF_ID_mmap_all 284ULL
-#define WT_CONF_ID_multiprocess 285ULL
-#define WT_CONF_ID_name 20ULL
-#define WT_CONF_ID_next_random 110ULL
-#define WT_CONF_ID_next_random_sample_size 111ULL
-#define WT_CONF_ID_next_random_seed 112ULL
-#define WT_CONF_ID_no_timestamp 133ULL
-#define WT_CONF_ID_nvram_path 162ULL
-#define WT_CONF_ID_object_target_size 53ULL
-#define WT_CONF_ID_obsolete_tw_btree_max 218ULL
-#define WT_CONF_ID_oldest 68ULL
-#define WT_CONF_ID_oldest_timestamp 254ULL
-#define WT_CONF_ID_on_close 241ULL
-#define WT_CONF_ID_operation_timeout_ms 134ULL
-#define WT_CONF_ID_os_cache_dirty_max 40ULL
-#define WT_CONF_ID_os_cache_dirty_pct 226ULL
-#define WT_CONF_ID_os_cache_max 41ULL
-#define WT_CONF_ID_overwrite 71ULL
-#define WT_CONF_ID_panic_corrupt 88ULL
-#define WT_CONF_ID_path 232ULL
-#define WT_CONF_ID_percent_file_in_dram 163ULL
-#define WT_CONF_ID_pinned 175ULL
-#define WT_CONF_ID_prealloc 227ULL
-#define WT_CONF_ID_prealloc_init_count 228ULL
-#define WT_CONF_ID_prefix_compression 42ULL
-#define WT_CONF_ID_prefix_compression_min 43ULL
-#define WT_CONF_ID_prefix_search 72ULL
-#define WT_CONF_ID_prepare_timestamp 139ULL
-#define WT_CONF_ID_prepared 137ULL
-#define WT_CONF_ID_priority 135ULL
-#define WT_CONF_ID_quota 237ULL
-#define WT_CONF_ID_raw 113ULL
-#define WT_CONF_ID_read 138ULL
-#define WT_CONF_ID_read_corrupt 128ULL
-#define WT_CONF_ID_read_once 114ULL
+#define WT_CONF_ID_early_load 259ULL
+#define WT_CONF_ID_enabled 41ULL
+#define WT_CONF_ID_entry 260ULL
+#define WT_CONF_ID_error_prefix 205ULL
+#define WT_CONF_ID_evict_sample_inmem 209ULL
+#define WT_CONF_ID_evict_use_softptr 210ULL
+#define WT_CONF_ID_eviction 194ULL
+#define WT_CONF_ID_eviction_checkpoint_target 211ULL
+#define WT_CONF_ID_eviction_checkpoint_ts_ordering 204ULL
+#define WT_CONF_ID_eviction_dirty_target 212ULL
+#define WT_CONF_ID_eviction_dirty_trigger 213ULL
+#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 227ULL
+#define WT_CONF_ID_eviction_target 214ULL
+#define WT_CONF_ID_eviction_trigger 215ULL
+#define WT_CONF_ID_eviction_updates_target 216ULL
+#define WT_CONF_ID_eviction_updates_trigger 217ULL
+#define WT_CONF_ID_exclude 86ULL
+#define WT_CONF_ID_exclusive 90ULL
+#define WT_CONF_ID_exclusive_refreshed 83ULL
+#define WT_CONF_ID_extensions 288ULL
+#define WT_CONF_ID_extra_diagnostics 218ULL
+#define WT_CONF_ID_file 112ULL
+#define WT_CONF_ID_file_extend 289ULL
+#define WT_CONF_ID_file_max 230ULL
+#define WT_CONF_ID_file_metadata 93ULL
+#define WT_CONF_ID_fill_holes_on_close 296ULL
+#define WT_CONF_ID_final_flush 152ULL
+#define WT_CONF_ID_flush_time 70ULL
+#define WT_CONF_ID_flush_timestamp 71ULL
+#define WT_CONF_ID_flushed_data_cache_insertion 279ULL
+#define WT_CONF_ID_force 98ULL
+#define WT_CONF_ID_force_stop 113ULL
+#define WT_CONF_ID_force_write_wait 298ULL
+#define WT_CONF_ID_format 24ULL
+#define WT_CONF_ID_free_space_target 87ULL
+#define WT_CONF_ID_full_target 165ULL
+#define WT_CONF_ID_generation_drain_timeout_ms 223ULL
+#define WT_CONF_ID_get 125ULL
+#define WT_CONF_ID_granularity 114ULL
+#define WT_CONF_ID_handles 157ULL
+#define WT_CONF_ID_hashsize 167ULL
+#define WT_CONF_ID_hazard_max 293ULL
+#define WT_CONF_ID_huffman_key 25ULL
+#define WT_CONF_ID_huffman_value 26ULL
+#define WT_CONF_ID_hugepages 272ULL
+#define WT_CONF_ID_id 65ULL
+#define WT_CONF_ID_ignore_cache_size 265ULL
+#define WT_CONF_ID_ignore_in_memory_cache_size 27ULL
+#define WT_CONF_ID_ignore_prepare 138ULL
+#define WT_CONF_ID_immutable 69ULL
+#define WT_CONF_ID_in_memory 294ULL
+#define WT_CONF_ID_inclusive 81ULL
+#define WT_CONF_ID_internal_item_max 28ULL
+#define WT_CONF_ID_internal_key_max 29ULL
+#define WT_CONF_ID_internal_key_prefix_search 30ULL
+#define WT_CONF_ID_internal_key_truncate 31ULL
+#define WT_CONF_ID_internal_page_max 32ULL
+#define WT_CONF_ID_interval 311ULL
+#define WT_CONF_ID_isolation 139ULL
+#define WT_CONF_ID_json 253ULL
+#define WT_CONF_ID_json_output 234ULL
+#define WT_CONF_ID_key_format 33ULL
+#define WT_CONF_ID_key_gap 34ULL
+#define WT_CONF_ID_keyid 23ULL
+#define WT_CONF_ID_last 73ULL
+#define WT_CONF_ID_leaf_item_max 35ULL
+#define WT_CONF_ID_leaf_key_max 36ULL
+#define WT_CONF_ID_leaf_key_prefix_search 37ULL
+#define WT_CONF_ID_leaf_page_max 38ULL
+#define WT_CONF_ID_leaf_value_max 39ULL
+#define WT_CONF_ID_leak_memory 153ULL
+#define WT_CONF_ID_local_retention 57ULL
+#define WT_CONF_ID_lock_wait 99ULL
+#define WT_CONF_ID_log 158ULL
+#define WT_CONF_ID_log_retention 195ULL
+#define WT_CONF_ID_log_size 178ULL
+#define WT_CONF_ID_max_bytes 237ULL
+#define WT_CONF_ID_max_commits 238ULL
+#define WT_CONF_ID_max_inflight 319ULL
+#define WT_CONF_ID_max_percent_overhead 168ULL
+#define WT_CONF_ID_max_wait 239ULL
+#define WT_CONF_ID_memory_page_image_max 42ULL
+#define WT_CONF_ID_memory_page_max 43ULL
+#define WT_CONF_ID_metadata_file 94ULL
+#define WT_CONF_ID_method 182ULL
+#define WT_CONF_ID_mmap 301ULL
+#define WT_CONF_ID_mmap_all 302ULL
+#define WT_CONF_ID_multiprocess 303ULL
+#define WT_CONF_ID_name 22ULL
+#define WT_CONF_ID_next_random 117ULL
+#define WT_CONF_ID_next_random_sample_size 118ULL
+#define WT_CONF_ID_next_random_seed 119ULL
+#define WT_CONF_ID_no_timestamp 140ULL
+#define WT_CONF_ID_numa 273ULL
+#define WT_CONF_ID_nvram_path 169ULL
+#define WT_CONF_ID_object_target_size 58ULL
+#define WT_CONF_ID_obsolete_tw_btree_max 228ULL
+#define WT_CONF_ID_oldest 74ULL
+#define WT_CONF_ID_oldest_timestamp 267ULL
+#define WT_CONF_ID_on_close 254ULL
+#define WT_CONF_ID_operation_timeout_ms 141ULL
+#define WT_CONF_ID_os_cache_dirty_max 44ULL
+#define WT_CONF_ID_os_cache_dirty_pct 240ULL
+#define WT_CONF_ID_os_cache_max 45ULL
+#define WT_CONF_ID_overwrite 77ULL
+#define WT_CONF_ID_page_arena 46ULL
+#define WT_CONF_ID_panic_corrupt 95ULL
+#define WT_CONF_ID_path 246ULL
+#define WT_CONF_ID_percent_file_in_dram 171ULL
+#define WT_CONF_ID_pinned 184ULL
+#define WT_CONF_ID_policy 170ULL
+#define WT_CONF_ID_prealloc 241ULL
+#define WT_CONF_ID_prealloc_init_count 242ULL
+#define WT_CONF_ID_prefix_compression 47ULL
+#define WT_CONF_ID_prefix_compression_min 48ULL
+#define WT_CONF_ID_prefix_search 78ULL
+#define WT_CONF_ID_prepare_timestamp 146ULL
+#define WT_CONF_ID_prepared 144ULL
+#define WT_CONF_ID_priority 142ULL
+#define WT_CONF_ID_quota 250ULL
+#define WT_CONF_ID_raw 120ULL
+#define WT_CONF_ID_read 145ULL
+#define WT_CONF_ID_read_corrupt 135ULL
+#define WT_CONF_ID_read_once 121ULL
 #define WT_CONF_ID_read_timestamp 4ULL
-#define WT_CONF_ID_readonly 60ULL
-#define WT_CONF_ID_realloc_exact 187ULL
-#define WT_CONF_ID_realloc_malloc 188ULL
-#define WT_CONF_ID_recover 282ULL
-#define WT_CONF_ID_release 177ULL
-#define WT_CONF_ID_release_evict 101ULL
-#define WT_CONF_ID_release_evict_page 251ULL
-#define WT_CONF_ID_remove 229ULL
-#define WT_CONF_ID_remove_files 93ULL
-#define WT_CONF_ID_remove_shared 94ULL
-#define WT_CONF_ID_repair 89ULL
-#define WT_CONF_ID_require_max 264ULL
-#define WT_CONF_ID_require_min 265ULL
-#define WT_CONF_ID_reserve 238ULL
-#define WT_CONF_ID_rollback_error 189ULL
-#define WT_CONF_ID_run_once 81ULL
-#define WT_CONF_ID_salvage 288ULL
-#define WT_CONF_ID_secretkey 270ULL
-#define WT_CONF_ID_session_max 289ULL
-#define WT_CONF_ID_session_scratch_max 290ULL
-#define WT_CONF_ID_session_table_cache 291ULL
-#define WT_CONF_ID_sessions 152ULL
-#define WT_CONF_ID_shared 54ULL
-#define WT_CONF_ID_size 159ULL
-#define WT_CONF_ID_skip_sort_check 115ULL
-#define WT_CONF_ID_slow_checkpoint 190ULL
+#define WT_CONF_ID_readonly 66ULL
+#define WT_CONF_ID_realloc_exact 196ULL
+#define WT_CONF_ID_realloc_malloc 197ULL
+#define WT_CONF_ID_recover 299ULL
+#define WT_CONF_ID_recover_threads 300ULL
+#define WT_CONF_ID_release 186ULL
+#define WT_CONF_ID_release_evict 108ULL
+#define WT_CONF_ID_release_evict_page 264ULL
+#define WT_CONF_ID_remove 243ULL
+#define WT_CONF_ID_remove_files 100ULL
+#define WT_CONF_ID_remove_shared 101ULL
+#define WT_CONF_ID_repair 96ULL
+#define WT_CONF_ID_require_max 281ULL
+#define WT_CONF_ID_require_min 282ULL
+#define WT_CONF_ID_reserve 251ULL
+#define WT_CONF_ID_rollback_error 198ULL
+#define WT_CONF_ID_run_once 88ULL
+#define WT_CONF_ID_salvage 307ULL
+#define WT_CONF_ID_secretkey 287ULL
+#define WT_CONF_ID_session_max 308ULL
+#define WT_CONF_ID_session_scratch_max 309ULL
+#define WT_CONF_ID_session_table_cache 310ULL
+#define WT_CONF_ID_sessions 159ULL
+#define WT_CONF_ID_shared 59ULL
+#define WT_CONF_ID_shared_max 314ULL
+#define WT_CONF_ID_size 166ULL
+#define WT_CONF_ID_skip_sort_check 122ULL
+#define WT_CONF_ID_slow_checkpoint 199ULL
 #define WT_CONF_ID_source 8ULL
-#define WT_CONF_ID_sources 242ULL
-#define WT_CONF_ID_split_deepen_min_child 44ULL
-#define WT_CONF_ID_split_deepen_per_child 45ULL
-#define WT_CONF_ID_split_pct 46ULL
-#define WT_CONF_ID_src_id 108ULL
-#define WT_CONF_ID_stable_timestamp 129ULL
-#define WT_CONF_ID_statistics 116ULL
-#define WT_CONF_ID_storage_path 262ULL
-#define WT_CONF_ID_stress_skiplist 191ULL
-#define WT_CONF_ID_strict 130ULL
-#define WT_CONF_ID_sync 95ULL
-#define WT_CONF_ID_system_ram 164ULL
-#define WT_CONF_ID_table_logging 192ULL
-#define WT_CONF_ID_target 117ULL
-#define WT_CONF_ID_terminate 248ULL
-#define WT_CONF_ID_this_id 109ULL
-#define WT_CONF_ID_threads 234ULL
-#define WT_CONF_ID_threads_max 198ULL
-#define WT_CONF_ID_threads_min 199ULL
-#define WT_CONF_ID_tiered_flush_error_continue 193ULL
-#define WT_CONF_ID_tiered_object 61ULL
-#define WT_CONF_ID_tiers 69ULL
-#define WT_CONF_ID_timeout 82ULL
-#define WT_CONF_ID_timestamp 243ULL
-#define WT_CONF_ID_timing_stress_for_test 244ULL
-#define WT_CONF_ID_total 222ULL
-#define WT_CONF_ID_txn 153ULL
+#define WT_CONF_ID_sources 255ULL
+#define WT_CONF_ID_split_deepen_min_child 49ULL
+#define WT_CONF_ID_split_deepen_per_child 50ULL
+#define WT_CONF_ID_split_pct 51ULL
+#define WT_CONF_ID_src_id 115ULL
+#define WT_CONF_ID_stable_timestamp 136ULL
+#define WT_CONF_ID_statistics 123ULL
+#define WT_CONF_ID_storage_path 278ULL
+#define WT_CONF_ID_stress_skiplist 200ULL
+#define WT_CONF_ID_strict 137ULL
+#define WT_CONF_ID_sync 102ULL
+#define WT_CONF_ID_system_ram 172ULL
+#define WT_CONF_ID_table_logging 201ULL
+#define WT_CONF_ID_target 124ULL
+#define WT_CONF_ID_terminate 261ULL
+#define WT_CONF_ID_this_id 116ULL
+#define WT_CONF_ID_threads 179ULL
+#define WT_CONF_ID_threads_max 207ULL
+#define WT_CONF_ID_threads_min 208ULL
+#define WT_CONF_ID_tiered_flush_error_continue 202ULL
+#define WT_CONF_ID_tiered_object 67ULL
+#define WT_CONF_ID_tiers 75ULL
+#define WT_CONF_ID_timeout 89ULL
+#define WT_CONF_ID_timestamp 256ULL
+#define WT_CONF_ID_timing_stress_for_test 257ULL
+#define WT_CONF_ID_total 232ULL
+#define WT_CONF_ID_txn 160ULL
 #define WT_CONF_ID_type 9ULL
-#define WT_CONF_ID_update_restore_evict 194ULL
-#define WT_CONF_ID_use_environment 294ULL
-#define WT_CONF_ID_use_environment_priv 295ULL
-#define WT_CONF_ID_use_timestamp 144ULL
-#define WT_CONF_ID_value_format 55ULL
+#define WT_CONF_ID_update_restore_evict 203ULL
+#define WT_CONF_ID_use_environment 315ULL
+#define WT_CONF_ID_use_environment_priv 316ULL
+#define WT_CONF_ID_use_timestamp 151ULL
+#define WT_CONF_ID_value 82ULL
+#define WT_CONF_ID_value_format 60ULL
+#define WT_CONF_ID_value_zone_maps 61ULL
 #define WT_CONF_ID_verbose 10ULL
-#define WT_CONF_ID_verify_metadata 296ULL
-#define WT_CONF_ID_version 62ULL
-#define WT_CONF_ID_wait 171ULL
-#define WT_CONF_ID_write_through 297ULL
+#define WT_CONF_ID_verify_metadata 317ULL
+#define WT_CONF_ID_version 68ULL
+#define WT_CONF_ID_wait 180ULL
+#define WT_CONF_ID_warmup_threads 280ULL
+#define WT_CONF_ID_write_through 320ULL
 #define WT_CONF_ID_write_timestamp 5ULL
 #define WT_CONF_ID_write_timestamp_usage 11ULL
-#define WT_CONF_ID_zero_fill 230ULL
+#define WT_CONF_ID_zero_fill 244ULL
 
-#define WT_CONF_ID_COUNT 298
+#define WT_CONF_ID_COUNT 321
 /*
  * API configuration keys: END
  */
@@ -343,12 +366,19 @@ static const struct {
         uint64_t max_percent_overhead;
         uint64_t nvram_path;
         uint64_t percent_file_in_dram;
+        uint64_t policy;
         uint64_t size;
         uint64_t system_ram;
         uint64_t type;
     } Block_cache;
+    struct {
+    uint64_t hugepages;
+    uint64_t numa;
+    uint64_t size;
+    } Cache_arena;
     struct {
         uint64_t log_size;
+        uint64_t threads;
         uint64_t wait;
     } Checkpoint;
     struct {
@@ -365,6 +395,7 @@ static const struct {
         uint64_t pinned;
         uint64_t storage_path;
         uint64_t type;
+        uint64_t warmup_threads;
     } Chunk_cache;
     struct {
         uint64_t release;
@@ -422,6 +453,7 @@ static const struct {
     } Hash;
     struct {
         uint64_t checkpoint_cleanup_obsolete_tw_pages_dirty_max;
+        uint64_t descent_validation;
         uint64_t eviction_obsolete_tw_pages_dirty_max;
         uint64_t obsolete_tw_btree_max;
     } Heuristic_controls;
@@ -458,6 +490,12 @@ static const struct {
         uint64_t threads_max;
     } Live_restore;
     struct {
+        struct {
+            uint64_t enabled;
+            uint64_t max_bytes;
+            uint64_t max_commits;
+            uint64_t max_wait;
+        } Group_commit;
         uint64_t archive;
         uint64_t compressor;
         uint64_t enabled;
@@ -468,6 +506,7 @@ static const struct {
         uint64_t prealloc;
         uint64_t prealloc_init_count;
         uint64_t recover;
+        uint64_t recover_threads;
         uint64_t remove;
         uint64_t zero_fill;
     } Log;
@@ -476,6 +515,7 @@ static const struct {
         uint64_t path;
     } Operation_tracking;
     struct {
+        uint64_t async_read_depth;
         uint64_t available;
         uint64_t _default;
     } Prefetch;
@@ -515,8 +555,17 @@ static const struct {
         uint64_t enabled;
         uint64_t method;
     } Transaction_sync;
+    struct {
+    uint64_t session_max;
+    uint64_t shared_max;
+    } Update_pool;
+    struct {
+        uint64_t max_inflight;
+        uint64_t threads;
+    } Write_pipeline;
     uint64_t access_pattern_hint;
     uint64_t action;
+    uint64_t adaptive_hash_index;
     uint64_t allocation_size;
     uint64_t app_metadata;
     uint64_t append;
@@ -524,6 +573,7 @@ static const struct {
     uint64_t backup;
     uint64_t backup_restore_target;
     uint64_t block_allocation;
+    uint64_t block_allocation_arenas;
     uint64_t block_compressor;
     uint64_t bound;
     uint64_t bucket;
@@ -607,6 +657,7 @@ static const struct {
     uint64_t inclusive;
     uint64_t internal_item_max;
     uint64_t internal_key_max;
+    uint64_t internal_key_prefix_search;
     uint64_t internal_key_truncate;
     uint64_t internal_page_max;
     uint64_t isolation;
@@ -616,6 +667,7 @@ static const struct {
     uint64_t last;
     uint64_t leaf_item_max;
     uint64_t leaf_key_max;
+    uint64_t leaf_key_prefix_search;
     uint64_t leaf_page_max;
     uint64_t leaf_value_max;
     uint64_t leak_memory;
@@ -637,6 +689,7 @@ static const struct {
     uint64_t os_cache_dirty_max;
     uint64_t os_cache_max;
     uint64_t overwrite;
+    uint64_t page_arena;
     uint64_t prefix_compression;
     uint64_t prefix_compression_min;
     uint64_t prefix_search;
@@ -676,7 +729,9 @@ static const struct {
     uint64_t use_environment;
     uint64_t use_environment_priv;
     uint64_t use_timestamp;
+    uint64_t value;
     uint64_t value_format;
+    uint64_t value_zone_maps;
     uint64_t verbose;
     uint64_t verify_metadata;
     uint64_t version;
@@ -699,12 +754,19 @@ static const struct {
     WT_CONF_ID_Block_cache | (WT_CONF_ID_max_percent_overhead << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_nvram_path << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_percent_file_in_dram << 16),
+    WT_CONF_ID_Block_cache | (WT_CONF_ID_policy << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_size << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_system_ram << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_type << 16),
+    },
+    {
+    WT_CONF_ID_Cache_arena | (WT_CONF_ID_hugepages << 16),
+    WT_CONF_ID_Cache_arena | (WT_CONF_ID_numa << 16),
+    WT_CONF_ID_Cache_arena | (WT_CONF_ID_size << 16),
   },
   {
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_log_size << 16),
+    WT_CONF_ID_Checkpoint | (WT_CONF_ID_threads << 16),
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_wait << 16),
   },
   {
@@ -721,6 +783,7 @@ static const struct {
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_pinned << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_storage_path << 16),
     WT_CONF_ID_Chunk_cache | (WT_CONF_ID_type << 16),
+    WT_CONF_ID_Chunk_cache | (WT_CONF_ID_warmup_threads << 16),
   },
   {
     WT_CONF_ID_Compatibility | (WT_CONF_ID_release << 16),
@@ -779,6 +842,7 @@ static const struct {
   {
     WT_CONF_ID_Heuristic_controls |
       (WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max << 16),
+    WT_CONF_ID_Heuristic_controls | (WT_CONF_ID_descent_validation << 16),
     WT_CONF_ID_Heuristic_controls | (WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max << 16),
     WT_CONF_ID_Heuristic_controls | (WT_CONF_ID_obsolete_tw_btree_max << 16),
   },
@@ -815,6 +879,12 @@ static const struct {
     WT_CONF_ID_Live_restore | (WT_CONF_ID_threads_max << 16),
   },
   {
+    {
+      WT_CONF_ID_Log | (WT_CONF_ID_Group_commit << 16) | (WT_CONF_ID_enabled << 32),
+      WT_CONF_ID_Log | (WT_CONF_ID_Group_commit << 16) | (WT_CONF_ID_max_bytes << 32),
+      WT_CONF_ID_Log | (WT_CONF_ID_Group_commit << 16) | (WT_CONF_ID_max_commits << 32),
+      WT_CONF_ID_Log | (WT_CONF_ID_Group_commit << 16) | (WT_CONF_ID_max_wait << 32),
+    },
     WT_CONF_ID_Log | (WT_CONF_ID_archive << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_compressor << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_enabled << 16),
@@ -825,6 +895,7 @@ static const struct {
     WT_CONF_ID_Log | (WT_CONF_ID_prealloc << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_prealloc_init_count << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_recover << 16),
+    WT_CONF_ID_Log | (WT_CONF_ID_recover_threads << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_remove << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_zero_fill << 16),
   },
@@ -833,6 +904,7 @@ static const struct {
     WT_CONF_ID_Operation_tracking | (WT_CONF_ID_path << 16),
   },
   {
+    WT_CONF_ID_Prefetch | (WT_CONF_ID_async_read_depth << 16),
     WT_CONF_ID_Prefetch | (WT_CONF_ID_available << 16),
     WT_CONF_ID_Prefetch | (WT_CONF_ID_default << 16),
   },
@@ -871,9 +943,18 @@ static const struct {
   {
     WT_CONF_ID_Transaction_sync | (WT_CONF_ID_enabled << 16),
     WT_CONF_ID_Transaction_sync | (WT_CONF_ID_method << 16),
+    },
+    {
+    WT_CONF_ID_Update_pool | (WT_CONF_ID_session_max << 16),
+    WT_CONF_ID_Update_pool | (WT_CONF_ID_shared_max << 16),
+  },
+  {
+    WT_CONF_ID_Write_pipeline | (WT_CONF_ID_max_inflight << 16),
+    WT_CONF_ID_Write_pipeline | (WT_CONF_ID_threads << 16),
   },
   WT_CONF_ID_access_pattern_hint,
   WT_CONF_ID_action,
+  WT_CONF_ID_adaptive_hash_index,
   WT_CONF_ID_allocation_size,
   WT_CONF_ID_app_metadata,
   WT_CONF_ID_append,
@@ -881,6 +962,7 @@ static const struct {
   WT_CONF_ID_backup,
   WT_CONF_ID_backup_restore_target,
   WT_CONF_ID_block_allocation,
+  WT_CONF_ID_block_allocation_arenas,
   WT_CONF_ID_block_compressor,
   WT_CONF_ID_bound,
   WT_CONF_ID_bucket,
@@ -964,6 +1046,7 @@ static const struct {
   WT_CONF_ID_inclusive,
   WT_CONF_ID_internal_item_max,
   WT_CONF_ID_internal_key_max,
+  WT_CONF_ID_internal_key_prefix_search,
   WT_CONF_ID_internal_key_truncate,
   WT_CONF_ID_internal_page_max,
   WT_CONF_ID_isolation,
@@ -973,6 +1056,7 @@ static const struct {
   WT_CONF_ID_last,
   WT_CONF_ID_leaf_item_max,
   WT_CONF_ID_leaf_key_max,
+  WT_CONF_ID_leaf_key_prefix_search,
   WT_CONF_ID_leaf_page_max,
   WT_CONF_ID_leaf_value_max,
   WT_CONF_ID_leak_memory,
@@ -994,6 +1078,7 @@ static const struct {
   WT_CONF_ID_os_cache_dirty_max,
   WT_CONF_ID_os_cache_max,
   WT_CONF_ID_overwrite,
+  WT_CONF_ID_page_arena,
   WT_CONF_ID_prefix_compression,
   WT_CONF_ID_prefix_compression_min,
   WT_CONF_ID_prefix_search,
@@ -1033,7 +1118,9 @@ static const struct {
   WT_CONF_ID_use_environment,
   WT_CONF_ID_use_environment_priv,
   WT_CONF_ID_use_timestamp,
+  WT_CONF_ID_value,
   WT_CONF_ID_value_format,
+  WT_CONF_ID_value_zone_maps,
   WT_CONF_ID_verbose,
   WT_CONF_ID_verify_metadata,
   WT_CONF_ID_version,
@@ -193,6 +193,7 @@ extern const char __WT_CONFIG_CHOICE_compact_slow[];
 extern const char __WT_CONFIG_CHOICE_configuration[];
 extern const char __WT_CONFIG_CHOICE_cursor_check[];
 extern const char __WT_CONFIG_CHOICE_data[];
+extern const char __WT_CONFIG_CHOICE_delta[];
 extern const char __WT_CONFIG_CHOICE_disk_validate[];
 extern const char __WT_CONFIG_CHOICE_dsync[];
 extern const char __WT_CONFIG_CHOICE_error[];
@@ -208,6 +209,7 @@ extern const char __WT_CONFIG_CHOICE_fileops[];
 extern const char __WT_CONFIG_CHOICE_first[];
 extern const char __WT_CONFIG_CHOICE_first_commit[];
 extern const char __WT_CONFIG_CHOICE_force[];
+extern const char __WT_CONFIG_CHOICE_frequency[];
 extern const char __WT_CONFIG_CHOICE_fsync[];
 extern const char __WT_CONFIG_CHOICE_generation[];
 extern const char __WT_CONFIG_CHOICE_generation_check[];
@@ -240,6 +242,7 @@ extern const char __WT_CONFIG_CHOICE_on[];
 extern const char __WT_CONFIG_CHOICE_ordered[];
 extern const char __WT_CONFIG_CHOICE_out_of_order[];
 extern const char __WT_CONFIG_CHOICE_overflow[];
+extern const char __WT_CONFIG_CHOICE_page_index[];
 extern const char __WT_CONFIG_CHOICE_pinned[];
 extern const char __WT_CONFIG_CHOICE_prefetch[];
 extern const char __WT_CONFIG_CHOICE_prefetch_1[];
@@ -287,6 +290,7 @@ extern const char __WT_CONFIG_CHOICE_thread_group[];
 extern const char __WT_CONFIG_CHOICE_tiered[];
 extern const char __WT_CONFIG_CHOICE_tiered_flush_finish[];
 extern const char __WT_CONFIG_CHOICE_timestamp[];
+extern const char __WT_CONFIG_CHOICE_tinylfu[];
 extern const char __WT_CONFIG_CHOICE_transaction[];
 extern const char __WT_CONFIG_CHOICE_tree_walk[];
 extern const char __WT_CONFIG_CHOICE_true[];
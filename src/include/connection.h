@@ -174,6 +174,9 @@ struct __wt_heuristic_controls {
 
     /* Maximum number of btrees that can be processed per checkpoint. */
     uint32_t obsolete_tw_btree_max;
+
+    /* Searches validate internal page split versions when descending the tree. */
+    bool descent_version_validation;
 };
 
 /*
@@ -490,6 +493,12 @@ struct __wt_connection_impl {
 
     size_t session_scratch_max; /* Max scratch memory per session */
 
+    /* Discarded updates shared by the sessions' update pools. */
+    WT_SPINLOCK update_pool_lock;
+    WT_UPDATE_POOL update_pool;
+    size_t update_pool_session_max; /* Max bytes of each session's pool, 0 if pools are disabled */
+    size_t update_pool_shared_max;  /* Max bytes of the shared pool */
+
     WT_CACHE *cache;                        /* Page cache */
     wt_shared volatile uint64_t cache_size; /* Cache size (either statically
                                      configured or the current size
@@ -520,6 +529,8 @@ struct __wt_connection_impl {
         uint64_t recovery_ms;
     } recovery_timeline;
 
+    WT_RECOVERY *recovery; /* Recovery state, set while the log is replayed */
+
     /* Record the important timestamps of each stage in shutdown. */
     struct __wt_shutdown_timeline {
         uint64_t rts_ms;
@@ -572,9 +583,12 @@ struct __wt_connection_impl {
     uint64_t prefetch_queue_count;
     /* Queue of refs to pre-fetch from */
     TAILQ_HEAD(__wt_pf_qh, __wt_prefetch_queue_entry) pfqh; /* Locked: prefetch_lock */
+    uint32_t prefetch_async_depth; /* Asynchronous reads in flight per pre-fetch thread */
     bool prefetch_auto_on;
     bool prefetch_available;
 
+    WT_REC_WRITE_PIPELINE rec_pipeline; /* Reconciliation write pipeline */
+
 #define WT_STATLOG_FILENAME "WiredTigerStat.%d.%H"
     WT_SESSION_IMPL *stat_session; /* Statistics log session */
     wt_thread_t stat_tid;          /* Statistics log thread */
@@ -655,6 +669,7 @@ struct __wt_connection_impl {
 
     /* Generations manager */
     wt_shared volatile uint64_t generations[WT_GENERATIONS];
+    wt_shared uint64_t generations_oldest[WT_GENERATIONS]; /* Oldest generations last found */
     uint64_t gen_drain_timeout_ms; /* Maximum waiting time for a resource to drain in diagnostic
                                       mode before timing out */
 
@@ -664,7 +679,9 @@ struct __wt_connection_impl {
 #define WT_FILE_TYPE_DATA 0x1ull /* Data files */
 #define WT_FILE_TYPE_LOG 0x2ull  /* Log files */
                                  /* AUTOMATIC FLAG VALUE GENERATION STOP 64 */
+    uint64_t direct_io;          /* O_DIRECT */
     uint64_t write_through;      /* FILE_FLAG_WRITE_THROUGH */
+    size_t buffer_alignment;     /* Direct I/O buffer alignment */
 
     bool mmap;     /* use mmap when reading checkpoints */
     bool mmap_all; /* use mmap for all I/O on data files */
@@ -16,7 +16,7 @@
  */
 #define WT_CURSOR_STATIC_INIT(n, get_key, get_value, get_raw_key_value, set_key, set_value,      \
   compare, equals, next, prev, reset, search, search_near, insert, modify, update, remove,       \
-  reserve, reconfigure, largest_key, bound, cache, reopen, checkpoint_id, close)                 \
+  reserve, reconfigure, largest_key, bound, search_batch, cache, reopen, checkpoint_id, close)   \
     static const WT_CURSOR n = {                                                                 \
       NULL, /* session */                                                                        \
       NULL, /* uri */                                                                            \
@@ -24,7 +24,7 @@
       NULL, /* value_format */                                                                   \
       get_key, get_value, get_raw_key_value, set_key, set_value, compare, equals, next, prev,    \
       reset, search, search_near, insert, modify, update, remove, reserve, checkpoint_id, close, \
-      largest_key, reconfigure, bound, cache, reopen, 0, /* uri_hash */                          \
+      largest_key, reconfigure, bound, search_batch, cache, reopen, 0, /* uri_hash */            \
       {NULL, NULL},                                      /* TAILQ_ENTRY q */                     \
       0,                                                 /* recno key */                         \
       {0},                                               /* recno raw buffer */                  \
@@ -216,6 +216,15 @@ struct __wt_cursor_btree {
     /* An intermediate structure to hold the update value to be assigned to the cursor buffer. */
     WT_UPDATE_VALUE *upd_value, _upd_value;
 
+    /* The values returned by the last WT_CURSOR.search_batch call, referenced by the caller. */
+    WT_ITEM batch_values;
+
+    /*
+     * Value bounds: cursor next and prev skip records whose values fall outside them, and leaf pages
+     * whose zone maps show they hold no value within them.
+     */
+    WT_ITEM value_lower, value_upper;
+
     /*
      * Bits used by checkpoint cursor: a private transaction, used to provide the proper read
      * snapshot; a reference to the corresponding history store checkpoint, which keeps it from
@@ -262,16 +271,20 @@ struct __wt_cursor_btree {
 #endif
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_CBT_ACTIVE 0x001u             /* Active in the tree */
-#define WT_CBT_CACHEABLE_RLE_CELL 0x002u /* Col-store: value in RLE cell valid for its keys */
-#define WT_CBT_ITERATE_APPEND 0x004u     /* Col-store: iterating append list */
-#define WT_CBT_ITERATE_NEXT 0x008u       /* Next iteration configuration */
-#define WT_CBT_ITERATE_PREV 0x010u       /* Prev iteration configuration */
-#define WT_CBT_ITERATE_RETRY_NEXT 0x020u /* Prepare conflict by next. */
-#define WT_CBT_ITERATE_RETRY_PREV 0x040u /* Prepare conflict by prev. */
-#define WT_CBT_READ_ONCE 0x080u          /* Page in with WT_READ_WONT_NEED */
-#define WT_CBT_SEARCH_SMALLEST 0x100u    /* Row-store: small-key insert list */
-#define WT_CBT_VAR_ONPAGE_MATCH 0x200u   /* Var-store: on-page recno match */
+#define WT_CBT_ACTIVE 0x0001u                /* Active in the tree */
+#define WT_CBT_CACHEABLE_RLE_CELL 0x0002u    /* Col-store: value in RLE cell valid for its keys */
+#define WT_CBT_ITERATE_APPEND 0x0004u        /* Col-store: iterating append list */
+#define WT_CBT_ITERATE_NEXT 0x0008u          /* Next iteration configuration */
+#define WT_CBT_ITERATE_PREV 0x0010u          /* Prev iteration configuration */
+#define WT_CBT_ITERATE_RETRY_NEXT 0x0020u    /* Prepare conflict by next. */
+#define WT_CBT_ITERATE_RETRY_PREV 0x0040u    /* Prepare conflict by prev. */
+#define WT_CBT_READ_ONCE 0x0080u             /* Page in with WT_READ_WONT_NEED */
+#define WT_CBT_SEARCH_SMALLEST 0x0100u       /* Row-store: small-key insert list */
+#define WT_CBT_VALUE_LOWER 0x0200u           /* Value lower bound set */
+#define WT_CBT_VALUE_LOWER_INCLUSIVE 0x0400u /* Value lower bound inclusive */
+#define WT_CBT_VALUE_UPPER 0x0800u           /* Value upper bound set */
+#define WT_CBT_VALUE_UPPER_INCLUSIVE 0x1000u /* Value upper bound inclusive */
+#define WT_CBT_VAR_ONPAGE_MATCH 0x2000u      /* Var-store: on-page recno match */
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
 
 #define WT_CBT_POSITION_MASK /* Flags associated with position */                      \
@@ -425,6 +438,10 @@ struct __wt_cursor_stat {
     const char **cfg; /* Original cursor configuration */
     char *desc_buf;   /* Saved description string */
 
+    int64_t *delta;     /* Delta cursors: statistics from the last refresh */
+    size_t delta_alloc; /* Allocated bytes */
+    int delta_count;    /* Count of saved statistics values */
+
     int key;    /* Current stats key */
     uint64_t v; /* Current stats value */
     WT_ITEM pv; /* Current stats value (string) */
@@ -453,6 +470,12 @@ struct __wt_cursor_table {
                           * overlapping set_value calls.
                           */
     WT_CURSOR **idx_cursors;
+
+    /*
+     * Column groups a projection doesn't reference: reads don't move them, they're only positioned
+     * for writes. NULL if the projection references every column group.
+     */
+    bool *cg_skip;
 };
 
 struct __wt_cursor_version {
@@ -8,6 +8,14 @@
 
 #pragma once
 
+/*
+ * WT_HAZARD_FILTER_BIT --
+ *   The bit representing a page in a session's hazard pointer summary, taken from the top
+ *   bits of a multiplicative hash of the WT_REF address.
+ */
+#define WT_HAZARD_FILTER_BIT(ref) \
+    ((uint64_t)1 << (((uint64_t)(uintptr_t)(ref) * 0x9e3779b97f4a7c15ULL) >> 58))
+
 /*
  * WT_HAZARD_COOKIE --
  *   State passed through to callbacks during the session walk logic when
@@ -15,6 +23,7 @@
  */
 struct __wt_hazard_cookie {
     WT_REF *search_ref;
+    uint64_t search_bit;
     WT_SESSION_IMPL **ret_session;
     WT_HAZARD *ret_hp;
     uint32_t walk_cnt;
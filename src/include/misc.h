@@ -97,6 +97,9 @@
 
 #define WT_ALIGN_NEAREST(n, v) ((((uintmax_t)(n)) + ((v) / 2)) & ~(((uintmax_t)(v)) - 1))
 
+/* Check if a pointer is aligned to a specified power-of-2, an alignment of 0 matches anything. */
+#define WT_PTR_ALIGNED(p, v) ((v) == 0 || ((uintptr_t)(p) & ((uintptr_t)(v)-1)) == 0)
+
 /* Min, max. */
 #define WT_MIN(a, b) ((a) < (b) ? (a) : (b))
 #define WT_MAX(a, b) ((a) < (b) ? (b) : (a))
@@ -120,6 +120,12 @@
         TAILQ_REMOVE(&(h)->fhhash[bucket], fh, hashq); \
     } while (0)
 
+/* The default alignment of I/O buffers when direct I/O is configured. */
+#define WT_BUFFER_ALIGNMENT_DEFAULT (4 * WT_KILOBYTE)
+
+/* The maximum number of NUMA nodes WiredTiger places memory on. */
+#define WT_NUMA_NODE_MAX 1024
+
 struct __wt_fh {
     /*
      * There is a file name field in both the WT_FH and WT_FILE_HANDLE structures, which isn't
@@ -137,6 +143,7 @@ struct __wt_fh {
     TAILQ_ENTRY(__wt_fh) hashq;          /* internal hash queue */
     u_int ref;                           /* reference count */
     WT_FS_OPEN_FILE_TYPE file_type;      /* file type */
+    bool direct_io;                      /* direct I/O requested */
 
     WT_FILE_HANDLE *handle;
 };
@@ -164,6 +171,8 @@ struct __wt_file_handle_posix {
      */
     int fd; /* POSIX file handle */
 
+    bool direct_io; /* O_DIRECT configured */
+
     /* The memory buffer and variables if we use mmap for I/O */
     uint8_t *mmap_buf;
     bool mmap_file_mappable;
@@ -210,3 +219,28 @@ struct __wt_fstream {
     int (*fstr_getline)(WT_SESSION_IMPL *, WT_FSTREAM *, WT_ITEM *);
     int (*fstr_printf)(WT_SESSION_IMPL *, WT_FSTREAM *, const char *, va_list);
 };
+
+/*
+ * WT_IO_URING --
+ *	An io_uring instance: submission and completion rings shared with the kernel. A ring is owned
+ * by a single thread, there is no locking.
+ */
+struct __wt_io_uring {
+    int fd;            /* Ring file descriptor */
+    uint32_t entries;  /* Submission queue size */
+    uint32_t pending;  /* Requests queued but not yet submitted */
+    uint32_t inflight; /* Requests submitted but not yet reaped */
+
+    /* Submission queue. */
+    void *sq_ring;
+    size_t sq_ring_size;
+    uint32_t *sq_head, *sq_tail, *sq_mask, *sq_array;
+    void *sqes; /* struct io_uring_sqe array */
+    size_t sqes_size;
+
+    /* Completion queue. */
+    void *cq_ring;
+    size_t cq_ring_size;
+    uint32_t *cq_head, *cq_tail, *cq_mask;
+    void *cqes; /* struct io_uring_cqe array */
+};
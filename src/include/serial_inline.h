@@ -169,7 +169,7 @@ __wt_col_append_serial(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *
 
     if (ret != 0) {
         /* Free unused memory on error. */
-        __wt_free(session, new_ins);
+        __wt_insert_free(session, &new_ins);
         return (ret);
     }
 
@@ -221,7 +221,7 @@ __wt_insert_serial(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_
 
     if (ret != 0) {
         /* Free unused memory on error. */
-        __wt_free(session, new_ins);
+        __wt_insert_free(session, &new_ins);
         return (ret);
     }
 
@@ -270,7 +270,7 @@ __wt_update_serial(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_PAGE *page
         if ((ret = __wt_txn_modify_check(
                session, cbt, upd->next = *srch_upd, &prev_upd_ts, upd->type)) != 0) {
             /* Free unused memory on error. */
-            __wt_free(session, upd);
+            __wt_upd_free(session, &upd);
             return (ret);
         }
     }
@@ -47,6 +47,14 @@ struct __wt_hazard_array {
                                  this many slots to find all active pointers */
     wt_shared uint32_t num_active; /* Number of array slots containing an active hazard pointer */
     uint32_t size;                 /* Allocated size of the array */
+
+    /*
+     * Summary of the pages referenced by the session's hazard pointers, one bit per hash of the
+     * WT_REF address. Bits are only added while the session holds hazard pointers and the summary
+     * is cleared when it releases the last one, so it may include pages no longer referenced, but
+     * never misses one that is. Eviction skips the session's array unless the page's bit is set.
+     */
+    wt_shared uint64_t filter;
 };
 
 /*
@@ -57,6 +65,13 @@ struct __wt_prefetch {
     WT_PAGE *prefetch_prev_ref_home;
     uint64_t prefetch_disk_read_count; /* Sequential cache requests that caused a leaf read */
     uint64_t prefetch_skipped_with_parent;
+
+    /* Asynchronous reads, used by pre-fetch threads only. */
+    WT_IO_URING *ring;
+    WT_PREFETCH_READ *reads;
+    uint32_t reads_count; /* Slots in the current batch */
+    uint32_t reads_ready; /* Images not yet consumed */
+    bool async_unsupported;
 };
 
 /*
@@ -171,6 +186,8 @@ struct __wt_session_impl {
     u_int scratch_alloc;      /* Currently allocated */
     size_t scratch_cached;    /* Scratch bytes cached */
     WT_SPINLOCK scratch_lock; /* Scratch buffer lock */
+
+    WT_UPDATE_POOL update_pool; /* Discarded updates kept for reuse */
 #ifdef HAVE_DIAGNOSTIC
 
     /* Enforce the contract that a session is only used by a single thread at a time. */
@@ -337,12 +354,13 @@ struct __wt_session_impl {
 
 /* Generations manager */
 #define WT_GEN_CHECKPOINT 0   /* Checkpoint generation */
-#define WT_GEN_EVICT 1        /* Eviction generation */
-#define WT_GEN_HAS_SNAPSHOT 2 /* Snapshot generation */
-#define WT_GEN_HAZARD 3       /* Hazard pointer */
-#define WT_GEN_SPLIT 4        /* Page splits */
-#define WT_GEN_TXN_COMMIT 5   /* Commit generation */
-#define WT_GENERATIONS 6      /* Total generation manager entries */
+#define WT_GEN_CHUNKCACHE 1   /* Chunk cache lookups */
+#define WT_GEN_EVICT 2        /* Eviction generation */
+#define WT_GEN_HAS_SNAPSHOT 3 /* Snapshot generation */
+#define WT_GEN_HAZARD 4       /* Hazard pointer */
+#define WT_GEN_SPLIT 5        /* Page splits */
+#define WT_GEN_TXN_COMMIT 6   /* Commit generation */
+#define WT_GENERATIONS 7      /* Total generation manager entries */
     wt_shared volatile uint64_t generations[WT_GENERATIONS];
 
     /*
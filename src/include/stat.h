@@ -89,14 +89,15 @@
 #define WT_SESSION_STATS_FIELD_TO_OFFSET(stats, fld) (int)(&(stats)->fld - (int64_t *)(stats))
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_STAT_CLEAR 0x01u
-#define WT_STAT_JSON 0x02u
-#define WT_STAT_ON_CLOSE 0x04u
-#define WT_STAT_TYPE_ALL 0x08u
-#define WT_STAT_TYPE_CACHE_WALK 0x10u
-#define WT_STAT_TYPE_FAST 0x20u
-#define WT_STAT_TYPE_SIZE 0x40u
-#define WT_STAT_TYPE_TREE_WALK 0x80u
+#define WT_STAT_CLEAR 0x001u
+#define WT_STAT_DELTA 0x002u
+#define WT_STAT_JSON 0x004u
+#define WT_STAT_ON_CLOSE 0x008u
+#define WT_STAT_TYPE_ALL 0x010u
+#define WT_STAT_TYPE_CACHE_WALK 0x020u
+#define WT_STAT_TYPE_FAST 0x040u
+#define WT_STAT_TYPE_SIZE 0x080u
+#define WT_STAT_TYPE_TREE_WALK 0x100u
 /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
 
 /*
@@ -142,6 +143,42 @@ __wt_stats_aggregate_dsrc(void *stats_arg, int slot)
     return (__wt_stats_aggregate_internal(stats_arg, slot, WT_STAT_DSRC_COUNTER_SLOTS));
 }
 
+/*
+ * Sum all of the values from all structures in the array, replacing the values in the target
+ * structure. When every value is wanted (for example, when a statistics cursor is opened), walking
+ * each structure in memory order is far cheaper than summing each value across the array in turn.
+ */
+static WT_INLINE void
+__wt_stats_aggregate_all_internal(void *stats_arg, int64_t *to, size_t count, u_int num_slots)
+{
+    int64_t **stats, *from;
+    size_t i;
+    u_int slot;
+
+    stats = (int64_t **)stats_arg;
+    memcpy(to, stats[0], count * sizeof(int64_t));
+    for (slot = 1; slot < num_slots; ++slot)
+        for (from = stats[slot], i = 0; i < count; ++i)
+            to[i] += from[i];
+
+    /* As for single values, limit our return to positive values. */
+    for (i = 0; i < count; ++i)
+        if (to[i] < 0)
+            to[i] = 0;
+}
+
+static WT_INLINE void
+__wt_stats_aggregate_all_conn(void *stats_arg, int64_t *to, size_t count)
+{
+    __wt_stats_aggregate_all_internal(stats_arg, to, count, WT_STAT_CONN_COUNTER_SLOTS);
+}
+
+static WT_INLINE void
+__wt_stats_aggregate_all_dsrc(void *stats_arg, int64_t *to, size_t count)
+{
+    __wt_stats_aggregate_all_internal(stats_arg, to, count, WT_STAT_DSRC_COUNTER_SLOTS);
+}
+
 /*
  * Clear the values in all structures in the array for connection statistics.
  */
@@ -440,6 +477,9 @@ struct __wt_connection_stats {
     int64_t block_cache_blocks_evicted;
     int64_t block_cache_bypass_filesize;
     int64_t block_cache_lookups;
+    int64_t block_cache_admission_sketch_resets;
+    int64_t block_cache_admission_accepted;
+    int64_t block_cache_admission_rejected;
     int64_t block_cache_not_evicted_overhead;
     int64_t block_cache_bypass_writealloc;
     int64_t block_cache_bypass_overhead_put;
@@ -457,6 +497,7 @@ struct __wt_connection_stats {
     int64_t block_cache_bytes;
     int64_t block_cache_bytes_insert_read;
     int64_t block_cache_bytes_insert_write;
+    int64_t block_write_aligned_copy;
     int64_t block_preload;
     int64_t block_read;
     int64_t block_write;
@@ -483,14 +524,20 @@ struct __wt_connection_stats {
     int64_t cache_bytes_inuse;
     int64_t cache_bytes_dirty_total;
     int64_t cache_bytes_other;
+    int64_t cache_update_pool_bytes;
     int64_t cache_bytes_read;
     int64_t cache_bytes_write;
+    int64_t cache_arena_hugepages;
+    int64_t cache_arena_bytes_inuse;
+    int64_t cache_arena_bytes;
+    int64_t cache_arena_bytes_fragmented;
     int64_t cache_eviction_blocked_checkpoint;
     int64_t cache_eviction_blocked_checkpoint_hs;
     int64_t eviction_server_evict_attempt;
     int64_t eviction_worker_evict_attempt;
     int64_t eviction_server_evict_fail;
     int64_t eviction_worker_evict_fail;
+    int64_t eviction_get_ref_steal;
     int64_t eviction_get_ref_empty;
     int64_t eviction_get_ref_empty2;
     int64_t eviction_aggressive_set;
@@ -600,8 +647,12 @@ struct __wt_connection_stats {
     int64_t eviction_timed_out_ops;
     int64_t cache_eviction_blocked_overflow_keys;
     int64_t cache_read_overflow;
+    int64_t cache_page_arena_chunk;
     int64_t eviction_app_attempt;
     int64_t eviction_app_fail;
+    int64_t cache_arena_alloc_remote;
+    int64_t cache_arena_alloc;
+    int64_t cache_arena_alloc_fallback;
     int64_t cache_eviction_deepen;
     int64_t cache_write_hs;
     int64_t eviction_consider_prefetch;
@@ -644,6 +695,9 @@ struct __wt_connection_stats {
     int64_t cache_pages_dirty;
     int64_t cache_eviction_blocked_uncommitted_truncate;
     int64_t cache_eviction_clean;
+    int64_t cache_update_pool_alloc;
+    int64_t cache_update_pool_alloc_reuse;
+    int64_t cache_update_pool_refill;
     int64_t fsync_all_fh_total;
     int64_t fsync_all_fh;
     int64_t fsync_all_time;
@@ -730,10 +784,12 @@ struct __wt_connection_stats {
     int64_t chunkcache_retries;
     int64_t chunkcache_retries_checksum_mismatch;
     int64_t chunkcache_toomany_retries;
+    int64_t chunkcache_bytes_warmed_up;
     int64_t chunkcache_bytes_read_persistent;
     int64_t chunkcache_bytes_inuse;
     int64_t chunkcache_bytes_inuse_pinned;
     int64_t chunkcache_chunks_inuse;
+    int64_t chunkcache_chunks_warmed_up;
     int64_t chunkcache_created_from_metadata;
     int64_t chunkcache_chunks_pinned;
     int64_t cond_auto_wait_reset;
@@ -760,6 +816,9 @@ struct __wt_connection_stats {
     int64_t cursor_skip_hs_cur_position;
     int64_t cursor_tree_walk_inmem_del_page_skip;
     int64_t cursor_tree_walk_ondisk_del_page_skip;
+    int64_t cursor_tree_walk_zone_page_skip;
+    int64_t cursor_search_ahi_miss;
+    int64_t cursor_search_ahi_hit;
     int64_t cursor_search_near_prefix_fast_paths;
     int64_t cursor_reposition_failed;
     int64_t cursor_reposition;
@@ -813,6 +872,8 @@ struct __wt_connection_stats {
     int64_t cursor_reserve_error;
     int64_t cursor_reset;
     int64_t cursor_reset_error;
+    int64_t cursor_search_batch;
+    int64_t cursor_search_batch_error;
     int64_t cursor_search;
     int64_t cursor_search_error;
     int64_t cursor_search_hs;
@@ -874,6 +935,11 @@ struct __wt_connection_stats {
     int64_t lock_txn_global_write_count;
     int64_t log_slot_switch_busy;
     int64_t log_force_remove_sleep;
+    int64_t log_group_commit_window;
+    int64_t log_group_commit;
+    int64_t log_group_commit_full;
+    int64_t log_group_commit_joined;
+    int64_t log_group_commit_wait;
     int64_t log_bytes_payload;
     int64_t log_bytes_written;
     int64_t log_zero_fills;
@@ -951,6 +1017,10 @@ struct __wt_connection_stats {
     int64_t prefetch_skipped_internal_page;
     int64_t prefetch_skipped_no_flag_set;
     int64_t prefetch_failed_start;
+    int64_t prefetch_async_read_submitted;
+    int64_t prefetch_async_read_failed;
+    int64_t prefetch_async_read_used;
+    int64_t prefetch_async_read_batches;
     int64_t prefetch_skipped_same_ref;
     int64_t prefetch_disk_one;
     int64_t prefetch_skipped_no_valid_dhandle;
@@ -1111,6 +1181,7 @@ struct __wt_connection_stats {
     int64_t txn_pinned_timestamp_oldest;
     int64_t txn_timestamp_oldest_active_read;
     int64_t txn_rollback_to_stable_running;
+    int64_t txn_snapshot_reused;
     int64_t txn_walk_sessions;
     int64_t txn_commit;
     int64_t txn_rollback;
@@ -1128,7 +1199,9 @@ struct __wt_dsrc_stats {
     int64_t backup_blocks_uncompressed;
     int64_t block_extension;
     int64_t block_alloc;
+    int64_t block_arena_alloc;
     int64_t block_free;
+    int64_t block_arena_free;
     int64_t block_checkpoint_size;
     int64_t allocation_size;
     int64_t block_reuse_bytes;
@@ -1211,6 +1284,7 @@ struct __wt_dsrc_stats {
     int64_t cache_eviction_blocked_multi_block_reconciliation_during_checkpoint;
     int64_t cache_eviction_blocked_overflow_keys;
     int64_t cache_read_overflow;
+    int64_t cache_page_arena_chunk;
     int64_t cache_eviction_deepen;
     int64_t cache_write_hs;
     int64_t cache_eviction_dirty_obsolete_tw;
@@ -1289,6 +1363,9 @@ struct __wt_dsrc_stats {
     int64_t cursor_skip_hs_cur_position;
     int64_t cursor_tree_walk_inmem_del_page_skip;
     int64_t cursor_tree_walk_ondisk_del_page_skip;
+    int64_t cursor_tree_walk_zone_page_skip;
+    int64_t cursor_search_ahi_miss;
+    int64_t cursor_search_ahi_hit;
     int64_t cursor_search_near_prefix_fast_paths;
     int64_t cursor_reposition_failed;
     int64_t cursor_reposition;
@@ -1329,6 +1406,7 @@ struct __wt_dsrc_stats {
     int64_t cursor_reopen_error;
     int64_t cursor_reserve_error;
     int64_t cursor_reset_error;
+    int64_t cursor_search_batch_error;
     int64_t cursor_search_error;
     int64_t cursor_search_near_error;
     int64_t cursor_update_error;
@@ -1345,6 +1423,7 @@ struct __wt_dsrc_stats {
     int64_t cursor_remove_bytes;
     int64_t cursor_reserve;
     int64_t cursor_reset;
+    int64_t cursor_search_batch;
     int64_t cursor_search;
     int64_t cursor_search_hs;
     int64_t cursor_search_near;
@@ -188,6 +188,20 @@ struct __wt_txn_global {
     wt_shared volatile uint64_t metadata_pinned; /* Oldest ID for metadata */
 
     WT_TXN_SHARED *txn_shared_list; /* Per-session shared transaction states */
+
+    /*
+     * The concurrent transaction IDs found by the last walk of the shared transaction states, kept
+     * so transactions without an ID can reuse them instead of walking every session. The walk stays
+     * valid until a transaction commits updates, which starts a new snapshot generation. Readers
+     * copy it without locking and retry or walk if the sequence number was odd or changed.
+     */
+    WT_SPINLOCK snapshot_cache_lock;                /* Serialize publishing */
+    wt_shared volatile uint64_t snapshot_cache_seq; /* Sequence number, odd while updating */
+    wt_shared uint64_t snapshot_cache_gen;          /* Snapshot generation of the walk */
+    wt_shared uint64_t snapshot_cache_max;          /* Current ID when walked */
+    wt_shared uint64_t snapshot_cache_pinned;       /* Pinned ID of the walk */
+    wt_shared uint32_t snapshot_cache_count;        /* Number of concurrent IDs */
+    wt_shared uint64_t *snapshot_cache;             /* Concurrent IDs */
 };
 
 typedef enum __wt_txn_isolation {
@@ -394,3 +408,67 @@ struct __wt_txn {
      */
     uint64_t __snapshot[];
 };
+
+/*
+ * WT_RECOVERY_FILE --
+ *	A file being recovered.
+ */
+struct __wt_recovery_file {
+    const char *uri; /* File URI. */
+    WT_CURSOR *c;    /* Cursor used for recovery. */
+    WT_LSN ckpt_lsn; /* File's checkpoint LSN. */
+};
+
+/*
+ * WT_RECOVERY_WORKER --
+ *	A recovery thread's queue of batches of log operations to apply. The log reader fills the
+ *	pending batch and swaps it into the queue when it's full; the recovery thread applies queued
+ *	batches in order and returns their buffers to the queue for reuse.
+ */
+#define WT_RECOVERY_BATCH_SIZE (64 * WT_KILOBYTE)
+#define WT_RECOVERY_QUEUE_SIZE 8
+struct __wt_recovery_worker {
+    WT_SPINLOCK lock;                      /* Queue lock */
+    WT_ITEM queue[WT_RECOVERY_QUEUE_SIZE]; /* Batches of operations */
+    wt_shared uint64_t head;               /* Next batch to apply */
+    wt_shared uint64_t tail;               /* Next free slot */
+
+    WT_ITEM pending;   /* Batch being filled by the log reader */
+    wt_shared int ret; /* First error applying operations */
+};
+
+/*
+ * WT_RECOVERY --
+ *	State maintained during recovery.
+ */
+#define WT_RECOVERY_MAX_WORKERS 10
+struct __wt_recovery {
+    WT_SESSION_IMPL *session;
+
+    /* Files from the metadata, indexed by file ID. */
+    WT_RECOVERY_FILE *files;
+    size_t file_alloc; /* Allocated size of files array. */
+    u_int max_fileid;  /* Maximum file ID seen. */
+    u_int nfiles;      /* Number of files in the metadata. */
+
+    WT_LSN ckpt_lsn;     /* Start LSN for main recovery loop. */
+    WT_LSN max_ckpt_lsn; /* Maximum checkpoint LSN seen. */
+    WT_LSN max_rec_lsn;  /* Maximum recovery LSN seen. */
+
+    bool backup_only;   /* Set to only recover backup. */
+    bool missing;       /* Were there missing files? */
+    bool metadata_only; /*
+                         * Set during the first recovery pass,
+                         * when only the metadata is recovered.
+                         */
+
+    /*
+     * Operations on files are applied by a group of threads while the main recovery pass reads
+     * the log, each file's operations are applied in log order by the same thread.
+     */
+    WT_THREAD_GROUP thread_group;
+    WT_RECOVERY_WORKER *workers;
+    uint32_t workers_num;
+    WT_CONDVAR *workers_cond; /* Signalled as recovery threads free queue slots */
+    wt_shared bool workers_run;
+};
@@ -1330,6 +1330,100 @@ __wt_upd_alloc_tombstone(WT_SESSION_IMPL *session, WT_UPDATE **updp, size_t *siz
     return (__wt_upd_alloc(session, NULL, WT_UPDATE_TOMBSTONE, updp, sizep));
 }
 
+/*
+ * __wt_upd_alloc_pool --
+ *     Allocate a WT_UPDATE structure and associated value from the session's update pool, if update
+ *     pools are configured and the update is small enough, and fill it in.
+ */
+static WT_INLINE int
+__wt_upd_alloc_pool(WT_SESSION_IMPL *session, const WT_ITEM *value, u_int modify_type,
+  WT_UPDATE **updp, size_t *sizep)
+{
+    WT_UPDATE *upd;
+    size_t allocsz;
+
+    if (value == NULL || value->size == 0)
+        allocsz = WT_UPDATE_SIZE_NOVALUE;
+    else
+        allocsz = WT_UPDATE_SIZE + value->size;
+    if (S2C(session)->update_pool_session_max == 0 || allocsz > WT_UPDATE_POOL_MAX)
+        return (__wt_upd_alloc(session, value, modify_type, updp, sizep));
+
+    *updp = NULL;
+    WT_ASSERT(session, modify_type != WT_UPDATE_INVALID);
+
+    WT_RET(__wt_update_pool_alloc(session, allocsz, &upd));
+    if (value != NULL && value->size != 0) {
+        upd->size = WT_STORE_SIZE(value->size);
+        memcpy(upd->data, value->data, value->size);
+    }
+    upd->type = (uint8_t)modify_type;
+
+    *updp = upd;
+    if (sizep != NULL)
+        *sizep = WT_UPDATE_MEMSIZE(upd);
+    return (0);
+}
+
+/*
+ * __wt_upd_alloc_arena --
+ *     Allocate the WT_UPDATE structure of a key being inserted into a page, from the page's arena
+ *     if the tree allocates inserts from page arenas and the update is small. Later updates of the
+ *     key are allocated individually, so obsolete versions of frequently updated keys are freed as
+ *     they're discarded, rather than with the page.
+ */
+static WT_INLINE int
+__wt_upd_alloc_arena(WT_SESSION_IMPL *session, WT_PAGE *page, const WT_ITEM *value,
+  u_int modify_type, WT_UPDATE **updp, size_t *sizep)
+{
+    WT_UPDATE *upd;
+    size_t allocsz;
+
+    if (value == NULL || value->size == 0)
+        allocsz = WT_UPDATE_SIZE_NOVALUE;
+    else
+        allocsz = WT_UPDATE_SIZE + value->size;
+    if (!S2BT(session)->page_arena || allocsz > WT_PAGE_ARENA_UPDATE_MAX)
+        return (__wt_upd_alloc_pool(session, value, modify_type, updp, sizep));
+
+    *updp = NULL;
+    WT_ASSERT(session, modify_type != WT_UPDATE_INVALID);
+
+    WT_RET(__wt_page_arena_alloc(session, page, allocsz, &upd));
+    if (value != NULL && value->size != 0) {
+        upd->size = WT_STORE_SIZE(value->size);
+        memcpy(upd->data, value->data, value->size);
+    }
+    upd->type = (uint8_t)modify_type;
+    upd->alloc = WT_UPDATE_ALLOC_ARENA;
+
+    /* The arena's memory is charged to the page as the arena grows. */
+    *updp = upd;
+    if (sizep != NULL)
+        *sizep = 0;
+    return (0);
+}
+
+/*
+ * __wt_upd_free --
+ *     Free a WT_UPDATE structure: return it to the session's update pool if it was allocated from
+ *     one, leave it to be freed with its page arena if it was allocated from one.
+ */
+static WT_INLINE void
+__wt_upd_free(WT_SESSION_IMPL *session, WT_UPDATE **updp)
+{
+    WT_UPDATE *upd;
+
+    if ((upd = *updp) == NULL)
+        return;
+    *updp = NULL;
+
+    if (upd->alloc >= WT_UPDATE_ALLOC_POOL)
+        __wt_update_pool_free(session, upd);
+    else if (upd->alloc != WT_UPDATE_ALLOC_ARENA)
+        __wt_free(session, upd);
+}
+
 /*
  * __wt_txn_read_upd_list_internal --
  *     Internal helper function to get the first visible update in a list (or NULL if none are
@@ -69,6 +69,10 @@ struct __wt_addr;
 typedef struct __wt_addr WT_ADDR;
 struct __wt_addr_copy;
 typedef struct __wt_addr_copy WT_ADDR_COPY;
+struct __wt_addr_zone;
+typedef struct __wt_addr_zone WT_ADDR_ZONE;
+struct __wt_ahi_entry;
+typedef struct __wt_ahi_entry WT_AHI_ENTRY;
 struct __wt_background_compact;
 typedef struct __wt_background_compact WT_BACKGROUND_COMPACT;
 struct __wt_background_compact_exclude;
@@ -85,6 +89,8 @@ struct __wt_blkincr;
 typedef struct __wt_blkincr WT_BLKINCR;
 struct __wt_block;
 typedef struct __wt_block WT_BLOCK;
+struct __wt_block_arena;
+typedef struct __wt_block_arena WT_BLOCK_ARENA;
 struct __wt_block_ckpt;
 typedef struct __wt_block_ckpt WT_BLOCK_CKPT;
 struct __wt_block_desc;
@@ -103,6 +109,12 @@ struct __wt_bucket_storage;
 typedef struct __wt_bucket_storage WT_BUCKET_STORAGE;
 struct __wt_cache;
 typedef struct __wt_cache WT_CACHE;
+struct __wt_cache_arena;
+typedef struct __wt_cache_arena WT_CACHE_ARENA;
+struct __wt_cache_arena_node;
+typedef struct __wt_cache_arena_node WT_CACHE_ARENA_NODE;
+struct __wt_cache_arena_slab;
+typedef struct __wt_cache_arena_slab WT_CACHE_ARENA_SLAB;
 struct __wt_cache_pool;
 typedef struct __wt_cache_pool WT_CACHE_POOL;
 struct __wt_capacity;
@@ -139,6 +151,8 @@ struct __wt_ckpt_connection;
 typedef struct __wt_ckpt_connection WT_CKPT_CONNECTION;
 struct __wt_ckpt_handle_stats;
 typedef struct __wt_ckpt_handle_stats WT_CKPT_HANDLE_STATS;
+struct __wt_ckpt_leaf;
+typedef struct __wt_ckpt_leaf WT_CKPT_LEAF;
 struct __wt_ckpt_session;
 typedef struct __wt_ckpt_session WT_CKPT_SESSION;
 struct __wt_ckpt_snapshot;
@@ -229,6 +243,8 @@ struct __wt_evict_entry;
 typedef struct __wt_evict_entry WT_EVICT_ENTRY;
 struct __wt_evict_queue;
 typedef struct __wt_evict_queue WT_EVICT_QUEUE;
+struct __wt_evict_shard;
+typedef struct __wt_evict_shard WT_EVICT_SHARD;
 struct __wt_evict_timeline;
 typedef struct __wt_evict_timeline WT_EVICT_TIMELINE;
 struct __wt_ext;
@@ -269,6 +285,8 @@ struct __wt_insert;
 typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
 typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_io_uring;
+typedef struct __wt_io_uring WT_IO_URING;
 struct __wt_json;
 typedef struct __wt_json WT_JSON;
 struct __wt_keyed_encryptor;
@@ -323,6 +341,10 @@ struct __wt_ovfl_track;
 typedef struct __wt_ovfl_track WT_OVFL_TRACK;
 struct __wt_page;
 typedef struct __wt_page WT_PAGE;
+struct __wt_page_arena;
+typedef struct __wt_page_arena WT_PAGE_ARENA;
+struct __wt_page_arena_chunk;
+typedef struct __wt_page_arena_chunk WT_PAGE_ARENA_CHUNK;
 struct __wt_page_deleted;
 typedef struct __wt_page_deleted WT_PAGE_DELETED;
 struct __wt_page_header;
@@ -337,6 +359,8 @@ struct __wt_prefetch;
 typedef struct __wt_prefetch WT_PREFETCH;
 struct __wt_prefetch_queue_entry;
 typedef struct __wt_prefetch_queue_entry WT_PREFETCH_QUEUE_ENTRY;
+struct __wt_prefetch_read;
+typedef struct __wt_prefetch_read WT_PREFETCH_READ;
 struct __wt_process;
 typedef struct __wt_process WT_PROCESS;
 struct __wt_rec_chunk;
@@ -345,12 +369,22 @@ struct __wt_rec_dictionary;
 typedef struct __wt_rec_dictionary WT_REC_DICTIONARY;
 struct __wt_rec_kv;
 typedef struct __wt_rec_kv WT_REC_KV;
+struct __wt_rec_write_job;
+typedef struct __wt_rec_write_job WT_REC_WRITE_JOB;
+struct __wt_rec_write_pipeline;
+typedef struct __wt_rec_write_pipeline WT_REC_WRITE_PIPELINE;
 struct __wt_reconcile;
 typedef struct __wt_reconcile WT_RECONCILE;
 struct __wt_reconcile_timeline;
 typedef struct __wt_reconcile_timeline WT_RECONCILE_TIMELINE;
+struct __wt_recovery;
+typedef struct __wt_recovery WT_RECOVERY;
+struct __wt_recovery_file;
+typedef struct __wt_recovery_file WT_RECOVERY_FILE;
 struct __wt_recovery_timeline;
 typedef struct __wt_recovery_timeline WT_RECOVERY_TIMELINE;
+struct __wt_recovery_worker;
+typedef struct __wt_recovery_worker WT_RECOVERY_WORKER;
 struct __wt_ref;
 typedef struct __wt_ref WT_REF;
 struct __wt_ref_hist;
@@ -359,6 +393,8 @@ struct __wt_rollback_to_stable;
 typedef struct __wt_rollback_to_stable WT_ROLLBACK_TO_STABLE;
 struct __wt_row;
 typedef struct __wt_row WT_ROW;
+struct __wt_row_keydir;
+typedef struct __wt_row_keydir WT_ROW_KEYDIR;
 struct __wt_rts_cookie;
 typedef struct __wt_rts_cookie WT_RTS_COOKIE;
 struct __wt_rts_work_unit;
@@ -427,6 +463,8 @@ struct __wt_txn_snapshot;
 typedef struct __wt_txn_snapshot WT_TXN_SNAPSHOT;
 struct __wt_update;
 typedef struct __wt_update WT_UPDATE;
+struct __wt_update_pool;
+typedef struct __wt_update_pool WT_UPDATE_POOL;
 struct __wt_update_value;
 typedef struct __wt_update_value WT_UPDATE_VALUE;
 struct __wt_update_vector;
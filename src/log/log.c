@@ -283,6 +283,12 @@ __log_fsync_file(WT_SESSION_IMPL *session, WT_LSN *min_lsn, const char *method,
         WT_ERR(__wt_fsync(session, log_fh, true));
         time_stop = __wt_clock(session);
         fsync_duration_usecs = WT_CLOCKDIFF_US(time_stop, time_start);
+        /*
+         * Keep a moving average of the sync time, group commit sizes its wait from it. Round up so
+         * short syncs don't truncate the average to zero.
+         */
+        __wt_atomic_store64(&log->sync_usecs,
+          (__wt_atomic_load64(&log->sync_usecs) * 7 + fsync_duration_usecs + 7) / 8);
         WT_ASSIGN_LSN(&log->sync_lsn, min_lsn);
         WT_STAT_CONN_INCR(session, log_sync);
         WT_STAT_CONN_INCRV(session, log_sync_duration, fsync_duration_usecs);
@@ -2604,11 +2610,12 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
     WT_MYSLOT myslot;
     int64_t release_size;
     uint32_t fill_size, force, rdup_len;
-    bool free_slot;
+    bool free_slot, group_sync, switch_slot;
 
     conn = S2C(session);
     log_mgr = &conn->log_mgr;
     log = log_mgr->log;
+    group_sync = false;
     if (record->size > UINT32_MAX)
         WT_RET_MSG(session, EFBIG,
           "Log record size of %" WT_SIZET_FMT " exceeds the maximum supported size of %" PRIu32,
@@ -2673,6 +2680,15 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
 
     WT_STAT_CONN_INCR(session, log_writes);
 
+    /*
+     * Count synchronous commits in progress, a group commit leader only waits for others to join
+     * its slot if there are some.
+     */
+    if (log_mgr->group_commit && LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC)) {
+        group_sync = true;
+        (void)__wt_atomic_add32(&log->group_sync_active, 1);
+    }
+
     /*
      * The only time joining a slot should ever return an error is if it detects a panic.
      */
@@ -2683,7 +2699,20 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
      */
     force = LF_ISSET(WT_LOG_FLUSH | WT_LOG_FSYNC);
     ret = 0;
-    if (myslot.end_offset >= WT_LOG_SLOT_BUF_MAX || F_ISSET(&myslot, WT_MYSLOT_UNBUFFERED) || force)
+    switch_slot =
+      myslot.end_offset >= WT_LOG_SLOT_BUF_MAX || F_ISSET(&myslot, WT_MYSLOT_UNBUFFERED);
+
+    /*
+     * With group commit, the leader of the group waits for other synchronous commits to join the
+     * slot before forcing it out. The other members of the group don't force the slot, they wait
+     * for the leader's write and sync.
+     */
+    if (F_ISSET(&myslot, WT_MYSLOT_GROUP_LEADER) && !switch_slot)
+        __wti_log_slot_group_wait(session, &myslot);
+    else if (F_ISSET(&myslot, WT_MYSLOT_GROUP_FOLLOWER))
+        force = 0;
+
+    if (switch_slot || force)
         ret = __wti_log_slot_switch(session, &myslot, true, false, NULL);
     if (ret == 0)
         ret = __wti_log_fill(session, &myslot, false, record, &lsn);
@@ -2724,6 +2753,8 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
     }
 
 err:
+    if (group_sync)
+        (void)__wt_atomic_sub32(&log->group_sync_active, 1);
     if (ret == 0 && lsnp != NULL)
         WT_ASSIGN_LSN(lsnp, &lsn);
     /*
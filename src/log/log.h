@@ -138,12 +138,17 @@ struct __wt_log_manager {
 
     WT_COMPRESSOR *compressor; /* configuration : Logging compressor */
 
-    wt_off_t dirty_max;             /* configuration : Log dirty system cache max size */
-    wt_off_t extend_len;            /* configuration : file_extend log length */
-    wt_off_t file_max;              /* configuration : Log file max size */
-    uint32_t force_write_wait;      /* configuration : Log force write wait */
-    const char *log_path;           /* configuration : Logging path format */
-    wt_shared uint32_t txn_logsync; /* configuration : Log sync */
+    wt_off_t dirty_max;                   /* configuration : Log dirty system cache max size */
+    wt_off_t extend_len;                  /* configuration : file_extend log length */
+    wt_off_t file_max;                    /* configuration : Log file max size */
+    uint32_t force_write_wait;            /* configuration : Log force write wait */
+    wt_shared bool group_commit;          /* configuration : Group commit enabled */
+    wt_shared uint64_t group_max_bytes;   /* configuration : Group commit size limit */
+    wt_shared uint32_t group_max_commits; /* configuration : Group commit count limit */
+    wt_shared uint64_t group_max_wait;    /* configuration : Group commit wait limit (usecs) */
+    const char *log_path;                 /* configuration : Logging path format */
+    uint32_t recover_threads;             /* configuration : Recovery apply threads */
+    wt_shared uint32_t txn_logsync;       /* configuration : Log sync */
 
     wt_shared uint32_t cursors;   /* Private : Log cursor count */
     uint32_t prealloc;            /* Private : Log file pre-allocation */
@@ -326,6 +326,15 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
     if (cval.val != 0)
         log_mgr->force_write_wait = (uint32_t)cval.val;
 
+    WT_RET(__wt_config_gets(session, cfg, "log.group_commit.enabled", &cval));
+    log_mgr->group_commit = cval.val != 0;
+    WT_RET(__wt_config_gets(session, cfg, "log.group_commit.max_bytes", &cval));
+    log_mgr->group_max_bytes = (uint64_t)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "log.group_commit.max_commits", &cval));
+    log_mgr->group_max_commits = (uint32_t)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "log.group_commit.max_wait", &cval));
+    log_mgr->group_max_wait = (uint64_t)cval.val;
+
     /*
      * Note it's meaningless to reconfigure this value during runtime, it only matters on create
      * before recovery runs.
@@ -336,6 +345,9 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
         WT_RET(__wt_config_gets_def(session, cfg, "log.recover", 0, &cval));
         if (WT_CONFIG_LIT_MATCH("error", cval))
             F_SET(&conn->log_mgr, WT_LOG_RECOVER_ERR);
+
+        WT_RET(__wt_config_gets(session, cfg, "log.recover_threads", &cval));
+        log_mgr->recover_threads = (uint32_t)cval.val;
     }
 
     WT_RET(__wt_config_gets(session, cfg, "log.zero_fill", &cval));
@@ -123,6 +123,7 @@ struct __wt_logslot {
     wt_shared volatile int64_t slot_state; /* Slot state */
     wt_shared int64_t slot_unbuffered;     /* Unbuffered data in this slot */
     wt_shared int slot_error;              /* Error value */
+    wt_shared uint32_t slot_group_count;   /* Synchronous commits joined */
     wt_shared wt_off_t slot_start_offset;  /* Starting file offset */
     wt_shared wt_off_t slot_last_offset;   /* Last record offset */
     WT_LSN slot_release_lsn;               /* Slot release LSN */
@@ -163,9 +164,11 @@ struct __wt_myslot {
     wt_off_t offset;     /* Slot buffer offset */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_MYSLOT_CLOSE 0x1u         /* This thread is closing the slot */
-#define WT_MYSLOT_NEEDS_RELEASE 0x2u /* This thread is releasing the slot */
-#define WT_MYSLOT_UNBUFFERED 0x4u    /* Write directly */
+#define WT_MYSLOT_CLOSE 0x01u         /* This thread is closing the slot */
+#define WT_MYSLOT_GROUP_FOLLOWER 0x02u /* Another thread leads our group commit */
+#define WT_MYSLOT_GROUP_LEADER 0x04u   /* This thread leads a group commit */
+#define WT_MYSLOT_NEEDS_RELEASE 0x08u /* This thread is releasing the slot */
+#define WT_MYSLOT_UNBUFFERED 0x10u    /* Write directly */
                                      /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 };
@@ -238,6 +241,13 @@ struct __wt_log {
     uint64_t write_calls; /* Calls to log_write */
 #endif
 
+    /*
+     * Group commit information
+     */
+    wt_shared uint32_t group_sync_active; /* Synchronous commits in progress */
+    wt_shared uint64_t group_window;      /* Current group commit wait (usecs) */
+    wt_shared uint64_t sync_usecs;        /* Moving average of log file sync time (usecs) */
+
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_LOG_FORCE_NEWFILE 0x1u   /* Force switch to new log file */
 #define WT_LOG_OPENED 0x2u          /* Log subsystem successfully open */
@@ -327,6 +337,7 @@ extern int64_t __wti_log_slot_release(WT_MYSLOT *myslot, int64_t size)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern void __wti_log_slot_activate(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
 extern void __wti_log_slot_free(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
+extern void __wti_log_slot_group_wait(WT_SESSION_IMPL *session, WT_MYSLOT *myslot);
 extern void __wti_log_slot_join(
   WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT_MYSLOT *myslot);
 extern void __wti_log_wrlsn(WT_SESSION_IMPL *session, int *yield);
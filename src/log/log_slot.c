@@ -77,6 +77,7 @@ __wti_log_slot_activate(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
     __wt_atomic_storei64(&slot->slot_last_offset, __wt_lsn_offset(&log->alloc_lsn));
     slot->slot_fh = log->log_fh;
     __wt_atomic_storei32(&slot->slot_error, 0);
+    __wt_atomic_store32(&slot->slot_group_count, 0);
     WT_DIAGNOSTIC_YIELD;
     /*
      * Set the slot state last. Other threads may have a stale pointer to this slot and could try to
@@ -628,6 +629,16 @@ __wti_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, W
         F_SET_ATOMIC_16(slot, WT_SLOT_FLUSH);
     if (LF_ISSET(WT_LOG_FSYNC))
         F_SET_ATOMIC_16(slot, WT_SLOT_SYNC);
+    /*
+     * With group commit, the first synchronous commit to join the slot leads the group: it holds
+     * the slot open and forces it out, the others rely on it.
+     */
+    if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC) && conn->log_mgr.group_commit) {
+        if (__wt_atomic_add32(&slot->slot_group_count, 1) == 1)
+            F_SET(myslot, WT_MYSLOT_GROUP_LEADER);
+        else
+            F_SET(myslot, WT_MYSLOT_GROUP_FOLLOWER);
+    }
     if (F_ISSET(myslot, WT_MYSLOT_UNBUFFERED)) {
         WT_ASSERT(session, __wt_atomic_loadi64(&slot->slot_unbuffered) == 0);
         WT_STAT_CONN_INCR(session, log_slot_unbuffered);
@@ -638,6 +649,83 @@ __wti_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, W
     myslot->end_offset = (wt_off_t)((uint64_t)join_offset + mysize);
 }
 
+/*
+ * __wti_log_slot_group_wait --
+ *     Hold the caller's slot open for other synchronous commits to join it. The caller leads the
+ *     group and will switch the slot when we return, so the group shares a single sync. Only wait
+ *     if other synchronous commits are in progress, stop when the group reaches the configured size
+ *     or commit count or when the wait window expires, then tune the window for the next group.
+ */
+void
+__wti_log_slot_group_wait(WT_SESSION_IMPL *session, WT_MYSLOT *myslot)
+{
+    WT_LOG *log;
+    WT_LOGSLOT *slot;
+    WT_LOG_MANAGER *log_mgr;
+    int64_t state;
+    uint64_t max_bytes, time_start, usecs, window;
+    uint32_t count, max_commits;
+    u_int yield_count;
+    bool full;
+
+    log_mgr = &S2C(session)->log_mgr;
+    log = log_mgr->log;
+    slot = myslot->slot;
+    usecs = 0;
+    full = false;
+
+    /* If ours is the only synchronous commit in progress, there is nobody to wait for. */
+    if (__wt_atomic_load32(&log->group_sync_active) > 1) {
+        max_bytes = WT_MIN(log_mgr->group_max_bytes, WT_LOG_SLOT_BUF_MAX);
+        max_commits = log_mgr->group_max_commits;
+        window = __wt_atomic_load64(&log->group_window);
+
+        time_start = __wt_clock(session);
+        for (yield_count = 0;; ++yield_count) {
+            /* Another thread may have closed the slot. */
+            WT_COMPILER_BARRIER();
+            state = __wt_atomic_loadiv64(&slot->slot_state);
+            if (__wt_atomic_load_pointer(&log->active_slot) != slot || !WT_LOG_SLOT_OPEN(state))
+                break;
+            if ((uint64_t)WT_LOG_SLOT_JOINED(state) >= max_bytes ||
+              __wt_atomic_load32(&slot->slot_group_count) >= max_commits) {
+                full = true;
+                break;
+            }
+            usecs = WT_CLOCKDIFF_US(__wt_clock(session), time_start);
+            if (usecs >= window)
+                break;
+            if (yield_count < WT_THOUSAND)
+                __wt_yield();
+            else
+                __wt_sleep(0, 10);
+        }
+        usecs = WT_CLOCKDIFF_US(__wt_clock(session), time_start);
+
+        /*
+         * If no other commit joined, halve the window. If commits joined but the group didn't fill,
+         * double it. The window never exceeds the average sync time, a commit arriving later than
+         * that can share the next sync instead, and never drops to zero so it can grow again.
+         */
+        if (__wt_atomic_load32(&slot->slot_group_count) <= 1)
+            window /= 2;
+        else if (!full)
+            window *= 2;
+        window =
+          WT_MIN(window, WT_MIN(log_mgr->group_max_wait, __wt_atomic_load64(&log->sync_usecs)));
+        window = WT_MAX(window, 1);
+        __wt_atomic_store64(&log->group_window, window);
+        WT_STAT_CONN_SET(session, log_group_commit_window, window);
+    }
+
+    count = __wt_atomic_load32(&slot->slot_group_count);
+    WT_STAT_CONN_INCR(session, log_group_commit);
+    WT_STAT_CONN_INCRV(session, log_group_commit_joined, count);
+    WT_STAT_CONN_INCRV(session, log_group_commit_wait, usecs);
+    if (full)
+        WT_STAT_CONN_INCR(session, log_group_commit_full);
+}
+
 /*
  * __wti_log_slot_release --
  *     Each thread in a consolidated group releases its portion to signal it has completed copying
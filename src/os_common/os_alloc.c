@@ -165,6 +165,66 @@ __wt_realloc_noclear(
     return (__realloc_func(session, bytes_allocated_ret, bytes_to_allocate, false, retp));
 }
 
+/*
+ * __wt_realloc_aligned --
+ *     ANSI realloc function that aligns to buffer boundaries, configured with the
+ *     "buffer_alignment" key to wiredtiger_open. Unlike realloc, the buffer may be reallocated even
+ *     if it's large enough, when the existing memory isn't aligned. The allocated memory isn't
+ *     cleared.
+ */
+int
+__wt_realloc_aligned(
+  WT_SESSION_IMPL *session, size_t *bytes_allocated_ret, size_t bytes_to_allocate, void *retp)
+{
+#if defined(HAVE_POSIX_MEMALIGN)
+    WT_DECL_RET;
+    size_t alignment, bytes_allocated;
+    void *newp, *p;
+
+    /*
+     * !!!
+     * This function MUST handle a NULL WT_SESSION_IMPL handle.
+     */
+    if (session != NULL && (alignment = S2C(session)->buffer_alignment) != 0) {
+        p = *(void **)retp;
+        bytes_allocated = (bytes_allocated_ret == NULL) ? 0 : *bytes_allocated_ret;
+        WT_ASSERT(session,
+          (p == NULL && bytes_allocated == 0) ||
+            (p != NULL && (bytes_allocated_ret == NULL || bytes_allocated != 0)));
+        WT_ASSERT(session, bytes_to_allocate != 0);
+
+        /*
+         * Direct I/O requires reads and writes be a multiple of the alignment as well as aligned in
+         * memory, never allocate less than a full alignment unit.
+         */
+        bytes_to_allocate = WT_ALIGN(bytes_to_allocate, alignment);
+        if (p != NULL && bytes_allocated >= bytes_to_allocate && WT_PTR_ALIGNED(p, alignment))
+            return (0);
+
+        WT_STAT_CONN_INCR(session, memory_allocation);
+
+        if ((ret = posix_memalign(&newp, alignment, bytes_to_allocate)) != 0)
+            WT_RET_MSG(session, ret, "memory allocation of %" WT_SIZET_FMT " bytes failed",
+              bytes_to_allocate);
+
+        if (p != NULL)
+            memcpy(newp, p, WT_MIN(bytes_allocated, bytes_to_allocate));
+        __wt_free(session, p);
+
+        /* Update caller's bytes allocated value. */
+        if (bytes_allocated_ret != NULL)
+            *bytes_allocated_ret = bytes_to_allocate;
+
+        *(void **)retp = newp;
+        return (0);
+    }
+#endif
+    /*
+     * If there is no posix_memalign function, or no alignment configured, fall back to realloc.
+     */
+    return (__realloc_func(session, bytes_allocated_ret, bytes_to_allocate, false, retp));
+}
+
 /*
  * __wt_memdup --
  *     Duplicate a byte string of a given length.
@@ -272,6 +272,12 @@ __wt_open(WT_SESSION_IMPL *session, const char *name, WT_FS_OPEN_FILE_TYPE file_
         WT_ASSERT(session, lock_file || !LF_ISSET(WT_FS_OPEN_CREATE));
     }
 
+    /* Optionally bypass the system buffer cache for data files. */
+    if (file_type == WT_FS_OPEN_FILE_TYPE_DATA && FLD_ISSET(conn->direct_io, WT_FILE_TYPE_DATA)) {
+        LF_SET(WT_FS_OPEN_DIRECTIO);
+        fh->direct_io = true;
+    }
+
     /* Create the path to the file. */
     if (!LF_ISSET(WT_FS_OPEN_FIXED))
         WT_ERR(__wt_filename(session, name, &path));
@@ -0,0 +1,309 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+
+/*
+ * __io_uring_unmap --
+ *     Unmap the ring memory.
+ */
+static void
+__io_uring_unmap(WT_IO_URING *ring)
+{
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+        (void)munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED)
+        (void)munmap(ring->cq_ring, ring->cq_ring_size);
+    if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED)
+        (void)munmap(ring->sq_ring, ring->sq_ring_size);
+}
+
+/*
+ * __wt_io_uring_create --
+ *     Create an io_uring instance with room for the given number of in-flight requests. Returns
+ *     ENOTSUP if the running kernel doesn't support io_uring, the caller is expected to fall back
+ *     to synchronous I/O.
+ */
+int
+__wt_io_uring_create(WT_SESSION_IMPL *session, uint32_t entries, WT_IO_URING **ringp)
+{
+    struct io_uring_params p;
+    WT_DECL_RET;
+    WT_IO_URING *ring;
+    uint8_t *cq, *sq;
+
+    *ringp = NULL;
+
+    WT_RET(__wt_calloc_one(session, &ring));
+    WT_CLEAR(p);
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, entries, &p)) < 0) {
+        /*
+         * Kernels without io_uring return ENOSYS, container runtimes commonly block the system call
+         * with EPERM. Neither is an error, the caller uses synchronous reads instead.
+         */
+        ret = __wt_errno();
+        __wt_free(session, ring);
+        if (ret == ENOSYS || ret == EPERM || ret == EACCES)
+            return (__wt_set_return(session, ENOTSUP));
+        WT_RET_MSG(session, ret, "io_uring_setup");
+    }
+    ring->entries = p.sq_entries;
+
+    ring->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED)
+        WT_ERR_MSG(session, __wt_errno(), "io_uring submission ring mmap");
+    ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+        WT_ERR_MSG(session, __wt_errno(), "io_uring submission entries mmap");
+    ring->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+    if (ring->cq_ring == MAP_FAILED)
+        WT_ERR_MSG(session, __wt_errno(), "io_uring completion ring mmap");
+
+    sq = ring->sq_ring;
+    ring->sq_head = (uint32_t *)(sq + p.sq_off.head);
+    ring->sq_tail = (uint32_t *)(sq + p.sq_off.tail);
+    ring->sq_mask = (uint32_t *)(sq + p.sq_off.ring_mask);
+    ring->sq_array = (uint32_t *)(sq + p.sq_off.array);
+    cq = ring->cq_ring;
+    ring->cq_head = (uint32_t *)(cq + p.cq_off.head);
+    ring->cq_tail = (uint32_t *)(cq + p.cq_off.tail);
+    ring->cq_mask = (uint32_t *)(cq + p.cq_off.ring_mask);
+    ring->cqes = cq + p.cq_off.cqes;
+
+    *ringp = ring;
+    return (0);
+
+err:
+    __io_uring_unmap(ring);
+    (void)close(ring->fd);
+    __wt_free(session, ring);
+    return (ret);
+}
+
+/*
+ * __wt_io_uring_destroy --
+ *     Discard an io_uring instance. Any requests still in flight are waited for, the kernel may be
+ *     writing into the caller's buffers until they complete.
+ */
+void
+__wt_io_uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING **ringp)
+{
+    WT_IO_URING *ring;
+    uint64_t notused;
+    int result;
+
+    if ((ring = *ringp) == NULL)
+        return;
+    *ringp = NULL;
+
+    while (ring->inflight > 0 || ring->pending > 0)
+        if (__wt_io_uring_reap(session, ring, true, &notused, &result) != 0)
+            break;
+
+    __io_uring_unmap(ring);
+    (void)close(ring->fd);
+    __wt_free(session, ring);
+}
+
+/*
+ * __wt_io_uring_read --
+ *     Queue a read of a file handle into the caller's buffer, the read isn't started until the next
+ *     call to submit or reap. The buffer must remain valid until the read's completion is reaped.
+ *     Returns ENOTSUP for file handles that aren't backed by a POSIX file descriptor, and EBUSY if
+ *     the ring is full.
+ */
+int
+__wt_io_uring_read(WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_FH *fh, wt_off_t offset,
+  size_t len, void *buf, uint64_t user_data)
+{
+    struct io_uring_sqe *sqe;
+    uint32_t index, tail;
+    int fd;
+
+    WT_RET(__wt_posix_file_fd(session, fh, &fd));
+
+    if (ring->pending + ring->inflight >= ring->entries)
+        return (EBUSY);
+
+    tail = *ring->sq_tail + ring->pending;
+    index = tail & *ring->sq_mask;
+    sqe = &((struct io_uring_sqe *)ring->sqes)[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->off = (uint64_t)offset;
+    sqe->addr = (uint64_t)(uintptr_t)buf;
+    sqe->len = (uint32_t)len;
+    sqe->user_data = user_data;
+    ring->sq_array[index] = index;
+    ++ring->pending;
+
+    return (0);
+}
+
+/*
+ * __io_uring_enter --
+ *     Publish queued requests to the kernel and optionally wait for a completion.
+ */
+static int
+__io_uring_enter(WT_SESSION_IMPL *session, WT_IO_URING *ring, bool wait)
+{
+    WT_DECL_RET;
+    uint32_t submit;
+    long sysret;
+
+    submit = ring->pending;
+    if (submit != 0)
+        __atomic_store_n(ring->sq_tail, *ring->sq_tail + submit, __ATOMIC_RELEASE);
+
+    for (;;) {
+        sysret = syscall(__NR_io_uring_enter, ring->fd, submit, wait ? 1 : 0,
+          wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if (sysret >= 0)
+            break;
+        if ((ret = __wt_errno()) != EINTR && ret != EAGAIN)
+            WT_RET_MSG(session, ret, "io_uring_enter");
+    }
+
+    /* The kernel consumes the submission queue in order, anything it didn't take stays pending. */
+    ring->pending -= (uint32_t)sysret;
+    ring->inflight += (uint32_t)sysret;
+    if (ring->pending != 0)
+        __atomic_store_n(ring->sq_tail, *ring->sq_tail - ring->pending, __ATOMIC_RELEASE);
+    return (0);
+}
+
+/*
+ * __wt_io_uring_submit --
+ *     Start any queued reads without waiting for them to complete.
+ */
+int
+__wt_io_uring_submit(WT_SESSION_IMPL *session, WT_IO_URING *ring)
+{
+    if (ring->pending == 0)
+        return (0);
+    return (__io_uring_enter(session, ring, false));
+}
+
+/*
+ * __wt_io_uring_reap --
+ *     Return a completed request: its user data and result, the number of bytes read or a negated
+ *     error number. Queued requests are submitted first. Returns WT_NOTFOUND if there's nothing in
+ *     flight, or if nothing has completed and the caller didn't ask to wait.
+ */
+int
+__wt_io_uring_reap(
+  WT_SESSION_IMPL *session, WT_IO_URING *ring, bool wait, uint64_t *user_datap, int *resultp)
+{
+    struct io_uring_cqe *cqe;
+    uint32_t head;
+
+    *user_datap = 0;
+    *resultp = 0;
+
+    if (ring->pending != 0)
+        WT_RET(__io_uring_enter(session, ring, false));
+
+    for (;;) {
+        head = *ring->cq_head;
+        if (head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+            cqe = &((struct io_uring_cqe *)ring->cqes)[head & *ring->cq_mask];
+            *user_datap = cqe->user_data;
+            *resultp = cqe->res;
+            __atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+            --ring->inflight;
+            return (0);
+        }
+        if (!wait || ring->inflight == 0)
+            return (WT_NOTFOUND);
+        WT_RET(__io_uring_enter(session, ring, true));
+    }
+}
+
+#else
+/*
+ * __wt_io_uring_create --
+ *     Create an io_uring instance, not supported by this build.
+ */
+int
+__wt_io_uring_create(WT_SESSION_IMPL *session, uint32_t entries, WT_IO_URING **ringp)
+{
+    WT_UNUSED(entries);
+
+    *ringp = NULL;
+    return (__wt_set_return(session, ENOTSUP));
+}
+
+/*
+ * __wt_io_uring_destroy --
+ *     Discard an io_uring instance, not supported by this build.
+ */
+void
+__wt_io_uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING **ringp)
+{
+    WT_UNUSED(session);
+
+    *ringp = NULL;
+}
+
+/*
+ * __wt_io_uring_read --
+ *     Queue a read, not supported by this build.
+ */
+int
+__wt_io_uring_read(WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_FH *fh, wt_off_t offset,
+  size_t len, void *buf, uint64_t user_data)
+{
+    WT_UNUSED(ring);
+    WT_UNUSED(fh);
+    WT_UNUSED(offset);
+    WT_UNUSED(len);
+    WT_UNUSED(buf);
+    WT_UNUSED(user_data);
+
+    return (__wt_set_return(session, ENOTSUP));
+}
+
+/*
+ * __wt_io_uring_submit --
+ *     Start queued reads, not supported by this build.
+ */
+int
+__wt_io_uring_submit(WT_SESSION_IMPL *session, WT_IO_URING *ring)
+{
+    WT_UNUSED(ring);
+
+    return (__wt_set_return(session, ENOTSUP));
+}
+
+/*
+ * __wt_io_uring_reap --
+ *     Return a completed request, not supported by this build.
+ */
+int
+__wt_io_uring_reap(
+  WT_SESSION_IMPL *session, WT_IO_URING *ring, bool wait, uint64_t *user_datap, int *resultp)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(ring);
+    WT_UNUSED(wait);
+
+    *user_datap = 0;
+    *resultp = 0;
+    return (WT_NOTFOUND);
+}
+#endif
@@ -523,6 +523,9 @@ __posix_file_read(
       "read: %s, fd=%d, offset=%" PRId64 ", len=%" WT_SIZET_FMT, file_handle->name, pfh->fd, offset,
       len);
 
+    /* Assert direct I/O reads into an aligned buffer. */
+    WT_ASSERT(session, !pfh->direct_io || WT_PTR_ALIGNED(buf, S2C(session)->buffer_alignment));
+
     /* Break reads larger than 1GB into 1GB chunks. */
     nr = 0;
     for (addr = buf; len > 0; addr += nr, len -= (size_t)nr, offset += nr) {
@@ -690,6 +693,9 @@ __posix_file_write(
       "write: %s, fd=%d, offset=%" PRId64 ", len=%" WT_SIZET_FMT, file_handle->name, pfh->fd,
       offset, len);
 
+    /* Assert direct I/O writes from an aligned buffer. */
+    WT_ASSERT(session, !pfh->direct_io || WT_PTR_ALIGNED(buf, S2C(session)->buffer_alignment));
+
     /* Break writes larger than 1GB into 1GB chunks. */
     for (addr = buf; len > 0; addr += nw, len -= (size_t)nw, offset += nw) {
         chunk = WT_MIN(len, WT_GIGABYTE);
@@ -888,6 +894,28 @@ __posix_open_file(WT_FILE_SYSTEM *file_system, WT_SESSION *wt_session, const cha
     if (ret != 0)
         WT_ERR_MSG(session, ret, "%s: handle-open: open", name);
 
+#ifdef O_DIRECT
+    /*
+     * Direct I/O: bypass the system buffer cache. Set the flag once the file is open rather than in
+     * the open call: filesystems that don't support direct I/O (for example, tmpfs) fail the open
+     * with EINVAL after creating the file. If the filesystem rejects the flag, fall back to
+     * buffered I/O.
+     */
+    if (LF_ISSET(WT_FS_OPEN_DIRECTIO)) {
+        WT_SYSCALL(((f = fcntl(pfh->fd, F_GETFL)) == -1 ? -1 : 0), ret);
+        if (ret == 0)
+            WT_SYSCALL(fcntl(pfh->fd, F_SETFL, f | O_DIRECT), ret);
+        if (ret == 0)
+            pfh->direct_io = true;
+        else if (ret == EINVAL)
+            __wt_verbose_warning(session, WT_VERB_FILEOPS,
+              "%s: handle-open: direct I/O not supported by the filesystem, using buffered I/O",
+              name);
+        else
+            WT_ERR_MSG(session, ret, "%s: handle-open: fcntl(O_DIRECT)", name);
+    }
+#endif
+
 #ifdef __linux__
     /*
      * Durability: some filesystems require a directory sync to be confident the file will appear.
@@ -906,7 +934,7 @@ __posix_open_file(WT_FILE_SYSTEM *file_system, WT_SESSION *wt_session, const cha
      * If the user set an access pattern hint, call fadvise now. Ignore fadvise when doing direct
      * I/O, the kernel cache isn't interesting.
      */
-    if (file_type == WT_FS_OPEN_FILE_TYPE_DATA &&
+    if (file_type == WT_FS_OPEN_FILE_TYPE_DATA && !pfh->direct_io &&
       LF_ISSET(WT_FS_OPEN_ACCESS_RAND | WT_FS_OPEN_ACCESS_SEQ)) {
         advise_flag = 0;
         if (LF_ISSET(WT_FS_OPEN_ACCESS_RAND))
@@ -930,11 +958,13 @@ directory_open:
     pfh->mmap_flags = LF_ISSET(WT_FS_OPEN_READONLY) ? MAP_PRIVATE : MAP_SHARED;
     if (LF_ISSET(WT_FS_OPEN_FORCE_MMAP))
         pfh->mmap_file_mappable = true;
-    if (conn->mmap_all) {
+    if (conn->mmap_all && !pfh->direct_io) {
         /*
          * We are going to use mmap for I/O. So let's mmap the file on opening. If mmap fails, we
          * will just mark the file as not mappable (inside the mapping function) and will use system
-         * calls for I/O on this file. We will not crash the database if mmap fails.
+         * calls for I/O on this file. We will not crash the database if mmap fails. Files opened
+         * for direct I/O are never mapped, the Linux open(2) documentation says applications
+         * should avoid mixing mmap(2) of files with direct I/O to the same files.
          */
         if (file_type == WT_FS_OPEN_FILE_TYPE_DATA || file_type == WT_FS_OPEN_FILE_TYPE_LOG) {
             pfh->mmap_file_mappable = true;
@@ -1032,6 +1062,27 @@ __wt_os_posix(WT_SESSION_IMPL *session, WT_FILE_SYSTEM **fsp)
     return (0);
 }
 
+/*
+ * __wt_posix_file_fd --
+ *     Return the POSIX file descriptor underlying a file handle, for I/O interfaces that bypass the
+ *     file handle methods. Returns ENOTSUP if the handle wasn't opened by the POSIX file system or
+ *     its reads are served from a mapped region.
+ */
+int
+__wt_posix_file_fd(WT_SESSION_IMPL *session, WT_FH *fh, int *fdp)
+{
+    WT_FILE_HANDLE_POSIX *pfh;
+
+    *fdp = -1;
+
+    if (fh->handle->close != __posix_file_close || fh->handle->fh_read != __posix_file_read)
+        return (__wt_set_return(session, ENOTSUP));
+
+    pfh = (WT_FILE_HANDLE_POSIX *)fh->handle;
+    *fdp = pfh->fd;
+    return (0);
+}
+
 /*
  * Here is the synchronization protocol to prevent race conditions when a session is remapping the
  * file while others might be reading or writing it:
@@ -8,6 +8,11 @@
 
 #include "wt_internal.h"
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
 /*
  * __wti_posix_map --
  *     Map a file into memory.
@@ -158,3 +163,98 @@ __wti_posix_unmap(
 
     WT_RET_MSG(session, __wt_errno(), "%s: memory-unmap: munmap", fh->name);
 }
+
+/*
+ * __wt_map_anonymous --
+ *     Map anonymous memory, backed by explicitly reserved huge pages if requested and available,
+ *     and by transparent huge pages otherwise, where the system supports them.
+ */
+int
+__wt_map_anonymous(
+  WT_SESSION_IMPL *session, size_t len, bool hugepages, void *mapp, bool *hugepagesp)
+{
+    void *map;
+
+    *(void **)mapp = NULL;
+    *hugepagesp = false;
+
+#ifdef MAP_HUGETLB
+    /*
+     * Huge pages must be reserved by the administrator: it's not an error if there aren't enough,
+     * fall back to a normal mapping.
+     */
+    if (hugepages) {
+        map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+          -1, (wt_off_t)0);
+        if (map != MAP_FAILED) {
+            *(void **)mapp = map;
+            *hugepagesp = true;
+            return (0);
+        }
+        __wt_verbose_info(session, WT_VERB_HANDLEOPS,
+          "anonymous memory-map: %" WT_SIZET_FMT " bytes of huge pages unavailable: %s", len,
+          __wt_strerror(session, __wt_errno(), NULL, 0));
+    }
+#endif
+
+    if ((map = mmap(NULL, len, PROT_READ | PROT_WRITE,
+#ifdef MAP_NOCORE
+           MAP_NOCORE |
+#endif
+             MAP_PRIVATE | MAP_ANONYMOUS,
+           -1, (wt_off_t)0)) == MAP_FAILED)
+        WT_RET_MSG(session, __wt_errno(), "anonymous memory-map: mmap: %" WT_SIZET_FMT " bytes",
+          len);
+
+#ifdef MADV_HUGEPAGE
+    /* Transparent huge pages are advisory, ignore failure. */
+    if (hugepages)
+        (void)madvise(map, len, MADV_HUGEPAGE);
+#endif
+
+    *(void **)mapp = map;
+    return (0);
+}
+
+/*
+ * __wt_map_anonymous_bind --
+ *     Prefer a NUMA node for the physical memory backing part of an anonymous mapping. The policy
+ *     is advisory, it's ignored on systems without NUMA support.
+ */
+void
+__wt_map_anonymous_bind(WT_SESSION_IMPL *session, void *map, size_t len, u_int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    unsigned long nodemask[WT_NUMA_NODE_MAX / (8 * sizeof(unsigned long))];
+    size_t bits;
+
+    if (node >= WT_NUMA_NODE_MAX)
+        return;
+    bits = 8 * sizeof(unsigned long);
+    memset(nodemask, 0, sizeof(nodemask));
+    nodemask[node / bits] = 1UL << (node % bits);
+    if (syscall(SYS_mbind, map, len, MPOL_PREFERRED, nodemask, WT_NUMA_NODE_MAX, 0) != 0)
+        __wt_verbose_info(session, WT_VERB_HANDLEOPS,
+          "anonymous memory-map: binding %" WT_SIZET_FMT " bytes to NUMA node %u: %s", len, node,
+          __wt_strerror(session, __wt_errno(), NULL, 0));
+#else
+    WT_UNUSED(session);
+    WT_UNUSED(map);
+    WT_UNUSED(len);
+    WT_UNUSED(node);
+#endif
+}
+
+/*
+ * __wt_unmap_anonymous --
+ *     Remove an anonymous memory mapping.
+ */
+int
+__wt_unmap_anonymous(WT_SESSION_IMPL *session, void *map, size_t len)
+{
+    if (munmap(map, len) == 0)
+        return (0);
+
+    WT_RET_MSG(session, __wt_errno(), "anonymous memory-unmap: munmap: %" WT_SIZET_FMT " bytes",
+      len);
+}
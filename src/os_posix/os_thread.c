@@ -8,6 +8,11 @@
 
 #include "wt_internal.h"
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
 #ifdef __linux__
 
 /*
@@ -147,3 +152,47 @@ __wt_process_id(void)
 {
     return ((uintmax_t)getpid());
 }
+
+/*
+ * __wt_numa_node --
+ *     Return the NUMA node of the processor the thread is running on.
+ */
+u_int
+__wt_numa_node(void)
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned int cpu, node;
+
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0)
+        return (node);
+#endif
+    return (0);
+}
+
+/*
+ * __wt_numa_node_count --
+ *     Return the number of NUMA nodes the process can allocate memory from.
+ */
+u_int
+__wt_numa_node_count(void)
+{
+#if defined(__linux__) && defined(SYS_get_mempolicy)
+    unsigned long nodemask[WT_NUMA_NODE_MAX / (8 * sizeof(unsigned long))];
+    size_t bits;
+    u_int count, i;
+    int mode;
+
+    /* The count is one past the highest node in the set of nodes the process may use. */
+    bits = 8 * sizeof(unsigned long);
+    memset(nodemask, 0, sizeof(nodemask));
+    if (syscall(SYS_get_mempolicy, &mode, nodemask, WT_NUMA_NODE_MAX, NULL, MPOL_F_MEMS_ALLOWED) ==
+      0) {
+        for (count = 0, i = 0; i < WT_NUMA_NODE_MAX; ++i)
+            if ((nodemask[i / bits] & (1UL << (i % bits))) != 0)
+                count = i + 1;
+        if (count != 0)
+            return (count);
+    }
+#endif
+    return (1);
+}
@@ -105,3 +105,63 @@ __wti_win_unmap(WT_FILE_HANDLE *file_handle, WT_SESSION *wt_session, void *mappe
 
     return (ret);
 }
+
+/*
+ * __wt_map_anonymous --
+ *     Map anonymous memory. Large pages require the lock-memory privilege on Windows, the mapping
+ *     always uses the default page size.
+ */
+int
+__wt_map_anonymous(
+  WT_SESSION_IMPL *session, size_t len, bool hugepages, void *mapp, bool *hugepagesp)
+{
+    DWORD windows_error;
+    void *map;
+
+    WT_UNUSED(hugepages);
+
+    *(void **)mapp = NULL;
+    *hugepagesp = false;
+
+    if ((map = VirtualAlloc(NULL, len, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE)) == NULL) {
+        windows_error = __wt_getlasterror();
+        WT_RET_MSG(session, __wt_map_windows_error(windows_error),
+          "anonymous memory-map: VirtualAlloc: %" WT_SIZET_FMT " bytes: %s", len,
+          __wt_formatmessage(session, windows_error));
+    }
+
+    *(void **)mapp = map;
+    return (0);
+}
+
+/*
+ * __wt_map_anonymous_bind --
+ *     Prefer a NUMA node for the physical memory backing part of an anonymous mapping. Windows
+ *     places memory on the node of the thread first touching it, there's nothing to do.
+ */
+void
+__wt_map_anonymous_bind(WT_SESSION_IMPL *session, void *map, size_t len, u_int node)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(map);
+    WT_UNUSED(len);
+    WT_UNUSED(node);
+}
+
+/*
+ * __wt_unmap_anonymous --
+ *     Remove an anonymous memory mapping.
+ */
+int
+__wt_unmap_anonymous(WT_SESSION_IMPL *session, void *map, size_t len)
+{
+    DWORD windows_error;
+
+    if (VirtualFree(map, 0, MEM_RELEASE) != 0)
+        return (0);
+
+    windows_error = __wt_getlasterror();
+    WT_RET_MSG(session, __wt_map_windows_error(windows_error),
+      "anonymous memory-unmap: VirtualFree: %" WT_SIZET_FMT " bytes: %s", len,
+      __wt_formatmessage(session, windows_error));
+}
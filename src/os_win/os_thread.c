@@ -103,3 +103,33 @@ __wt_process_id(void)
 {
     return (uintmax_t)GetCurrentProcessId();
 }
+
+/*
+ * __wt_numa_node --
+ *     Return the NUMA node of the processor the thread is running on.
+ */
+u_int
+__wt_numa_node(void)
+{
+    PROCESSOR_NUMBER processor;
+    USHORT node;
+
+    GetCurrentProcessorNumberEx(&processor);
+    if (GetNumaProcessorNodeEx(&processor, &node) == 0 || node == MAXUSHORT)
+        return (0);
+    return ((u_int)node);
+}
+
+/*
+ * __wt_numa_node_count --
+ *     Return the number of NUMA nodes the process can allocate memory from.
+ */
+u_int
+__wt_numa_node_count(void)
+{
+    ULONG highest;
+
+    if (GetNumaHighestNodeNumber(&highest) == 0)
+        return (1);
+    return ((u_int)highest + 1);
+}
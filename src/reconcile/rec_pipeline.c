@@ -0,0 +1,281 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __rec_pipeline_thread_chk --
+ *     Check to decide if a write pipeline thread should continue running.
+ */
+static bool
+__rec_pipeline_thread_chk(WT_SESSION_IMPL *session)
+{
+    return (__wt_atomic_loadbool(&S2C(session)->rec_pipeline.run));
+}
+
+/*
+ * __rec_pipeline_write --
+ *     Compress, encrypt, checksum and write a job's block.
+ */
+static void
+__rec_pipeline_write(WT_SESSION_IMPL *session, WT_REC_WRITE_JOB *job)
+{
+    WT_DECL_RET;
+
+    WT_WITH_DHANDLE(session, job->dhandle,
+      ret = __wt_blkcache_write(session, &job->image, job->addr, &job->addr_size,
+        &job->compressed_size, false, job->checkpoint_io, false));
+    job->ret = ret;
+}
+
+/*
+ * __rec_pipeline_thread_run --
+ *     Write blocks queued by reconciliations.
+ */
+static int
+__rec_pipeline_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_REC_WRITE_JOB *job;
+    WT_REC_WRITE_PIPELINE *pipe;
+    uint32_t i;
+    bool worked;
+
+    WT_UNUSED(thread);
+
+    pipe = &S2C(session)->rec_pipeline;
+    worked = false;
+
+    for (i = 0, job = pipe->jobs; i < pipe->jobs_entries; ++i, ++job) {
+        if (__wt_atomic_load32(&job->state) != WT_REC_WRITE_QUEUED ||
+          !__wt_atomic_cas32(&job->state, WT_REC_WRITE_QUEUED, WT_REC_WRITE_BUSY))
+            continue;
+
+        /*
+         * Act as the session syncing the tree if the reconciliation is part of the sync, the block
+         * belongs to that sync the same way the reconciliation's own writes do.
+         */
+        session->ckpt.sync_owner = job->sync_owner;
+        __rec_pipeline_write(session, job);
+        session->ckpt.sync_owner = NULL;
+
+        WT_RELEASE_WRITE(job->state, WT_REC_WRITE_DONE);
+        worked = true;
+    }
+
+    /* Wait for more work if there was nothing to do. */
+    if (!worked)
+        __wt_cond_wait(
+          session, pipe->threads.wait_cond, 10 * WT_THOUSAND, __rec_pipeline_thread_chk);
+
+    return (0);
+}
+
+/*
+ * __wti_rec_pipeline_queue --
+ *     Hand a copy of a block's disk image to the write pipeline, if it's running and there's room.
+ *     The reconciliation collects the block's address when it waits for the pipeline.
+ */
+int
+__wti_rec_pipeline_queue(
+  WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_ITEM *image, uint32_t multi_slot, bool *queuedp)
+{
+    WT_DECL_RET;
+    WT_REC_WRITE_JOB *job;
+    WT_REC_WRITE_PIPELINE *pipe;
+    uint32_t i;
+
+    *queuedp = false;
+    pipe = &S2C(session)->rec_pipeline;
+
+    if (!__wt_atomic_loadbool(&pipe->run))
+        return (0);
+
+    /* Collect any of our writes that have completed, it frees up their slots. */
+    if (r->pipeline_writes != 0)
+        WT_RET(__wti_rec_pipeline_wait(session, r, false));
+
+    /* Write the block ourselves rather than exceed the pipeline's memory limit. */
+    if (__wt_atomic_load64(&pipe->inflight_bytes) + image->size > pipe->inflight_max)
+        return (0);
+
+    for (i = 0, job = pipe->jobs; i < pipe->jobs_entries; ++i, ++job)
+        if (__wt_atomic_load32(&job->state) == WT_REC_WRITE_EMPTY &&
+          __wt_atomic_cas32(&job->state, WT_REC_WRITE_EMPTY, WT_REC_WRITE_FILLING))
+            break;
+    if (i == pipe->jobs_entries)
+        return (0);
+
+    /* The block manager aligns the write in place, size the copy the same as the original. */
+    if ((ret = __wt_buf_init(session, &job->image, image->memsize)) != 0) {
+        WT_RELEASE_WRITE(job->state, WT_REC_WRITE_EMPTY);
+        return (ret);
+    }
+    memcpy(job->image.mem, image->data, image->size);
+    job->image.size = image->size;
+
+    job->session = session;
+    job->sync_owner = WT_SESSION_SYNC_OWNER(session);
+    job->dhandle = session->dhandle;
+    job->multi_slot = multi_slot;
+    job->checkpoint_io = F_ISSET(r, WT_REC_CHECKPOINT);
+    job->addr_size = job->compressed_size = 0;
+    job->ret = 0;
+
+    (void)__wt_atomic_add64(&pipe->inflight_bytes, image->size);
+    ++r->pipeline_writes;
+
+    WT_RELEASE_WRITE(job->state, WT_REC_WRITE_QUEUED);
+    __wt_cond_signal(session, pipe->threads.wait_cond);
+
+    *queuedp = true;
+    return (0);
+}
+
+/*
+ * __wti_rec_pipeline_wait --
+ *     Collect a reconciliation's completed pipeline writes, handing each block's address back to
+ *     the reconciliation. If waiting, collect all of them: write any block no pipeline thread has
+ *     started on, and wait for the rest. Once a write fails, blocks not yet started aren't written.
+ */
+int
+__wti_rec_pipeline_wait(WT_SESSION_IMPL *session, WT_RECONCILE *r, bool wait)
+{
+    WT_DECL_RET;
+    WT_REC_WRITE_JOB *job;
+    WT_REC_WRITE_PIPELINE *pipe;
+    uint32_t i, state;
+    bool written;
+
+    pipe = &S2C(session)->rec_pipeline;
+
+    for (i = 0, job = pipe->jobs; i < pipe->jobs_entries && r->pipeline_writes != 0; ++i, ++job) {
+        /*
+         * The owning session is set before a job is queued, and we aren't filling any slot, so a
+         * queued job naming our session is one of ours.
+         */
+        WT_ACQUIRE_READ(state, job->state);
+        if (state == WT_REC_WRITE_EMPTY || state == WT_REC_WRITE_FILLING || job->session != session)
+            continue;
+
+        written = true;
+        while (wait && state != WT_REC_WRITE_DONE) {
+            /* Take back blocks no pipeline thread has started on. */
+            if (state == WT_REC_WRITE_QUEUED &&
+              __wt_atomic_cas32(&job->state, WT_REC_WRITE_QUEUED, WT_REC_WRITE_FILLING)) {
+                if (ret == 0)
+                    __rec_pipeline_write(session, job);
+                else
+                    written = false;
+                state = WT_REC_WRITE_DONE;
+                break;
+            }
+            __wt_yield();
+            WT_ACQUIRE_READ(state, job->state);
+        }
+        if (state != WT_REC_WRITE_DONE)
+            continue;
+
+        if (written) {
+            WT_TRET(job->ret);
+            if (job->ret == 0)
+                WT_TRET(__wti_rec_split_write_complete(
+                  session, r, job->multi_slot, job->addr, job->addr_size, job->compressed_size));
+        }
+
+        (void)__wt_atomic_sub64(&pipe->inflight_bytes, job->image.size);
+        --r->pipeline_writes;
+        job->session = job->sync_owner = NULL;
+        job->dhandle = NULL;
+        WT_RELEASE_WRITE(job->state, WT_REC_WRITE_EMPTY);
+    }
+
+    WT_ASSERT(session, !wait || r->pipeline_writes == 0);
+    return (ret);
+}
+
+/*
+ * __wt_rec_pipeline_create --
+ *     Start the write pipeline threads, if configured.
+ */
+int
+__wt_rec_pipeline_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_REC_WRITE_PIPELINE *pipe;
+
+    conn = S2C(session);
+    pipe = &conn->rec_pipeline;
+
+    WT_RET(__wt_config_gets(session, cfg, "write_pipeline.max_inflight", &cval));
+    pipe->inflight_max = (uint64_t)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "write_pipeline.threads", &cval));
+    pipe->threads_num = (uint32_t)cval.val;
+
+    /* In-memory and read-only databases don't write blocks. */
+    if (pipe->threads_num == 0 || F_ISSET(conn, WT_CONN_IN_MEMORY | WT_CONN_READONLY))
+        return (0);
+
+    /* Allow a few blocks per thread to wait to be written. */
+    WT_RET(__wt_calloc_def(session, 4 * pipe->threads_num, &pipe->jobs));
+    pipe->jobs_entries = 4 * pipe->threads_num;
+
+    /* Set first, the threads might run before we finish up. */
+    __wt_atomic_storebool(&pipe->run, true);
+
+    WT_ERR(__wt_thread_group_create(session, &pipe->threads, "write-pipeline", pipe->threads_num,
+      pipe->threads_num, WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL, __rec_pipeline_thread_chk,
+      __rec_pipeline_thread_run, NULL));
+    return (0);
+
+err:
+    /* A thread group that fails to start cleans up after itself. */
+    __wt_atomic_storebool(&pipe->run, false);
+    __wt_free(session, pipe->jobs);
+    pipe->jobs_entries = 0;
+    return (ret);
+}
+
+/*
+ * __wt_rec_pipeline_destroy --
+ *     Stop the write pipeline threads. Every reconciliation collects its writes before it
+ *     finishes, there's nothing queued once no reconciliation can run.
+ */
+int
+__wt_rec_pipeline_destroy(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    WT_REC_WRITE_JOB *job;
+    WT_REC_WRITE_PIPELINE *pipe;
+    uint32_t i;
+
+    pipe = &S2C(session)->rec_pipeline;
+
+    if (!__wt_atomic_loadbool(&pipe->run))
+        return (0);
+
+    /* Wait for any thread group changes to stabilize. */
+    __wt_writelock(session, &pipe->threads.lock);
+
+    /* Signal the threads to finish. */
+    __wt_atomic_storebool(&pipe->run, false);
+    __wt_cond_signal(session, pipe->threads.wait_cond);
+
+    /* We call the destroy function still holding the write lock. It assumes it is called locked. */
+    WT_TRET(__wt_thread_group_destroy(session, &pipe->threads));
+
+    for (i = 0, job = pipe->jobs; i < pipe->jobs_entries; ++i, ++job) {
+        WT_ASSERT(session, job->state == WT_REC_WRITE_EMPTY);
+        __wt_buf_free(session, &job->image);
+    }
+    __wt_free(session, pipe->jobs);
+    pipe->jobs_entries = 0;
+
+    return (ret);
+}
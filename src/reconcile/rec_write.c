@@ -278,6 +278,13 @@ __reconcile(WT_SESSION_IMPL *session, WT_REF *ref, WT_SALVAGE_COOKIE *salvage, u
     if (!session->evict_timeline.reentry_hs_eviction)
         session->reconcile_timeline.image_build_finish = __wt_clock(session);
 
+    /*
+     * Collect the blocks handed to the write pipeline: a failed write is an ordinary reconciliation
+     * failure, it shouldn't wait for wrapup where failures panic.
+     */
+    if (ret == 0 && r->pipeline_writes != 0)
+        ret = __wti_rec_pipeline_wait(session, r, true);
+
     /*
      * If we failed, don't bail out yet; we still need to update stats and tidy up.
      */
@@ -780,6 +787,10 @@ __rec_cleanup(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 
     btree = S2BT(session);
 
+    /* Error paths may not have collected the blocks handed to the write pipeline. */
+    if (r->pipeline_writes != 0)
+        WT_RET(__wti_rec_pipeline_wait(session, r, true));
+
     if (r->hs_cursor != NULL)
         WT_RET(r->hs_cursor->reset(r->hs_cursor));
 
@@ -852,12 +863,12 @@ __rec_destroy_session(WT_SESSION_IMPL *session)
 }
 
 /*
- * __rec_write --
- *     Write a block, with optional diagnostic checks.
+ * __rec_write_check --
+ *     Optional diagnostic checks of a block we're writing.
  */
 static int
-__rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep,
-  size_t *compressed_sizep, bool checkpoint, bool checkpoint_io, bool compressed)
+__rec_write_check(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep,
+  bool checkpoint, bool compressed)
 {
     WT_BTREE *btree;
     WT_DECL_ITEM(ctmp);
@@ -913,9 +924,21 @@ __rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_
              */
             ret = __wt_verify_dsk(session, "[write-check]", buf);
         }
-        WT_RET(ret);
     }
 
+    return (ret);
+}
+
+/*
+ * __rec_write --
+ *     Write a block, with optional diagnostic checks.
+ */
+static int
+__rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep,
+  size_t *compressed_sizep, bool checkpoint, bool checkpoint_io, bool compressed)
+{
+    WT_RET(__rec_write_check(session, buf, addr, addr_sizep, checkpoint, compressed));
+
     return (__wt_blkcache_write(
       session, buf, addr, addr_sizep, compressed_sizep, checkpoint, checkpoint_io, compressed));
 }
@@ -1041,11 +1064,12 @@ __rec_split_chunk_init(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_REC_CHUNK *
     /*
      * Allocate and clear the disk image buffer.
      *
-     * Don't touch the disk image item memory, that memory is reused.
+     * Don't touch the disk image item memory, that memory is reused. Images that aren't compressed
+     * or encrypted are written from the buffer, allocate it aligned for direct I/O.
      *
      * Clear the disk page header to ensure all of it is initialized, even the unused fields.
      */
-    WT_RET(__wt_buf_init(session, &chunk->image, r->disk_img_buf_size));
+    WT_RET(__wt_buf_init_aligned(session, &chunk->image, r->disk_img_buf_size));
     memset(chunk->image.mem, 0, WT_PAGE_HEADER_SIZE);
 
 #ifdef HAVE_DIAGNOSTIC
@@ -1968,6 +1992,73 @@ __rec_split_write_header(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_REC_CHUNK
     memset(WT_BLOCK_HEADER_REF(dsk), 0, btree->block_header);
 }
 
+/*
+ * __rec_split_zone_add --
+ *     Add a value to a zone map being built.
+ */
+static void
+__rec_split_zone_add(WT_ITEM *value, WT_ITEM *min, WT_ITEM *max, bool *foundp)
+{
+    if (!*foundp || __wt_lex_compare(value, min) < 0)
+        *min = *value;
+    if (!*foundp || __wt_lex_compare(value, max) > 0)
+        *max = *value;
+    *foundp = true;
+}
+
+/*
+ * __rec_split_zone --
+ *     Build a row-store leaf block's value zone map from its disk image.
+ */
+static void
+__rec_split_zone(WT_SESSION_IMPL *session, WT_REC_CHUNK *chunk, WT_ADDR_ZONE *zone)
+{
+    WT_CELL_UNPACK_KV unpack;
+    WT_ITEM empty, max, min, value;
+    bool found, key;
+
+    WT_CLEAR(empty);
+    empty.data = "";
+    WT_CLEAR(max);
+    WT_CLEAR(min);
+    found = key = false;
+
+    /*
+     * Zero-length values aren't stored, a key followed by another key or ending the page has one.
+     * We don't read overflow values, a block with any has no zone map.
+     */
+    WT_CELL_FOREACH_KV (session, (WT_PAGE_HEADER *)chunk->image.mem, unpack) {
+        switch (unpack.type) {
+        case WT_CELL_KEY:
+        case WT_CELL_KEY_OVFL:
+            if (key)
+                __rec_split_zone_add(&empty, &min, &max, &found);
+            key = true;
+            break;
+        case WT_CELL_VALUE:
+            value.data = unpack.data;
+            value.size = unpack.size;
+            __rec_split_zone_add(&value, &min, &max, &found);
+            key = false;
+            break;
+        default:
+            return;
+        }
+    }
+    WT_CELL_FOREACH_END;
+    if (key)
+        __rec_split_zone_add(&empty, &min, &max, &found);
+    if (!found)
+        return;
+
+    zone->min_size = (uint8_t)WT_MIN(min.size, WT_ADDR_ZONE_MAX);
+    memcpy(zone->min, min.data, zone->min_size);
+    zone->max_size = (uint8_t)WT_MIN(max.size, WT_ADDR_ZONE_MAX);
+    memcpy(zone->max, max.data, zone->max_size);
+    zone->max_truncated = max.size > WT_ADDR_ZONE_MAX;
+    zone->set = true;
+}
+
 /*
  * __rec_compression_adjust --
  *     Adjust the pre-compression page size based on compression results.
@@ -2042,6 +2133,47 @@ __rec_compression_adjust(WT_SESSION_IMPL *session, uint32_t max, size_t compress
     WT_WRITE_ONCE(*adjustp, new);
 }
 
+/*
+ * __rec_split_write_adjust --
+ *     Adjust the tree's pre-compression page size after writing a block.
+ */
+static void
+__rec_split_write_adjust(
+  WT_SESSION_IMPL *session, WT_RECONCILE *r, size_t compressed_size, bool last_block)
+{
+    WT_BTREE *btree;
+
+    btree = S2BT(session);
+
+    if (compressed_size == 0)
+        return;
+    if (WT_PAGE_IS_INTERNAL(r->page) && btree->intlpage_compadjust)
+        __rec_compression_adjust(
+          session, btree->maxintlpage, compressed_size, last_block, &btree->maxintlpage_precomp);
+    if (!WT_PAGE_IS_INTERNAL(r->page) && btree->leafpage_compadjust)
+        __rec_compression_adjust(
+          session, btree->maxleafpage, compressed_size, last_block, &btree->maxleafpage_precomp);
+}
+
+/*
+ * __wti_rec_split_write_complete --
+ *     Complete a block write handed to the write pipeline, setting the block's address.
+ */
+int
+__wti_rec_split_write_complete(WT_SESSION_IMPL *session, WT_RECONCILE *r, uint32_t multi_slot,
+  const uint8_t *addr, size_t addr_size, size_t compressed_size)
+{
+    WT_MULTI *multi;
+
+    multi = &r->multi[multi_slot];
+    WT_RET(__wt_memdup(session, addr, addr_size, &multi->addr.addr));
+    multi->addr.size = (uint8_t)addr_size;
+
+    /* Pipeline writes are never the last block. */
+    __rec_split_write_adjust(session, r, compressed_size, false);
+    return (0);
+}
+
 /*
  * __rec_split_write --
  *     Write a disk block out for the split helper functions.
@@ -2055,6 +2187,7 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_REC_CHUNK *chunk
     WT_PAGE *page;
     size_t addr_size, compressed_size;
     uint8_t addr[WT_ADDR_MAX_COOKIE];
+    bool queued;
 #ifdef HAVE_DIAGNOSTIC
     bool verify_image;
 #endif
@@ -2111,6 +2244,12 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_REC_CHUNK *chunk
 
     /* Initialize the page header(s). */
     __rec_split_write_header(session, r, chunk, multi, chunk->image.mem);
+
+    /* Record the block's value zone map. */
+    WT_CLEAR(multi->addr.zone);
+    if (page->type == WT_PAGE_ROW_LEAF && btree->value_zone_maps)
+        __rec_split_zone(session, chunk, &multi->addr.zone);
+
     if (r->page->type == WT_PAGE_COL_FIX)
         __wti_rec_col_fix_write_auxheader(session, chunk->entries, chunk->aux_start_offset,
           chunk->auxentries, chunk->image.mem, chunk->image.size);
@@ -2162,23 +2301,33 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_REC_CHUNK *chunk
         WT_ASSERT_ALWAYS(session, chunk->entries > 0, "Trying to write an empty chunk");
     }
 
+    /*
+     * Hand blocks other than the last to the write pipeline, if it's running: the block is written
+     * while we build the next one, and we collect its address before wrapping up. We write the last
+     * block ourselves, overlapping with any blocks still in the pipeline.
+     */
+    queued = false;
+    if (!last_block && compressed_image == NULL) {
+        WT_RET(__wti_rec_pipeline_queue(
+          session, r, &chunk->image, (uint32_t)(multi - r->multi), &queued));
+        if (queued)
+            WT_RET(__rec_write_check(session, &chunk->image, addr, &addr_size, false, false));
+    }
+
     /* Write the disk image and get an address. */
-    WT_RET(__rec_write(session, compressed_image == NULL ? &chunk->image : compressed_image, addr,
-      &addr_size, &compressed_size, false, F_ISSET(r, WT_REC_CHECKPOINT),
-      compressed_image != NULL));
+    if (!queued) {
+        WT_RET(__rec_write(session, compressed_image == NULL ? &chunk->image : compressed_image,
+          addr, &addr_size, &compressed_size, false, F_ISSET(r, WT_REC_CHECKPOINT),
+          compressed_image != NULL));
+        WT_RET(__wt_memdup(session, addr, addr_size, &multi->addr.addr));
+        multi->addr.size = (uint8_t)addr_size;
+
+        /* Adjust the pre-compression page size based on compression results. */
+        __rec_split_write_adjust(session, r, compressed_size, last_block);
+    }
 #ifdef HAVE_DIAGNOSTIC
     verify_image = false;
 #endif
-    WT_RET(__wt_memdup(session, addr, addr_size, &multi->addr.addr));
-    multi->addr.size = (uint8_t)addr_size;
-
-    /* Adjust the pre-compression page size based on compression results. */
-    if (WT_PAGE_IS_INTERNAL(page) && compressed_size != 0 && btree->intlpage_compadjust)
-        __rec_compression_adjust(
-          session, btree->maxintlpage, compressed_size, last_block, &btree->maxintlpage_precomp);
-    if (!WT_PAGE_IS_INTERNAL(page) && compressed_size != 0 && btree->leafpage_compadjust)
-        __rec_compression_adjust(
-          session, btree->maxleafpage, compressed_size, last_block, &btree->maxleafpage_precomp);
 
     /* Update the per-page reconciliation time statistics now that we've written something. */
     __rec_page_time_stats(session, r);
@@ -2436,6 +2585,10 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
     WT_TIME_AGGREGATE_INIT(&ta);
     previous_ref_state = 0;
 
+    /* Collect the addresses of blocks handed to the write pipeline, if not already done. */
+    if (r->pipeline_writes != 0)
+        WT_RET(__wti_rec_pipeline_wait(session, r, true));
+
     /*
      * If using the history store table eviction path and we found updates that weren't globally
      * visible when reconciling this page, copy them into the database's history store. This can
@@ -2661,8 +2814,11 @@ __rec_write_err(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 
     /*
      * On error, discard blocks we've written, they're unreferenced by the tree. This is not a
-     * question of correctness, we're avoiding block leaks.
+     * question of correctness, we're avoiding block leaks. Wait for blocks handed to the write
+     * pipeline first, so we know all of them.
      */
+    if (r->pipeline_writes != 0)
+        WT_TRET(__wti_rec_pipeline_wait(session, r, true));
     for (multi = r->multi, i = 0; i < r->multi_next; ++multi, ++i)
         if (multi->addr.addr != NULL)
             WT_TRET(__wt_btree_block_free(session, multi->addr.addr, multi->addr.size));
@@ -21,6 +21,51 @@ struct __wt_delete_hs_upd {
     WT_UPDATE *tombstone;
 };
 
+/*
+ * WT_REC_WRITE_JOB --
+ *	A block handed to the write pipeline by a reconciliation. The pipeline thread compresses,
+ * encrypts, checksums and writes a copy of the block's disk image; the reconciliation collects the
+ * block's address once the write completes.
+ */
+struct __wt_rec_write_job {
+    WT_SESSION_IMPL *session;    /* Reconciling session */
+    WT_SESSION_IMPL *sync_owner; /* Session syncing the tree, if the reconciliation is */
+    WT_DATA_HANDLE *dhandle;     /* Tree being reconciled */
+    WT_ITEM image;               /* Copy of the block's disk image */
+    uint32_t multi_slot;         /* Reconciliation's WT_MULTI slot */
+    bool checkpoint_io;          /* Written as part of a checkpoint */
+
+    uint8_t addr[WT_ADDR_MAX_COOKIE]; /* Address of the written block */
+    size_t addr_size;                 /* Address size */
+    size_t compressed_size;           /* Block size after compression */
+    int ret;                          /* Write's return */
+
+#define WT_REC_WRITE_EMPTY 0   /* Unused */
+#define WT_REC_WRITE_FILLING 1 /* Being filled in or written by the reconciling session */
+#define WT_REC_WRITE_QUEUED 2  /* Waiting for a pipeline thread */
+#define WT_REC_WRITE_BUSY 3    /* Being written by a pipeline thread */
+#define WT_REC_WRITE_DONE 4    /* Written, waiting for the reconciling session */
+    wt_shared uint32_t state;
+};
+
+/*
+ * WT_REC_WRITE_PIPELINE --
+ *	Threads writing the blocks of multi-block reconciliations (including compression, encryption
+ * and checksums), so one reconciliation can keep several block writes in flight while it builds the
+ * next block.
+ */
+struct __wt_rec_write_pipeline {
+    WT_THREAD_GROUP threads;
+    uint32_t threads_num;
+    wt_shared bool run; /* Pipeline threads are running */
+
+    WT_REC_WRITE_JOB *jobs; /* Job slots */
+    uint32_t jobs_entries;
+
+    uint64_t inflight_max;             /* Maximum bytes of queued images */
+    wt_shared uint64_t inflight_bytes; /* Bytes of queued images */
+};
+
 /*
  * Reconciliation is the process of taking an in-memory page, walking each entry
  * in the page, building a backing disk image in a temporary buffer representing
@@ -198,6 +243,8 @@ struct __wt_reconcile {
     uint32_t multi_next;
     size_t multi_allocated;
 
+    uint32_t pipeline_writes; /* Blocks with the write pipeline */
+
     /*
      * Root pages are written when wrapping up the reconciliation, remember the image we're going to
      * write.
@@ -286,6 +333,10 @@ extern int __wt_bulk_wrapup(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_ovfl_discard_add(WT_SESSION_IMPL *session, WT_PAGE *page, WT_CELL *cell)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_rec_pipeline_create(WT_SESSION_IMPL *session, const char *cfg[])
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_rec_pipeline_destroy(WT_SESSION_IMPL *session)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_reconcile(WT_SESSION_IMPL *session, WT_REF *ref, WT_SALVAGE_COOKIE *salvage,
   uint32_t flags) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern uint32_t __wt_split_page_size(int split_pct, uint32_t maxpagesize, uint32_t allocsize)
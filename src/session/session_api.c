@@ -247,6 +247,7 @@ __session_clear(WT_SESSION_IMPL *session)
 
     __wt_atomic_store32(&session->hazards.inuse, 0);
     session->hazards.num_active = 0;
+    __wt_atomic_store64(&session->hazards.filter, 0);
 }
 
 /*
@@ -394,6 +395,9 @@ __wt_session_close_internal(WT_SESSION_IMPL *session)
     /* Release common session resources. */
     WT_TRET(__wt_session_release_resources(session));
 
+    /* Return pooled updates to the connection. */
+    __wt_update_pool_session_discard(session);
+
     /* The API lock protects opening and closing of sessions. */
     __wt_spin_lock(session, &conn->api_lock);
 
@@ -10,10 +10,12 @@
 
 /*
  * __wt_session_prefetch_check --
- *     Check if pre-fetching work should be performed for a given ref.
+ *     Check if pre-fetching work should be performed for a given ref. Callers that know the pages
+ *     they are going to read, rather than guessing from a traversal, can skip the check the session
+ *     has recently read leaf pages from disk.
  */
 bool
-__wt_session_prefetch_check(WT_SESSION_IMPL *session, WT_REF *ref)
+__wt_session_prefetch_check(WT_SESSION_IMPL *session, WT_REF *ref, bool check_reads)
 {
     /*
      * Check if pre-fetching is enabled for this particular session. We don't perform pre-fetching
@@ -54,10 +56,10 @@ __wt_session_prefetch_check(WT_SESSION_IMPL *session, WT_REF *ref)
         return (false);
     }
 
-    if (session->pf.prefetch_disk_read_count == 1)
+    if (check_reads && session->pf.prefetch_disk_read_count == 1)
         WT_STAT_CONN_INCR(session, prefetch_disk_one);
 
-    if (session->pf.prefetch_disk_read_count < 2) {
+    if (check_reads && session->pf.prefetch_disk_read_count < 2) {
         WT_STAT_CONN_INCR(session, prefetch_skipped_disk_read_count);
         WT_STAT_CONN_INCR(session, prefetch_skipped);
         return (false);
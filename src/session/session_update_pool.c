@@ -0,0 +1,207 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __update_pool_local --
+ *     Return the session's own update pool, or NULL if the session can be shared between threads
+ *     and must use the connection's pool.
+ */
+static WT_INLINE WT_UPDATE_POOL *
+__update_pool_local(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    conn = S2C(session);
+    return (session == conn->default_session || session == &conn->dummy_session ?
+        NULL :
+        &session->update_pool);
+}
+
+/*
+ * __update_pool_move --
+ *     Move updates of a size class from one pool to another, until at least the given number of
+ *     bytes has moved or the class is empty.
+ */
+static void
+__update_pool_move(WT_UPDATE_POOL *from, WT_UPDATE_POOL *to, u_int class, size_t bytes)
+{
+    WT_UPDATE *upd;
+    size_t moved, size;
+
+    size = WT_UPDATE_POOL_CLASS_SIZE(class);
+    for (moved = 0; moved < bytes && (upd = from->free[class]) != NULL; moved += size) {
+        from->free[class] = upd->next;
+        from->bytes -= size;
+        upd->next = to->free[class];
+        to->free[class] = upd;
+        to->bytes += size;
+    }
+}
+
+/*
+ * __update_pool_shrink --
+ *     Move updates from one pool to another until the first holds no more than the given number of
+ *     bytes.
+ */
+static void
+__update_pool_shrink(WT_UPDATE_POOL *from, WT_UPDATE_POOL *to, size_t bytes)
+{
+    u_int class;
+
+    for (class = 0; class < WT_UPDATE_POOL_CLASSES && from->bytes > bytes; ++class)
+        __update_pool_move(from, to, class, from->bytes - bytes);
+}
+
+/*
+ * __update_pool_discard --
+ *     Free the updates in a pool.
+ */
+static void
+__update_pool_discard(WT_SESSION_IMPL *session, WT_UPDATE_POOL *pool)
+{
+    WT_UPDATE *upd;
+    u_int class;
+
+    for (class = 0; class < WT_UPDATE_POOL_CLASSES; ++class)
+        while ((upd = pool->free[class]) != NULL) {
+            pool->free[class] = upd->next;
+            pool->bytes -= WT_UPDATE_POOL_CLASS_SIZE(class);
+            WT_STAT_CONN_DECRV(session, cache_update_pool_bytes, WT_UPDATE_POOL_CLASS_SIZE(class));
+            __wt_free(session, upd);
+        }
+}
+
+/*
+ * __wt_update_pool_alloc --
+ *     Allocate a WT_UPDATE structure of the given size from the session's update pool. The
+ *     structure is cleared, not the memory following it.
+ */
+int
+__wt_update_pool_alloc(WT_SESSION_IMPL *session, size_t size, WT_UPDATE **updp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_UPDATE *upd;
+    WT_UPDATE_POOL *pool;
+    u_int class;
+
+    *updp = NULL;
+    conn = S2C(session);
+
+    WT_ASSERT(session, size >= WT_UPDATE_SIZE_NOVALUE && size <= WT_UPDATE_POOL_MAX);
+    for (class = 0; WT_UPDATE_POOL_CLASS_SIZE(class) < size; ++class)
+        ;
+    size = WT_UPDATE_POOL_CLASS_SIZE(class);
+
+    WT_STAT_CONN_INCR(session, cache_update_pool_alloc);
+
+    /*
+     * If the session's pool has no updates of the size, refill it with up to half its maximum from
+     * the connection's pool. Check the connection's pool without the lock first, it's usually the
+     * threads evicting pages filling it and often there's nothing to take.
+     */
+    if ((pool = __update_pool_local(session)) != NULL && pool->free[class] == NULL &&
+      __wt_atomic_load_pointer(&conn->update_pool.free[class]) != NULL) {
+        __wt_spin_lock(session, &conn->update_pool_lock);
+        __update_pool_move(&conn->update_pool, pool, class, conn->update_pool_session_max / 2);
+        __wt_spin_unlock(session, &conn->update_pool_lock);
+        WT_STAT_CONN_INCR(session, cache_update_pool_refill);
+    }
+
+    if (pool != NULL && (upd = pool->free[class]) != NULL) {
+        pool->free[class] = upd->next;
+        pool->bytes -= size;
+        WT_STAT_CONN_INCR(session, cache_update_pool_alloc_reuse);
+        WT_STAT_CONN_DECRV(session, cache_update_pool_bytes, size);
+
+        memset(upd, 0, sizeof(WT_UPDATE));
+    } else
+        WT_RET(__wt_calloc(session, 1, size, &upd));
+    upd->alloc = (uint8_t)(WT_UPDATE_ALLOC_POOL + class);
+
+    *updp = upd;
+    return (0);
+}
+
+/*
+ * __wt_update_pool_free --
+ *     Return a WT_UPDATE structure allocated from an update pool to the session's pool.
+ */
+void
+__wt_update_pool_free(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_UPDATE_POOL excess, *pool;
+    size_t size;
+    u_int class;
+
+    conn = S2C(session);
+    class = (u_int)(upd->alloc - WT_UPDATE_ALLOC_POOL);
+    size = WT_UPDATE_POOL_CLASS_SIZE(class);
+
+    WT_STAT_CONN_INCRV(session, cache_update_pool_bytes, size);
+
+    if ((pool = __update_pool_local(session)) != NULL) {
+        upd->next = pool->free[class];
+        pool->free[class] = upd;
+        pool->bytes += size;
+        if (pool->bytes <= conn->update_pool_session_max)
+            return;
+    }
+
+    /*
+     * The session's pool is full: move half of it to the connection's pool, and if that pushes the
+     * connection's pool past its maximum, free the excess once the lock is released.
+     */
+    WT_CLEAR(excess);
+    __wt_spin_lock(session, &conn->update_pool_lock);
+    if (pool == NULL) {
+        upd->next = conn->update_pool.free[class];
+        conn->update_pool.free[class] = upd;
+        conn->update_pool.bytes += size;
+    } else
+        __update_pool_shrink(pool, &conn->update_pool, conn->update_pool_session_max / 2);
+    __update_pool_shrink(&conn->update_pool, &excess, conn->update_pool_shared_max);
+    __wt_spin_unlock(session, &conn->update_pool_lock);
+
+    __update_pool_discard(session, &excess);
+}
+
+/*
+ * __wt_update_pool_session_discard --
+ *     Return a closing session's pooled updates to the connection's pool.
+ */
+void
+__wt_update_pool_session_discard(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_UPDATE_POOL excess, *pool;
+
+    conn = S2C(session);
+    if ((pool = __update_pool_local(session)) == NULL || pool->bytes == 0)
+        return;
+
+    WT_CLEAR(excess);
+    __wt_spin_lock(session, &conn->update_pool_lock);
+    __update_pool_shrink(pool, &conn->update_pool, 0);
+    __update_pool_shrink(&conn->update_pool, &excess, conn->update_pool_shared_max);
+    __wt_spin_unlock(session, &conn->update_pool_lock);
+
+    __update_pool_discard(session, &excess);
+}
+
+/*
+ * __wt_update_pool_destroy --
+ *     Free the connection's pooled updates.
+ */
+void
+__wt_update_pool_destroy(WT_SESSION_IMPL *session)
+{
+    __update_pool_discard(session, &S2C(session)->update_pool);
+}
@@ -28,6 +28,8 @@ __gen_name(int which)
     switch (which) {
     case WT_GEN_CHECKPOINT:
         return ("checkpoint");
+    case WT_GEN_CHUNKCACHE:
+        return ("chunk cache");
     case WT_GEN_EVICT:
         return ("evict");
     case WT_GEN_HAS_SNAPSHOT:
@@ -260,6 +262,24 @@ __gen_oldest_callback(
     return (0);
 }
 
+/*
+ * __gen_oldest_publish --
+ *     Publish the oldest generation found in use for the resource. Threads entering a generation
+ *     take the current generation, so no thread can later be found in an older one: other threads
+ *     can rely on the published value without walking the sessions.
+ */
+static void
+__gen_oldest_publish(WT_CONNECTION_IMPL *conn, int which, uint64_t oldest)
+{
+    uint64_t v;
+
+    for (;;) {
+        v = __wt_atomic_load64(&conn->generations_oldest[which]);
+        if (v >= oldest || __wt_atomic_cas64(&conn->generations_oldest[which], v, oldest))
+            break;
+    }
+}
+
 /*
  * __gen_oldest --
  *     Return the oldest generation in use for the resource.
@@ -284,6 +304,7 @@ __gen_oldest(WT_SESSION_IMPL *session, int which)
 
     WT_IGNORE_RET(__wt_session_array_walk(session, __gen_oldest_callback, false, &cookie));
 
+    __gen_oldest_publish(conn, which, cookie.ret_oldest_gen);
     return (cookie.ret_oldest_gen);
 }
 
@@ -320,6 +341,10 @@ __wt_gen_active(WT_SESSION_IMPL *session, int which, uint64_t generation)
 {
     WT_GENERATION_COOKIE cookie;
 
+    /* No thread can be in a generation older than the oldest generation last found. */
+    if (generation < __wt_atomic_load64(&S2C(session)->generations_oldest[which]))
+        return (false);
+
     WT_CLEAR(cookie);
     cookie.which = which;
     cookie.target_generation = generation;
@@ -399,13 +424,20 @@ __stash_discard(WT_SESSION_IMPL *session, int which)
     WT_SESSION_STASH *session_stash;
     WT_STASH *stash;
     size_t i;
-    uint64_t oldest;
+    uint64_t oldest, own;
+    bool walked;
 
     conn = S2C(session);
     session_stash = &session->stash[which];
 
-    /* Get the resource's oldest generation. */
-    oldest = __gen_oldest(session, which);
+    /*
+     * Start with the resource's oldest generation last found, and only walk the sessions for the
+     * current one when that isn't enough to discard an object. Walking the sessions can't help if
+     * our own generation isn't newer than the object's.
+     */
+    oldest = __wt_atomic_load64(&conn->generations_oldest[which]);
+    own = __wt_session_gen(session, which);
+    walked = false;
 
     for (i = 0, stash = session_stash->list; i < session_stash->cnt; ++i, ++stash) {
         if (stash->p == NULL)
@@ -414,8 +446,14 @@ __stash_discard(WT_SESSION_IMPL *session, int which)
          * The list is expected to be in generation-sorted order, quit as soon as we find a object
          * we can't discard.
          */
-        if (stash->gen >= oldest)
-            break;
+        if (stash->gen >= oldest) {
+            if (walked || (own != 0 && own <= stash->gen))
+                break;
+            oldest = __gen_oldest(session, which);
+            walked = true;
+            if (stash->gen >= oldest)
+                break;
+        }
 
         (void)__wt_atomic_sub64(&conn->stashed_bytes, stash->len);
         (void)__wt_atomic_sub64(&conn->stashed_objects, 1);
@@ -134,6 +134,13 @@ __wt_hazard_set_func(WT_SESSION_IMPL *session, WT_REF *ref, bool *busyp
 
     WT_ASSERT(session, hp->ref == NULL);
 
+    /*
+     * Add the page to the session's hazard pointer summary before publishing the hazard pointer,
+     * the barrier below orders both before we check the page's state.
+     */
+    __wt_atomic_store64(
+      &session->hazards.filter, session->hazards.filter | WT_HAZARD_FILTER_BIT(ref));
+
     /*
      * Do the dance:
      *
@@ -175,6 +182,8 @@ __wt_hazard_set_func(WT_SESSION_IMPL *session, WT_REF *ref, bool *busyp
      * eviction.
      */
     hp->ref = NULL;
+    if (session->hazards.num_active == 0)
+        __wt_atomic_store64(&session->hazards.filter, 0);
     *busyp = true;
     return (0);
 }
@@ -206,14 +215,16 @@ __wt_hazard_clear(WT_SESSION_IMPL *session, WT_REF *ref)
             WT_RELEASE_WRITE(hp->ref, NULL);
 
             /*
-             * If this was the last hazard pointer in the session, reset the size so that checks can
-             * skip this session.
+             * If this was the last hazard pointer in the session, reset the size and the summary so
+             * that checks can skip this session.
              *
              * A write-barrier() is necessary before the change to the in-use value, the number of
              * active references can never be less than the number of in-use slots.
              */
-            if (--session->hazards.num_active == 0)
+            if (--session->hazards.num_active == 0) {
+                WT_RELEASE_WRITE(session->hazards.filter, 0);
                 WT_RELEASE_WRITE_WITH_BARRIER(session->hazards.inuse, 0);
+            }
             return (0);
         }
 
@@ -270,6 +281,7 @@ __wt_hazard_close(WT_SESSION_IMPL *session)
             hp->ref = NULL;
             --session->hazards.num_active;
         }
+    __wt_atomic_store64(&session->hazards.filter, 0);
 
     if (session->hazards.num_active != 0)
         __wt_errx(session, "session %p: close hazard pointer table: count didn't match entries",
@@ -309,6 +321,15 @@ __hazard_check_callback(
     uint32_t hazard_inuse, i;
 
     cookie = (WT_HAZARD_COOKIE *)cookiep;
+
+    /*
+     * Skip the session's hazard pointer array if its summary doesn't include the page. The caller
+     * locked the page before checking, so any hazard pointer set after the summary was read will
+     * see the locked state and back off.
+     */
+    if ((__wt_atomic_load64(&array_session->hazards.filter) & cookie->search_bit) == 0)
+        return (0);
+
     hazard_get_reference(array_session, &cookie->ret_hp, &hazard_inuse);
 
     if (hazard_inuse > cookie->max) {
@@ -347,6 +368,7 @@ __wt_hazard_check(WT_SESSION_IMPL *session, WT_REF *ref, WT_SESSION_IMPL **sessi
     WT_CLEAR(cookie);
     cookie.ret_session = sessionp;
     cookie.search_ref = ref;
+    cookie.search_bit = WT_HAZARD_FILTER_BIT(ref);
 
     /* If a file can never be evicted, hazard pointers aren't required. */
     if (F_ISSET(S2BT(session), WT_BTREE_IN_MEMORY))
@@ -46,9 +46,13 @@ __wt_buf_grow_worker(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t size)
 
     /*
      * This function is also used to ensure data is local to the buffer, check to see if we actually
-     * need to grow anything.
+     * need to grow anything. Buffers used for direct I/O must be aligned, reallocate them if they
+     * aren't, regardless of size.
      */
-    if (size > buf->memsize)
+    if (F_ISSET(buf, WT_ITEM_ALIGNED)) {
+        if (size > buf->memsize || !WT_PTR_ALIGNED(buf->mem, S2C(session)->buffer_alignment))
+            WT_RET(__wt_realloc_aligned(session, &buf->memsize, size, &buf->mem));
+    } else if (size > buf->memsize)
         WT_RET(__wt_realloc_noclear(session, &buf->memsize, size, &buf->mem));
 
     if (buf->data == NULL) {
@@ -340,9 +344,13 @@ __wt_scr_alloc_func(WT_SESSION_IMPL *session, size_t size, WT_ITEM **scratchp
         WT_ERR(__wt_calloc_one(session, best));
     }
 
-    /* Grow the buffer as necessary and return. */
+    /*
+     * Grow the buffer as necessary and return. Scratch buffers are the session's pool of buffers
+     * aligned for direct I/O: blocks are compressed and encrypted into them, and the block manager
+     * does its other I/O using them.
+     */
     session->scratch_cached -= (*best)->memsize;
-    WT_ERR(__wt_buf_init(session, *best, size));
+    WT_ERR(__wt_buf_init_aligned(session, *best, size));
     F_SET(*best, WT_ITEM_INUSE);
 
 #ifdef HAVE_DIAGNOSTIC
@@ -9,7 +9,9 @@ static const char *const __stats_dsrc_desc[] = {
   "backup: total modified incremental blocks without compressed data",
   "block-manager: allocations requiring file extension",
   "block-manager: blocks allocated",
+  "block-manager: blocks allocated from allocation arenas",
   "block-manager: blocks freed",
+  "block-manager: blocks freed into allocation arenas",
   "block-manager: checkpoint size",
   "block-manager: file allocation unit size",
   "block-manager: file bytes available for reuse",
@@ -103,6 +105,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: multi-block reconciliation blocked whilst checkpoint is running",
   "cache: overflow keys on a multiblock row-store page blocked its eviction",
   "cache: overflow pages read into cache",
+  "cache: page arena chunks allocated",
   "cache: page split during eviction deepened the tree",
   "cache: page written requiring history store records",
   "cache: pages dirtied due to obsolete time window by eviction",
@@ -183,6 +186,9 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: Total number of entries skipped to position the history store cursor",
   "cursor: Total number of in-memory deleted pages skipped during tree walk",
   "cursor: Total number of on-disk deleted pages skipped during tree walk",
+  "cursor: Total number of pages skipped during tree walk by cursor value bounds",
+  "cursor: Total number of searches not resolved by the adaptive hash index",
+  "cursor: Total number of searches resolved by the adaptive hash index",
   "cursor: Total number of times a search near has exited due to prefix config",
   "cursor: Total number of times cursor fails to temporarily release pinned page to encourage "
   "eviction of hot or large page",
@@ -225,6 +231,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: cursor reopen calls that return an error",
   "cursor: cursor reserve calls that return an error",
   "cursor: cursor reset calls that return an error",
+  "cursor: cursor search batch calls that return an error",
   "cursor: cursor search calls that return an error",
   "cursor: cursor search near calls that return an error",
   "cursor: cursor update calls that return an error",
@@ -241,6 +248,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: remove key bytes removed",
   "cursor: reserve calls",
   "cursor: reset calls",
+  "cursor: search batch calls",
   "cursor: search calls",
   "cursor: search history store calls",
   "cursor: search near calls",
@@ -329,13 +337,21 @@ __wt_stat_dsrc_init_single(WT_DSRC_STATS *stats)
 int
 __wt_stat_dsrc_init(WT_SESSION_IMPL *session, WT_DATA_HANDLE *handle)
 {
+    size_t size;
     int i;
+    uint8_t *p;
 
-    WT_RET(__wt_calloc(session, (size_t)WT_STAT_DSRC_COUNTER_SLOTS, sizeof(*handle->stat_array),
-      &handle->stat_array));
+    /*
+     * Pad each slot's structure to a cache line boundary so threads updating different slots never
+     * share a cache line.
+     */
+    size = WT_ALIGN(sizeof(WT_DSRC_STATS), WT_CACHE_LINE_ALIGNMENT);
+    WT_RET(__wt_calloc(session, 1,
+      (size_t)WT_STAT_DSRC_COUNTER_SLOTS * size + WT_CACHE_LINE_ALIGNMENT, &handle->stat_array));
 
+    p = (uint8_t *)WT_ALIGN((uintptr_t)handle->stat_array, WT_CACHE_LINE_ALIGNMENT);
     for (i = 0; i < WT_STAT_DSRC_COUNTER_SLOTS; ++i) {
-        handle->stats[i] = &handle->stat_array[i];
+        handle->stats[i] = (WT_DSRC_STATS *)(p + (size_t)i * size);
         __wt_stat_dsrc_init_single(handle->stats[i]);
     }
     return (0);
@@ -356,7 +372,9 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->backup_blocks_uncompressed = 0;
     stats->block_extension = 0;
     stats->block_alloc = 0;
+    stats->block_arena_alloc = 0;
     stats->block_free = 0;
+    stats->block_arena_free = 0;
     stats->block_checkpoint_size = 0;
     stats->allocation_size = 0;
     stats->block_reuse_bytes = 0;
@@ -439,6 +457,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cache_eviction_blocked_multi_block_reconciliation_during_checkpoint = 0;
     stats->cache_eviction_blocked_overflow_keys = 0;
     stats->cache_read_overflow = 0;
+    stats->cache_page_arena_chunk = 0;
     stats->cache_eviction_deepen = 0;
     stats->cache_write_hs = 0;
     stats->cache_eviction_dirty_obsolete_tw = 0;
@@ -517,6 +536,9 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_skip_hs_cur_position = 0;
     stats->cursor_tree_walk_inmem_del_page_skip = 0;
     stats->cursor_tree_walk_ondisk_del_page_skip = 0;
+    stats->cursor_tree_walk_zone_page_skip = 0;
+    stats->cursor_search_ahi_miss = 0;
+    stats->cursor_search_ahi_hit = 0;
     stats->cursor_search_near_prefix_fast_paths = 0;
     stats->cursor_reposition_failed = 0;
     stats->cursor_reposition = 0;
@@ -557,6 +579,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_reopen_error = 0;
     stats->cursor_reserve_error = 0;
     stats->cursor_reset_error = 0;
+    stats->cursor_search_batch_error = 0;
     stats->cursor_search_error = 0;
     stats->cursor_search_near_error = 0;
     stats->cursor_update_error = 0;
@@ -573,6 +596,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_remove_bytes = 0;
     stats->cursor_reserve = 0;
     stats->cursor_reset = 0;
+    stats->cursor_search_batch = 0;
     stats->cursor_search = 0;
     stats->cursor_search_hs = 0;
     stats->cursor_search_near = 0;
@@ -657,7 +681,9 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->backup_blocks_uncompressed += from->backup_blocks_uncompressed;
     to->block_extension += from->block_extension;
     to->block_alloc += from->block_alloc;
+    to->block_arena_alloc += from->block_arena_alloc;
     to->block_free += from->block_free;
+    to->block_arena_free += from->block_arena_free;
     to->block_checkpoint_size += from->block_checkpoint_size;
     if (from->allocation_size > to->allocation_size)
         to->allocation_size = from->allocation_size;
@@ -758,6 +784,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
       from->cache_eviction_blocked_multi_block_reconciliation_during_checkpoint;
     to->cache_eviction_blocked_overflow_keys += from->cache_eviction_blocked_overflow_keys;
     to->cache_read_overflow += from->cache_read_overflow;
+    to->cache_page_arena_chunk += from->cache_page_arena_chunk;
     to->cache_eviction_deepen += from->cache_eviction_deepen;
     to->cache_write_hs += from->cache_write_hs;
     to->cache_eviction_dirty_obsolete_tw += from->cache_eviction_dirty_obsolete_tw;
@@ -839,6 +866,9 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_skip_hs_cur_position += from->cursor_skip_hs_cur_position;
     to->cursor_tree_walk_inmem_del_page_skip += from->cursor_tree_walk_inmem_del_page_skip;
     to->cursor_tree_walk_ondisk_del_page_skip += from->cursor_tree_walk_ondisk_del_page_skip;
+    to->cursor_tree_walk_zone_page_skip += from->cursor_tree_walk_zone_page_skip;
+    to->cursor_search_ahi_miss += from->cursor_search_ahi_miss;
+    to->cursor_search_ahi_hit += from->cursor_search_ahi_hit;
     to->cursor_search_near_prefix_fast_paths += from->cursor_search_near_prefix_fast_paths;
     to->cursor_reposition_failed += from->cursor_reposition_failed;
     to->cursor_reposition += from->cursor_reposition;
@@ -880,6 +910,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_reopen_error += from->cursor_reopen_error;
     to->cursor_reserve_error += from->cursor_reserve_error;
     to->cursor_reset_error += from->cursor_reset_error;
+    to->cursor_search_batch_error += from->cursor_search_batch_error;
     to->cursor_search_error += from->cursor_search_error;
     to->cursor_search_near_error += from->cursor_search_near_error;
     to->cursor_update_error += from->cursor_update_error;
@@ -896,6 +927,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_remove_bytes += from->cursor_remove_bytes;
     to->cursor_reserve += from->cursor_reserve;
     to->cursor_reset += from->cursor_reset;
+    to->cursor_search_batch += from->cursor_search_batch;
     to->cursor_search += from->cursor_search;
     to->cursor_search_hs += from->cursor_search_hs;
     to->cursor_search_near += from->cursor_search_near;
@@ -966,353 +998,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
 void
 __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
 {
-    int64_t v;
-
-    to->autocommit_readonly_retry += WT_STAT_DSRC_READ(from, autocommit_readonly_retry);
-    to->autocommit_update_retry += WT_STAT_DSRC_READ(from, autocommit_update_retry);
-    to->backup_blocks_compressed += WT_STAT_DSRC_READ(from, backup_blocks_compressed);
-    to->backup_blocks_uncompressed += WT_STAT_DSRC_READ(from, backup_blocks_uncompressed);
-    to->block_extension += WT_STAT_DSRC_READ(from, block_extension);
-    to->block_alloc += WT_STAT_DSRC_READ(from, block_alloc);
-    to->block_free += WT_STAT_DSRC_READ(from, block_free);
-    to->block_checkpoint_size += WT_STAT_DSRC_READ(from, block_checkpoint_size);
-    if ((v = WT_STAT_DSRC_READ(from, allocation_size)) > to->allocation_size)
-        to->allocation_size = v;
-    to->block_reuse_bytes += WT_STAT_DSRC_READ(from, block_reuse_bytes);
-    if ((v = WT_STAT_DSRC_READ(from, block_magic)) > to->block_magic)
-        to->block_magic = v;
-    if ((v = WT_STAT_DSRC_READ(from, block_major)) > to->block_major)
-        to->block_major = v;
-    to->block_size += WT_STAT_DSRC_READ(from, block_size);
-    if ((v = WT_STAT_DSRC_READ(from, block_minor)) > to->block_minor)
-        to->block_minor = v;
-    to->btree_checkpoint_generation += WT_STAT_DSRC_READ(from, btree_checkpoint_generation);
-    to->btree_clean_checkpoint_timer += WT_STAT_DSRC_READ(from, btree_clean_checkpoint_timer);
-    to->btree_compact_pages_reviewed += WT_STAT_DSRC_READ(from, btree_compact_pages_reviewed);
-    to->btree_compact_pages_rewritten += WT_STAT_DSRC_READ(from, btree_compact_pages_rewritten);
-    to->btree_compact_pages_skipped += WT_STAT_DSRC_READ(from, btree_compact_pages_skipped);
-    to->btree_compact_bytes_rewritten_expected +=
-      WT_STAT_DSRC_READ(from, btree_compact_bytes_rewritten_expected);
-    to->btree_compact_pages_rewritten_expected +=
-      WT_STAT_DSRC_READ(from, btree_compact_pages_rewritten_expected);
-    to->btree_checkpoint_pages_reconciled +=
-      WT_STAT_DSRC_READ(from, btree_checkpoint_pages_reconciled);
-    to->btree_compact_skipped += WT_STAT_DSRC_READ(from, btree_compact_skipped);
-    to->btree_column_fix += WT_STAT_DSRC_READ(from, btree_column_fix);
-    to->btree_column_tws += WT_STAT_DSRC_READ(from, btree_column_tws);
-    to->btree_column_internal += WT_STAT_DSRC_READ(from, btree_column_internal);
-    to->btree_column_rle += WT_STAT_DSRC_READ(from, btree_column_rle);
-    to->btree_column_deleted += WT_STAT_DSRC_READ(from, btree_column_deleted);
-    to->btree_column_variable += WT_STAT_DSRC_READ(from, btree_column_variable);
-    if ((v = WT_STAT_DSRC_READ(from, btree_fixed_len)) > to->btree_fixed_len)
-        to->btree_fixed_len = v;
-    if ((v = WT_STAT_DSRC_READ(from, btree_maxintlpage)) > to->btree_maxintlpage)
-        to->btree_maxintlpage = v;
-    if ((v = WT_STAT_DSRC_READ(from, btree_maxleafkey)) > to->btree_maxleafkey)
-        to->btree_maxleafkey = v;
-    if ((v = WT_STAT_DSRC_READ(from, btree_maxleafpage)) > to->btree_maxleafpage)
-        to->btree_maxleafpage = v;
-    if ((v = WT_STAT_DSRC_READ(from, btree_maxleafvalue)) > to->btree_maxleafvalue)
-        to->btree_maxleafvalue = v;
-    if ((v = WT_STAT_DSRC_READ(from, btree_maximum_depth)) > to->btree_maximum_depth)
-        to->btree_maximum_depth = v;
-    to->btree_entries += WT_STAT_DSRC_READ(from, btree_entries);
-    to->btree_overflow += WT_STAT_DSRC_READ(from, btree_overflow);
-    to->btree_row_empty_values += WT_STAT_DSRC_READ(from, btree_row_empty_values);
-    to->btree_row_internal += WT_STAT_DSRC_READ(from, btree_row_internal);
-    to->btree_row_leaf += WT_STAT_DSRC_READ(from, btree_row_leaf);
-    to->cache_bytes_inuse += WT_STAT_DSRC_READ(from, cache_bytes_inuse);
-    to->cache_bytes_dirty_total += WT_STAT_DSRC_READ(from, cache_bytes_dirty_total);
-    to->cache_bytes_read += WT_STAT_DSRC_READ(from, cache_bytes_read);
-    to->cache_bytes_write += WT_STAT_DSRC_READ(from, cache_bytes_write);
-    to->cache_eviction_blocked_checkpoint +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_checkpoint);
-    to->cache_eviction_blocked_checkpoint_hs +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_checkpoint_hs);
-    to->eviction_fail += WT_STAT_DSRC_READ(from, eviction_fail);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_1 +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_1);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_2 +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_2);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_3 +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_3);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_4 +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_4);
-    to->cache_eviction_blocked_remove_hs_race_with_checkpoint +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_remove_hs_race_with_checkpoint);
-    to->cache_eviction_blocked_no_progress +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_no_progress);
-    to->eviction_walk_passes += WT_STAT_DSRC_READ(from, eviction_walk_passes);
-    to->cache_eviction_target_page_lt10 += WT_STAT_DSRC_READ(from, cache_eviction_target_page_lt10);
-    to->cache_eviction_target_page_lt32 += WT_STAT_DSRC_READ(from, cache_eviction_target_page_lt32);
-    to->cache_eviction_target_page_ge128 +=
-      WT_STAT_DSRC_READ(from, cache_eviction_target_page_ge128);
-    to->cache_eviction_target_page_lt64 += WT_STAT_DSRC_READ(from, cache_eviction_target_page_lt64);
-    to->cache_eviction_target_page_lt128 +=
-      WT_STAT_DSRC_READ(from, cache_eviction_target_page_lt128);
-    to->cache_eviction_target_page_reduced +=
-      WT_STAT_DSRC_READ(from, cache_eviction_target_page_reduced);
-    to->cache_eviction_blocked_hazard += WT_STAT_DSRC_READ(from, cache_eviction_blocked_hazard);
-    to->cache_hs_insert += WT_STAT_DSRC_READ(from, cache_hs_insert);
-    to->cache_hs_insert_restart += WT_STAT_DSRC_READ(from, cache_hs_insert_restart);
-    to->cache_hs_read += WT_STAT_DSRC_READ(from, cache_hs_read);
-    to->cache_hs_read_miss += WT_STAT_DSRC_READ(from, cache_hs_read_miss);
-    to->cache_hs_read_squash += WT_STAT_DSRC_READ(from, cache_hs_read_squash);
-    to->cache_hs_order_lose_durable_timestamp +=
-      WT_STAT_DSRC_READ(from, cache_hs_order_lose_durable_timestamp);
-    to->cache_hs_key_truncate_rts_unstable +=
-      WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts_unstable);
-    to->cache_hs_key_truncate_rts += WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts);
-    to->cache_hs_btree_truncate += WT_STAT_DSRC_READ(from, cache_hs_btree_truncate);
-    to->cache_hs_key_truncate += WT_STAT_DSRC_READ(from, cache_hs_key_truncate);
-    to->cache_hs_order_remove += WT_STAT_DSRC_READ(from, cache_hs_order_remove);
-    to->cache_hs_key_truncate_onpage_removal +=
-      WT_STAT_DSRC_READ(from, cache_hs_key_truncate_onpage_removal);
-    to->cache_hs_btree_truncate_dryrun += WT_STAT_DSRC_READ(from, cache_hs_btree_truncate_dryrun);
-    to->cache_hs_key_truncate_rts_unstable_dryrun +=
-      WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts_unstable_dryrun);
-    to->cache_hs_key_truncate_rts_dryrun +=
-      WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts_dryrun);
-    to->cache_hs_order_reinsert += WT_STAT_DSRC_READ(from, cache_hs_order_reinsert);
-    to->cache_hs_write_squash += WT_STAT_DSRC_READ(from, cache_hs_write_squash);
-    to->cache_inmem_splittable += WT_STAT_DSRC_READ(from, cache_inmem_splittable);
-    to->cache_inmem_split += WT_STAT_DSRC_READ(from, cache_inmem_split);
-    to->cache_eviction_blocked_internal_page_split +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_internal_page_split);
-    to->cache_eviction_internal += WT_STAT_DSRC_READ(from, cache_eviction_internal);
-    to->cache_eviction_split_internal += WT_STAT_DSRC_READ(from, cache_eviction_split_internal);
-    to->cache_eviction_split_leaf += WT_STAT_DSRC_READ(from, cache_eviction_split_leaf);
-    to->cache_eviction_random_sample_inmem_root +=
-      WT_STAT_DSRC_READ(from, cache_eviction_random_sample_inmem_root);
-    to->cache_eviction_dirty += WT_STAT_DSRC_READ(from, cache_eviction_dirty);
-    to->cache_eviction_blocked_multi_block_reconciliation_during_checkpoint +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_multi_block_reconciliation_during_checkpoint);
-    to->cache_eviction_blocked_overflow_keys +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_overflow_keys);
-    to->cache_read_overflow += WT_STAT_DSRC_READ(from, cache_read_overflow);
-    to->cache_eviction_deepen += WT_STAT_DSRC_READ(from, cache_eviction_deepen);
-    to->cache_write_hs += WT_STAT_DSRC_READ(from, cache_write_hs);
-    to->cache_eviction_dirty_obsolete_tw +=
-      WT_STAT_DSRC_READ(from, cache_eviction_dirty_obsolete_tw);
-    to->cache_read += WT_STAT_DSRC_READ(from, cache_read);
-    to->cache_read_deleted += WT_STAT_DSRC_READ(from, cache_read_deleted);
-    to->cache_read_deleted_prepared += WT_STAT_DSRC_READ(from, cache_read_deleted_prepared);
-    to->cache_read_checkpoint += WT_STAT_DSRC_READ(from, cache_read_checkpoint);
-    to->cache_pages_requested += WT_STAT_DSRC_READ(from, cache_pages_requested);
-    to->cache_pages_prefetch += WT_STAT_DSRC_READ(from, cache_pages_prefetch);
-    to->cache_eviction_pages_seen += WT_STAT_DSRC_READ(from, cache_eviction_pages_seen);
-    to->cache_write += WT_STAT_DSRC_READ(from, cache_write);
-    to->cache_write_restore += WT_STAT_DSRC_READ(from, cache_write_restore);
-    to->cache_eviction_blocked_recently_modified +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_recently_modified);
-    to->cache_reverse_splits += WT_STAT_DSRC_READ(from, cache_reverse_splits);
-    to->cache_reverse_splits_skipped_vlcs +=
-      WT_STAT_DSRC_READ(from, cache_reverse_splits_skipped_vlcs);
-    to->cache_hs_insert_full_update += WT_STAT_DSRC_READ(from, cache_hs_insert_full_update);
-    to->cache_hs_insert_reverse_modify += WT_STAT_DSRC_READ(from, cache_hs_insert_reverse_modify);
-    to->cache_bytes_dirty += WT_STAT_DSRC_READ(from, cache_bytes_dirty);
-    to->cache_bytes_dirty_internal += WT_STAT_DSRC_READ(from, cache_bytes_dirty_internal);
-    to->cache_bytes_dirty_leaf += WT_STAT_DSRC_READ(from, cache_bytes_dirty_leaf);
-    to->cache_eviction_blocked_uncommitted_truncate +=
-      WT_STAT_DSRC_READ(from, cache_eviction_blocked_uncommitted_truncate);
-    to->cache_eviction_clean += WT_STAT_DSRC_READ(from, cache_eviction_clean);
-    to->cache_state_gen_avg_gap += WT_STAT_DSRC_READ(from, cache_state_gen_avg_gap);
-    to->cache_state_avg_written_size += WT_STAT_DSRC_READ(from, cache_state_avg_written_size);
-    to->cache_state_avg_visited_age += WT_STAT_DSRC_READ(from, cache_state_avg_visited_age);
-    to->cache_state_avg_unvisited_age += WT_STAT_DSRC_READ(from, cache_state_avg_unvisited_age);
-    to->cache_state_pages_clean += WT_STAT_DSRC_READ(from, cache_state_pages_clean);
-    to->cache_state_gen_current += WT_STAT_DSRC_READ(from, cache_state_gen_current);
-    to->cache_state_pages_dirty += WT_STAT_DSRC_READ(from, cache_state_pages_dirty);
-    to->cache_state_root_entries += WT_STAT_DSRC_READ(from, cache_state_root_entries);
-    to->cache_state_pages_internal += WT_STAT_DSRC_READ(from, cache_state_pages_internal);
-    to->cache_state_pages_leaf += WT_STAT_DSRC_READ(from, cache_state_pages_leaf);
-    to->cache_state_gen_max_gap += WT_STAT_DSRC_READ(from, cache_state_gen_max_gap);
-    to->cache_state_max_pagesize += WT_STAT_DSRC_READ(from, cache_state_max_pagesize);
-    to->cache_state_min_written_size += WT_STAT_DSRC_READ(from, cache_state_min_written_size);
-    to->cache_state_unvisited_count += WT_STAT_DSRC_READ(from, cache_state_unvisited_count);
-    to->cache_state_smaller_alloc_size += WT_STAT_DSRC_READ(from, cache_state_smaller_alloc_size);
-    to->cache_state_memory += WT_STAT_DSRC_READ(from, cache_state_memory);
-    to->cache_state_queued += WT_STAT_DSRC_READ(from, cache_state_queued);
-    to->cache_state_not_queueable += WT_STAT_DSRC_READ(from, cache_state_not_queueable);
-    to->cache_state_refs_skipped += WT_STAT_DSRC_READ(from, cache_state_refs_skipped);
-    to->cache_state_root_size += WT_STAT_DSRC_READ(from, cache_state_root_size);
-    to->cache_state_pages += WT_STAT_DSRC_READ(from, cache_state_pages);
-    to->checkpoint_snapshot_acquired += WT_STAT_DSRC_READ(from, checkpoint_snapshot_acquired);
-    to->checkpoint_cleanup_pages_evict += WT_STAT_DSRC_READ(from, checkpoint_cleanup_pages_evict);
-    to->checkpoint_cleanup_pages_obsolete_tw +=
-      WT_STAT_DSRC_READ(from, checkpoint_cleanup_pages_obsolete_tw);
-    to->checkpoint_cleanup_pages_read_reclaim_space +=
-      WT_STAT_DSRC_READ(from, checkpoint_cleanup_pages_read_reclaim_space);
-    to->checkpoint_cleanup_pages_read_obsolete_tw +=
-      WT_STAT_DSRC_READ(from, checkpoint_cleanup_pages_read_obsolete_tw);
-    to->checkpoint_cleanup_pages_removed +=
-      WT_STAT_DSRC_READ(from, checkpoint_cleanup_pages_removed);
-    to->checkpoint_cleanup_pages_walk_skipped +=
-      WT_STAT_DSRC_READ(from, checkpoint_cleanup_pages_walk_skipped);
-    to->checkpoint_cleanup_pages_visited +=
-      WT_STAT_DSRC_READ(from, checkpoint_cleanup_pages_visited);
-    to->checkpoint_obsolete_applied += WT_STAT_DSRC_READ(from, checkpoint_obsolete_applied);
-    to->compress_precomp_intl_max_page_size +=
-      WT_STAT_DSRC_READ(from, compress_precomp_intl_max_page_size);
-    to->compress_precomp_leaf_max_page_size +=
-      WT_STAT_DSRC_READ(from, compress_precomp_leaf_max_page_size);
-    to->compress_write_fail += WT_STAT_DSRC_READ(from, compress_write_fail);
-    to->compress_write_too_small += WT_STAT_DSRC_READ(from, compress_write_too_small);
-    to->compress_read += WT_STAT_DSRC_READ(from, compress_read);
-    to->compress_read_ratio_hist_max += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_max);
-    to->compress_read_ratio_hist_2 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_2);
-    to->compress_read_ratio_hist_4 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_4);
-    to->compress_read_ratio_hist_8 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_8);
-    to->compress_read_ratio_hist_16 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_16);
-    to->compress_read_ratio_hist_32 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_32);
-    to->compress_read_ratio_hist_64 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_64);
-    to->compress_write += WT_STAT_DSRC_READ(from, compress_write);
-    to->compress_write_ratio_hist_max += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_max);
-    to->compress_write_ratio_hist_2 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_2);
-    to->compress_write_ratio_hist_4 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_4);
-    to->compress_write_ratio_hist_8 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_8);
-    to->compress_write_ratio_hist_16 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_16);
-    to->compress_write_ratio_hist_32 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_32);
-    to->compress_write_ratio_hist_64 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_64);
-    to->cursor_tree_walk_del_page_skip += WT_STAT_DSRC_READ(from, cursor_tree_walk_del_page_skip);
-    to->cursor_next_skip_total += WT_STAT_DSRC_READ(from, cursor_next_skip_total);
-    to->cursor_prev_skip_total += WT_STAT_DSRC_READ(from, cursor_prev_skip_total);
-    to->cursor_skip_hs_cur_position += WT_STAT_DSRC_READ(from, cursor_skip_hs_cur_position);
-    to->cursor_tree_walk_inmem_del_page_skip +=
-      WT_STAT_DSRC_READ(from, cursor_tree_walk_inmem_del_page_skip);
-    to->cursor_tree_walk_ondisk_del_page_skip +=
-      WT_STAT_DSRC_READ(from, cursor_tree_walk_ondisk_del_page_skip);
-    to->cursor_search_near_prefix_fast_paths +=
-      WT_STAT_DSRC_READ(from, cursor_search_near_prefix_fast_paths);
-    to->cursor_reposition_failed += WT_STAT_DSRC_READ(from, cursor_reposition_failed);
-    to->cursor_reposition += WT_STAT_DSRC_READ(from, cursor_reposition);
-    to->cursor_insert_bulk += WT_STAT_DSRC_READ(from, cursor_insert_bulk);
-    to->cursor_reopen += WT_STAT_DSRC_READ(from, cursor_reopen);
-    to->cursor_cache += WT_STAT_DSRC_READ(from, cursor_cache);
-    to->cursor_create += WT_STAT_DSRC_READ(from, cursor_create);
-    to->cursor_bound_error += WT_STAT_DSRC_READ(from, cursor_bound_error);
-    to->cursor_bounds_reset += WT_STAT_DSRC_READ(from, cursor_bounds_reset);
-    to->cursor_bounds_comparisons += WT_STAT_DSRC_READ(from, cursor_bounds_comparisons);
-    to->cursor_bounds_next_unpositioned += WT_STAT_DSRC_READ(from, cursor_bounds_next_unpositioned);
-    to->cursor_bounds_next_early_exit += WT_STAT_DSRC_READ(from, cursor_bounds_next_early_exit);
-    to->cursor_bounds_prev_unpositioned += WT_STAT_DSRC_READ(from, cursor_bounds_prev_unpositioned);
-    to->cursor_bounds_prev_early_exit += WT_STAT_DSRC_READ(from, cursor_bounds_prev_early_exit);
-    to->cursor_bounds_search_early_exit += WT_STAT_DSRC_READ(from, cursor_bounds_search_early_exit);
-    to->cursor_bounds_search_near_repositioned_cursor +=
-      WT_STAT_DSRC_READ(from, cursor_bounds_search_near_repositioned_cursor);
-    to->cursor_cache_error += WT_STAT_DSRC_READ(from, cursor_cache_error);
-    to->cursor_close_error += WT_STAT_DSRC_READ(from, cursor_close_error);
-    to->cursor_compare_error += WT_STAT_DSRC_READ(from, cursor_compare_error);
-    to->cursor_equals_error += WT_STAT_DSRC_READ(from, cursor_equals_error);
-    to->cursor_get_key_error += WT_STAT_DSRC_READ(from, cursor_get_key_error);
-    to->cursor_get_value_error += WT_STAT_DSRC_READ(from, cursor_get_value_error);
-    to->cursor_insert_error += WT_STAT_DSRC_READ(from, cursor_insert_error);
-    to->cursor_insert_check_error += WT_STAT_DSRC_READ(from, cursor_insert_check_error);
-    to->cursor_largest_key_error += WT_STAT_DSRC_READ(from, cursor_largest_key_error);
-    to->cursor_modify_error += WT_STAT_DSRC_READ(from, cursor_modify_error);
-    to->cursor_next_error += WT_STAT_DSRC_READ(from, cursor_next_error);
-    to->cursor_next_hs_tombstone += WT_STAT_DSRC_READ(from, cursor_next_hs_tombstone);
-    to->cursor_next_skip_lt_100 += WT_STAT_DSRC_READ(from, cursor_next_skip_lt_100);
-    to->cursor_next_skip_ge_100 += WT_STAT_DSRC_READ(from, cursor_next_skip_ge_100);
-    to->cursor_next_random_error += WT_STAT_DSRC_READ(from, cursor_next_random_error);
-    to->cursor_prev_error += WT_STAT_DSRC_READ(from, cursor_prev_error);
-    to->cursor_prev_hs_tombstone += WT_STAT_DSRC_READ(from, cursor_prev_hs_tombstone);
-    to->cursor_prev_skip_ge_100 += WT_STAT_DSRC_READ(from, cursor_prev_skip_ge_100);
-    to->cursor_prev_skip_lt_100 += WT_STAT_DSRC_READ(from, cursor_prev_skip_lt_100);
-    to->cursor_reconfigure_error += WT_STAT_DSRC_READ(from, cursor_reconfigure_error);
-    to->cursor_remove_error += WT_STAT_DSRC_READ(from, cursor_remove_error);
-    to->cursor_reopen_error += WT_STAT_DSRC_READ(from, cursor_reopen_error);
-    to->cursor_reserve_error += WT_STAT_DSRC_READ(from, cursor_reserve_error);
-    to->cursor_reset_error += WT_STAT_DSRC_READ(from, cursor_reset_error);
-    to->cursor_search_error += WT_STAT_DSRC_READ(from, cursor_search_error);
-    to->cursor_search_near_error += WT_STAT_DSRC_READ(from, cursor_search_near_error);
-    to->cursor_update_error += WT_STAT_DSRC_READ(from, cursor_update_error);
-    to->cursor_insert += WT_STAT_DSRC_READ(from, cursor_insert);
-    to->cursor_insert_bytes += WT_STAT_DSRC_READ(from, cursor_insert_bytes);
-    to->cursor_modify += WT_STAT_DSRC_READ(from, cursor_modify);
-    to->cursor_modify_bytes += WT_STAT_DSRC_READ(from, cursor_modify_bytes);
-    to->cursor_modify_bytes_touch += WT_STAT_DSRC_READ(from, cursor_modify_bytes_touch);
-    to->cursor_next += WT_STAT_DSRC_READ(from, cursor_next);
-    to->cursor_open_count += WT_STAT_DSRC_READ(from, cursor_open_count);
-    to->cursor_restart += WT_STAT_DSRC_READ(from, cursor_restart);
-    to->cursor_prev += WT_STAT_DSRC_READ(from, cursor_prev);
-    to->cursor_remove += WT_STAT_DSRC_READ(from, cursor_remove);
-    to->cursor_remove_bytes += WT_STAT_DSRC_READ(from, cursor_remove_bytes);
-    to->cursor_reserve += WT_STAT_DSRC_READ(from, cursor_reserve);
-    to->cursor_reset += WT_STAT_DSRC_READ(from, cursor_reset);
-    to->cursor_search += WT_STAT_DSRC_READ(from, cursor_search);
-    to->cursor_search_hs += WT_STAT_DSRC_READ(from, cursor_search_hs);
-    to->cursor_search_near += WT_STAT_DSRC_READ(from, cursor_search_near);
-    to->cursor_truncate += WT_STAT_DSRC_READ(from, cursor_truncate);
-    to->cursor_update += WT_STAT_DSRC_READ(from, cursor_update);
-    to->cursor_update_bytes += WT_STAT_DSRC_READ(from, cursor_update_bytes);
-    to->cursor_update_bytes_changed += WT_STAT_DSRC_READ(from, cursor_update_bytes_changed);
-    to->rec_vlcs_emptied_pages += WT_STAT_DSRC_READ(from, rec_vlcs_emptied_pages);
-    to->rec_time_window_bytes_ts += WT_STAT_DSRC_READ(from, rec_time_window_bytes_ts);
-    to->rec_time_window_bytes_txn += WT_STAT_DSRC_READ(from, rec_time_window_bytes_txn);
-    to->rec_dictionary += WT_STAT_DSRC_READ(from, rec_dictionary);
-    to->rec_page_delete_fast += WT_STAT_DSRC_READ(from, rec_page_delete_fast);
-    to->rec_suffix_compression += WT_STAT_DSRC_READ(from, rec_suffix_compression);
-    to->rec_multiblock_internal += WT_STAT_DSRC_READ(from, rec_multiblock_internal);
-    to->rec_prefix_compression += WT_STAT_DSRC_READ(from, rec_prefix_compression);
-    to->rec_multiblock_leaf += WT_STAT_DSRC_READ(from, rec_multiblock_leaf);
-    to->rec_overflow_key_leaf += WT_STAT_DSRC_READ(from, rec_overflow_key_leaf);
-    if ((v = WT_STAT_DSRC_READ(from, rec_multiblock_max)) > to->rec_multiblock_max)
-        to->rec_multiblock_max = v;
-    to->rec_overflow_value += WT_STAT_DSRC_READ(from, rec_overflow_value);
-    to->rec_pages += WT_STAT_DSRC_READ(from, rec_pages);
-    to->rec_pages_eviction += WT_STAT_DSRC_READ(from, rec_pages_eviction);
-    to->rec_page_delete += WT_STAT_DSRC_READ(from, rec_page_delete);
-    to->rec_time_aggr_newest_start_durable_ts +=
-      WT_STAT_DSRC_READ(from, rec_time_aggr_newest_start_durable_ts);
-    to->rec_time_aggr_newest_stop_durable_ts +=
-      WT_STAT_DSRC_READ(from, rec_time_aggr_newest_stop_durable_ts);
-    to->rec_time_aggr_newest_stop_ts += WT_STAT_DSRC_READ(from, rec_time_aggr_newest_stop_ts);
-    to->rec_time_aggr_newest_stop_txn += WT_STAT_DSRC_READ(from, rec_time_aggr_newest_stop_txn);
-    to->rec_time_aggr_newest_txn += WT_STAT_DSRC_READ(from, rec_time_aggr_newest_txn);
-    to->rec_time_aggr_oldest_start_ts += WT_STAT_DSRC_READ(from, rec_time_aggr_oldest_start_ts);
-    to->rec_time_aggr_prepared += WT_STAT_DSRC_READ(from, rec_time_aggr_prepared);
-    to->rec_time_window_pages_prepared += WT_STAT_DSRC_READ(from, rec_time_window_pages_prepared);
-    to->rec_time_window_pages_durable_start_ts +=
-      WT_STAT_DSRC_READ(from, rec_time_window_pages_durable_start_ts);
-    to->rec_time_window_pages_start_ts += WT_STAT_DSRC_READ(from, rec_time_window_pages_start_ts);
-    to->rec_time_window_pages_start_txn += WT_STAT_DSRC_READ(from, rec_time_window_pages_start_txn);
-    to->rec_time_window_pages_durable_stop_ts +=
-      WT_STAT_DSRC_READ(from, rec_time_window_pages_durable_stop_ts);
-    to->rec_time_window_pages_stop_ts += WT_STAT_DSRC_READ(from, rec_time_window_pages_stop_ts);
-    to->rec_time_window_pages_stop_txn += WT_STAT_DSRC_READ(from, rec_time_window_pages_stop_txn);
-    to->rec_time_window_prepared += WT_STAT_DSRC_READ(from, rec_time_window_prepared);
-    to->rec_time_window_durable_start_ts +=
-      WT_STAT_DSRC_READ(from, rec_time_window_durable_start_ts);
-    to->rec_time_window_start_ts += WT_STAT_DSRC_READ(from, rec_time_window_start_ts);
-    to->rec_time_window_start_txn += WT_STAT_DSRC_READ(from, rec_time_window_start_txn);
-    to->rec_time_window_durable_stop_ts += WT_STAT_DSRC_READ(from, rec_time_window_durable_stop_ts);
-    to->rec_time_window_stop_ts += WT_STAT_DSRC_READ(from, rec_time_window_stop_ts);
-    to->rec_time_window_stop_txn += WT_STAT_DSRC_READ(from, rec_time_window_stop_txn);
-    to->session_compact += WT_STAT_DSRC_READ(from, session_compact);
-    to->txn_read_race_prepare_commit += WT_STAT_DSRC_READ(from, txn_read_race_prepare_commit);
-    to->txn_read_overflow_remove += WT_STAT_DSRC_READ(from, txn_read_overflow_remove);
-    to->txn_read_race_prepare_update += WT_STAT_DSRC_READ(from, txn_read_race_prepare_update);
-    to->txn_rts_sweep_hs_keys_dryrun += WT_STAT_DSRC_READ(from, txn_rts_sweep_hs_keys_dryrun);
-    to->txn_rts_hs_stop_older_than_newer_start +=
-      WT_STAT_DSRC_READ(from, txn_rts_hs_stop_older_than_newer_start);
-    to->txn_rts_inconsistent_ckpt += WT_STAT_DSRC_READ(from, txn_rts_inconsistent_ckpt);
-    to->txn_rts_keys_removed += WT_STAT_DSRC_READ(from, txn_rts_keys_removed);
-    to->txn_rts_keys_restored += WT_STAT_DSRC_READ(from, txn_rts_keys_restored);
-    to->txn_rts_keys_removed_dryrun += WT_STAT_DSRC_READ(from, txn_rts_keys_removed_dryrun);
-    to->txn_rts_keys_restored_dryrun += WT_STAT_DSRC_READ(from, txn_rts_keys_restored_dryrun);
-    to->txn_rts_hs_restore_tombstones += WT_STAT_DSRC_READ(from, txn_rts_hs_restore_tombstones);
-    to->txn_rts_hs_restore_updates += WT_STAT_DSRC_READ(from, txn_rts_hs_restore_updates);
-    to->txn_rts_delete_rle_skipped += WT_STAT_DSRC_READ(from, txn_rts_delete_rle_skipped);
-    to->txn_rts_stable_rle_skipped += WT_STAT_DSRC_READ(from, txn_rts_stable_rle_skipped);
-    to->txn_rts_sweep_hs_keys += WT_STAT_DSRC_READ(from, txn_rts_sweep_hs_keys);
-    to->txn_rts_hs_restore_tombstones_dryrun +=
-      WT_STAT_DSRC_READ(from, txn_rts_hs_restore_tombstones_dryrun);
-    to->txn_rts_hs_restore_updates_dryrun +=
-      WT_STAT_DSRC_READ(from, txn_rts_hs_restore_updates_dryrun);
-    to->txn_rts_hs_removed += WT_STAT_DSRC_READ(from, txn_rts_hs_removed);
-    to->txn_rts_hs_removed_dryrun += WT_STAT_DSRC_READ(from, txn_rts_hs_removed_dryrun);
-    to->txn_update_conflict += WT_STAT_DSRC_READ(from, txn_update_conflict);
+    __wt_stats_aggregate_all_dsrc(from, (int64_t *)to, sizeof(*to) / sizeof(int64_t));
 }
 
 static const char *const __stats_connection_desc[] = {
@@ -1344,6 +1030,9 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: evicted blocks",
   "block-cache: file size causing bypass",
   "block-cache: lookups",
+  "block-cache: number of admission frequency sketch resets",
+  "block-cache: number of blocks admitted in place of a less frequently accessed block",
+  "block-cache: number of blocks not admitted because they were less frequently accessed than the blocks they would replace",
   "block-cache: number of blocks not evicted due to overhead",
   "block-cache: number of bypasses because no-write-allocate setting was on",
   "block-cache: number of bypasses due to overhead on put",
@@ -1361,6 +1050,7 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: total bytes",
   "block-cache: total bytes inserted on read path",
   "block-cache: total bytes inserted on write path",
+  "block-manager: blocks copied into aligned buffers for direct I/O writes",
   "block-manager: blocks pre-loaded",
   "block-manager: blocks read",
   "block-manager: blocks written",
@@ -1388,14 +1078,20 @@ static const char *const __stats_connection_desc[] = {
   "cache: bytes currently in the cache",
   "cache: bytes dirty in the cache cumulative",
   "cache: bytes not belonging to page images in the cache",
+  "cache: bytes of discarded updates held by update pools",
   "cache: bytes read into cache",
   "cache: bytes written from cache",
+  "cache: cache arena backed by explicitly reserved huge pages",
+  "cache: cache arena bytes allocated to page images",
+  "cache: cache arena bytes assigned to size classes",
+  "cache: cache arena bytes lost to fragmentation",
   "cache: checkpoint blocked page eviction",
   "cache: checkpoint of history store file blocked non-history store page eviction",
   "cache: evict page attempts by eviction server",
   "cache: evict page attempts by eviction worker threads",
   "cache: evict page failures by eviction server",
   "cache: evict page failures by eviction worker threads",
+  "cache: eviction calls to get a page found a page in another shard",
   "cache: eviction calls to get a page found queue empty",
   "cache: eviction calls to get a page found queue empty after locking",
   "cache: eviction currently operating in aggressive mode",
@@ -1521,8 +1217,12 @@ static const char *const __stats_connection_desc[] = {
   "cache: operations timed out waiting for space in cache",
   "cache: overflow keys on a multiblock row-store page blocked its eviction",
   "cache: overflow pages read into cache",
+  "cache: page arena chunks allocated",
   "cache: page evict attempts by application threads",
   "cache: page evict failures by application threads",
+  "cache: page images allocated from a remote NUMA node of the cache arena",
+  "cache: page images allocated from the cache arena",
+  "cache: page images the cache arena could not allocate",
   "cache: page split during eviction deepened the tree",
   "cache: page written requiring history store records",
   "cache: pages considered for eviction that were brought in by pre-fetch",
@@ -1567,6 +1267,9 @@ static const char *const __stats_connection_desc[] = {
   "cache: tracked dirty pages in the cache",
   "cache: uncommitted truncate blocked page eviction",
   "cache: unmodified pages evicted",
+  "cache: update pool allocations",
+  "cache: update pool allocations reusing discarded updates",
+  "cache: update pool refills from the shared pool",
   "capacity: background fsync file handles considered",
   "capacity: background fsync file handles synced",
   "capacity: background fsync time (msecs)",
@@ -1653,10 +1356,12 @@ static const char *const __stats_connection_desc[] = {
   "chunk-cache: retried accessing a chunk while I/O was in progress",
   "chunk-cache: retries from a chunk cache checksum mismatch",
   "chunk-cache: timed out due to too many retries",
+  "chunk-cache: total bytes read back by the startup warm-up",
   "chunk-cache: total bytes read from persistent content",
   "chunk-cache: total bytes used by the cache",
   "chunk-cache: total bytes used by the cache for pinned chunks",
   "chunk-cache: total chunks held by the chunk cache",
+  "chunk-cache: total chunks read back by the startup warm-up",
   "chunk-cache: total number of chunks inserted on startup from persisted metadata.",
   "chunk-cache: total pinned chunks held by the chunk cache",
   "connection: auto adjusting condition resets",
@@ -1683,6 +1388,9 @@ static const char *const __stats_connection_desc[] = {
   "cursor: Total number of entries skipped to position the history store cursor",
   "cursor: Total number of in-memory deleted pages skipped during tree walk",
   "cursor: Total number of on-disk deleted pages skipped during tree walk",
+  "cursor: Total number of pages skipped during tree walk by cursor value bounds",
+  "cursor: Total number of searches not resolved by the adaptive hash index",
+  "cursor: Total number of searches resolved by the adaptive hash index",
   "cursor: Total number of times a search near has exited due to prefix config",
   "cursor: Total number of times cursor fails to temporarily release pinned page to encourage "
   "eviction of hot or large page",
@@ -1738,6 +1446,8 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor reserve calls that return an error",
   "cursor: cursor reset calls",
   "cursor: cursor reset calls that return an error",
+  "cursor: cursor search batch calls",
+  "cursor: cursor search batch calls that return an error",
   "cursor: cursor search calls",
   "cursor: cursor search calls that return an error",
   "cursor: cursor search history store calls",
@@ -1799,6 +1509,11 @@ static const char *const __stats_connection_desc[] = {
   "lock: txn global write lock acquisitions",
   "log: busy returns attempting to switch slots",
   "log: force log remove time sleeping (usecs)",
+  "log: group commit current wait window (usecs)",
+  "log: group commit groups",
+  "log: group commit groups closed at the size or commit limit",
+  "log: group commit synchronous commits grouped",
+  "log: group commit time waiting for commits to join (usecs)",
   "log: log bytes of payload data",
   "log: log bytes written",
   "log: log files manually zero-filled",
@@ -1876,6 +1591,10 @@ static const char *const __stats_connection_desc[] = {
   "prefetch: could not perform pre-fetch on internal page",
   "prefetch: could not perform pre-fetch on ref without the pre-fetch flag set",
   "prefetch: number of times pre-fetch failed to start",
+    "prefetch: pre-fetch asynchronous block reads submitted",
+    "prefetch: pre-fetch asynchronous block reads that failed",
+    "prefetch: pre-fetch asynchronous block reads used to read a page",
+    "prefetch: pre-fetch asynchronous read batches",
   "prefetch: pre-fetch not repeating for recently pre-fetched ref",
   "prefetch: pre-fetch not triggered after single disk read",
   "prefetch: pre-fetch not triggered as there is no valid dhandle",
@@ -2044,6 +1763,7 @@ static const char *const __stats_connection_desc[] = {
   "transaction: transaction range of timestamps pinned by the oldest timestamp",
   "transaction: transaction read timestamp of the oldest active reader",
   "transaction: transaction rollback to stable currently running",
+  "transaction: transaction snapshots reused without a walk of concurrent sessions",
   "transaction: transaction walk of concurrent sessions",
   "transaction: transactions committed",
   "transaction: transactions rolled back",
@@ -2067,13 +1787,21 @@ __wt_stat_connection_init_single(WT_CONNECTION_STATS *stats)
 int
 __wt_stat_connection_init(WT_SESSION_IMPL *session, WT_CONNECTION_IMPL *handle)
 {
+    size_t size;
     int i;
+    uint8_t *p;
 
-    WT_RET(__wt_calloc(session, (size_t)WT_STAT_CONN_COUNTER_SLOTS, sizeof(*handle->stat_array),
-      &handle->stat_array));
+    /*
+     * Pad each slot's structure to a cache line boundary so threads updating different slots never
+     * share a cache line.
+     */
+    size = WT_ALIGN(sizeof(WT_CONNECTION_STATS), WT_CACHE_LINE_ALIGNMENT);
+    WT_RET(__wt_calloc(session, 1,
+      (size_t)WT_STAT_CONN_COUNTER_SLOTS * size + WT_CACHE_LINE_ALIGNMENT, &handle->stat_array));
 
+    p = (uint8_t *)WT_ALIGN((uintptr_t)handle->stat_array, WT_CACHE_LINE_ALIGNMENT);
     for (i = 0; i < WT_STAT_CONN_COUNTER_SLOTS; ++i) {
-        handle->stats[i] = &handle->stat_array[i];
+        handle->stats[i] = (WT_CONNECTION_STATS *)(p + (size_t)i * size);
         __wt_stat_connection_init_single(handle->stats[i]);
     }
     return (0);
@@ -2116,6 +1844,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_cache_blocks_evicted = 0;
     stats->block_cache_bypass_filesize = 0;
     stats->block_cache_lookups = 0;
+    stats->block_cache_admission_sketch_resets = 0;
+    stats->block_cache_admission_accepted = 0;
+    stats->block_cache_admission_rejected = 0;
     stats->block_cache_not_evicted_overhead = 0;
     stats->block_cache_bypass_writealloc = 0;
     stats->block_cache_bypass_overhead_put = 0;
@@ -2133,6 +1864,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_cache_bytes = 0;
     stats->block_cache_bytes_insert_read = 0;
     stats->block_cache_bytes_insert_write = 0;
+    stats->block_write_aligned_copy = 0;
     stats->block_preload = 0;
     stats->block_read = 0;
     stats->block_write = 0;
@@ -2159,14 +1891,20 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing cache_bytes_inuse */
     /* not clearing cache_bytes_dirty_total */
     /* not clearing cache_bytes_other */
+    /* not clearing cache_update_pool_bytes */
     stats->cache_bytes_read = 0;
     stats->cache_bytes_write = 0;
+    /* not clearing cache_arena_hugepages */
+    /* not clearing cache_arena_bytes_inuse */
+    /* not clearing cache_arena_bytes */
+    /* not clearing cache_arena_bytes_fragmented */
     stats->cache_eviction_blocked_checkpoint = 0;
     stats->cache_eviction_blocked_checkpoint_hs = 0;
     stats->eviction_server_evict_attempt = 0;
     stats->eviction_worker_evict_attempt = 0;
     stats->eviction_server_evict_fail = 0;
     stats->eviction_worker_evict_fail = 0;
+    stats->eviction_get_ref_steal = 0;
     stats->eviction_get_ref_empty = 0;
     stats->eviction_get_ref_empty2 = 0;
     /* not clearing eviction_aggressive_set */
@@ -2276,8 +2014,12 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->eviction_timed_out_ops = 0;
     stats->cache_eviction_blocked_overflow_keys = 0;
     stats->cache_read_overflow = 0;
+    stats->cache_page_arena_chunk = 0;
     stats->eviction_app_attempt = 0;
     stats->eviction_app_fail = 0;
+    stats->cache_arena_alloc_remote = 0;
+    stats->cache_arena_alloc = 0;
+    stats->cache_arena_alloc_fallback = 0;
     stats->cache_eviction_deepen = 0;
     stats->cache_write_hs = 0;
     /* not clearing eviction_consider_prefetch */
@@ -2320,6 +2062,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing cache_pages_dirty */
     stats->cache_eviction_blocked_uncommitted_truncate = 0;
     stats->cache_eviction_clean = 0;
+    stats->cache_update_pool_alloc = 0;
+    stats->cache_update_pool_alloc_reuse = 0;
+    stats->cache_update_pool_refill = 0;
     stats->fsync_all_fh_total = 0;
     stats->fsync_all_fh = 0;
     /* not clearing fsync_all_time */
@@ -2406,10 +2151,12 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->chunkcache_retries = 0;
     stats->chunkcache_retries_checksum_mismatch = 0;
     stats->chunkcache_toomany_retries = 0;
+    stats->chunkcache_bytes_warmed_up = 0;
     stats->chunkcache_bytes_read_persistent = 0;
     stats->chunkcache_bytes_inuse = 0;
     stats->chunkcache_bytes_inuse_pinned = 0;
     stats->chunkcache_chunks_inuse = 0;
+    stats->chunkcache_chunks_warmed_up = 0;
     stats->chunkcache_created_from_metadata = 0;
     stats->chunkcache_chunks_pinned = 0;
     stats->cond_auto_wait_reset = 0;
@@ -2436,6 +2183,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_skip_hs_cur_position = 0;
     stats->cursor_tree_walk_inmem_del_page_skip = 0;
     stats->cursor_tree_walk_ondisk_del_page_skip = 0;
+    stats->cursor_tree_walk_zone_page_skip = 0;
+    stats->cursor_search_ahi_miss = 0;
+    stats->cursor_search_ahi_hit = 0;
     stats->cursor_search_near_prefix_fast_paths = 0;
     stats->cursor_reposition_failed = 0;
     stats->cursor_reposition = 0;
@@ -2489,6 +2239,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_reserve_error = 0;
     stats->cursor_reset = 0;
     stats->cursor_reset_error = 0;
+    stats->cursor_search_batch = 0;
+    stats->cursor_search_batch_error = 0;
     stats->cursor_search = 0;
     stats->cursor_search_error = 0;
     stats->cursor_search_hs = 0;
@@ -2550,6 +2302,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->lock_txn_global_write_count = 0;
     stats->log_slot_switch_busy = 0;
     stats->log_force_remove_sleep = 0;
+    /* not clearing log_group_commit_window */
+    stats->log_group_commit = 0;
+    stats->log_group_commit_full = 0;
+    stats->log_group_commit_joined = 0;
+    stats->log_group_commit_wait = 0;
     stats->log_bytes_payload = 0;
     stats->log_bytes_written = 0;
     stats->log_zero_fills = 0;
@@ -2627,6 +2384,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->prefetch_skipped_internal_page = 0;
     stats->prefetch_skipped_no_flag_set = 0;
     stats->prefetch_failed_start = 0;
+    stats->prefetch_async_read_submitted = 0;
+    stats->prefetch_async_read_failed = 0;
+    stats->prefetch_async_read_used = 0;
+    stats->prefetch_async_read_batches = 0;
     stats->prefetch_skipped_same_ref = 0;
     stats->prefetch_disk_one = 0;
     stats->prefetch_skipped_no_valid_dhandle = 0;
@@ -2787,6 +2548,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing txn_pinned_timestamp_oldest */
     /* not clearing txn_timestamp_oldest_active_read */
     /* not clearing txn_rollback_to_stable_running */
+    stats->txn_snapshot_reused = 0;
     stats->txn_walk_sessions = 0;
     stats->txn_commit = 0;
     stats->txn_rollback = 0;
@@ -2805,824 +2567,7 @@ __wt_stat_connection_clear_all(WT_CONNECTION_STATS **stats)
 void
 __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *to)
 {
-    int64_t v;
-
-    to->autocommit_readonly_retry += WT_STAT_CONN_READ(from, autocommit_readonly_retry);
-    to->autocommit_update_retry += WT_STAT_CONN_READ(from, autocommit_update_retry);
-    to->background_compact_fail += WT_STAT_CONN_READ(from, background_compact_fail);
-    to->background_compact_fail_cache_pressure +=
-      WT_STAT_CONN_READ(from, background_compact_fail_cache_pressure);
-    to->background_compact_interrupted += WT_STAT_CONN_READ(from, background_compact_interrupted);
-    to->background_compact_ema += WT_STAT_CONN_READ(from, background_compact_ema);
-    to->background_compact_bytes_recovered +=
-      WT_STAT_CONN_READ(from, background_compact_bytes_recovered);
-    to->background_compact_running += WT_STAT_CONN_READ(from, background_compact_running);
-    to->background_compact_exclude += WT_STAT_CONN_READ(from, background_compact_exclude);
-    to->background_compact_skipped += WT_STAT_CONN_READ(from, background_compact_skipped);
-    to->background_compact_sleep_cache_pressure +=
-      WT_STAT_CONN_READ(from, background_compact_sleep_cache_pressure);
-    to->background_compact_success += WT_STAT_CONN_READ(from, background_compact_success);
-    to->background_compact_timeout += WT_STAT_CONN_READ(from, background_compact_timeout);
-    to->background_compact_files_tracked +=
-      WT_STAT_CONN_READ(from, background_compact_files_tracked);
-    to->backup_cursor_open += WT_STAT_CONN_READ(from, backup_cursor_open);
-    to->backup_dup_open += WT_STAT_CONN_READ(from, backup_dup_open);
-    to->backup_granularity += WT_STAT_CONN_READ(from, backup_granularity);
-    to->backup_bits_clr += WT_STAT_CONN_READ(from, backup_bits_clr);
-    to->backup_incremental += WT_STAT_CONN_READ(from, backup_incremental);
-    to->backup_start += WT_STAT_CONN_READ(from, backup_start);
-    to->backup_blocks += WT_STAT_CONN_READ(from, backup_blocks);
-    to->backup_blocks_compressed += WT_STAT_CONN_READ(from, backup_blocks_compressed);
-    to->backup_blocks_uncompressed += WT_STAT_CONN_READ(from, backup_blocks_uncompressed);
-    to->block_cache_blocks_update += WT_STAT_CONN_READ(from, block_cache_blocks_update);
-    to->block_cache_bytes_update += WT_STAT_CONN_READ(from, block_cache_bytes_update);
-    to->block_cache_blocks_evicted += WT_STAT_CONN_READ(from, block_cache_blocks_evicted);
-    to->block_cache_bypass_filesize += WT_STAT_CONN_READ(from, block_cache_bypass_filesize);
-    to->block_cache_lookups += WT_STAT_CONN_READ(from, block_cache_lookups);
-    to->block_cache_not_evicted_overhead +=
-      WT_STAT_CONN_READ(from, block_cache_not_evicted_overhead);
-    to->block_cache_bypass_writealloc += WT_STAT_CONN_READ(from, block_cache_bypass_writealloc);
-    to->block_cache_bypass_overhead_put += WT_STAT_CONN_READ(from, block_cache_bypass_overhead_put);
-    to->block_cache_bypass_get += WT_STAT_CONN_READ(from, block_cache_bypass_get);
-    to->block_cache_bypass_put += WT_STAT_CONN_READ(from, block_cache_bypass_put);
-    to->block_cache_eviction_passes += WT_STAT_CONN_READ(from, block_cache_eviction_passes);
-    to->block_cache_hits += WT_STAT_CONN_READ(from, block_cache_hits);
-    to->block_cache_misses += WT_STAT_CONN_READ(from, block_cache_misses);
-    to->block_cache_bypass_chkpt += WT_STAT_CONN_READ(from, block_cache_bypass_chkpt);
-    to->block_cache_blocks_removed += WT_STAT_CONN_READ(from, block_cache_blocks_removed);
-    to->block_cache_blocks_removed_blocked +=
-      WT_STAT_CONN_READ(from, block_cache_blocks_removed_blocked);
-    to->block_cache_blocks += WT_STAT_CONN_READ(from, block_cache_blocks);
-    to->block_cache_blocks_insert_read += WT_STAT_CONN_READ(from, block_cache_blocks_insert_read);
-    to->block_cache_blocks_insert_write += WT_STAT_CONN_READ(from, block_cache_blocks_insert_write);
-    to->block_cache_bytes += WT_STAT_CONN_READ(from, block_cache_bytes);
-    to->block_cache_bytes_insert_read += WT_STAT_CONN_READ(from, block_cache_bytes_insert_read);
-    to->block_cache_bytes_insert_write += WT_STAT_CONN_READ(from, block_cache_bytes_insert_write);
-    to->block_preload += WT_STAT_CONN_READ(from, block_preload);
-    to->block_read += WT_STAT_CONN_READ(from, block_read);
-    to->block_write += WT_STAT_CONN_READ(from, block_write);
-    to->block_byte_read += WT_STAT_CONN_READ(from, block_byte_read);
-    to->block_byte_read_mmap += WT_STAT_CONN_READ(from, block_byte_read_mmap);
-    to->block_byte_read_syscall += WT_STAT_CONN_READ(from, block_byte_read_syscall);
-    to->block_byte_write += WT_STAT_CONN_READ(from, block_byte_write);
-    to->block_byte_write_compact += WT_STAT_CONN_READ(from, block_byte_write_compact);
-    to->block_byte_write_checkpoint += WT_STAT_CONN_READ(from, block_byte_write_checkpoint);
-    to->block_byte_write_mmap += WT_STAT_CONN_READ(from, block_byte_write_mmap);
-    to->block_byte_write_syscall += WT_STAT_CONN_READ(from, block_byte_write_syscall);
-    to->block_map_read += WT_STAT_CONN_READ(from, block_map_read);
-    to->block_byte_map_read += WT_STAT_CONN_READ(from, block_byte_map_read);
-    to->block_remap_file_resize += WT_STAT_CONN_READ(from, block_remap_file_resize);
-    to->block_remap_file_write += WT_STAT_CONN_READ(from, block_remap_file_write);
-    to->eviction_app_time += WT_STAT_CONN_READ(from, eviction_app_time);
-    to->cache_read_app_count += WT_STAT_CONN_READ(from, cache_read_app_count);
-    to->cache_read_app_time += WT_STAT_CONN_READ(from, cache_read_app_time);
-    to->cache_write_app_count += WT_STAT_CONN_READ(from, cache_write_app_count);
-    to->cache_write_app_time += WT_STAT_CONN_READ(from, cache_write_app_time);
-    to->cache_bytes_updates += WT_STAT_CONN_READ(from, cache_bytes_updates);
-    to->cache_bytes_image += WT_STAT_CONN_READ(from, cache_bytes_image);
-    to->cache_bytes_hs += WT_STAT_CONN_READ(from, cache_bytes_hs);
-    to->cache_bytes_inuse += WT_STAT_CONN_READ(from, cache_bytes_inuse);
-    to->cache_bytes_dirty_total += WT_STAT_CONN_READ(from, cache_bytes_dirty_total);
-    to->cache_bytes_other += WT_STAT_CONN_READ(from, cache_bytes_other);
-    to->cache_bytes_read += WT_STAT_CONN_READ(from, cache_bytes_read);
-    to->cache_bytes_write += WT_STAT_CONN_READ(from, cache_bytes_write);
-    to->cache_eviction_blocked_checkpoint +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_checkpoint);
-    to->cache_eviction_blocked_checkpoint_hs +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_checkpoint_hs);
-    to->eviction_server_evict_attempt += WT_STAT_CONN_READ(from, eviction_server_evict_attempt);
-    to->eviction_worker_evict_attempt += WT_STAT_CONN_READ(from, eviction_worker_evict_attempt);
-    to->eviction_server_evict_fail += WT_STAT_CONN_READ(from, eviction_server_evict_fail);
-    to->eviction_worker_evict_fail += WT_STAT_CONN_READ(from, eviction_worker_evict_fail);
-    to->eviction_get_ref_empty += WT_STAT_CONN_READ(from, eviction_get_ref_empty);
-    to->eviction_get_ref_empty2 += WT_STAT_CONN_READ(from, eviction_get_ref_empty2);
-    to->eviction_aggressive_set += WT_STAT_CONN_READ(from, eviction_aggressive_set);
-    to->eviction_empty_score += WT_STAT_CONN_READ(from, eviction_empty_score);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_1 +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_1);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_2 +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_2);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_3 +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_3);
-    to->cache_eviction_blocked_no_ts_checkpoint_race_4 +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_4);
-    to->cache_eviction_blocked_remove_hs_race_with_checkpoint +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_remove_hs_race_with_checkpoint);
-    to->cache_eviction_blocked_no_progress +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_no_progress);
-    to->eviction_walk_passes += WT_STAT_CONN_READ(from, eviction_walk_passes);
-    to->eviction_queue_empty += WT_STAT_CONN_READ(from, eviction_queue_empty);
-    to->eviction_queue_not_empty += WT_STAT_CONN_READ(from, eviction_queue_not_empty);
-    to->eviction_server_skip_dirty_pages_during_checkpoint +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_dirty_pages_during_checkpoint);
-    to->eviction_server_skip_intl_page_with_active_child +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_intl_page_with_active_child);
-    to->eviction_server_skip_metatdata_with_history +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_metatdata_with_history);
-    to->eviction_server_skip_pages_last_running +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_pages_last_running);
-    to->eviction_server_skip_pages_retry +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_pages_retry);
-    to->eviction_server_skip_unwanted_pages +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_unwanted_pages);
-    to->eviction_server_skip_unwanted_tree +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_unwanted_tree);
-    to->eviction_server_skip_trees_too_many_active_walks +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_trees_too_many_active_walks);
-    to->eviction_server_skip_checkpointing_trees +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_checkpointing_trees);
-    to->eviction_server_skip_trees_stick_in_cache +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_trees_stick_in_cache);
-    to->eviction_server_skip_trees_eviction_disabled +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_trees_eviction_disabled);
-    to->eviction_server_skip_trees_not_useful_before +=
-      WT_STAT_CONN_READ(from, eviction_server_skip_trees_not_useful_before);
-    to->eviction_server_slept += WT_STAT_CONN_READ(from, eviction_server_slept);
-    to->eviction_slow += WT_STAT_CONN_READ(from, eviction_slow);
-    to->eviction_walk_leaf_notfound += WT_STAT_CONN_READ(from, eviction_walk_leaf_notfound);
-    to->eviction_state += WT_STAT_CONN_READ(from, eviction_state);
-    to->eviction_walk_sleeps += WT_STAT_CONN_READ(from, eviction_walk_sleeps);
-    if ((v = WT_STAT_CONN_READ(from, npos_evict_walk_max)) > to->npos_evict_walk_max)
-        to->npos_evict_walk_max = v;
-    to->eviction_restored_pos += WT_STAT_CONN_READ(from, eviction_restored_pos);
-    to->eviction_restored_pos_differ += WT_STAT_CONN_READ(from, eviction_restored_pos_differ);
-    to->cache_eviction_target_page_lt10 += WT_STAT_CONN_READ(from, cache_eviction_target_page_lt10);
-    to->cache_eviction_target_page_lt32 += WT_STAT_CONN_READ(from, cache_eviction_target_page_lt32);
-    to->cache_eviction_target_page_ge128 +=
-      WT_STAT_CONN_READ(from, cache_eviction_target_page_ge128);
-    to->cache_eviction_target_page_lt64 += WT_STAT_CONN_READ(from, cache_eviction_target_page_lt64);
-    to->cache_eviction_target_page_lt128 +=
-      WT_STAT_CONN_READ(from, cache_eviction_target_page_lt128);
-    to->cache_eviction_target_page_reduced +=
-      WT_STAT_CONN_READ(from, cache_eviction_target_page_reduced);
-    to->eviction_target_strategy_both_clean_and_dirty +=
-      WT_STAT_CONN_READ(from, eviction_target_strategy_both_clean_and_dirty);
-    to->eviction_target_strategy_clean += WT_STAT_CONN_READ(from, eviction_target_strategy_clean);
-    to->eviction_target_strategy_dirty += WT_STAT_CONN_READ(from, eviction_target_strategy_dirty);
-    to->eviction_walks_abandoned += WT_STAT_CONN_READ(from, eviction_walks_abandoned);
-    to->eviction_walks_stopped += WT_STAT_CONN_READ(from, eviction_walks_stopped);
-    to->eviction_walks_gave_up_no_targets +=
-      WT_STAT_CONN_READ(from, eviction_walks_gave_up_no_targets);
-    to->eviction_walks_gave_up_ratio += WT_STAT_CONN_READ(from, eviction_walks_gave_up_ratio);
-    to->eviction_walk_random_returns_null_position +=
-      WT_STAT_CONN_READ(from, eviction_walk_random_returns_null_position);
-    to->eviction_walks_ended += WT_STAT_CONN_READ(from, eviction_walks_ended);
-    to->eviction_walk_restart += WT_STAT_CONN_READ(from, eviction_walk_restart);
-    to->eviction_walk_from_root += WT_STAT_CONN_READ(from, eviction_walk_from_root);
-    to->eviction_walk_saved_pos += WT_STAT_CONN_READ(from, eviction_walk_saved_pos);
-    to->eviction_active_workers += WT_STAT_CONN_READ(from, eviction_active_workers);
-    to->eviction_stable_state_workers += WT_STAT_CONN_READ(from, eviction_stable_state_workers);
-    to->eviction_walks_active += WT_STAT_CONN_READ(from, eviction_walks_active);
-    to->eviction_walks_started += WT_STAT_CONN_READ(from, eviction_walks_started);
-    to->eviction_force_no_retry += WT_STAT_CONN_READ(from, eviction_force_no_retry);
-    to->eviction_force_hs_fail += WT_STAT_CONN_READ(from, eviction_force_hs_fail);
-    to->eviction_force_hs += WT_STAT_CONN_READ(from, eviction_force_hs);
-    to->eviction_force_hs_success += WT_STAT_CONN_READ(from, eviction_force_hs_success);
-    to->eviction_force_clean += WT_STAT_CONN_READ(from, eviction_force_clean);
-    to->eviction_force_dirty += WT_STAT_CONN_READ(from, eviction_force_dirty);
-    to->eviction_force_long_update_list += WT_STAT_CONN_READ(from, eviction_force_long_update_list);
-    to->eviction_force_delete += WT_STAT_CONN_READ(from, eviction_force_delete);
-    to->eviction_force += WT_STAT_CONN_READ(from, eviction_force);
-    to->eviction_force_fail += WT_STAT_CONN_READ(from, eviction_force_fail);
-    to->cache_eviction_blocked_hazard += WT_STAT_CONN_READ(from, cache_eviction_blocked_hazard);
-    to->cache_hazard_checks += WT_STAT_CONN_READ(from, cache_hazard_checks);
-    to->cache_hazard_walks += WT_STAT_CONN_READ(from, cache_hazard_walks);
-    if ((v = WT_STAT_CONN_READ(from, cache_hazard_max)) > to->cache_hazard_max)
-        to->cache_hazard_max = v;
-    to->cache_hs_insert += WT_STAT_CONN_READ(from, cache_hs_insert);
-    to->cache_hs_insert_restart += WT_STAT_CONN_READ(from, cache_hs_insert_restart);
-    to->cache_hs_ondisk_max += WT_STAT_CONN_READ(from, cache_hs_ondisk_max);
-    to->cache_hs_ondisk += WT_STAT_CONN_READ(from, cache_hs_ondisk);
-    to->cache_hs_read += WT_STAT_CONN_READ(from, cache_hs_read);
-    to->cache_hs_read_miss += WT_STAT_CONN_READ(from, cache_hs_read_miss);
-    to->cache_hs_read_squash += WT_STAT_CONN_READ(from, cache_hs_read_squash);
-    to->cache_hs_order_lose_durable_timestamp +=
-      WT_STAT_CONN_READ(from, cache_hs_order_lose_durable_timestamp);
-    to->cache_hs_key_truncate_rts_unstable +=
-      WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts_unstable);
-    to->cache_hs_key_truncate_rts += WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts);
-    to->cache_hs_btree_truncate += WT_STAT_CONN_READ(from, cache_hs_btree_truncate);
-    to->cache_hs_key_truncate += WT_STAT_CONN_READ(from, cache_hs_key_truncate);
-    to->cache_hs_order_remove += WT_STAT_CONN_READ(from, cache_hs_order_remove);
-    to->cache_hs_key_truncate_onpage_removal +=
-      WT_STAT_CONN_READ(from, cache_hs_key_truncate_onpage_removal);
-    to->cache_hs_btree_truncate_dryrun += WT_STAT_CONN_READ(from, cache_hs_btree_truncate_dryrun);
-    to->cache_hs_key_truncate_rts_unstable_dryrun +=
-      WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts_unstable_dryrun);
-    to->cache_hs_key_truncate_rts_dryrun +=
-      WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts_dryrun);
-    to->cache_hs_order_reinsert += WT_STAT_CONN_READ(from, cache_hs_order_reinsert);
-    to->cache_hs_write_squash += WT_STAT_CONN_READ(from, cache_hs_write_squash);
-    to->cache_inmem_splittable += WT_STAT_CONN_READ(from, cache_inmem_splittable);
-    to->cache_inmem_split += WT_STAT_CONN_READ(from, cache_inmem_split);
-    to->cache_eviction_blocked_internal_page_split +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_internal_page_split);
-    to->cache_eviction_internal += WT_STAT_CONN_READ(from, cache_eviction_internal);
-    to->eviction_internal_pages_queued += WT_STAT_CONN_READ(from, eviction_internal_pages_queued);
-    to->eviction_internal_pages_seen += WT_STAT_CONN_READ(from, eviction_internal_pages_seen);
-    to->eviction_internal_pages_already_queued +=
-      WT_STAT_CONN_READ(from, eviction_internal_pages_already_queued);
-    to->cache_eviction_split_internal += WT_STAT_CONN_READ(from, cache_eviction_split_internal);
-    to->cache_eviction_split_leaf += WT_STAT_CONN_READ(from, cache_eviction_split_leaf);
-    to->cache_eviction_random_sample_inmem_root +=
-      WT_STAT_CONN_READ(from, cache_eviction_random_sample_inmem_root);
-    to->cache_bytes_max += WT_STAT_CONN_READ(from, cache_bytes_max);
-    to->eviction_maximum_milliseconds += WT_STAT_CONN_READ(from, eviction_maximum_milliseconds);
-    to->eviction_maximum_page_size += WT_STAT_CONN_READ(from, eviction_maximum_page_size);
-    to->eviction_app_dirty_attempt += WT_STAT_CONN_READ(from, eviction_app_dirty_attempt);
-    to->eviction_app_dirty_fail += WT_STAT_CONN_READ(from, eviction_app_dirty_fail);
-    to->cache_eviction_dirty += WT_STAT_CONN_READ(from, cache_eviction_dirty);
-    to->cache_eviction_blocked_multi_block_reconciliation_during_checkpoint +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_multi_block_reconciliation_during_checkpoint);
-    if ((v = WT_STAT_CONN_READ(from, npos_read_walk_max)) > to->npos_read_walk_max)
-        to->npos_read_walk_max = v;
-    to->eviction_timed_out_ops += WT_STAT_CONN_READ(from, eviction_timed_out_ops);
-    to->cache_eviction_blocked_overflow_keys +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_overflow_keys);
-    to->cache_read_overflow += WT_STAT_CONN_READ(from, cache_read_overflow);
-    to->eviction_app_attempt += WT_STAT_CONN_READ(from, eviction_app_attempt);
-    to->eviction_app_fail += WT_STAT_CONN_READ(from, eviction_app_fail);
-    to->cache_eviction_deepen += WT_STAT_CONN_READ(from, cache_eviction_deepen);
-    to->cache_write_hs += WT_STAT_CONN_READ(from, cache_write_hs);
-    to->eviction_consider_prefetch += WT_STAT_CONN_READ(from, eviction_consider_prefetch);
-    to->cache_pages_inuse += WT_STAT_CONN_READ(from, cache_pages_inuse);
-    to->cache_eviction_dirty_obsolete_tw +=
-      WT_STAT_CONN_READ(from, cache_eviction_dirty_obsolete_tw);
-    to->eviction_pages_in_parallel_with_checkpoint +=
-      WT_STAT_CONN_READ(from, eviction_pages_in_parallel_with_checkpoint);
-    to->eviction_pages_ordinary_queued += WT_STAT_CONN_READ(from, eviction_pages_ordinary_queued);
-    to->eviction_pages_queued_post_lru += WT_STAT_CONN_READ(from, eviction_pages_queued_post_lru);
-    to->eviction_pages_queued_urgent += WT_STAT_CONN_READ(from, eviction_pages_queued_urgent);
-    to->eviction_pages_queued_oldest += WT_STAT_CONN_READ(from, eviction_pages_queued_oldest);
-    to->eviction_pages_queued_urgent_hs_dirty +=
-      WT_STAT_CONN_READ(from, eviction_pages_queued_urgent_hs_dirty);
-    to->cache_read += WT_STAT_CONN_READ(from, cache_read);
-    to->cache_read_deleted += WT_STAT_CONN_READ(from, cache_read_deleted);
-    to->cache_read_deleted_prepared += WT_STAT_CONN_READ(from, cache_read_deleted_prepared);
-    to->cache_read_checkpoint += WT_STAT_CONN_READ(from, cache_read_checkpoint);
-    to->eviction_clear_ordinary += WT_STAT_CONN_READ(from, eviction_clear_ordinary);
-    to->cache_pages_requested += WT_STAT_CONN_READ(from, cache_pages_requested);
-    to->cache_pages_prefetch += WT_STAT_CONN_READ(from, cache_pages_prefetch);
-    to->cache_eviction_pages_seen += WT_STAT_CONN_READ(from, cache_eviction_pages_seen);
-    to->eviction_pages_already_queued += WT_STAT_CONN_READ(from, eviction_pages_already_queued);
-    to->eviction_fail += WT_STAT_CONN_READ(from, eviction_fail);
-    to->eviction_fail_active_children_on_an_internal_page +=
-      WT_STAT_CONN_READ(from, eviction_fail_active_children_on_an_internal_page);
-    to->eviction_fail_in_reconciliation += WT_STAT_CONN_READ(from, eviction_fail_in_reconciliation);
-    to->eviction_fail_checkpoint_no_ts += WT_STAT_CONN_READ(from, eviction_fail_checkpoint_no_ts);
-    to->eviction_walk += WT_STAT_CONN_READ(from, eviction_walk);
-    to->cache_write += WT_STAT_CONN_READ(from, cache_write);
-    to->cache_write_restore += WT_STAT_CONN_READ(from, cache_write_restore);
-    to->cache_overhead += WT_STAT_CONN_READ(from, cache_overhead);
-    to->cache_eviction_blocked_recently_modified +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_recently_modified);
-    to->cache_reverse_splits += WT_STAT_CONN_READ(from, cache_reverse_splits);
-    to->cache_reverse_splits_skipped_vlcs +=
-      WT_STAT_CONN_READ(from, cache_reverse_splits_skipped_vlcs);
-    to->cache_hs_insert_full_update += WT_STAT_CONN_READ(from, cache_hs_insert_full_update);
-    to->cache_hs_insert_reverse_modify += WT_STAT_CONN_READ(from, cache_hs_insert_reverse_modify);
-    to->eviction_reentry_hs_eviction_milliseconds +=
-      WT_STAT_CONN_READ(from, eviction_reentry_hs_eviction_milliseconds);
-    to->cache_bytes_internal += WT_STAT_CONN_READ(from, cache_bytes_internal);
-    to->cache_bytes_leaf += WT_STAT_CONN_READ(from, cache_bytes_leaf);
-    to->cache_bytes_dirty += WT_STAT_CONN_READ(from, cache_bytes_dirty);
-    to->cache_bytes_dirty_internal += WT_STAT_CONN_READ(from, cache_bytes_dirty_internal);
-    to->cache_bytes_dirty_leaf += WT_STAT_CONN_READ(from, cache_bytes_dirty_leaf);
-    to->cache_pages_dirty += WT_STAT_CONN_READ(from, cache_pages_dirty);
-    to->cache_eviction_blocked_uncommitted_truncate +=
-      WT_STAT_CONN_READ(from, cache_eviction_blocked_uncommitted_truncate);
-    to->cache_eviction_clean += WT_STAT_CONN_READ(from, cache_eviction_clean);
-    to->fsync_all_fh_total += WT_STAT_CONN_READ(from, fsync_all_fh_total);
-    to->fsync_all_fh += WT_STAT_CONN_READ(from, fsync_all_fh);
-    to->fsync_all_time += WT_STAT_CONN_READ(from, fsync_all_time);
-    to->capacity_bytes_read += WT_STAT_CONN_READ(from, capacity_bytes_read);
-    to->capacity_bytes_ckpt += WT_STAT_CONN_READ(from, capacity_bytes_ckpt);
-    to->capacity_bytes_chunkcache += WT_STAT_CONN_READ(from, capacity_bytes_chunkcache);
-    to->capacity_bytes_evict += WT_STAT_CONN_READ(from, capacity_bytes_evict);
-    to->capacity_bytes_log += WT_STAT_CONN_READ(from, capacity_bytes_log);
-    to->capacity_bytes_written += WT_STAT_CONN_READ(from, capacity_bytes_written);
-    to->capacity_threshold += WT_STAT_CONN_READ(from, capacity_threshold);
-    to->capacity_time_total += WT_STAT_CONN_READ(from, capacity_time_total);
-    to->capacity_time_ckpt += WT_STAT_CONN_READ(from, capacity_time_ckpt);
-    to->capacity_time_evict += WT_STAT_CONN_READ(from, capacity_time_evict);
-    to->capacity_time_log += WT_STAT_CONN_READ(from, capacity_time_log);
-    to->capacity_time_read += WT_STAT_CONN_READ(from, capacity_time_read);
-    to->capacity_time_chunkcache += WT_STAT_CONN_READ(from, capacity_time_chunkcache);
-    to->checkpoint_cleanup_success += WT_STAT_CONN_READ(from, checkpoint_cleanup_success);
-    to->checkpoint_snapshot_acquired += WT_STAT_CONN_READ(from, checkpoint_snapshot_acquired);
-    to->checkpoint_skipped += WT_STAT_CONN_READ(from, checkpoint_skipped);
-    to->checkpoint_fsync_post += WT_STAT_CONN_READ(from, checkpoint_fsync_post);
-    to->checkpoint_fsync_post_duration += WT_STAT_CONN_READ(from, checkpoint_fsync_post_duration);
-    to->checkpoint_generation += WT_STAT_CONN_READ(from, checkpoint_generation);
-    to->checkpoint_time_max += WT_STAT_CONN_READ(from, checkpoint_time_max);
-    to->checkpoint_time_min += WT_STAT_CONN_READ(from, checkpoint_time_min);
-    to->checkpoint_handle_drop_duration += WT_STAT_CONN_READ(from, checkpoint_handle_drop_duration);
-    to->checkpoint_handle_duration += WT_STAT_CONN_READ(from, checkpoint_handle_duration);
-    to->checkpoint_handle_apply_duration +=
-      WT_STAT_CONN_READ(from, checkpoint_handle_apply_duration);
-    to->checkpoint_handle_skip_duration += WT_STAT_CONN_READ(from, checkpoint_handle_skip_duration);
-    to->checkpoint_handle_meta_check_duration +=
-      WT_STAT_CONN_READ(from, checkpoint_handle_meta_check_duration);
-    to->checkpoint_handle_lock_duration += WT_STAT_CONN_READ(from, checkpoint_handle_lock_duration);
-    to->checkpoint_handle_applied += WT_STAT_CONN_READ(from, checkpoint_handle_applied);
-    to->checkpoint_handle_dropped += WT_STAT_CONN_READ(from, checkpoint_handle_dropped);
-    to->checkpoint_handle_meta_checked += WT_STAT_CONN_READ(from, checkpoint_handle_meta_checked);
-    to->checkpoint_handle_locked += WT_STAT_CONN_READ(from, checkpoint_handle_locked);
-    to->checkpoint_handle_skipped += WT_STAT_CONN_READ(from, checkpoint_handle_skipped);
-    to->checkpoint_handle_walked += WT_STAT_CONN_READ(from, checkpoint_handle_walked);
-    to->checkpoint_time_recent += WT_STAT_CONN_READ(from, checkpoint_time_recent);
-    to->checkpoints_api += WT_STAT_CONN_READ(from, checkpoints_api);
-    to->checkpoints_compact += WT_STAT_CONN_READ(from, checkpoints_compact);
-    to->checkpoint_sync += WT_STAT_CONN_READ(from, checkpoint_sync);
-    to->checkpoint_presync += WT_STAT_CONN_READ(from, checkpoint_presync);
-    to->checkpoint_hs_pages_reconciled += WT_STAT_CONN_READ(from, checkpoint_hs_pages_reconciled);
-    to->checkpoint_pages_visited_internal +=
-      WT_STAT_CONN_READ(from, checkpoint_pages_visited_internal);
-    to->checkpoint_pages_visited_leaf += WT_STAT_CONN_READ(from, checkpoint_pages_visited_leaf);
-    to->checkpoint_pages_reconciled += WT_STAT_CONN_READ(from, checkpoint_pages_reconciled);
-    to->checkpoint_cleanup_pages_evict += WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_evict);
-    to->checkpoint_cleanup_pages_obsolete_tw +=
-      WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_obsolete_tw);
-    to->checkpoint_cleanup_pages_read_reclaim_space +=
-      WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_read_reclaim_space);
-    to->checkpoint_cleanup_pages_read_obsolete_tw +=
-      WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_read_obsolete_tw);
-    to->checkpoint_cleanup_pages_removed +=
-      WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_removed);
-    to->checkpoint_cleanup_pages_walk_skipped +=
-      WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_walk_skipped);
-    to->checkpoint_cleanup_pages_visited +=
-      WT_STAT_CONN_READ(from, checkpoint_cleanup_pages_visited);
-    to->checkpoint_prep_running += WT_STAT_CONN_READ(from, checkpoint_prep_running);
-    to->checkpoint_prep_max += WT_STAT_CONN_READ(from, checkpoint_prep_max);
-    to->checkpoint_prep_min += WT_STAT_CONN_READ(from, checkpoint_prep_min);
-    to->checkpoint_prep_recent += WT_STAT_CONN_READ(from, checkpoint_prep_recent);
-    to->checkpoint_prep_total += WT_STAT_CONN_READ(from, checkpoint_prep_total);
-    to->checkpoint_state += WT_STAT_CONN_READ(from, checkpoint_state);
-    to->checkpoint_scrub_target += WT_STAT_CONN_READ(from, checkpoint_scrub_target);
-    to->checkpoint_scrub_max += WT_STAT_CONN_READ(from, checkpoint_scrub_max);
-    to->checkpoint_scrub_min += WT_STAT_CONN_READ(from, checkpoint_scrub_min);
-    to->checkpoint_scrub_recent += WT_STAT_CONN_READ(from, checkpoint_scrub_recent);
-    to->checkpoint_scrub_total += WT_STAT_CONN_READ(from, checkpoint_scrub_total);
-    to->checkpoint_stop_stress_active += WT_STAT_CONN_READ(from, checkpoint_stop_stress_active);
-    to->checkpoint_tree_duration += WT_STAT_CONN_READ(from, checkpoint_tree_duration);
-    to->checkpoints_total_failed += WT_STAT_CONN_READ(from, checkpoints_total_failed);
-    to->checkpoints_total_succeed += WT_STAT_CONN_READ(from, checkpoints_total_succeed);
-    to->checkpoint_time_total += WT_STAT_CONN_READ(from, checkpoint_time_total);
-    to->checkpoint_obsolete_applied += WT_STAT_CONN_READ(from, checkpoint_obsolete_applied);
-    to->checkpoint_wait_reduce_dirty += WT_STAT_CONN_READ(from, checkpoint_wait_reduce_dirty);
-    to->chunkcache_spans_chunks_read += WT_STAT_CONN_READ(from, chunkcache_spans_chunks_read);
-    to->chunkcache_chunks_evicted += WT_STAT_CONN_READ(from, chunkcache_chunks_evicted);
-    to->chunkcache_exceeded_bitmap_capacity +=
-      WT_STAT_CONN_READ(from, chunkcache_exceeded_bitmap_capacity);
-    to->chunkcache_exceeded_capacity += WT_STAT_CONN_READ(from, chunkcache_exceeded_capacity);
-    to->chunkcache_lookups += WT_STAT_CONN_READ(from, chunkcache_lookups);
-    to->chunkcache_chunks_loaded_from_flushed_tables +=
-      WT_STAT_CONN_READ(from, chunkcache_chunks_loaded_from_flushed_tables);
-    to->chunkcache_metadata_inserted += WT_STAT_CONN_READ(from, chunkcache_metadata_inserted);
-    to->chunkcache_metadata_removed += WT_STAT_CONN_READ(from, chunkcache_metadata_removed);
-    to->chunkcache_metadata_work_units_dropped +=
-      WT_STAT_CONN_READ(from, chunkcache_metadata_work_units_dropped);
-    to->chunkcache_metadata_work_units_created +=
-      WT_STAT_CONN_READ(from, chunkcache_metadata_work_units_created);
-    to->chunkcache_metadata_work_units_dequeued +=
-      WT_STAT_CONN_READ(from, chunkcache_metadata_work_units_dequeued);
-    to->chunkcache_misses += WT_STAT_CONN_READ(from, chunkcache_misses);
-    to->chunkcache_io_failed += WT_STAT_CONN_READ(from, chunkcache_io_failed);
-    to->chunkcache_retries += WT_STAT_CONN_READ(from, chunkcache_retries);
-    to->chunkcache_retries_checksum_mismatch +=
-      WT_STAT_CONN_READ(from, chunkcache_retries_checksum_mismatch);
-    to->chunkcache_toomany_retries += WT_STAT_CONN_READ(from, chunkcache_toomany_retries);
-    to->chunkcache_bytes_read_persistent +=
-      WT_STAT_CONN_READ(from, chunkcache_bytes_read_persistent);
-    to->chunkcache_bytes_inuse += WT_STAT_CONN_READ(from, chunkcache_bytes_inuse);
-    to->chunkcache_bytes_inuse_pinned += WT_STAT_CONN_READ(from, chunkcache_bytes_inuse_pinned);
-    to->chunkcache_chunks_inuse += WT_STAT_CONN_READ(from, chunkcache_chunks_inuse);
-    to->chunkcache_created_from_metadata +=
-      WT_STAT_CONN_READ(from, chunkcache_created_from_metadata);
-    to->chunkcache_chunks_pinned += WT_STAT_CONN_READ(from, chunkcache_chunks_pinned);
-    to->cond_auto_wait_reset += WT_STAT_CONN_READ(from, cond_auto_wait_reset);
-    to->cond_auto_wait += WT_STAT_CONN_READ(from, cond_auto_wait);
-    to->cond_auto_wait_skipped += WT_STAT_CONN_READ(from, cond_auto_wait_skipped);
-    to->time_travel += WT_STAT_CONN_READ(from, time_travel);
-    to->file_open += WT_STAT_CONN_READ(from, file_open);
-    to->buckets_dh += WT_STAT_CONN_READ(from, buckets_dh);
-    to->buckets += WT_STAT_CONN_READ(from, buckets);
-    to->memory_allocation += WT_STAT_CONN_READ(from, memory_allocation);
-    to->memory_free += WT_STAT_CONN_READ(from, memory_free);
-    to->memory_grow += WT_STAT_CONN_READ(from, memory_grow);
-    to->no_session_sweep_5min += WT_STAT_CONN_READ(from, no_session_sweep_5min);
-    to->no_session_sweep_60min += WT_STAT_CONN_READ(from, no_session_sweep_60min);
-    to->cond_wait += WT_STAT_CONN_READ(from, cond_wait);
-    to->rwlock_read += WT_STAT_CONN_READ(from, rwlock_read);
-    to->rwlock_write += WT_STAT_CONN_READ(from, rwlock_write);
-    to->fsync_io += WT_STAT_CONN_READ(from, fsync_io);
-    to->read_io += WT_STAT_CONN_READ(from, read_io);
-    to->write_io += WT_STAT_CONN_READ(from, write_io);
-    to->cursor_tree_walk_del_page_skip += WT_STAT_CONN_READ(from, cursor_tree_walk_del_page_skip);
-    to->cursor_next_skip_total += WT_STAT_CONN_READ(from, cursor_next_skip_total);
-    to->cursor_prev_skip_total += WT_STAT_CONN_READ(from, cursor_prev_skip_total);
-    to->cursor_skip_hs_cur_position += WT_STAT_CONN_READ(from, cursor_skip_hs_cur_position);
-    to->cursor_tree_walk_inmem_del_page_skip +=
-      WT_STAT_CONN_READ(from, cursor_tree_walk_inmem_del_page_skip);
-    to->cursor_tree_walk_ondisk_del_page_skip +=
-      WT_STAT_CONN_READ(from, cursor_tree_walk_ondisk_del_page_skip);
-    to->cursor_search_near_prefix_fast_paths +=
-      WT_STAT_CONN_READ(from, cursor_search_near_prefix_fast_paths);
-    to->cursor_reposition_failed += WT_STAT_CONN_READ(from, cursor_reposition_failed);
-    to->cursor_reposition += WT_STAT_CONN_READ(from, cursor_reposition);
-    to->cursor_bulk_count += WT_STAT_CONN_READ(from, cursor_bulk_count);
-    to->cursor_cached_count += WT_STAT_CONN_READ(from, cursor_cached_count);
-    to->cursor_bound_error += WT_STAT_CONN_READ(from, cursor_bound_error);
-    to->cursor_bounds_reset += WT_STAT_CONN_READ(from, cursor_bounds_reset);
-    to->cursor_bounds_comparisons += WT_STAT_CONN_READ(from, cursor_bounds_comparisons);
-    to->cursor_bounds_next_unpositioned += WT_STAT_CONN_READ(from, cursor_bounds_next_unpositioned);
-    to->cursor_bounds_next_early_exit += WT_STAT_CONN_READ(from, cursor_bounds_next_early_exit);
-    to->cursor_bounds_prev_unpositioned += WT_STAT_CONN_READ(from, cursor_bounds_prev_unpositioned);
-    to->cursor_bounds_prev_early_exit += WT_STAT_CONN_READ(from, cursor_bounds_prev_early_exit);
-    to->cursor_bounds_search_early_exit += WT_STAT_CONN_READ(from, cursor_bounds_search_early_exit);
-    to->cursor_bounds_search_near_repositioned_cursor +=
-      WT_STAT_CONN_READ(from, cursor_bounds_search_near_repositioned_cursor);
-    to->cursor_insert_bulk += WT_STAT_CONN_READ(from, cursor_insert_bulk);
-    to->cursor_cache_error += WT_STAT_CONN_READ(from, cursor_cache_error);
-    to->cursor_cache += WT_STAT_CONN_READ(from, cursor_cache);
-    to->cursor_close_error += WT_STAT_CONN_READ(from, cursor_close_error);
-    to->cursor_compare_error += WT_STAT_CONN_READ(from, cursor_compare_error);
-    to->cursor_create += WT_STAT_CONN_READ(from, cursor_create);
-    to->cursor_equals_error += WT_STAT_CONN_READ(from, cursor_equals_error);
-    to->cursor_get_key_error += WT_STAT_CONN_READ(from, cursor_get_key_error);
-    to->cursor_get_value_error += WT_STAT_CONN_READ(from, cursor_get_value_error);
-    to->cursor_insert += WT_STAT_CONN_READ(from, cursor_insert);
-    to->cursor_insert_error += WT_STAT_CONN_READ(from, cursor_insert_error);
-    to->cursor_insert_check_error += WT_STAT_CONN_READ(from, cursor_insert_check_error);
-    to->cursor_insert_bytes += WT_STAT_CONN_READ(from, cursor_insert_bytes);
-    to->cursor_largest_key_error += WT_STAT_CONN_READ(from, cursor_largest_key_error);
-    to->cursor_modify += WT_STAT_CONN_READ(from, cursor_modify);
-    to->cursor_modify_error += WT_STAT_CONN_READ(from, cursor_modify_error);
-    to->cursor_modify_bytes += WT_STAT_CONN_READ(from, cursor_modify_bytes);
-    to->cursor_modify_bytes_touch += WT_STAT_CONN_READ(from, cursor_modify_bytes_touch);
-    to->cursor_next += WT_STAT_CONN_READ(from, cursor_next);
-    to->cursor_next_error += WT_STAT_CONN_READ(from, cursor_next_error);
-    to->cursor_next_hs_tombstone += WT_STAT_CONN_READ(from, cursor_next_hs_tombstone);
-    to->cursor_next_skip_lt_100 += WT_STAT_CONN_READ(from, cursor_next_skip_lt_100);
-    to->cursor_next_skip_ge_100 += WT_STAT_CONN_READ(from, cursor_next_skip_ge_100);
-    to->cursor_next_random_error += WT_STAT_CONN_READ(from, cursor_next_random_error);
-    to->cursor_restart += WT_STAT_CONN_READ(from, cursor_restart);
-    to->cursor_prev += WT_STAT_CONN_READ(from, cursor_prev);
-    to->cursor_prev_error += WT_STAT_CONN_READ(from, cursor_prev_error);
-    to->cursor_prev_hs_tombstone += WT_STAT_CONN_READ(from, cursor_prev_hs_tombstone);
-    to->cursor_prev_skip_ge_100 += WT_STAT_CONN_READ(from, cursor_prev_skip_ge_100);
-    to->cursor_prev_skip_lt_100 += WT_STAT_CONN_READ(from, cursor_prev_skip_lt_100);
-    to->cursor_reconfigure_error += WT_STAT_CONN_READ(from, cursor_reconfigure_error);
-    to->cursor_remove += WT_STAT_CONN_READ(from, cursor_remove);
-    to->cursor_remove_error += WT_STAT_CONN_READ(from, cursor_remove_error);
-    to->cursor_remove_bytes += WT_STAT_CONN_READ(from, cursor_remove_bytes);
-    to->cursor_reopen_error += WT_STAT_CONN_READ(from, cursor_reopen_error);
-    to->cursor_reserve += WT_STAT_CONN_READ(from, cursor_reserve);
-    to->cursor_reserve_error += WT_STAT_CONN_READ(from, cursor_reserve_error);
-    to->cursor_reset += WT_STAT_CONN_READ(from, cursor_reset);
-    to->cursor_reset_error += WT_STAT_CONN_READ(from, cursor_reset_error);
-    to->cursor_search += WT_STAT_CONN_READ(from, cursor_search);
-    to->cursor_search_error += WT_STAT_CONN_READ(from, cursor_search_error);
-    to->cursor_search_hs += WT_STAT_CONN_READ(from, cursor_search_hs);
-    to->cursor_search_near += WT_STAT_CONN_READ(from, cursor_search_near);
-    to->cursor_search_near_error += WT_STAT_CONN_READ(from, cursor_search_near_error);
-    to->cursor_sweep_buckets += WT_STAT_CONN_READ(from, cursor_sweep_buckets);
-    to->cursor_sweep_closed += WT_STAT_CONN_READ(from, cursor_sweep_closed);
-    to->cursor_sweep_examined += WT_STAT_CONN_READ(from, cursor_sweep_examined);
-    to->cursor_sweep += WT_STAT_CONN_READ(from, cursor_sweep);
-    to->cursor_truncate += WT_STAT_CONN_READ(from, cursor_truncate);
-    to->cursor_truncate_keys_deleted += WT_STAT_CONN_READ(from, cursor_truncate_keys_deleted);
-    to->cursor_update += WT_STAT_CONN_READ(from, cursor_update);
-    to->cursor_update_error += WT_STAT_CONN_READ(from, cursor_update_error);
-    to->cursor_update_bytes += WT_STAT_CONN_READ(from, cursor_update_bytes);
-    to->cursor_update_bytes_changed += WT_STAT_CONN_READ(from, cursor_update_bytes_changed);
-    to->cursor_reopen += WT_STAT_CONN_READ(from, cursor_reopen);
-    to->cursor_open_count += WT_STAT_CONN_READ(from, cursor_open_count);
-    to->dh_conn_handle_table_count += WT_STAT_CONN_READ(from, dh_conn_handle_table_count);
-    to->dh_conn_handle_tiered_count += WT_STAT_CONN_READ(from, dh_conn_handle_tiered_count);
-    to->dh_conn_handle_tiered_tree_count +=
-      WT_STAT_CONN_READ(from, dh_conn_handle_tiered_tree_count);
-    to->dh_conn_handle_btree_count += WT_STAT_CONN_READ(from, dh_conn_handle_btree_count);
-    to->dh_conn_handle_checkpoint_count += WT_STAT_CONN_READ(from, dh_conn_handle_checkpoint_count);
-    to->dh_conn_handle_size += WT_STAT_CONN_READ(from, dh_conn_handle_size);
-    to->dh_conn_handle_count += WT_STAT_CONN_READ(from, dh_conn_handle_count);
-    to->dh_sweep_ref += WT_STAT_CONN_READ(from, dh_sweep_ref);
-    to->dh_sweep_dead_close += WT_STAT_CONN_READ(from, dh_sweep_dead_close);
-    to->dh_sweep_remove += WT_STAT_CONN_READ(from, dh_sweep_remove);
-    to->dh_sweep_expired_close += WT_STAT_CONN_READ(from, dh_sweep_expired_close);
-    to->dh_sweep_tod += WT_STAT_CONN_READ(from, dh_sweep_tod);
-    to->dh_sweeps += WT_STAT_CONN_READ(from, dh_sweeps);
-    to->dh_sweep_skip_ckpt += WT_STAT_CONN_READ(from, dh_sweep_skip_ckpt);
-    to->dh_session_handles += WT_STAT_CONN_READ(from, dh_session_handles);
-    to->dh_session_sweeps += WT_STAT_CONN_READ(from, dh_session_sweeps);
-    to->live_restore_state += WT_STAT_CONN_READ(from, live_restore_state);
-    to->live_restore_queue_length += WT_STAT_CONN_READ(from, live_restore_queue_length);
-    to->lock_btree_page_count += WT_STAT_CONN_READ(from, lock_btree_page_count);
-    to->lock_btree_page_wait_application +=
-      WT_STAT_CONN_READ(from, lock_btree_page_wait_application);
-    to->lock_btree_page_wait_internal += WT_STAT_CONN_READ(from, lock_btree_page_wait_internal);
-    to->lock_checkpoint_count += WT_STAT_CONN_READ(from, lock_checkpoint_count);
-    to->lock_checkpoint_wait_application +=
-      WT_STAT_CONN_READ(from, lock_checkpoint_wait_application);
-    to->lock_checkpoint_wait_internal += WT_STAT_CONN_READ(from, lock_checkpoint_wait_internal);
-    to->lock_dhandle_wait_application += WT_STAT_CONN_READ(from, lock_dhandle_wait_application);
-    to->lock_dhandle_wait_internal += WT_STAT_CONN_READ(from, lock_dhandle_wait_internal);
-    to->lock_dhandle_read_count += WT_STAT_CONN_READ(from, lock_dhandle_read_count);
-    to->lock_dhandle_write_count += WT_STAT_CONN_READ(from, lock_dhandle_write_count);
-    to->lock_metadata_count += WT_STAT_CONN_READ(from, lock_metadata_count);
-    to->lock_metadata_wait_application += WT_STAT_CONN_READ(from, lock_metadata_wait_application);
-    to->lock_metadata_wait_internal += WT_STAT_CONN_READ(from, lock_metadata_wait_internal);
-    to->lock_schema_count += WT_STAT_CONN_READ(from, lock_schema_count);
-    to->lock_schema_wait_application += WT_STAT_CONN_READ(from, lock_schema_wait_application);
-    to->lock_schema_wait_internal += WT_STAT_CONN_READ(from, lock_schema_wait_internal);
-    to->lock_table_wait_application += WT_STAT_CONN_READ(from, lock_table_wait_application);
-    to->lock_table_wait_internal += WT_STAT_CONN_READ(from, lock_table_wait_internal);
-    to->lock_table_read_count += WT_STAT_CONN_READ(from, lock_table_read_count);
-    to->lock_table_write_count += WT_STAT_CONN_READ(from, lock_table_write_count);
-    to->lock_txn_global_wait_application +=
-      WT_STAT_CONN_READ(from, lock_txn_global_wait_application);
-    to->lock_txn_global_wait_internal += WT_STAT_CONN_READ(from, lock_txn_global_wait_internal);
-    to->lock_txn_global_read_count += WT_STAT_CONN_READ(from, lock_txn_global_read_count);
-    to->lock_txn_global_write_count += WT_STAT_CONN_READ(from, lock_txn_global_write_count);
-    to->log_slot_switch_busy += WT_STAT_CONN_READ(from, log_slot_switch_busy);
-    to->log_force_remove_sleep += WT_STAT_CONN_READ(from, log_force_remove_sleep);
-    to->log_bytes_payload += WT_STAT_CONN_READ(from, log_bytes_payload);
-    to->log_bytes_written += WT_STAT_CONN_READ(from, log_bytes_written);
-    to->log_zero_fills += WT_STAT_CONN_READ(from, log_zero_fills);
-    to->log_flush += WT_STAT_CONN_READ(from, log_flush);
-    to->log_force_write += WT_STAT_CONN_READ(from, log_force_write);
-    to->log_force_write_skip += WT_STAT_CONN_READ(from, log_force_write_skip);
-    to->log_compress_writes += WT_STAT_CONN_READ(from, log_compress_writes);
-    to->log_compress_write_fails += WT_STAT_CONN_READ(from, log_compress_write_fails);
-    to->log_compress_small += WT_STAT_CONN_READ(from, log_compress_small);
-    to->log_release_write_lsn += WT_STAT_CONN_READ(from, log_release_write_lsn);
-    to->log_scans += WT_STAT_CONN_READ(from, log_scans);
-    to->log_scan_rereads += WT_STAT_CONN_READ(from, log_scan_rereads);
-    to->log_write_lsn += WT_STAT_CONN_READ(from, log_write_lsn);
-    to->log_write_lsn_skip += WT_STAT_CONN_READ(from, log_write_lsn_skip);
-    to->log_sync += WT_STAT_CONN_READ(from, log_sync);
-    to->log_sync_duration += WT_STAT_CONN_READ(from, log_sync_duration);
-    to->log_sync_dir += WT_STAT_CONN_READ(from, log_sync_dir);
-    to->log_sync_dir_duration += WT_STAT_CONN_READ(from, log_sync_dir_duration);
-    to->log_writes += WT_STAT_CONN_READ(from, log_writes);
-    to->log_slot_consolidated += WT_STAT_CONN_READ(from, log_slot_consolidated);
-    to->log_max_filesize += WT_STAT_CONN_READ(from, log_max_filesize);
-    to->log_prealloc_max += WT_STAT_CONN_READ(from, log_prealloc_max);
-    to->log_prealloc_missed += WT_STAT_CONN_READ(from, log_prealloc_missed);
-    to->log_prealloc_files += WT_STAT_CONN_READ(from, log_prealloc_files);
-    to->log_prealloc_used += WT_STAT_CONN_READ(from, log_prealloc_used);
-    to->log_scan_records += WT_STAT_CONN_READ(from, log_scan_records);
-    to->log_slot_close_race += WT_STAT_CONN_READ(from, log_slot_close_race);
-    to->log_slot_close_unbuf += WT_STAT_CONN_READ(from, log_slot_close_unbuf);
-    to->log_slot_closes += WT_STAT_CONN_READ(from, log_slot_closes);
-    to->log_slot_races += WT_STAT_CONN_READ(from, log_slot_races);
-    to->log_slot_yield_race += WT_STAT_CONN_READ(from, log_slot_yield_race);
-    to->log_slot_immediate += WT_STAT_CONN_READ(from, log_slot_immediate);
-    to->log_slot_yield_close += WT_STAT_CONN_READ(from, log_slot_yield_close);
-    to->log_slot_yield_sleep += WT_STAT_CONN_READ(from, log_slot_yield_sleep);
-    to->log_slot_yield += WT_STAT_CONN_READ(from, log_slot_yield);
-    to->log_slot_active_closed += WT_STAT_CONN_READ(from, log_slot_active_closed);
-    to->log_slot_yield_duration += WT_STAT_CONN_READ(from, log_slot_yield_duration);
-    to->log_slot_no_free_slots += WT_STAT_CONN_READ(from, log_slot_no_free_slots);
-    to->log_slot_unbuffered += WT_STAT_CONN_READ(from, log_slot_unbuffered);
-    to->log_compress_mem += WT_STAT_CONN_READ(from, log_compress_mem);
-    to->log_buffer_size += WT_STAT_CONN_READ(from, log_buffer_size);
-    to->log_compress_len += WT_STAT_CONN_READ(from, log_compress_len);
-    to->log_slot_coalesced += WT_STAT_CONN_READ(from, log_slot_coalesced);
-    to->log_close_yields += WT_STAT_CONN_READ(from, log_close_yields);
-    to->perf_hist_fsread_latency_lt10 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt10);
-    to->perf_hist_fsread_latency_lt50 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt50);
-    to->perf_hist_fsread_latency_lt100 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt100);
-    to->perf_hist_fsread_latency_lt250 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt250);
-    to->perf_hist_fsread_latency_lt500 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt500);
-    to->perf_hist_fsread_latency_lt1000 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_lt1000);
-    to->perf_hist_fsread_latency_gt1000 += WT_STAT_CONN_READ(from, perf_hist_fsread_latency_gt1000);
-    to->perf_hist_fsread_latency_total_msecs +=
-      WT_STAT_CONN_READ(from, perf_hist_fsread_latency_total_msecs);
-    to->perf_hist_fswrite_latency_lt10 += WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_lt10);
-    to->perf_hist_fswrite_latency_lt50 += WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_lt50);
-    to->perf_hist_fswrite_latency_lt100 += WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_lt100);
-    to->perf_hist_fswrite_latency_lt250 += WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_lt250);
-    to->perf_hist_fswrite_latency_lt500 += WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_lt500);
-    to->perf_hist_fswrite_latency_lt1000 +=
-      WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_lt1000);
-    to->perf_hist_fswrite_latency_gt1000 +=
-      WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_gt1000);
-    to->perf_hist_fswrite_latency_total_msecs +=
-      WT_STAT_CONN_READ(from, perf_hist_fswrite_latency_total_msecs);
-    to->perf_hist_opread_latency_lt100 += WT_STAT_CONN_READ(from, perf_hist_opread_latency_lt100);
-    to->perf_hist_opread_latency_lt250 += WT_STAT_CONN_READ(from, perf_hist_opread_latency_lt250);
-    to->perf_hist_opread_latency_lt500 += WT_STAT_CONN_READ(from, perf_hist_opread_latency_lt500);
-    to->perf_hist_opread_latency_lt1000 += WT_STAT_CONN_READ(from, perf_hist_opread_latency_lt1000);
-    to->perf_hist_opread_latency_lt10000 +=
-      WT_STAT_CONN_READ(from, perf_hist_opread_latency_lt10000);
-    to->perf_hist_opread_latency_gt10000 +=
-      WT_STAT_CONN_READ(from, perf_hist_opread_latency_gt10000);
-    to->perf_hist_opread_latency_total_usecs +=
-      WT_STAT_CONN_READ(from, perf_hist_opread_latency_total_usecs);
-    to->perf_hist_opwrite_latency_lt100 += WT_STAT_CONN_READ(from, perf_hist_opwrite_latency_lt100);
-    to->perf_hist_opwrite_latency_lt250 += WT_STAT_CONN_READ(from, perf_hist_opwrite_latency_lt250);
-    to->perf_hist_opwrite_latency_lt500 += WT_STAT_CONN_READ(from, perf_hist_opwrite_latency_lt500);
-    to->perf_hist_opwrite_latency_lt1000 +=
-      WT_STAT_CONN_READ(from, perf_hist_opwrite_latency_lt1000);
-    to->perf_hist_opwrite_latency_lt10000 +=
-      WT_STAT_CONN_READ(from, perf_hist_opwrite_latency_lt10000);
-    to->perf_hist_opwrite_latency_gt10000 +=
-      WT_STAT_CONN_READ(from, perf_hist_opwrite_latency_gt10000);
-    to->perf_hist_opwrite_latency_total_usecs +=
-      WT_STAT_CONN_READ(from, perf_hist_opwrite_latency_total_usecs);
-    to->prefetch_skipped_internal_page += WT_STAT_CONN_READ(from, prefetch_skipped_internal_page);
-    to->prefetch_skipped_no_flag_set += WT_STAT_CONN_READ(from, prefetch_skipped_no_flag_set);
-    to->prefetch_failed_start += WT_STAT_CONN_READ(from, prefetch_failed_start);
-    to->prefetch_skipped_same_ref += WT_STAT_CONN_READ(from, prefetch_skipped_same_ref);
-    to->prefetch_disk_one += WT_STAT_CONN_READ(from, prefetch_disk_one);
-    to->prefetch_skipped_no_valid_dhandle +=
-      WT_STAT_CONN_READ(from, prefetch_skipped_no_valid_dhandle);
-    to->prefetch_skipped += WT_STAT_CONN_READ(from, prefetch_skipped);
-    to->prefetch_skipped_disk_read_count +=
-      WT_STAT_CONN_READ(from, prefetch_skipped_disk_read_count);
-    to->prefetch_skipped_internal_session +=
-      WT_STAT_CONN_READ(from, prefetch_skipped_internal_session);
-    to->prefetch_skipped_special_handle += WT_STAT_CONN_READ(from, prefetch_skipped_special_handle);
-    to->prefetch_pages_fail += WT_STAT_CONN_READ(from, prefetch_pages_fail);
-    to->prefetch_pages_queued += WT_STAT_CONN_READ(from, prefetch_pages_queued);
-    to->prefetch_pages_read += WT_STAT_CONN_READ(from, prefetch_pages_read);
-    to->prefetch_skipped_error_ok += WT_STAT_CONN_READ(from, prefetch_skipped_error_ok);
-    to->prefetch_attempts += WT_STAT_CONN_READ(from, prefetch_attempts);
-    to->rec_vlcs_emptied_pages += WT_STAT_CONN_READ(from, rec_vlcs_emptied_pages);
-    to->rec_time_window_bytes_ts += WT_STAT_CONN_READ(from, rec_time_window_bytes_ts);
-    to->rec_time_window_bytes_txn += WT_STAT_CONN_READ(from, rec_time_window_bytes_txn);
-    to->rec_page_delete_fast += WT_STAT_CONN_READ(from, rec_page_delete_fast);
-    to->rec_overflow_key_leaf += WT_STAT_CONN_READ(from, rec_overflow_key_leaf);
-    to->rec_maximum_milliseconds += WT_STAT_CONN_READ(from, rec_maximum_milliseconds);
-    to->rec_maximum_image_build_milliseconds +=
-      WT_STAT_CONN_READ(from, rec_maximum_image_build_milliseconds);
-    to->rec_maximum_hs_wrapup_milliseconds +=
-      WT_STAT_CONN_READ(from, rec_maximum_hs_wrapup_milliseconds);
-    to->rec_overflow_value += WT_STAT_CONN_READ(from, rec_overflow_value);
-    to->rec_pages += WT_STAT_CONN_READ(from, rec_pages);
-    to->rec_pages_eviction += WT_STAT_CONN_READ(from, rec_pages_eviction);
-    to->rec_pages_with_prepare += WT_STAT_CONN_READ(from, rec_pages_with_prepare);
-    to->rec_pages_with_ts += WT_STAT_CONN_READ(from, rec_pages_with_ts);
-    to->rec_pages_with_txn += WT_STAT_CONN_READ(from, rec_pages_with_txn);
-    to->rec_page_delete += WT_STAT_CONN_READ(from, rec_page_delete);
-    to->rec_time_aggr_newest_start_durable_ts +=
-      WT_STAT_CONN_READ(from, rec_time_aggr_newest_start_durable_ts);
-    to->rec_time_aggr_newest_stop_durable_ts +=
-      WT_STAT_CONN_READ(from, rec_time_aggr_newest_stop_durable_ts);
-    to->rec_time_aggr_newest_stop_ts += WT_STAT_CONN_READ(from, rec_time_aggr_newest_stop_ts);
-    to->rec_time_aggr_newest_stop_txn += WT_STAT_CONN_READ(from, rec_time_aggr_newest_stop_txn);
-    to->rec_time_aggr_newest_txn += WT_STAT_CONN_READ(from, rec_time_aggr_newest_txn);
-    to->rec_time_aggr_oldest_start_ts += WT_STAT_CONN_READ(from, rec_time_aggr_oldest_start_ts);
-    to->rec_time_aggr_prepared += WT_STAT_CONN_READ(from, rec_time_aggr_prepared);
-    to->rec_time_window_pages_prepared += WT_STAT_CONN_READ(from, rec_time_window_pages_prepared);
-    to->rec_time_window_pages_durable_start_ts +=
-      WT_STAT_CONN_READ(from, rec_time_window_pages_durable_start_ts);
-    to->rec_time_window_pages_start_ts += WT_STAT_CONN_READ(from, rec_time_window_pages_start_ts);
-    to->rec_time_window_pages_start_txn += WT_STAT_CONN_READ(from, rec_time_window_pages_start_txn);
-    to->rec_time_window_pages_durable_stop_ts +=
-      WT_STAT_CONN_READ(from, rec_time_window_pages_durable_stop_ts);
-    to->rec_time_window_pages_stop_ts += WT_STAT_CONN_READ(from, rec_time_window_pages_stop_ts);
-    to->rec_time_window_pages_stop_txn += WT_STAT_CONN_READ(from, rec_time_window_pages_stop_txn);
-    to->rec_time_window_prepared += WT_STAT_CONN_READ(from, rec_time_window_prepared);
-    to->rec_time_window_durable_start_ts +=
-      WT_STAT_CONN_READ(from, rec_time_window_durable_start_ts);
-    to->rec_time_window_start_ts += WT_STAT_CONN_READ(from, rec_time_window_start_ts);
-    to->rec_time_window_start_txn += WT_STAT_CONN_READ(from, rec_time_window_start_txn);
-    to->rec_time_window_durable_stop_ts += WT_STAT_CONN_READ(from, rec_time_window_durable_stop_ts);
-    to->rec_time_window_stop_ts += WT_STAT_CONN_READ(from, rec_time_window_stop_ts);
-    to->rec_time_window_stop_txn += WT_STAT_CONN_READ(from, rec_time_window_stop_txn);
-    to->rec_split_stashed_bytes += WT_STAT_CONN_READ(from, rec_split_stashed_bytes);
-    to->rec_split_stashed_objects += WT_STAT_CONN_READ(from, rec_split_stashed_objects);
-    to->local_objects_inuse += WT_STAT_CONN_READ(from, local_objects_inuse);
-    to->flush_tier_fail += WT_STAT_CONN_READ(from, flush_tier_fail);
-    to->flush_tier += WT_STAT_CONN_READ(from, flush_tier);
-    to->flush_tier_skipped += WT_STAT_CONN_READ(from, flush_tier_skipped);
-    to->flush_tier_switched += WT_STAT_CONN_READ(from, flush_tier_switched);
-    to->local_objects_removed += WT_STAT_CONN_READ(from, local_objects_removed);
-    to->session_open += WT_STAT_CONN_READ(from, session_open);
-    to->session_query_ts += WT_STAT_CONN_READ(from, session_query_ts);
-    to->session_table_alter_fail += WT_STAT_CONN_READ(from, session_table_alter_fail);
-    to->session_table_alter_success += WT_STAT_CONN_READ(from, session_table_alter_success);
-    to->session_table_alter_trigger_checkpoint +=
-      WT_STAT_CONN_READ(from, session_table_alter_trigger_checkpoint);
-    to->session_table_alter_skip += WT_STAT_CONN_READ(from, session_table_alter_skip);
-    to->session_table_compact_conflicting_checkpoint +=
-      WT_STAT_CONN_READ(from, session_table_compact_conflicting_checkpoint);
-    to->session_table_compact_dhandle_success +=
-      WT_STAT_CONN_READ(from, session_table_compact_dhandle_success);
-    to->session_table_compact_fail += WT_STAT_CONN_READ(from, session_table_compact_fail);
-    to->session_table_compact_fail_cache_pressure +=
-      WT_STAT_CONN_READ(from, session_table_compact_fail_cache_pressure);
-    to->session_table_compact_passes += WT_STAT_CONN_READ(from, session_table_compact_passes);
-    to->session_table_compact_eviction += WT_STAT_CONN_READ(from, session_table_compact_eviction);
-    to->session_table_compact_running += WT_STAT_CONN_READ(from, session_table_compact_running);
-    to->session_table_compact_skipped += WT_STAT_CONN_READ(from, session_table_compact_skipped);
-    to->session_table_compact_success += WT_STAT_CONN_READ(from, session_table_compact_success);
-    to->session_table_compact_timeout += WT_STAT_CONN_READ(from, session_table_compact_timeout);
-    to->session_table_create_fail += WT_STAT_CONN_READ(from, session_table_create_fail);
-    to->session_table_create_success += WT_STAT_CONN_READ(from, session_table_create_success);
-    to->session_table_create_import_fail +=
-      WT_STAT_CONN_READ(from, session_table_create_import_fail);
-    to->session_table_create_import_repair +=
-      WT_STAT_CONN_READ(from, session_table_create_import_repair);
-    to->session_table_create_import_success +=
-      WT_STAT_CONN_READ(from, session_table_create_import_success);
-    to->session_table_drop_fail += WT_STAT_CONN_READ(from, session_table_drop_fail);
-    to->session_table_drop_success += WT_STAT_CONN_READ(from, session_table_drop_success);
-    to->session_table_salvage_fail += WT_STAT_CONN_READ(from, session_table_salvage_fail);
-    to->session_table_salvage_success += WT_STAT_CONN_READ(from, session_table_salvage_success);
-    to->session_table_truncate_fail += WT_STAT_CONN_READ(from, session_table_truncate_fail);
-    to->session_table_truncate_success += WT_STAT_CONN_READ(from, session_table_truncate_success);
-    to->session_table_verify_fail += WT_STAT_CONN_READ(from, session_table_verify_fail);
-    to->session_table_verify_success += WT_STAT_CONN_READ(from, session_table_verify_success);
-    to->tiered_work_units_dequeued += WT_STAT_CONN_READ(from, tiered_work_units_dequeued);
-    to->tiered_work_units_removed += WT_STAT_CONN_READ(from, tiered_work_units_removed);
-    to->tiered_work_units_created += WT_STAT_CONN_READ(from, tiered_work_units_created);
-    to->tiered_retention += WT_STAT_CONN_READ(from, tiered_retention);
-    to->thread_fsync_active += WT_STAT_CONN_READ(from, thread_fsync_active);
-    to->thread_read_active += WT_STAT_CONN_READ(from, thread_read_active);
-    to->thread_write_active += WT_STAT_CONN_READ(from, thread_write_active);
-    to->application_cache_ops += WT_STAT_CONN_READ(from, application_cache_ops);
-    to->application_evict_snapshot_refreshed +=
-      WT_STAT_CONN_READ(from, application_evict_snapshot_refreshed);
-    to->application_cache_time += WT_STAT_CONN_READ(from, application_cache_time);
-    to->txn_release_blocked += WT_STAT_CONN_READ(from, txn_release_blocked);
-    to->dhandle_lock_blocked += WT_STAT_CONN_READ(from, dhandle_lock_blocked);
-    to->page_index_slot_ref_blocked += WT_STAT_CONN_READ(from, page_index_slot_ref_blocked);
-    to->prepared_transition_blocked_page +=
-      WT_STAT_CONN_READ(from, prepared_transition_blocked_page);
-    to->page_busy_blocked += WT_STAT_CONN_READ(from, page_busy_blocked);
-    to->page_forcible_evict_blocked += WT_STAT_CONN_READ(from, page_forcible_evict_blocked);
-    to->page_locked_blocked += WT_STAT_CONN_READ(from, page_locked_blocked);
-    to->page_read_blocked += WT_STAT_CONN_READ(from, page_read_blocked);
-    to->page_sleep += WT_STAT_CONN_READ(from, page_sleep);
-    to->page_del_rollback_blocked += WT_STAT_CONN_READ(from, page_del_rollback_blocked);
-    to->child_modify_blocked_page += WT_STAT_CONN_READ(from, child_modify_blocked_page);
-    to->txn_prepared_updates += WT_STAT_CONN_READ(from, txn_prepared_updates);
-    to->txn_prepared_updates_committed += WT_STAT_CONN_READ(from, txn_prepared_updates_committed);
-    to->txn_prepared_updates_key_repeated +=
-      WT_STAT_CONN_READ(from, txn_prepared_updates_key_repeated);
-    to->txn_prepared_updates_rolledback += WT_STAT_CONN_READ(from, txn_prepared_updates_rolledback);
-    to->txn_read_race_prepare_commit += WT_STAT_CONN_READ(from, txn_read_race_prepare_commit);
-    to->txn_read_overflow_remove += WT_STAT_CONN_READ(from, txn_read_overflow_remove);
-    to->txn_rollback_oldest_pinned += WT_STAT_CONN_READ(from, txn_rollback_oldest_pinned);
-    to->txn_prepare += WT_STAT_CONN_READ(from, txn_prepare);
-    to->txn_prepare_commit += WT_STAT_CONN_READ(from, txn_prepare_commit);
-    to->txn_prepare_active += WT_STAT_CONN_READ(from, txn_prepare_active);
-    to->txn_prepare_rollback += WT_STAT_CONN_READ(from, txn_prepare_rollback);
-    to->txn_query_ts += WT_STAT_CONN_READ(from, txn_query_ts);
-    to->txn_read_race_prepare_update += WT_STAT_CONN_READ(from, txn_read_race_prepare_update);
-    to->txn_rts += WT_STAT_CONN_READ(from, txn_rts);
-    to->txn_rts_sweep_hs_keys_dryrun += WT_STAT_CONN_READ(from, txn_rts_sweep_hs_keys_dryrun);
-    to->txn_rts_hs_stop_older_than_newer_start +=
-      WT_STAT_CONN_READ(from, txn_rts_hs_stop_older_than_newer_start);
-    to->txn_rts_inconsistent_ckpt += WT_STAT_CONN_READ(from, txn_rts_inconsistent_ckpt);
-    to->txn_rts_keys_removed += WT_STAT_CONN_READ(from, txn_rts_keys_removed);
-    to->txn_rts_keys_restored += WT_STAT_CONN_READ(from, txn_rts_keys_restored);
-    to->txn_rts_keys_removed_dryrun += WT_STAT_CONN_READ(from, txn_rts_keys_removed_dryrun);
-    to->txn_rts_keys_restored_dryrun += WT_STAT_CONN_READ(from, txn_rts_keys_restored_dryrun);
-    to->txn_rts_pages_visited += WT_STAT_CONN_READ(from, txn_rts_pages_visited);
-    to->txn_rts_hs_restore_tombstones += WT_STAT_CONN_READ(from, txn_rts_hs_restore_tombstones);
-    to->txn_rts_hs_restore_updates += WT_STAT_CONN_READ(from, txn_rts_hs_restore_updates);
-    to->txn_rts_delete_rle_skipped += WT_STAT_CONN_READ(from, txn_rts_delete_rle_skipped);
-    to->txn_rts_stable_rle_skipped += WT_STAT_CONN_READ(from, txn_rts_stable_rle_skipped);
-    to->txn_rts_sweep_hs_keys += WT_STAT_CONN_READ(from, txn_rts_sweep_hs_keys);
-    to->txn_rts_hs_restore_tombstones_dryrun +=
-      WT_STAT_CONN_READ(from, txn_rts_hs_restore_tombstones_dryrun);
-    to->txn_rts_tree_walk_skip_pages += WT_STAT_CONN_READ(from, txn_rts_tree_walk_skip_pages);
-    to->txn_rts_upd_aborted += WT_STAT_CONN_READ(from, txn_rts_upd_aborted);
-    to->txn_rts_hs_restore_updates_dryrun +=
-      WT_STAT_CONN_READ(from, txn_rts_hs_restore_updates_dryrun);
-    to->txn_rts_hs_removed += WT_STAT_CONN_READ(from, txn_rts_hs_removed);
-    to->txn_rts_upd_aborted_dryrun += WT_STAT_CONN_READ(from, txn_rts_upd_aborted_dryrun);
-    to->txn_rts_hs_removed_dryrun += WT_STAT_CONN_READ(from, txn_rts_hs_removed_dryrun);
-    to->txn_sessions_walked += WT_STAT_CONN_READ(from, txn_sessions_walked);
-    to->txn_set_ts += WT_STAT_CONN_READ(from, txn_set_ts);
-    to->txn_set_ts_durable += WT_STAT_CONN_READ(from, txn_set_ts_durable);
-    to->txn_set_ts_durable_upd += WT_STAT_CONN_READ(from, txn_set_ts_durable_upd);
-    to->txn_set_ts_force += WT_STAT_CONN_READ(from, txn_set_ts_force);
-    to->txn_set_ts_out_of_order += WT_STAT_CONN_READ(from, txn_set_ts_out_of_order);
-    to->txn_set_ts_oldest += WT_STAT_CONN_READ(from, txn_set_ts_oldest);
-    to->txn_set_ts_oldest_upd += WT_STAT_CONN_READ(from, txn_set_ts_oldest_upd);
-    to->txn_set_ts_stable += WT_STAT_CONN_READ(from, txn_set_ts_stable);
-    to->txn_set_ts_stable_upd += WT_STAT_CONN_READ(from, txn_set_ts_stable_upd);
-    to->txn_begin += WT_STAT_CONN_READ(from, txn_begin);
-    to->txn_hs_ckpt_duration += WT_STAT_CONN_READ(from, txn_hs_ckpt_duration);
-    to->txn_pinned_range += WT_STAT_CONN_READ(from, txn_pinned_range);
-    to->txn_pinned_checkpoint_range += WT_STAT_CONN_READ(from, txn_pinned_checkpoint_range);
-    to->txn_pinned_timestamp += WT_STAT_CONN_READ(from, txn_pinned_timestamp);
-    to->txn_pinned_timestamp_checkpoint += WT_STAT_CONN_READ(from, txn_pinned_timestamp_checkpoint);
-    to->txn_pinned_timestamp_reader += WT_STAT_CONN_READ(from, txn_pinned_timestamp_reader);
-    to->txn_pinned_timestamp_oldest += WT_STAT_CONN_READ(from, txn_pinned_timestamp_oldest);
-    to->txn_timestamp_oldest_active_read +=
-      WT_STAT_CONN_READ(from, txn_timestamp_oldest_active_read);
-    to->txn_rollback_to_stable_running += WT_STAT_CONN_READ(from, txn_rollback_to_stable_running);
-    to->txn_walk_sessions += WT_STAT_CONN_READ(from, txn_walk_sessions);
-    to->txn_commit += WT_STAT_CONN_READ(from, txn_commit);
-    to->txn_rollback += WT_STAT_CONN_READ(from, txn_rollback);
-    to->txn_update_conflict += WT_STAT_CONN_READ(from, txn_update_conflict);
+    __wt_stats_aggregate_all_conn(from, (int64_t *)to, sizeof(*to) / sizeof(int64_t));
 }
 
 static const char *const __stats_session_desc[] = {
@@ -194,6 +194,84 @@ done:
     return (active);
 }
 
+/*
+ * __txn_snapshot_cache_get --
+ *     Copy the published walk of the concurrent transactions into our snapshot, after any IDs
+ *     already there. Return false if it isn't valid for our snapshot generation and the caller has
+ *     to walk the sessions.
+ */
+static bool
+__txn_snapshot_cache_get(WT_SESSION_IMPL *session, uint64_t snapshot_gen, uint64_t oldest_id,
+  uint32_t *np, uint64_t *current_idp, uint64_t *pinned_idp)
+{
+    WT_TXN_GLOBAL *txn_global;
+    uint64_t current_id, pinned_id, seq;
+    uint32_t count;
+
+    txn_global = &S2C(session)->txn_global;
+
+    WT_ACQUIRE_READ_WITH_BARRIER(seq, txn_global->snapshot_cache_seq);
+    if (seq % 2 != 0 || __wt_atomic_load64(&txn_global->snapshot_cache_gen) != snapshot_gen)
+        return (false);
+
+    count = __wt_atomic_load32(&txn_global->snapshot_cache_count);
+    current_id = __wt_atomic_load64(&txn_global->snapshot_cache_max);
+    pinned_id = __wt_atomic_load64(&txn_global->snapshot_cache_pinned);
+
+    /*
+     * Rolling back doesn't start a new snapshot generation, the oldest ID may have moved past a
+     * transaction that was running when the walk was published.
+     */
+    if (WT_TXNID_LT(pinned_id, oldest_id))
+        return (false);
+
+    WT_ASSERT(session, *np + count <= S2C(session)->session_array.size);
+    memcpy(session->txn->snapshot_data.snapshot + *np, txn_global->snapshot_cache,
+      count * sizeof(uint64_t));
+
+    /* Check the walk wasn't republished while we were copying it. */
+    WT_ACQUIRE_BARRIER();
+    if (__wt_atomic_loadv64(&txn_global->snapshot_cache_seq) != seq)
+        return (false);
+
+    *np += count;
+    *current_idp = current_id;
+    *pinned_idp = pinned_id;
+    return (true);
+}
+
+/*
+ * __txn_snapshot_cache_put --
+ *     Publish the concurrent transaction IDs found walking the sessions for reuse by other
+ *     transactions in the same snapshot generation.
+ */
+static void
+__txn_snapshot_cache_put(WT_SESSION_IMPL *session, uint64_t snapshot_gen, const uint64_t *ids,
+  uint32_t count, uint64_t current_id, uint64_t pinned_id)
+{
+    WT_TXN_GLOBAL *txn_global;
+    uint64_t seq;
+
+    txn_global = &S2C(session)->txn_global;
+
+    /* Don't wait, another thread is publishing a walk. */
+    if (__wt_spin_trylock(session, &txn_global->snapshot_cache_lock) != 0)
+        return;
+
+    seq = __wt_atomic_loadv64(&txn_global->snapshot_cache_seq);
+    __wt_atomic_storev64(&txn_global->snapshot_cache_seq, seq + 1);
+    WT_FULL_BARRIER();
+
+    __wt_atomic_store64(&txn_global->snapshot_cache_gen, snapshot_gen);
+    __wt_atomic_store32(&txn_global->snapshot_cache_count, count);
+    __wt_atomic_store64(&txn_global->snapshot_cache_max, current_id);
+    __wt_atomic_store64(&txn_global->snapshot_cache_pinned, pinned_id);
+    memcpy(txn_global->snapshot_cache, ids, count * sizeof(uint64_t));
+
+    WT_RELEASE_WRITE_WITH_BARRIER(txn_global->snapshot_cache_seq, seq + 2);
+    __wt_spin_unlock(session, &txn_global->snapshot_cache_lock);
+}
+
 /*
  * __txn_get_snapshot_int --
  *     Allocate a snapshot, optionally update our shared txn ids.
@@ -206,7 +284,8 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
     WT_TXN_GLOBAL *txn_global;
     WT_TXN_SHARED *s, *txn_shared;
     uint64_t current_id, id, pinned_id, prev_oldest_id, snapshot_gen;
-    uint32_t i, n, session_cnt;
+    uint32_t i, n, n_walk, session_cnt;
+    bool cacheable;
 
     conn = S2C(session);
     txn = session->txn;
@@ -226,6 +305,7 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
         __wt_session_gen_leave(session, WT_GEN_HAS_SNAPSHOT);
     }
     __wt_session_gen_enter(session, WT_GEN_HAS_SNAPSHOT);
+    snapshot_gen = __wt_session_gen(session, WT_GEN_HAS_SNAPSHOT);
 
     /* We're going to scan the table: wait for the lock. */
     __wt_readlock(session, &txn_global->rwlock);
@@ -256,7 +336,20 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
         goto done;
     }
 
+    /*
+     * A transaction without an ID can share a walk of the concurrent transactions with other such
+     * transactions: it includes every running transaction ID, and stays valid until a transaction
+     * commits updates.
+     */
+    cacheable = update_shared_state && txn->id == WT_TXN_NONE;
+    if (cacheable &&
+      __txn_snapshot_cache_get(session, snapshot_gen, prev_oldest_id, &n, &current_id, &pinned_id)) {
+        WT_STAT_CONN_INCR(session, txn_snapshot_reused);
+        goto done;
+    }
+
     /* Walk the array of concurrent transactions. */
+    n_walk = n;
     WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
     WT_STAT_CONN_INCR(session, txn_walk_sessions);
     for (i = 0, s = txn_global->txn_shared_list; i < session_cnt; i++, s++) {
@@ -301,6 +394,10 @@ __txn_get_snapshot_int(WT_SESSION_IMPL *session, bool update_shared_state)
     }
     WT_STAT_CONN_INCRV(session, txn_sessions_walked, i);
 
+    if (cacheable)
+        __txn_snapshot_cache_put(session, snapshot_gen, txn->snapshot_data.snapshot + n_walk,
+          n - n_walk, current_id, pinned_id);
+
     /*
      * If we got a new snapshot, update the published pinned ID for this session.
      */
@@ -2529,8 +2626,10 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
 
     WT_RWLOCK_INIT_TRACKED(session, &txn_global->rwlock, txn_global);
     WT_RET(__wt_rwlock_init(session, &txn_global->visibility_rwlock));
+    WT_RET(__wt_spin_init(session, &txn_global->snapshot_cache_lock, "snapshot cache"));
 
     WT_RET(__wt_calloc_def(session, conn->session_array.size, &txn_global->txn_shared_list));
+    WT_RET(__wt_calloc_def(session, conn->session_array.size, &txn_global->snapshot_cache));
 
     for (i = 0, s = txn_global->txn_shared_list; i < conn->session_array.size; i++, s++) {
         __wt_atomic_storev64(&s->id, WT_TXN_NONE);
@@ -2559,7 +2658,9 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
 
     __wt_rwlock_destroy(session, &txn_global->rwlock);
     __wt_rwlock_destroy(session, &txn_global->visibility_rwlock);
+    __wt_spin_destroy(session, &txn_global->snapshot_cache_lock);
     __wt_free(session, txn_global->txn_shared_list);
+    __wt_free(session, txn_global->snapshot_cache);
 }
 
 /*
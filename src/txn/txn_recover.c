@@ -13,53 +13,29 @@
     WT_DECL_VERBOSE_MULTI_CATEGORY( \
       ((WT_VERBOSE_CATEGORY[]){WT_VERB_RECOVERY, WT_VERB_RECOVERY_PROGRESS}))
 
-/* State maintained during recovery. */
-typedef struct {
-    const char *uri; /* File URI. */
-    WT_CURSOR *c;    /* Cursor used for recovery. */
-    WT_LSN ckpt_lsn; /* File's checkpoint LSN. */
-} WT_RECOVERY_FILE;
-
+/*
+ * A log operation queued for a recovery thread, the operation itself follows it in the recovery
+ * thread's batch.
+ */
 typedef struct {
-    WT_SESSION_IMPL *session;
-
-    /* Files from the metadata, indexed by file ID. */
-    WT_RECOVERY_FILE *files;
-    size_t file_alloc; /* Allocated size of files array. */
-    u_int max_fileid;  /* Maximum file ID seen. */
-    u_int nfiles;      /* Number of files in the metadata. */
-
-    WT_LSN ckpt_lsn;     /* Start LSN for main recovery loop. */
-    WT_LSN max_ckpt_lsn; /* Maximum checkpoint LSN seen. */
-    WT_LSN max_rec_lsn;  /* Maximum recovery LSN seen. */
-
-    bool backup_only;   /* Set to only recover backup. */
-    bool missing;       /* Were there missing files? */
-    bool metadata_only; /*
-                         * Set during the first recovery pass,
-                         * when only the metadata is recovered.
-                         */
-} WT_RECOVERY;
+    WT_LSN lsn;    /* Operation's LSN */
+    uint32_t size; /* Operation's size */
+} WT_RECOVERY_OP;
 
 /*
- * __recovery_cursor --
- *     Get a cursor for a recovery operation.
+ * __recovery_op_check --
+ *     Check if an operation on a file is to be applied during recovery.
  */
-static int
-__recovery_cursor(
-  WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, u_int id, bool duplicate, WT_CURSOR **cp)
+static bool
+__recovery_op_check(WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, u_int id)
 {
-    WT_CURSOR *c;
-    const char *cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), "overwrite", NULL};
     bool metadata_op;
 
-    c = NULL;
-
     /*
      * File ids with the bit set to ignore this operation are skipped.
      */
     if (WT_LOGOP_IS_IGNORED(id))
-        return (0);
+        return (false);
     /*
      * Metadata operations have an id of 0. Match operations based on the id and the current pass of
      * recovery for metadata.
@@ -70,29 +46,49 @@ __recovery_cursor(
      */
     metadata_op = id == WT_METAFILE_ID;
     if (r->metadata_only != metadata_op)
-        ;
-    else if (id >= r->nfiles || r->files[id].uri == NULL) {
+        return (false);
+    if (id >= r->nfiles || r->files[id].uri == NULL) {
         /* If a file is missing, output a verbose message once. */
         if (!r->missing)
             __wt_verbose(
               session, WT_VERB_RECOVERY, "No file found with ID %u (max %u)", id, r->nfiles);
         r->missing = true;
-    } else if (__wt_log_cmp(lsnp, &r->files[id].ckpt_lsn) >= 0) {
-        /*
-         * We're going to apply the operation. Get the cursor, opening one if none is cached.
-         */
-        if ((c = r->files[id].c) == NULL) {
-            WT_RET(__wt_open_cursor(session, r->files[id].uri, NULL, cfg, &c));
-            r->files[id].c = c;
-        }
+        return (false);
+    }
+    if (__wt_log_cmp(lsnp, &r->files[id].ckpt_lsn) < 0)
+        return (false);
+
 #ifndef WT_STANDALONE_BUILD
-        /*
-         * In the event of a clean shutdown, there shouldn't be any other table log records other
-         * than metadata.
-         */
-        if (!metadata_op)
-            S2C(session)->unclean_shutdown = true;
+    /*
+     * In the event of a clean shutdown, there shouldn't be any other table log records other than
+     * metadata. Operations applied by recovery threads were checked when they were queued, don't
+     * write the flag again from those threads.
+     */
+    if (!metadata_op && !S2C(session)->unclean_shutdown)
+        S2C(session)->unclean_shutdown = true;
 #endif
+    return (true);
+}
+
+/*
+ * __recovery_cursor --
+ *     Get a cursor for a recovery operation.
+ */
+static int
+__recovery_cursor(
+  WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, u_int id, bool duplicate, WT_CURSOR **cp)
+{
+    WT_CURSOR *c;
+    const char *cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), "overwrite", NULL};
+
+    c = NULL;
+
+    /*
+     * If we're going to apply the operation, get the cursor, opening one if none is cached.
+     */
+    if (__recovery_op_check(session, r, lsnp, id) && (c = r->files[id].c) == NULL) {
+        WT_RET(__wt_open_cursor(session, r->files[id].uri, NULL, cfg, &c));
+        r->files[id].c = c;
     }
 
     if (duplicate && c != NULL)
@@ -231,22 +227,22 @@ __txn_system_apply(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8
 
 /*
  * __txn_op_apply --
- *     Apply a transactional operation during recovery.
+ *     Apply a transactional operation during recovery, in the recovery session or a recovery
+ *     thread's session.
  */
 static int
-__txn_op_apply(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+__txn_op_apply(WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp,
+  const uint8_t *end)
 {
     WT_CURSOR *cursor, *start, *stop;
     WT_DECL_RET;
     WT_ITEM key, start_key, stop_key, value;
-    WT_SESSION_IMPL *session;
     wt_timestamp_t commit, durable, first_commit, prepare, read;
     size_t max_memsize;
     uint64_t recno, start_recno, stop_recno, t_nsec, t_sec;
     uint32_t fileid, mode, opsize, optype;
     char lsn_str[WT_MAX_LSN_STRING];
 
-    session = r->session;
     cursor = NULL;
 
     if (__wt_lsn_string(lsnp, sizeof(lsn_str), lsn_str) != 0) {
@@ -463,6 +459,320 @@ err:
     return (ret);
 }
 
+/*
+ * __recovery_batch_apply --
+ *     Apply a batch of operations queued for a recovery thread.
+ */
+static int
+__recovery_batch_apply(WT_SESSION_IMPL *session, WT_RECOVERY *r, WT_ITEM *batch)
+{
+    WT_RECOVERY_OP op;
+    const uint8_t *end, *next, *p;
+
+    end = (const uint8_t *)batch->data + batch->size;
+    for (p = batch->data; p < end; p = next) {
+        memcpy(&op, p, sizeof(op));
+        p += sizeof(op);
+        next = p + op.size;
+        WT_RET(__txn_op_apply(session, r, &op.lsn, &p, next));
+    }
+    return (0);
+}
+
+/*
+ * __recovery_thread_chk --
+ *     Check to decide if a recovery thread should continue running.
+ */
+static bool
+__recovery_thread_chk(WT_SESSION_IMPL *session)
+{
+    return (__wt_atomic_loadbool(&S2C(session)->recovery->workers_run));
+}
+
+/*
+ * __recovery_thread_run --
+ *     Entry function for a recovery thread: apply the batches of operations queued for it. This is
+ *     called repeatedly from the thread group code so it does not need to loop itself.
+ */
+static int
+__recovery_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_DECL_RET;
+    WT_ITEM *batch;
+    WT_RECOVERY *r;
+    WT_RECOVERY_WORKER *worker;
+
+    r = S2C(session)->recovery;
+    worker = &r->workers[thread->id];
+
+    for (;;) {
+        __wt_spin_lock(session, &worker->lock);
+        if (worker->head == worker->tail) {
+            __wt_spin_unlock(session, &worker->lock);
+            break;
+        }
+        batch = &worker->queue[worker->head % WT_RECOVERY_QUEUE_SIZE];
+        __wt_spin_unlock(session, &worker->lock);
+
+        /*
+         * After an error, keep draining the queue so the log reader doesn't wait for space, the
+         * error is returned once the log reader has finished.
+         */
+        if (worker->ret == 0 && (ret = __recovery_batch_apply(session, r, batch)) != 0) {
+            __wt_spin_lock(session, &worker->lock);
+            worker->ret = ret;
+            __wt_spin_unlock(session, &worker->lock);
+        }
+        batch->size = 0;
+
+        __wt_spin_lock(session, &worker->lock);
+        ++worker->head;
+        __wt_spin_unlock(session, &worker->lock);
+        __wt_cond_signal(session, r->workers_cond);
+    }
+
+    __wt_cond_wait(session, r->thread_group.wait_cond, 10 * WT_THOUSAND, __recovery_thread_chk);
+    return (0);
+}
+
+/*
+ * __recovery_thread_stop --
+ *     Shutdown function for a recovery thread: close the cursors it opened, they belong to the
+ *     thread's session.
+ */
+static int
+__recovery_thread_stop(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CURSOR *c;
+    WT_DECL_RET;
+    WT_RECOVERY *r;
+    WT_RECOVERY_WORKER *worker;
+    u_int i;
+
+    r = S2C(session)->recovery;
+    worker = &r->workers[thread->id];
+
+    for (i = thread->id; i < r->nfiles; i += r->workers_num)
+        if ((c = r->files[i].c) != NULL) {
+            r->files[i].c = NULL;
+            WT_TRET(c->close(c));
+        }
+    if (worker->ret == 0)
+        worker->ret = ret;
+    return (0);
+}
+
+/*
+ * __recovery_threads_create --
+ *     Start the threads applying operations on files in the main recovery pass.
+ */
+static int
+__recovery_threads_create(WT_RECOVERY *r)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    uint32_t i;
+
+    session = r->session;
+    conn = S2C(session);
+
+    if (conn->log_mgr.recover_threads == 0)
+        return (0);
+
+    WT_RET(__wt_calloc_def(session, conn->log_mgr.recover_threads, &r->workers));
+    r->workers_num = conn->log_mgr.recover_threads;
+    for (i = 0; i < r->workers_num; ++i)
+        WT_ERR(__wt_spin_init(session, &r->workers[i].lock, "recovery thread queue"));
+    WT_ERR(__wt_cond_alloc(session, "recovery threads", &r->workers_cond));
+
+    /* Set first, the threads might run before we finish up. */
+    conn->recovery = r;
+    __wt_atomic_storebool(&r->workers_run, true);
+
+    WT_ERR(__wt_thread_group_create(session, &r->thread_group, "recovery-threads", r->workers_num,
+      r->workers_num, WT_THREAD_CAN_WAIT, __recovery_thread_chk, __recovery_thread_run,
+      __recovery_thread_stop));
+
+    __wt_verbose_multi(session, WT_VERB_RECOVERY_ALL,
+      "Main recovery loop: applying operations with %" PRIu32 " recovery threads", r->workers_num);
+    return (0);
+
+err:
+    conn->recovery = NULL;
+    __wt_atomic_storebool(&r->workers_run, false);
+    __wt_cond_destroy(session, &r->workers_cond);
+    for (i = 0; i < r->workers_num; ++i)
+        __wt_spin_destroy(session, &r->workers[i].lock);
+    __wt_free(session, r->workers);
+    r->workers_num = 0;
+    return (ret);
+}
+
+/*
+ * __recovery_worker_push --
+ *     Queue a recovery thread's pending batch of operations, waiting for space if the queue is
+ *     full.
+ */
+static int
+__recovery_worker_push(WT_RECOVERY *r, WT_RECOVERY_WORKER *worker)
+{
+    WT_DECL_RET;
+    WT_ITEM *slot, tmp;
+    WT_SESSION_IMPL *session;
+
+    session = r->session;
+
+    for (;;) {
+        __wt_spin_lock(session, &worker->lock);
+        if ((ret = worker->ret) != 0 || worker->tail - worker->head < WT_RECOVERY_QUEUE_SIZE)
+            break;
+        __wt_spin_unlock(session, &worker->lock);
+        __wt_cond_wait(session, r->workers_cond, 10 * WT_THOUSAND, NULL);
+    }
+    if (ret == 0) {
+        /* Swap the pending batch into the queue, reusing the slot's buffer for the next batch. */
+        slot = &worker->queue[worker->tail % WT_RECOVERY_QUEUE_SIZE];
+        tmp = *slot;
+        *slot = worker->pending;
+        worker->pending = tmp;
+        ++worker->tail;
+    }
+    __wt_spin_unlock(session, &worker->lock);
+
+    if (ret == 0)
+        __wt_cond_signal(session, r->thread_group.wait_cond);
+    return (ret);
+}
+
+/*
+ * __recovery_threads_destroy --
+ *     Wait for the recovery threads to apply all of the queued operations and shut them down.
+ */
+static int
+__recovery_threads_destroy(WT_RECOVERY *r)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    uint32_t i, j;
+    bool drained;
+
+    session = r->session;
+    conn = S2C(session);
+
+    if (r->workers_num == 0)
+        return (0);
+
+    /* Queue any partial batches and wait for the queues to drain. */
+    for (i = 0; i < r->workers_num; ++i) {
+        worker = &r->workers[i];
+        if (worker->pending.size != 0)
+            WT_TRET(__recovery_worker_push(r, worker));
+    }
+    for (;;) {
+        drained = true;
+        for (i = 0; i < r->workers_num; ++i) {
+            worker = &r->workers[i];
+            __wt_spin_lock(session, &worker->lock);
+            if (worker->head != worker->tail)
+                drained = false;
+            __wt_spin_unlock(session, &worker->lock);
+        }
+        if (drained)
+            break;
+        __wt_cond_wait(session, r->workers_cond, 10 * WT_THOUSAND, NULL);
+    }
+
+    /* Wait for any thread group changes to stabilize. */
+    __wt_writelock(session, &r->thread_group.lock);
+
+    /* Signal the threads to finish. */
+    __wt_atomic_storebool(&r->workers_run, false);
+    __wt_cond_signal(session, r->thread_group.wait_cond);
+
+    /* We call the destroy function still holding the write lock. It assumes it is called locked. */
+    WT_TRET(__wt_thread_group_destroy(session, &r->thread_group));
+
+    for (i = 0; i < r->workers_num; ++i) {
+        worker = &r->workers[i];
+        WT_TRET(worker->ret);
+        for (j = 0; j < WT_RECOVERY_QUEUE_SIZE; ++j)
+            __wt_buf_free(session, &worker->queue[j]);
+        __wt_buf_free(session, &worker->pending);
+        __wt_spin_destroy(session, &worker->lock);
+    }
+    __wt_cond_destroy(session, &r->workers_cond);
+    __wt_free(session, r->workers);
+    r->workers_num = 0;
+    conn->recovery = NULL;
+
+    return (ret);
+}
+
+/*
+ * __txn_op_queue --
+ *     Queue a transactional operation for the recovery thread applying operations on its file.
+ */
+static int
+__txn_op_queue(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+{
+    WT_ITEM *batch;
+    WT_RECOVERY_OP op;
+    WT_RECOVERY_WORKER *worker;
+    WT_SESSION_IMPL *session;
+    uint64_t fileid;
+    uint32_t opsize, optype;
+    const uint8_t *p;
+
+    session = r->session;
+
+    /*
+     * Operations on files start with the ID of the file they apply to, anything else is handled by
+     * this thread.
+     */
+    WT_RET(__wt_logop_read(session, pp, end, &optype, &opsize));
+    switch (optype) {
+    case WT_LOGOP_COL_MODIFY:
+    case WT_LOGOP_COL_PUT:
+    case WT_LOGOP_COL_REMOVE:
+    case WT_LOGOP_COL_TRUNCATE:
+    case WT_LOGOP_ROW_MODIFY:
+    case WT_LOGOP_ROW_PUT:
+    case WT_LOGOP_ROW_REMOVE:
+    case WT_LOGOP_ROW_TRUNCATE:
+        break;
+    default:
+        return (__txn_op_apply(session, r, lsnp, pp, end));
+    }
+    if (opsize > WT_PTRDIFF(end, *pp))
+        WT_RET_MSG(session, WT_ERROR,
+          "log record operation type %" PRIu32 " size %" PRIu32 " overflows the record", optype,
+          opsize);
+
+    p = *pp;
+    *pp += opsize;
+    WT_RET(__wt_logop_unpack(session, &p, *pp, &optype, &opsize));
+    WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(*pp, p), &fileid));
+    if (!__recovery_op_check(session, r, lsnp, (u_int)fileid))
+        return (0);
+
+    /* Each file's operations are applied in log order by a single recovery thread. */
+    worker = &r->workers[fileid % r->workers_num];
+    batch = &worker->pending;
+    WT_ASSIGN_LSN(&op.lsn, lsnp);
+    op.size = opsize;
+    WT_RET(__wt_buf_extend(session, batch, batch->size + sizeof(op) + opsize));
+    memcpy((uint8_t *)batch->mem + batch->size, &op, sizeof(op));
+    memcpy((uint8_t *)batch->mem + batch->size + sizeof(op), *pp - opsize, opsize);
+    batch->size += sizeof(op) + opsize;
+
+    if (batch->size >= WT_RECOVERY_BATCH_SIZE)
+        WT_RET(__recovery_worker_push(r, worker));
+    return (0);
+}
+
 /*
  * __txn_commit_apply --
  *     Apply a commit record during recovery.
@@ -472,7 +782,10 @@ __txn_commit_apply(WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8
 {
     /* The logging subsystem zero-pads records. */
     while (*pp < end && **pp)
-        WT_RET(__txn_op_apply(r, lsnp, pp, end));
+        if (r->workers_num != 0)
+            WT_RET(__txn_op_queue(r, lsnp, pp, end));
+        else
+            WT_RET(__txn_op_apply(r->session, r, lsnp, pp, end));
 
     return (0);
 }
@@ -1127,11 +1440,19 @@ __wt_txn_recover(WT_SESSION_IMPL *session, const char *cfg[])
      */
     if (needs_rec)
         F_SET(&conn->log_mgr, WT_LOG_RECOVER_DIRTY);
+
+    /*
+     * Start the threads applying operations on files, the log is read and decoded by this thread.
+     * Wait for the threads to finish applying operations whether or not the scan succeeded: errors
+     * applying operations are handled the same as errors applying them in this thread.
+     */
+    WT_ERR(__recovery_threads_create(&r));
     if (WT_IS_INIT_LSN(&r.ckpt_lsn))
         ret = __wt_log_scan(
           session, NULL, NULL, WT_LOGSCAN_FIRST | WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
     else
         ret = __wt_log_scan(session, &r.ckpt_lsn, NULL, WT_LOGSCAN_RECOVER, __txn_log_recover, &r);
+    WT_TRET(__recovery_threads_destroy(&r));
     if (F_ISSET(conn, WT_CONN_SALVAGE))
         ret = 0;
     WT_ERR(ret);
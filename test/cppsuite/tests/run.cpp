@@ -47,6 +47,7 @@
 #include "hs_cleanup.cpp"
 #include "operations_test.cpp"
 #include "reverse_split.cpp"
+#include "split_descent_benchmarks.cpp"
 #include "test_template.cpp"
 
 extern "C" {
@@ -166,6 +167,8 @@ run_test(const std::string &test_name, const std::string &config, const std::str
         operations_test(args).run();
     else if (test_name == "reverse_split")
         reverse_split(args).run();
+    else if (test_name == "split_descent_benchmarks")
+        split_descent_benchmarks(args).run();
     else if (test_name == "test_template")
         test_template(args).run();
     else {
@@ -195,7 +198,8 @@ main(int argc, char *argv[])
       "api_instruction_count_benchmarks", "background_compact", "bounded_cursor_perf",
       "bounded_cursor_prefix_indices", "bounded_cursor_prefix_search_near",
       "bounded_cursor_prefix_stat", "bounded_cursor_stress", "burst_inserts", "cache_resize",
-      "hs_cleanup", "operations_test", "reverse_split", "test_template"};
+      "hs_cleanup", "operations_test", "reverse_split", "split_descent_benchmarks",
+      "test_template"};
 
     /* Set the program name for error messages. */
     (void)testutil_set_progname(argv);
@@ -0,0 +1,105 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <atomic>
+#include <map>
+
+#include "src/common/logger.h"
+#include "src/common/random_generator.h"
+#include "src/storage/connection_manager.h"
+#include "src/util/execution_timer.h"
+#include "src/main/test.h"
+
+namespace test_harness {
+/*
+ * This test compares the two ways searches can detect they raced with a split while descending the
+ * tree. Insert threads continuously add keys, splitting pages, while a read thread times point
+ * searches of existing keys. A custom thread alternates the connection between validating the
+ * parent page's index and validating internal page split versions, and the search time under each
+ * is added to the perf file.
+ */
+class split_descent_benchmarks : public test {
+public:
+    split_descent_benchmarks(const test_args &args) : test(args)
+    {
+        init_operation_tracker();
+    }
+
+    void
+    custom_operation(thread_worker *tc) override final
+    {
+        logger::log_msg(
+          LOG_INFO, type_string(tc->type) + " thread {" + std::to_string(tc->id) + "} commencing.");
+
+        WT_CONNECTION *conn = connection_manager::instance().get_connection();
+        while (tc->running()) {
+            tc->sleep();
+            bool version = !_version_validation.load();
+            testutil_check(conn->reconfigure(conn,
+              version ? "heuristic_controls=(descent_validation=version)" :
+                        "heuristic_controls=(descent_validation=page_index)"));
+            _version_validation.store(version);
+        }
+    }
+
+    void
+    read_operation(thread_worker *tc) override final
+    {
+        /* This test will only work with one read thread. */
+        testutil_assert(tc->thread_count == 1);
+
+        execution_timer page_index_timer("search_page_index_validation", test::_args.test_name);
+        execution_timer version_timer("search_version_validation", test::_args.test_name);
+
+        /*
+         * Search keys across each collection's whole key range, including keys recently appended
+         * to the pages being split.
+         */
+        std::map<uint64_t, scoped_cursor> cursors;
+        while (tc->running()) {
+            collection &coll = tc->db.get_random_collection();
+            if (cursors.find(coll.id) == cursors.end())
+                cursors.emplace(coll.id, std::move(tc->session.open_scoped_cursor(coll.name)));
+            auto &cursor = cursors[coll.id];
+
+            uint64_t key_id =
+              random_generator::instance().generate_integer<uint64_t>(0, coll.get_key_count() - 1);
+            const std::string key = tc->pad_string(std::to_string(key_id), tc->key_size);
+            cursor->set_key(cursor.get(), key.c_str());
+            execution_timer &timer = _version_validation.load() ? version_timer : page_index_timer;
+            testutil_check(
+              timer.track([&cursor]() -> int { return cursor->search(cursor.get()); }));
+            testutil_check(cursor->reset(cursor.get()));
+            tc->sleep();
+        }
+    }
+
+private:
+    std::atomic<bool> _version_validation{false};
+};
+} // namespace test_harness
@@ -0,0 +1,217 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Test case description: Check WT_CURSOR::search_batch returns the same results as searching for
+ * each key in turn. The batches are unsorted, include duplicate keys and keys that don't exist,
+ * and are searched both with and without cursor bounds, on tables read back from disk so the
+ * batch search reads and pre-fetches pages.
+ */
+
+#define BATCH_SIZE 1000
+#define KEY_SIZE 32
+#define NRECORDS (50 * WT_THOUSAND)
+#define NBATCHES 20
+
+static WT_RAND_STATE rnd;
+
+/*
+ * set_key --
+ *     Set the raw format of a key in an item.
+ */
+static void
+set_key(WT_SESSION *session, bool recno, uint64_t keyno, char *buf, WT_ITEM *key)
+{
+    size_t size;
+
+    if (recno) {
+        testutil_check(wiredtiger_struct_size(session, &size, "q", keyno));
+        testutil_check(wiredtiger_struct_pack(session, buf, KEY_SIZE, "q", keyno));
+        key->size = size;
+    } else {
+        testutil_snprintf(buf, KEY_SIZE, "%010" PRIu64, keyno);
+        key->size = strlen(buf) + 1;
+    }
+    key->data = buf;
+}
+
+/*
+ * populate --
+ *     Create a table with every other key in it.
+ */
+static void
+populate(WT_SESSION *session, const char *uri, const char *config, bool recno, bool fix)
+{
+    WT_CURSOR *cursor;
+    WT_ITEM key, value;
+    uint64_t keyno;
+    uint8_t bitf;
+    char keybuf[KEY_SIZE], valuebuf[64];
+
+    testutil_check(session->create(session, uri, config));
+    testutil_check(session->open_cursor(session, uri, NULL, "raw", &cursor));
+    for (keyno = 2; keyno <= 2 * NRECORDS; keyno += 2) {
+        set_key(session, recno, keyno, keybuf, &key);
+        cursor->set_key(cursor, &key);
+        if (fix) {
+            bitf = (uint8_t)(keyno % 255 + 1);
+            value.data = &bitf;
+            value.size = 1;
+        } else {
+            testutil_snprintf(valuebuf, sizeof(valuebuf), "value %" PRIu64 " ------", keyno);
+            value.data = valuebuf;
+            value.size = strlen(valuebuf) + 1;
+        }
+        cursor->set_value(cursor, &value);
+        testutil_check(cursor->insert(cursor));
+    }
+    testutil_check(cursor->close(cursor));
+}
+
+/*
+ * check --
+ *     Compare batch searches against searching for each key with a second cursor.
+ */
+static void
+check(WT_SESSION *session, const char *uri, bool recno, bool bounded)
+{
+    WT_CURSOR *batch_cursor, *cursor;
+    WT_ITEM key, keys[BATCH_SIZE], value, values[BATCH_SIZE];
+    uint64_t keynos[BATCH_SIZE];
+    int ret, results[BATCH_SIZE];
+    u_int batch, i, j, k;
+    char keybuf[BATCH_SIZE][KEY_SIZE], boundbuf[KEY_SIZE];
+
+    testutil_check(session->open_cursor(session, uri, NULL, "raw", &batch_cursor));
+    testutil_check(session->open_cursor(session, uri, NULL, "raw", &cursor));
+
+    for (batch = 0; batch < NBATCHES; ++batch) {
+        /* Random keys, including keys past the end of the table. */
+        for (i = 0; i < BATCH_SIZE; ++i) {
+            keynos[i] = testutil_random(&rnd) % (2 * NRECORDS + 100) + 1;
+            set_key(session, recno, keynos[i], keybuf[i], &keys[i]);
+        }
+
+        /* Force some duplicates into the batch. */
+        for (i = 0; i < BATCH_SIZE / 10; ++i) {
+            j = testutil_random(&rnd) % BATCH_SIZE;
+            k = testutil_random(&rnd) % BATCH_SIZE;
+            keynos[j] = keynos[k];
+            keys[j] = keys[k];
+        }
+
+        if (bounded) {
+            set_key(session, recno, NRECORDS / 2, boundbuf, &key);
+            batch_cursor->set_key(batch_cursor, &key);
+            testutil_check(batch_cursor->bound(batch_cursor, "action=set,bound=lower"));
+            set_key(session, recno, NRECORDS, boundbuf, &key);
+            batch_cursor->set_key(batch_cursor, &key);
+            testutil_check(batch_cursor->bound(batch_cursor, "action=set,bound=upper"));
+        }
+
+        testutil_check(
+          batch_cursor->search_batch(batch_cursor, keys, values, results, BATCH_SIZE));
+
+        for (i = 0; i < BATCH_SIZE; ++i) {
+            cursor->set_key(cursor, &keys[i]);
+            ret = cursor->search(cursor);
+            testutil_assert(ret == 0 || ret == WT_NOTFOUND);
+
+            /* Keys outside the bounds aren't returned. */
+            if (bounded && (keynos[i] < NRECORDS / 2 || keynos[i] > NRECORDS))
+                ret = WT_NOTFOUND;
+
+            testutil_assert(results[i] == ret);
+            if (ret == 0) {
+                testutil_check(cursor->get_value(cursor, &value));
+                testutil_assert(values[i].size == value.size);
+                testutil_assert(memcmp(values[i].data, value.data, value.size) == 0);
+            }
+        }
+        testutil_check(batch_cursor->reset(batch_cursor));
+    }
+
+    testutil_check(batch_cursor->close(batch_cursor));
+    testutil_check(cursor->close(cursor));
+}
+
+/*
+ * run --
+ *     Populate a table, re-open the database to read it back from disk and check batch searches.
+ */
+static void
+run(TEST_OPTS *opts, const char *uri, const char *config, bool recno, bool fix)
+{
+    WT_SESSION *session;
+
+    testutil_recreate_dir(opts->home);
+    testutil_check(wiredtiger_open(opts->home, NULL,
+      "create,cache_size=200MB,prefetch=(available=true),statistics=(all)", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &session));
+    populate(session, uri, config, recno, fix);
+    testutil_check(opts->conn->close(opts->conn, NULL));
+
+    testutil_check(wiredtiger_open(opts->home, NULL,
+      "cache_size=200MB,prefetch=(available=true),statistics=(all)", &opts->conn));
+    testutil_check(opts->conn->open_session(opts->conn, NULL, "prefetch=(enabled=true)", &session));
+    check(session, uri, recno, false);
+    /* Fixed-length column-stores don't support cursor bounds. */
+    if (!fix)
+        check(session, uri, recno, true);
+    testutil_check(session->close(session, NULL));
+    testutil_check(opts->conn->close(opts->conn, NULL));
+    opts->conn = NULL;
+}
+
+/*
+ * main --
+ *     Test batch searches on row-store, variable-length and fixed-length column-store tables.
+ */
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_random_init(&rnd, &opts->data_seed, 1);
+
+    run(opts, "file:search_batch.SS", "key_format=S,value_format=S,leaf_page_max=8KB", false,
+      false);
+    run(opts, "table:search_batch.SS", "key_format=S,value_format=S,leaf_page_max=8KB", false,
+      false);
+    run(opts, "file:search_batch.rS", "key_format=r,value_format=S,leaf_page_max=8KB", true,
+      false);
+    run(opts, "file:search_batch.r8t", "key_format=r,value_format=8t,leaf_page_max=8KB", true,
+      true);
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
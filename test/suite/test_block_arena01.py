@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import queue, threading, wttest
+from wiredtiger import stat
+from wtthread import checkpoint_thread, op_thread
+from wtscenario import make_scenarios
+
+# test_block_arena01.py
+#   Test block allocation arenas: threads writing and freeing blocks through arenas while the file
+#   is checkpointed leave the file's extent lists consistent across checkpoints, compaction and
+#   restarts.
+class test_block_arena01(wttest.WiredTigerTestCase):
+    uri = 'table:test_block_arena01'
+    conn_config = 'cache_size=20MB,statistics=(all)'
+    nops = 20000
+    nthreads = 8
+
+    arena_values = [
+        ('single-arena', dict(arenas=1)),
+        ('arenas', dict(arenas=8)),
+    ]
+    scenarios = make_scenarios(arena_values)
+
+    def get_stat(self, statistic):
+        stat_cursor = self.session.open_cursor('statistics:' + self.uri)
+        val = stat_cursor[statistic][2]
+        stat_cursor.close()
+        return val
+
+    def populate(self, value):
+        done = threading.Event()
+        ckpt = checkpoint_thread(self.conn, done)
+        work_queue = queue.Queue()
+        opthreads = []
+        try:
+            ckpt.start()
+            for i in range(self.nops):
+                work_queue.put_nowait(('i', i + 1, value))
+            for i in range(self.nthreads):
+                t = op_thread(self.conn, [self.uri], 'i', work_queue, done)
+                opthreads.append(t)
+                t.start()
+        except:
+            # Deplete the work queue if there's an error.
+            while not work_queue.empty():
+                work_queue.get()
+                work_queue.task_done()
+            raise
+        finally:
+            work_queue.join()
+            done.set()
+            for t in opthreads:
+                t.join()
+            ckpt.join()
+
+    def check(self, value):
+        cursor = self.session.open_cursor(self.uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, value)
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nops)
+
+    def test_block_arena01(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,block_allocation_arenas={}'.format(self.arenas))
+
+        # Overwrite the values so blocks written by earlier checkpoints are freed.
+        for round in range(1, 4):
+            self.populate(str(round) * 500)
+        self.session.checkpoint()
+        self.check('3' * 500)
+        self.assertGreater(self.get_stat(stat.dsrc.block_arena_alloc), 0)
+        self.assertGreater(self.get_stat(stat.dsrc.block_arena_free), 0)
+        self.session.verify(self.uri)
+
+        # Compaction allocates first-fit, bypassing the arenas.
+        self.session.compact(self.uri)
+        self.check('3' * 500)
+
+        # Restart and check the data.
+        self.reopen_conn()
+        self.check('3' * 500)
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
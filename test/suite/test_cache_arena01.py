@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_cache_arena01.py
+#   Test the cache arena: the images of pages read into the cache are allocated from the arena,
+#   images the arena can't hold fall back to the system allocator, and the arena's memory is
+#   reused as pages are evicted.
+class test_cache_arena01(wttest.WiredTigerTestCase):
+    uri = 'table:test_cache_arena01'
+    nrows = 20000
+
+    arena_values = [
+        ('default', dict(arena='size=64MB', fallback=False)),
+        ('no-hugepages-no-numa', dict(arena='size=64MB,hugepages=false,numa=false',
+            fallback=False)),
+        # A single slab can't hold the table, reads fall back to the system allocator.
+        ('small', dict(arena='size=2MB,numa=false', fallback=True)),
+    ]
+    scenarios = make_scenarios(arena_values)
+
+    def conn_config(self):
+        return 'cache_size=100MB,statistics=(all),cache_arena=({})'.format(self.arena)
+
+    def get_stat(self, statistic):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[statistic][2]
+        stat_cursor.close()
+        return val
+
+    def value(self, i, round):
+        return ('%d-%d-' % (i, round)) + 'a' * (i % 500)
+
+    def check(self, round):
+        cursor = self.session.open_cursor(self.uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value(k, round))
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrows)
+
+    def evict(self):
+        evict_cursor = self.session.open_cursor(self.uri, None, 'debug=(release_evict)')
+        for i in range(1, self.nrows + 1, 50):
+            evict_cursor.set_key(i)
+            evict_cursor.search()
+            evict_cursor.reset()
+        evict_cursor.close()
+
+    def test_cache_arena01(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            cursor[i] = self.value(i, 1)
+        cursor.close()
+        self.session.checkpoint()
+
+        # Restart so the pages are read from disk into the arena.
+        self.reopen_conn()
+        self.check(1)
+        self.assertGreater(self.get_stat(stat.conn.cache_arena_alloc), 0)
+        self.assertGreater(self.get_stat(stat.conn.cache_arena_bytes_inuse), 0)
+        self.assertGreaterEqual(self.get_stat(stat.conn.cache_arena_bytes),
+            self.get_stat(stat.conn.cache_arena_bytes_inuse))
+        if self.fallback:
+            self.assertGreater(self.get_stat(stat.conn.cache_arena_alloc_fallback), 0)
+
+        # Update the pages, evict them and read them back: the arena's memory is reused.
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            cursor[i] = self.value(i, 2)
+        cursor.close()
+        self.session.checkpoint()
+        for round in range(3):
+            self.evict()
+            self.check(2)
+
+        self.reopen_conn()
+        self.check(2)
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
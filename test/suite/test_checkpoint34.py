@@ -0,0 +1,136 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wtscenario import make_scenarios
+
+# test_checkpoint34.py
+#
+# Test checkpoints with helper threads writing leaf pages of the trees ahead of the checkpoint:
+# the checkpoint must contain exactly the stable data of every tree, and older versions must still
+# be readable from the history store.
+class test_checkpoint34(wttest.WiredTigerTestCase):
+    ntables = 20
+    nrows = 2000
+
+    threads_values = [
+        ('threads-0', dict(threads=0)),
+        ('threads-1', dict(threads=1)),
+        ('threads-4', dict(threads=4)),
+    ]
+    scenarios = make_scenarios(threads_values)
+
+    def conn_config(self):
+        return 'cache_size=50MB,checkpoint=(threads={})'.format(self.threads)
+
+    def uri(self, i):
+        return 'table:test_checkpoint34_{}'.format(i)
+
+    def update(self, value, ts):
+        for i in range(self.ntables):
+            c = self.session.open_cursor(self.uri(i))
+            self.session.begin_transaction()
+            for k in range(1, self.nrows + 1):
+                c[k] = value + str(i)
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+            c.close()
+
+    def check(self, value, ts):
+        for i in range(self.ntables):
+            c = self.session.open_cursor(self.uri(i))
+            self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+            count = 0
+            for k, v in c:
+                self.assertEqual(v, value + str(i))
+                count += 1
+            self.session.rollback_transaction()
+            self.assertEqual(count, self.nrows)
+            c.close()
+
+    def test_checkpoint_threads(self):
+        for i in range(self.ntables):
+            self.session.create(self.uri(i), 'key_format=i,value_format=S,leaf_page_max=4KB')
+
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+        self.update('a' * 100, 10)
+        self.update('b' * 100, 20)
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(10))
+
+        # The second round of updates isn't stable, only the first may be in the checkpoint.
+        self.session.checkpoint()
+        self.check('a' * 100, 10)
+        self.check('b' * 100, 20)
+
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(20))
+        self.update('c' * 100, 30)
+        self.session.checkpoint()
+
+        # Changing the number of helper threads takes effect at the next checkpoint.
+        self.conn.reconfigure('checkpoint=(threads=2)')
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(30))
+        self.session.checkpoint()
+
+        # Reopen and check the data came back from the checkpoint, with its history.
+        self.reopen_conn()
+        self.check('a' * 100, 10)
+        self.check('b' * 100, 20)
+        self.check('c' * 100, 30)
+
+    # A single large tree: the checkpoint hands its dirty leaf pages to the helper threads, and
+    # must only write the internal pages once their children are written.
+    def test_checkpoint_threads_single_tree(self):
+        uri = 'table:test_checkpoint34_single'
+        nrows = 50000
+        self.session.create(uri, 'key_format=i,value_format=S,leaf_page_max=4KB')
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+
+        for ts, value in [(10, 'a' * 100), (20, 'b' * 100), (30, 'c' * 100)]:
+            c = self.session.open_cursor(uri)
+            self.session.begin_transaction()
+            for k in range(1, nrows + 1):
+                c[k] = value
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+            c.close()
+            self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(ts))
+            self.session.checkpoint()
+
+        self.reopen_conn()
+        for ts, value in [(10, 'a' * 100), (20, 'b' * 100), (30, 'c' * 100)]:
+            c = self.session.open_cursor(uri)
+            self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+            count = 0
+            for k, v in c:
+                self.assertEqual(v, value)
+                count += 1
+            self.session.rollback_transaction()
+            self.assertEqual(count, nrows)
+            c.close()
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, sys
+import wiredtiger, wttest
+
+from test_chunkcache01 import get_stat, stat_assert_equal, stat_assert_greater
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+
+'''
+Functional testing for the startup warm-up of a persistent chunk cache. Verifies that the chunks
+created from metadata are read back in by the warm-up threads, or on first access when the warm-up
+is disabled, and that lookups return the right data either way.
+'''
+class test_chunkcache07(wttest.WiredTigerTestCase):
+    rows = 10000
+    uri = "table:chunkcache07"
+
+    warmup_values = [
+        ('no-warmup', dict(warmup_threads=0)),
+        ('one-thread', dict(warmup_threads=1)),
+        ('many-threads', dict(warmup_threads=8)),
+    ]
+
+    scenarios = make_scenarios(warmup_values)
+
+    def conn_config(self):
+        if sys.byteorder != 'little':
+            return ''
+
+        if not os.path.exists('bucket7'):
+            os.mkdir('bucket7')
+
+        return 'statistics=(all),' \
+            'tiered_storage=(auth_token=Secret,bucket=bucket7,bucket_prefix=pfx_,name=dir_store),' \
+            'chunk_cache=[enabled=true,chunk_size=512KB,capacity=10MB,type=FILE,' \
+            'storage_path=WiredTigerChunkCache,warmup_threads={}]'.format(self.warmup_threads)
+
+    def conn_extensions(self, extlist):
+        if os.name == 'nt':
+            extlist.skip_if_missing = True
+        extlist.extension('storage_sources', 'dir_store')
+
+    def test_chunkcache07(self):
+        # This test only makes sense on-disk, and WT's filesystem layer doesn't support mmap on
+        # big-endian platforms.
+        if sys.byteorder != 'little':
+            return
+
+        ds = SimpleDataSet(self, self.uri, self.rows, key_format='S', value_format='S')
+        ds.populate()
+
+        # Flush the table into the chunk cache and make sure the metadata is written out.
+        self.session.checkpoint()
+        self.session.checkpoint('flush_tier=(enabled)')
+        stat_assert_greater(self.session, wiredtiger.stat.conn.chunkcache_metadata_inserted, 0)
+
+        self.close_conn()
+        self.reopen_conn()
+        stat_assert_greater(self.session, wiredtiger.stat.conn.chunkcache_created_from_metadata, 0)
+
+        if self.warmup_threads == 0:
+            stat_assert_equal(self.session, wiredtiger.stat.conn.chunkcache_chunks_warmed_up, 0)
+        else:
+            # Wait for the warm-up to read back all of the chunks created from metadata.
+            created = get_stat(self.session, wiredtiger.stat.conn.chunkcache_created_from_metadata)
+            stat_assert_equal(self.session, wiredtiger.stat.conn.chunkcache_chunks_warmed_up,
+                created)
+            self.assertEqual(
+                get_stat(self.session, wiredtiger.stat.conn.chunkcache_bytes_warmed_up),
+                get_stat(self.session, wiredtiger.stat.conn.chunkcache_bytes_read_persistent))
+
+        # Check that our data is all intact.
+        ds.check()
+        self.assertGreater(get_stat(self.session, wiredtiger.stat.conn.chunkcache_lookups), 0)
+
+        # Reopen while the warm-up may still be running.
+        self.reopen_conn()
+        ds.check()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import glob
+import wttest
+
+# test_compress03.py
+#   Test zstd dictionary compression: a dictionary is trained for the file from samples of its
+#   pages, pages written after training are compressed with it, and the pages remain readable
+#   after a restart, including when dictionary training is no longer configured.
+#
+class test_compress03(wttest.WiredTigerTestCase):
+    uri = 'table:test_compress03'
+    nrows = 20000
+    zstd_config = 'dictionary_size=16KB,dictionary_samples=50'
+
+    def conn_config(self):
+        return 'builtin_extension_config={zstd={' + self.zstd_config + '}},cache_size=50MB'
+
+    # Load the compression extension, skip the test if missing
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', 'zstd', '(config="' + self.zstd_config + '")')
+
+    def value(self, i, round):
+        return '{"_id": %d, "round": %d, "name": "customer-%d", "status": "active", ' \
+            '"address": {"city": "city-%d", "country": "country"}}' % (i, round, i, i % 100)
+
+    def update(self, round):
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            self.session.begin_transaction()
+            cursor[i] = self.value(i, round)
+            self.session.commit_transaction()
+        cursor.close()
+
+    def check(self, round):
+        cursor = self.session.open_cursor(self.uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value(k, round))
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrows)
+
+    @wttest.zstdtest('Skip zstd on pcc and zseries machines')
+    def test_compress03(self):
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,block_compressor=zstd,leaf_page_max=8KB')
+
+        # Write enough pages to train a dictionary, then write the pages again using it.
+        self.update(1)
+        self.session.checkpoint()
+        self.update(2)
+        self.session.checkpoint()
+        self.assertGreater(len(glob.glob('test_compress03.wt.*.zdict')), 0)
+        self.assertEqual(len(glob.glob('test_compress03.wt.zdict')), 1)
+
+        # Restart and check the data, with and without dictionary training configured.
+        self.reopen_conn()
+        self.check(2)
+        self.update(3)
+        self.session.checkpoint()
+
+        self.zstd_config = 'dictionary_size=0'
+        self.reopen_conn()
+        self.check(3)
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
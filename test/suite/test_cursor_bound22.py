@@ -0,0 +1,159 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_cursor_bound22.py
+#   Test value bounds: cursor next and prev only return records whose values are within the value
+#   bounds, and skip pages whose zone maps show they hold no value within the bounds.
+class test_cursor_bound22(wttest.WiredTigerTestCase):
+    uri = 'file:test_cursor_bound22'
+    nrows = 10000
+
+    zone_maps = [
+        ('zone-maps', dict(zone_maps=True)),
+        ('no-zone-maps', dict(zone_maps=False)),
+    ]
+    scenarios = make_scenarios(zone_maps)
+
+    def value(self, i):
+        return 'value-%06d' % i
+
+    def get_stat(self, statistic):
+        stat_cursor = self.session.open_cursor('statistics:' + self.uri)
+        val = stat_cursor[statistic][2]
+        stat_cursor.close()
+        return val
+
+    def set_value_bound(self, cursor, value, bound, inclusive=True):
+        cursor.set_value(value)
+        return cursor.bound('bound={},inclusive={},value=true'.format(
+            bound, 'true' if inclusive else 'false'))
+
+    def scan(self, cursor, next):
+        keys = []
+        while (cursor.next() if next else cursor.prev()) == 0:
+            self.assertEqual(cursor.get_value(), self.value(cursor.get_key()))
+            keys.append(cursor.get_key())
+        return keys if next else keys[::-1]
+
+    def check(self, cursor, lower, upper, lower_inclusive=True, upper_inclusive=True):
+        expected = [i for i in range(1, self.nrows + 1)
+            if (lower is None or i > lower or (i == lower and lower_inclusive)) and
+                (upper is None or i < upper or (i == upper and upper_inclusive))]
+        for next in (True, False):
+            if lower is not None:
+                self.set_value_bound(cursor, self.value(lower), 'lower', lower_inclusive)
+            if upper is not None:
+                self.set_value_bound(cursor, self.value(upper), 'upper', upper_inclusive)
+            self.assertEqual(self.scan(cursor, next), expected)
+            cursor.reset()
+
+    def test_cursor_bound22(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S,leaf_page_max=4KB,' +
+            'value_zone_maps={}'.format('true' if self.zone_maps else 'false'))
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            cursor[i] = self.value(i)
+        cursor.close()
+
+        # Write the leaf pages, then evict them so the scans walk pages on disk.
+        self.session.checkpoint()
+        evict_cursor = self.session.open_cursor(self.uri, None, 'debug=(release_evict)')
+        for i in range(1, self.nrows + 1, 50):
+            evict_cursor.set_key(i)
+            self.assertEqual(evict_cursor.search(), 0)
+            evict_cursor.reset()
+        evict_cursor.close()
+
+        cursor = self.session.open_cursor(self.uri)
+        self.check(cursor, 5000, 5099)
+        self.check(cursor, 5000, 5099, False, False)
+        self.check(cursor, 9990, None)
+        self.check(cursor, None, 10)
+        self.check(cursor, 7777, 7777)
+
+        # Pages are only skipped with zone maps.
+        skipped = self.get_stat(stat.dsrc.cursor_tree_walk_zone_page_skip)
+        if self.zone_maps:
+            self.assertGreater(skipped, 0)
+        else:
+            self.assertEqual(skipped, 0)
+
+        # Key and value bounds combine.
+        cursor.set_key(5050)
+        cursor.bound('bound=lower')
+        self.set_value_bound(cursor, self.value(5000), 'lower')
+        self.set_value_bound(cursor, self.value(5099), 'upper')
+        self.assertEqual(self.scan(cursor, True), list(range(5050, 5100)))
+        cursor.reset()
+
+        # A page updated after its zone map was recorded isn't skipped.
+        cursor[10] = self.value(5050)
+        self.set_value_bound(cursor, self.value(5050), 'lower')
+        self.set_value_bound(cursor, self.value(5050), 'upper')
+        self.assertEqual(cursor.next(), 0)
+        self.assertEqual(cursor.get_key(), 10)
+        self.assertEqual(cursor.next(), 0)
+        self.assertEqual(cursor.get_key(), 5050)
+        self.assertEqual(cursor.next(), wiredtiger.WT_NOTFOUND)
+
+        # Resetting the cursor clears the value bounds, as does clearing the bounds.
+        cursor.reset()
+        self.assertEqual(len(self.scan(cursor, True)), self.nrows)
+        self.set_value_bound(cursor, self.value(5050), 'lower')
+        self.assertEqual(cursor.bound('action=clear'), 0)
+        self.assertEqual(len(self.scan(cursor, True)), self.nrows)
+        cursor.reset()
+
+        # Value bounds can't overlap, and need a value.
+        self.set_value_bound(cursor, self.value(5050), 'lower')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.set_value_bound(cursor, self.value(5000), 'upper'),
+            '/The provided cursor bounds are overlapping/')
+        cursor.reset()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: cursor.bound('bound=lower,value=true'), '/requires value be set/')
+        cursor.close()
+
+        # Value bounds aren't supported by the cursors of tables with column groups.
+        table_uri = 'table:test_cursor_bound22'
+        self.session.create(table_uri,
+            'key_format=i,value_format=SS,columns=(k,v1,v2),colgroups=(g1,g2)')
+        self.session.create('colgroup:test_cursor_bound22:g1', 'columns=(v1)')
+        self.session.create('colgroup:test_cursor_bound22:g2', 'columns=(v2)')
+        cursor = self.session.open_cursor(table_uri)
+        cursor.set_value('a', 'b')
+        self.assertRaisesException(wiredtiger.WiredTigerError,
+            lambda: cursor.bound('bound=lower,value=true'))
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_direct_io01.py
+#   Test direct I/O: data files written and read bypassing the system buffer cache survive
+#   checkpoints, eviction and restarts, and configurations direct I/O can't support are rejected.
+@wttest.skip_for_hook("tiered", "direct I/O is only configured for local data files")
+class test_direct_io01(wttest.WiredTigerTestCase):
+    nrows = 20000
+    uri = 'table:test_direct_io01'
+
+    alignment_values = [
+        ('default-alignment', dict(alignment='')),
+        ('8KB-alignment', dict(alignment=',buffer_alignment=8KB')),
+    ]
+    scenarios = make_scenarios(alignment_values)
+
+    def conn_config(self):
+        # Aligned buffers require posix_memalign, which Windows doesn't have.
+        if os.name == 'nt':
+            return 'cache_size=20MB'
+        return 'cache_size=20MB,statistics=(all),direct_io=[data]' + self.alignment
+
+    def skip_unsupported(self):
+        if os.name == 'nt':
+            self.skipTest('direct I/O is not supported on Windows')
+
+    def value(self, i, round):
+        return ('%d-%d-' % (i, round)) + 'a' * (i % 2000)
+
+    def check(self, round):
+        cursor = self.session.open_cursor(self.uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value(k, round))
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrows)
+
+    def test_direct_io01(self):
+        self.skip_unsupported()
+
+        self.session.create(self.uri, 'key_format=i,value_format=S,allocation_size=8KB')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            cursor[i] = self.value(i, 1)
+        cursor.close()
+        self.session.checkpoint()
+
+        # Evict the pages, read them back and update them.
+        evict_cursor = self.session.open_cursor(self.uri, None, 'debug=(release_evict)')
+        for i in range(1, self.nrows + 1, 100):
+            evict_cursor.set_key(i)
+            evict_cursor.search()
+            evict_cursor.reset()
+        evict_cursor.close()
+        self.check(1)
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            cursor[i] = self.value(i, 2)
+        cursor.close()
+        self.session.checkpoint()
+
+        # Data files aren't mapped, checkpoint cursors read through the file handle.
+        cursor = self.session.open_cursor(self.uri, None, 'checkpoint=WiredTigerCheckpoint')
+        self.assertEqual(cursor[self.nrows], self.value(self.nrows, 2))
+        cursor.close()
+
+        # Restart and check the data.
+        self.reopen_conn()
+        self.check(2)
+        self.session.verify(self.uri)
+
+    def test_direct_io01_allocation_size(self):
+        # Files whose allocation size isn't a multiple of the buffer alignment can't use direct I/O.
+        self.skip_unsupported()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create('table:small', 'allocation_size=512'),
+            '/not a multiple of the buffer alignment/')
+
+    def test_direct_io01_alignment(self):
+        self.skip_unsupported()
+        self.close_conn()
+        os.mkdir('badalign')
+        config = 'create,direct_io=[data],buffer_alignment=3KB'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open('badalign', config), '/is not a power of two/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_eviction04.py
+# Check eviction with the eviction queues split into one or more shards: fill a small cache from
+# several tables, so their trees belong to different shards, and check every table reads back.
+class test_eviction04(wttest.WiredTigerTestCase):
+    threads = [
+        ('one_shard', dict(threads_max=1)),
+        ('two_shards', dict(threads_max=8)),
+        ('five_shards', dict(threads_max=20)),
+    ]
+    scenarios = make_scenarios(threads)
+
+    nrows = 10000
+    ntables = 7
+    value = 'v' * 500
+
+    def conn_config(self):
+        return 'cache_size=10MB,statistics=(all),eviction=(threads_max={})'.format(self.threads_max)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_eviction(self):
+        uris = ['table:test_eviction04_{}'.format(i) for i in range(self.ntables)]
+        for uri in uris:
+            self.session.create(uri, 'key_format=i,value_format=S')
+
+        # Interleave the inserts so every tree is competing for the cache.
+        cursors = [self.session.open_cursor(uri) for uri in uris]
+        for i in range(1, self.nrows + 1):
+            for cursor in cursors:
+                cursor[i] = self.value + str(i)
+        for cursor in cursors:
+            cursor.close()
+
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_clean) +
+            self.get_stat(stat.conn.cache_eviction_dirty), 0)
+
+        for uri in uris:
+            cursor = self.session.open_cursor(uri)
+            count = 0
+            for key, value in cursor:
+                count += 1
+                self.assertEqual(value, self.value + str(key))
+            self.assertEqual(count, self.nrows)
+            cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import threading
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_log05.py
+#    Test group commit of synchronous transactions.
+class test_log05(wttest.WiredTigerTestCase):
+    uri = 'table:test_log05'
+    nthreads = 8
+    ncommits = 200
+
+    sync_method = [
+        ('dsync', dict(method='dsync')),
+        ('fsync', dict(method='fsync')),
+    ]
+    scenarios = make_scenarios(sync_method)
+
+    def conn_config(self):
+        return 'log=(enabled,group_commit=(enabled=false,max_wait=500)),statistics=(all),' + \
+            'transaction_sync=(enabled,method={})'.format(self.method)
+
+    def get_stat(self, s):
+        cursor = self.session.open_cursor('statistics:')
+        value = cursor[s][2]
+        cursor.close()
+        return value
+
+    def commit_thread(self, tid):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri)
+        for i in range(self.ncommits):
+            session.begin_transaction()
+            cursor['{}.{}'.format(tid, i)] = 'value {}'.format(i)
+            session.commit_transaction()
+        cursor.close()
+        session.close()
+
+    def run_commits(self):
+        threads = [threading.Thread(target=self.commit_thread, args=(t,))
+            for t in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri)
+        for t in range(self.nthreads):
+            for i in range(self.ncommits):
+                self.assertEqual(cursor['{}.{}'.format(t, i)], 'value {}'.format(i))
+        cursor.close()
+
+    def test_group_commit(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+
+        # Group commit is disabled, no groups are formed.
+        self.run_commits()
+        self.assertEqual(self.get_stat(stat.conn.log_group_commit), 0)
+
+        # Enable group commit: every synchronous commit either leads a group or joins one.
+        self.conn.reconfigure('log=(group_commit=(enabled=true,max_wait=500))')
+        self.run_commits()
+        groups = self.get_stat(stat.conn.log_group_commit)
+        joined = self.get_stat(stat.conn.log_group_commit_joined)
+        self.assertGreater(groups, 0)
+        self.assertGreaterEqual(joined, groups)
+        self.assertLessEqual(self.get_stat(stat.conn.log_group_commit_window), 500)
+
+        # Disable it again, the group count doesn't move.
+        self.conn.reconfigure('log=(group_commit=(enabled=false))')
+        self.run_commits()
+        self.assertEqual(self.get_stat(stat.conn.log_group_commit), groups)
+
+        self.check()
+
+        # The records are all recovered.
+        self.reopen_conn()
+        self.check()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_page_arena01.py
+#   Test page arenas: keys inserted into pages allocated from the pages' arenas survive updates,
+#   removes, in-memory splits, eviction and restarts.
+class test_page_arena01(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=50MB,statistics=(all)'
+    nrows = 50000
+
+    key_format_values = [
+        ('column', dict(key_format='r')),
+        ('row', dict(key_format='S')),
+    ]
+    scenarios = make_scenarios(key_format_values)
+
+    def key(self, i):
+        return i if self.key_format == 'r' else 'key-%08d' % i
+
+    def value(self, i, round):
+        return ('value-%d-%d-' % (i, round)) + 'a' * (i % 300)
+
+    def get_stat(self, statistic, uri):
+        stat_cursor = self.session.open_cursor('statistics:' + uri)
+        val = stat_cursor[statistic][2]
+        stat_cursor.close()
+        return val
+
+    def check(self, uri, round):
+        cursor = self.session.open_cursor(uri)
+        count = 0
+        for k, v in cursor:
+            i = k if self.key_format == 'r' else int(k[4:])
+            if i % 7 == 0:
+                self.fail('removed key {} found'.format(k))
+            self.assertEqual(v, self.value(i, round if i % 3 == 0 else 1))
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrows - self.nrows // 7)
+
+    def test_page_arena01(self):
+        uri = 'table:test_page_arena01'
+        self.session.create(uri, 'key_format={},value_format=S,page_arena=true,'
+            'memory_page_max=1MB,leaf_page_max=16KB'.format(self.key_format))
+
+        # Insert enough keys to split pages in memory, then update and remove some of them.
+        cursor = self.session.open_cursor(uri)
+        for i in range(1, self.nrows + 1):
+            cursor[self.key(i)] = self.value(i, 1)
+        for i in range(3, self.nrows + 1, 3):
+            cursor[self.key(i)] = self.value(i, 2)
+        for i in range(7, self.nrows + 1, 7):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.remove(), 0)
+        cursor.close()
+        self.assertGreater(self.get_stat(stat.dsrc.cache_page_arena_chunk, uri), 0)
+        self.check(uri, 2)
+
+        # Write and evict the pages, and check the data read back.
+        self.session.checkpoint()
+        evict_cursor = self.session.open_cursor(uri, None, 'debug=(release_evict)')
+        for i in range(1, self.nrows + 1, 100):
+            evict_cursor.set_key(self.key(i))
+            evict_cursor.search()
+            evict_cursor.reset()
+        evict_cursor.close()
+        self.check(uri, 2)
+
+        # Update the pages read back, and check the data after a restart.
+        cursor = self.session.open_cursor(uri)
+        for i in range(3, self.nrows + 1, 3):
+            cursor[self.key(i)] = self.value(i, 3)
+        cursor.close()
+        self.reopen_conn()
+        self.check(uri, 3)
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
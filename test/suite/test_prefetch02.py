@@ -55,6 +55,8 @@ class test_prefetch02(wttest.WiredTigerTestCase, suite_subprocess):
                             session_cfg='prefetch=(enabled=true)', prefetch=True)),
         ('config_c', dict(conn_cfg='prefetch=(available=false,default=false),statistics=(all)',
                             session_cfg='', prefetch=False)),
+        ('config_d', dict(conn_cfg='prefetch=(async_read_depth=16,available=true,default=true),statistics=(all)',
+                            session_cfg='', prefetch=True)),
     ]
 
     prefetch_scenarios = [
@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_schema09.py
+#    Test projection cursors on tables with column groups: reads only move the column groups the
+#    projection references, and writes through a projection cursor keep the other column groups
+#    and the table's indices consistent.
+class test_schema09(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    tablename = 'test_schema09'
+    uri = 'table:' + tablename
+    nentries = 1000
+
+    key_format_values = [
+        ('column', dict(key_format='r')),
+        ('row', dict(key_format='i')),
+    ]
+    scenarios = make_scenarios(key_format_values)
+
+    def expect(self, i):
+        return [i * 2, 'value-%d' % i, i % 37]
+
+    def key(self, i):
+        # Record numbers start at 1.
+        return i + 1 if self.key_format == 'r' else i
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=' + self.key_format +
+            ',value_format=iSi,columns=(k,v0,v1,v2),colgroups=(c0,c1,c2)')
+        for i in range(0, 3):
+            self.session.create('colgroup:%s:c%d' % (self.tablename, i), 'columns=(v%d)' % i)
+        self.session.create('index:%s:v2' % self.tablename, 'columns=(v2)')
+
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(0, self.nentries):
+            cursor[self.key(i)] = self.expect(i)
+        cursor.close()
+
+    def cursor_stat(self, colgroup, field):
+        statcursor = self.session.open_cursor(
+            'statistics:file:%s_c%d.wt' % (self.tablename, colgroup))
+        value = statcursor[field][2]
+        statcursor.close()
+        return value
+
+    def check(self, removed):
+        cursor = self.session.open_cursor(self.uri)
+        count = 0
+        for i in range(0, self.nentries):
+            if i in removed:
+                continue
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), self.expect(i))
+            count += 1
+        cursor.close()
+
+        # The index must match the column groups.
+        icursor = self.session.open_cursor('index:%s:v2(k,v0,v1)' % self.tablename)
+        icount = 0
+        for v2, k, v0, v1 in icursor:
+            i = k - 1 if self.key_format == 'r' else k
+            self.assertEqual([v0, v1, v2], self.expect(i))
+            icount += 1
+        icursor.close()
+        self.assertEqual(icount, count)
+
+    def test_projection_read(self):
+        self.populate()
+
+        # Scan a single column: the column groups the projection doesn't reference aren't read.
+        next_calls = self.cursor_stat(2, stat.dsrc.cursor_next)
+        cursor = self.session.open_cursor(self.uri + '(v1)')
+        i = 0
+        for k, v1 in cursor:
+            self.assertEqual(k, self.key(i))
+            self.assertEqual(v1, self.expect(i)[1])
+            i += 1
+        self.assertEqual(i, self.nentries)
+        self.assertEqual(self.cursor_stat(2, stat.dsrc.cursor_next), next_calls)
+
+        # Search, search-near and prev return the projected columns.
+        cursor.set_key(self.key(17))
+        self.assertEqual(cursor.search(), 0)
+        self.assertEqual(cursor.get_value(), self.expect(17)[1])
+        self.assertEqual(cursor.prev(), 0)
+        self.assertEqual(cursor.get_value(), self.expect(16)[1])
+        cursor.set_key(self.key(23))
+        self.assertEqual(cursor.search_near(), 0)
+        self.assertEqual(cursor.get_value(), self.expect(23)[1])
+        cursor.close()
+
+        # Projections in a different column order, and of a column group other than the first.
+        cursor = self.session.open_cursor(self.uri + '(v2,v0)')
+        cursor.set_key(self.key(42))
+        self.assertEqual(cursor.search(), 0)
+        self.assertEqual(cursor.get_value(), [self.expect(42)[2], self.expect(42)[0]])
+        cursor.close()
+
+        # Search-near positions every column group of a full cursor.
+        cursor = self.session.open_cursor(self.uri)
+        cursor.set_key(self.key(99))
+        self.assertEqual(cursor.search_near(), 0)
+        self.assertEqual(cursor.get_value(), self.expect(99))
+        cursor.close()
+
+    def test_projection_write(self):
+        self.populate()
+
+        # Update and remove records through a projection cursor positioned by reads.
+        cursor = self.session.open_cursor(self.uri + '(v1)')
+        removed = []
+        i = 0
+        while cursor.next() == 0:
+            if i % 10 == 0:
+                cursor.set_value('updated-%d' % i)
+                self.assertEqual(cursor.update(), 0)
+            elif i % 10 == 1:
+                self.assertEqual(cursor.remove(), 0)
+                removed.append(i)
+            i += 1
+        cursor.close()
+        self.assertEqual(i, self.nentries)
+
+        expect = self.expect
+        def updated(i):
+            value = expect(i)
+            if i % 10 == 0:
+                value[1] = 'updated-%d' % i
+            return value
+        self.expect = updated
+        self.check(removed)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_search_ahi01.py
+#   Searches resolved through the adaptive hash index must return the same results as searches
+#   descending the tree, as keys are updated and removed, and as pages split and are evicted.
+class test_search_ahi01(wttest.WiredTigerTestCase):
+    uri = 'file:test_search_ahi01'
+    conn_config = 'statistics=(all)'
+    nentries = 10000
+    hot = range(0, 10000, 97)
+
+    def key(self, i):
+        return 'key%08d' % (i * 2)
+
+    def get_stat(self, statistic):
+        stat_cursor = self.session.open_cursor('statistics:' + self.uri)
+        val = stat_cursor[statistic][2]
+        stat_cursor.close()
+        return val
+
+    # Search the hot keys often enough for them to be installed in the index.
+    def check(self, value, removed=-1):
+        cursor = self.session.open_cursor(self.uri)
+        for n in range(6):
+            for i in self.hot:
+                cursor.set_key(self.key(i))
+                if i == removed:
+                    self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+                else:
+                    self.assertEqual(cursor.search(), 0)
+                    self.assertEqual(cursor.get_value(), value(i))
+                cursor.reset()
+        cursor.close()
+
+    # Evict the pages holding the hot keys, in a separate session so the cached cursor doesn't
+    # keep evicting them.
+    def evict(self):
+        session = self.conn.open_session()
+        evict_cursor = session.open_cursor(self.uri, None, 'debug=(release_evict)')
+        for i in self.hot:
+            evict_cursor.set_key(self.key(i))
+            evict_cursor.search()
+            evict_cursor.reset()
+        evict_cursor.close()
+        session.close()
+
+    def test_search_ahi01(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,leaf_page_max=4KB,' +
+            'adaptive_hash_index=1024')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nentries):
+            cursor[self.key(i)] = 'a' + str(i)
+        cursor.close()
+        self.session.checkpoint()
+        self.evict()
+
+        self.check(lambda i: 'a' + str(i))
+        hits = self.get_stat(stat.dsrc.cursor_search_ahi_hit)
+        self.assertGreater(hits, 0)
+
+        # Updates and removes of keys found through the index.
+        cursor = self.session.open_cursor(self.uri)
+        for i in self.hot:
+            cursor[self.key(i)] = 'b' + str(i)
+        cursor.set_key(self.key(self.hot[1]))
+        self.assertEqual(cursor.remove(), 0)
+        cursor.close()
+        self.check(lambda i: 'b' + str(i), self.hot[1])
+
+        # Split the pages holding the hot keys, then evict and read them again.
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nentries):
+            cursor[self.key(i) + '/split'] = 'c' * 100
+        cursor.close()
+        self.check(lambda i: 'b' + str(i), self.hot[1])
+        self.session.checkpoint()
+        self.evict()
+        self.check(lambda i: 'b' + str(i), self.hot[1])
+        self.assertGreater(self.get_stat(stat.dsrc.cursor_search_ahi_hit), hits)
+
+        # Searches of missing keys aren't resolved through the index.
+        cursor = self.session.open_cursor(self.uri)
+        for n in range(6):
+            cursor.set_key(self.key(self.hot[2]) + '/missing')
+            self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+
+        # The index isn't used for tables without one.
+        self.session.create('file:test_search_ahi01_off', 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor('file:test_search_ahi01_off')
+        cursor['a'] = 'a'
+        for n in range(6):
+            self.assertEqual(cursor['a'], 'a')
+        cursor.close()
+        stat_cursor = self.session.open_cursor('statistics:file:test_search_ahi01_off')
+        self.assertEqual(stat_cursor[stat.dsrc.cursor_search_ahi_hit][2], 0)
+        stat_cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
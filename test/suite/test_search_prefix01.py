@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_search_prefix01.py
+#       Searching row-store internal pages through the key prefix array, and
+#       leaf pages through the key prefix directory, must return the same
+#       results as the plain binary search, both for pages built by splits in
+#       memory and for pages read back from disk.
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+class test_search_prefix01(wttest.WiredTigerTestCase):
+    uri = 'table:test_search_prefix01'
+    nentries = 20000
+
+    prefix_values = [
+        ('prefix-off', dict(prefix_search='false')),
+        ('prefix-on', dict(prefix_search='true')),
+    ]
+
+    # Build leaf page key directories on the first search of a page, or after a few searches.
+    leaf_prefix_values = [
+        ('leaf-off', dict(leaf_prefix_searches=0)),
+        ('leaf-first', dict(leaf_prefix_searches=1)),
+        ('leaf-later', dict(leaf_prefix_searches=3)),
+    ]
+
+    # Keys sharing a long common prefix force the prefix array to skip the shared bytes; short
+    # keys keep the interesting bytes inside the first eight.
+    key_values = [
+        ('long-common', dict(key_prefix='commonprefix/commonprefix/')),
+        ('short', dict(key_prefix='')),
+    ]
+
+    scenarios = make_scenarios(prefix_values, leaf_prefix_values, key_values)
+
+    def key(self, i):
+        # Even keys are inserted, odd keys are probed as missing.
+        k = self.key_prefix + '%08d' % (i * 2)
+        if i % 3 == 0:
+            k += '/tail'
+        return k
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(0, self.nentries, 7):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), str(i))
+
+            # A key sorting immediately after an existing key must not be found and search_near
+            # must land on one of its neighbours.
+            missing = self.key(i) + '\x01'
+            cursor.set_key(missing)
+            self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+            cursor.set_key(missing)
+            exact = cursor.search_near()
+            self.assertNotEqual(exact, 0)
+            if exact < 0:
+                self.assertEqual(cursor.get_key(), self.key(i))
+
+        # Keys sorting before and after everything in the tree.
+        cursor.set_key(' ')
+        self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.set_key(' ')
+        self.assertEqual(cursor.search_near(), 1)
+        self.assertEqual(cursor.get_key(), self.key(0))
+        cursor.set_key('~')
+        self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.set_key('~')
+        self.assertEqual(cursor.search_near(), -1)
+        self.assertEqual(cursor.get_key(), self.key(self.nentries - 1))
+        cursor.close()
+
+    def test_search_prefix(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'allocation_size=512,internal_page_max=512,leaf_page_max=512,' +
+            'internal_key_prefix_search=' + self.prefix_search +
+            ',leaf_key_prefix_search=' + str(self.leaf_prefix_searches))
+
+        # Insert out of order so splits happen across the whole tree.
+        cursor = self.session.open_cursor(self.uri)
+        for j in range(self.nentries):
+            i = (j * 7919) % self.nentries
+            cursor[self.key(i)] = str(i)
+        cursor.close()
+        self.check()
+
+        # Reopen so the internal pages are instantiated from their disk images.
+        self.session.checkpoint()
+        self.reopen_conn()
+        self.check()
+
+if __name__ == '__main__':
+    wttest.run()
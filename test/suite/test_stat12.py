@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger
+import wttest
+
+# test_stat12.py
+#    Statistics cursors configured with "delta" only return the statistics that
+#    changed since the cursor's statistics were last gathered.
+class test_stat12(wttest.WiredTigerTestCase):
+    uri = 'table:test_stat12'
+    conn_config = 'statistics=(all)'
+
+    def stat_keys(self, cursor):
+        keys = []
+        while cursor.next() == 0:
+            keys.append(cursor.get_key())
+        return keys
+
+    def insert(self, count):
+        c = self.session.open_cursor(self.uri, None, None)
+        for i in range(count):
+            c[i] = i
+        c.close()
+
+    def check_delta(self, uri):
+        full = self.session.open_cursor(uri, None, None)
+        nfull = len(self.stat_keys(full))
+        full.close()
+
+        # The first set of statistics is returned in full.
+        delta = self.session.open_cursor(uri, None, 'statistics=(all,delta)')
+        self.assertEqual(len(self.stat_keys(delta)), nfull)
+
+        # After an update, only the changed values are returned.
+        self.insert(100)
+        delta.reset()
+        changed = self.stat_keys(delta)
+        self.assertGreater(len(changed), 0)
+        self.assertLess(len(changed), nfull)
+
+        # Searching still finds any statistic, changed or not.
+        delta.reset()
+        for key in changed:
+            delta.set_key(key)
+            self.assertEqual(delta.search(), 0)
+
+        # Walking backward skips unchanged values as well.
+        delta.reset()
+        self.insert(100)
+        backward = []
+        while delta.prev() == 0:
+            backward.append(delta.get_key())
+        self.assertGreater(len(backward), 0)
+        self.assertLess(len(backward), nfull)
+        delta.close()
+
+    def test_stat_delta_connection(self):
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        self.check_delta('statistics:')
+
+    def test_stat_delta_table(self):
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        self.check_delta('statistics:' + self.uri)
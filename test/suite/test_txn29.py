@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn29.py
+#   Recovery: operations on files are applied by the recovery threads.
+#
+
+from helper import simulate_crash_restart
+from wtscenario import make_scenarios
+import wttest
+
+class test_txn29(wttest.WiredTigerTestCase):
+    nentries = 5000
+    ntables = 7
+
+    threads = [
+        ('serial', dict(recover_threads=0)),
+        ('one-thread', dict(recover_threads=1)),
+        ('four-threads', dict(recover_threads=4)),
+        ('max-threads', dict(recover_threads=10)),
+    ]
+    formats = [
+        ('row', dict(key_format='S')),
+        ('var', dict(key_format='r')),
+    ]
+    scenarios = make_scenarios(threads, formats)
+
+    def conn_config(self):
+        return 'log=(enabled,file_max=100K,recover_threads={})'.format(self.recover_threads)
+
+    def uri(self, i):
+        return 'table:test_txn29_' + str(i)
+
+    def key(self, i):
+        return str(i).zfill(10) if self.key_format == 'S' else i
+
+    def expected(self, table, i):
+        # Every fifth key is removed, every third key is overwritten.
+        if i % 5 == 0:
+            return None
+        if i % 3 == 0:
+            return 'updated {} {}'.format(table, i)
+        return 'value {} {}'.format(table, i)
+
+    def test_recover_threads(self):
+        for t in range(self.ntables):
+            self.session.create(self.uri(t), 'key_format={},value_format=S'.format(self.key_format))
+        self.session.checkpoint()
+
+        # Interleave the operations on the tables so log records mix operations on all of them.
+        cursors = [self.session.open_cursor(self.uri(t)) for t in range(self.ntables)]
+        for i in range(1, self.nentries + 1):
+            self.session.begin_transaction()
+            for t, c in enumerate(cursors):
+                c[self.key(i)] = 'value {} {}'.format(t, i)
+            self.session.commit_transaction()
+        for i in range(1, self.nentries + 1):
+            self.session.begin_transaction()
+            for t, c in enumerate(cursors):
+                if i % 5 == 0:
+                    c.set_key(self.key(i))
+                    self.assertEqual(c.remove(), 0)
+                elif i % 3 == 0:
+                    c[self.key(i)] = 'updated {} {}'.format(t, i)
+            self.session.commit_transaction()
+        for c in cursors:
+            c.close()
+        self.session.log_flush('sync=on')
+
+        simulate_crash_restart(self, ".", "RESTART")
+
+        for t in range(self.ntables):
+            c = self.session.open_cursor(self.uri(t))
+            count = 0
+            for key, value in c:
+                i = int(key)
+                self.assertEqual(value, self.expected(t, i))
+                count += 1
+            expected_count = len([i for i in range(1, self.nentries + 1) if i % 5 != 0])
+            self.assertEqual(count, expected_count)
+            c.close()
+
+if __name__ == '__main__':
+    wttest.run()
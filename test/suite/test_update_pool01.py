@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_update_pool01.py
+#   Test update pools: the memory of discarded updates is reused by later updates, both by the
+#   session discarding them and, through the connection's pool, by other sessions.
+class test_update_pool01(wttest.WiredTigerTestCase):
+    uri = 'table:test_update_pool01'
+    nrows = 2000
+
+    pool_values = [
+        ('session-pool', dict(session_max='1MB', shared_max='16MB')),
+        ('shared-pool-only', dict(session_max='4KB', shared_max='16MB')),
+        ('no-shared-pool', dict(session_max='64KB', shared_max='0')),
+    ]
+    scenarios = make_scenarios(pool_values)
+
+    def conn_config(self):
+        return 'cache_size=50MB,statistics=(all),update_pool=(session_max={},shared_max={})'.format(
+            self.session_max, self.shared_max)
+
+    def get_stat(self, statistic):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[statistic][2]
+        stat_cursor.close()
+        return val
+
+    def value(self, i, round):
+        return ('%d-%d-' % (i, round)) + 'a' * ((i * 37 + round) % 300)
+
+    def update(self, session, round):
+        cursor = session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            session.begin_transaction()
+            cursor[i] = self.value(i, round)
+            session.commit_transaction()
+        cursor.close()
+
+    def check(self, round):
+        cursor = self.session.open_cursor(self.uri)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, self.value(k, round))
+            count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrows)
+
+    def test_update_pool01(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+
+        # Updating the same keys repeatedly discards the obsolete updates, later updates reuse them.
+        for round in range(1, 11):
+            self.update(self.session, round)
+        self.check(10)
+        self.assertGreater(self.get_stat(stat.conn.cache_update_pool_alloc), 0)
+        self.assertGreater(self.get_stat(stat.conn.cache_update_pool_alloc_reuse), 0)
+
+        # Evict the pages: their updates are discarded into the pools, and another session's updates
+        # reuse them.
+        self.session.checkpoint()
+        evict_cursor = self.session.open_cursor(self.uri, None, 'debug=(release_evict)')
+        for i in range(1, self.nrows + 1, 100):
+            evict_cursor.set_key(i)
+            evict_cursor.search()
+            evict_cursor.reset()
+        evict_cursor.close()
+
+        session2 = self.conn.open_session()
+        self.update(session2, 11)
+        session2.close()
+        self.check(11)
+
+        # Restart and check the data.
+        self.reopen_conn()
+        self.check(11)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import random
+import wttest
+from wtscenario import make_scenarios
+
+# test_write_pipeline01.py
+#
+# Test the write pipeline: large in-memory pages are reconciled into many blocks, the blocks other
+# than the last are written by the pipeline threads, and the checkpoint must reference all of them.
+class test_write_pipeline01(wttest.WiredTigerTestCase):
+    uri = 'table:test_write_pipeline01'
+    nrows = 20000
+
+    pipeline_values = [
+        ('threads-0', dict(threads=0, max_inflight='16MB')),
+        ('threads-1', dict(threads=1, max_inflight='16MB')),
+        ('threads-4', dict(threads=4, max_inflight='16MB')),
+        ('threads-4-small', dict(threads=4, max_inflight='1MB')),
+    ]
+    scenarios = make_scenarios(pipeline_values)
+
+    def conn_config(self):
+        return 'cache_size=100MB,write_pipeline=(threads={},max_inflight={})'.format(
+            self.threads, self.max_inflight)
+
+    def check(self, value, ts):
+        c = self.session.open_cursor(self.uri)
+        self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+        count = 0
+        for k, v in c:
+            self.assertEqual(v, value + str(k))
+            count += 1
+        self.session.rollback_transaction()
+        self.assertEqual(count, self.nrows)
+        c.close()
+
+    def test_write_pipeline(self):
+        # Small leaf pages that can grow large in memory, so reconciliation writes many blocks.
+        self.session.create(self.uri,
+            'key_format=i,value_format=S,leaf_page_max=4KB,memory_page_max=10MB')
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+
+        keys = list(range(1, self.nrows + 1))
+        random.shuffle(keys)
+        for ts, value in [(10, 'a' * 100), (20, 'b' * 100)]:
+            c = self.session.open_cursor(self.uri)
+            self.session.begin_transaction()
+            for k in keys:
+                c[k] = value + str(k)
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+            c.close()
+            self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(ts))
+            self.session.checkpoint()
+
+        # Reopen and check the data came back from the checkpoint, with its history.
+        self.reopen_conn()
+        self.check('a' * 100, 10)
+        self.check('b' * 100, 20)
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()